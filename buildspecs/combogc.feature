@@ -67,6 +67,7 @@
 		<flag id="module_gc_staccato" value="true"/>
 		<flag id="module_gc_trace" value="true"/>
 		<flag id="module_gcchk" value="true"/>
+		<flag id="module_gcevtdump" value="true"/>
 		<flag id="opt_noClassloaders" value="false"/>
 	</flags>
 </feature>
@@ -23,21 +23,26 @@ package com.ibm.j9ddr.vm29.j9;
 
 import static com.ibm.j9ddr.vm29.events.EventManager.raiseCorruptDataEvent;
 
+import java.util.ArrayList;
 import java.util.Iterator;
+import java.util.List;
+import java.util.NoSuchElementException;
 
 import com.ibm.j9ddr.CorruptDataException;
+import com.ibm.j9ddr.vm29.pointer.generated.J9HashTablePointer;
 import com.ibm.j9ddr.vm29.pointer.generated.J9JVMTIEnvPointer;
 import com.ibm.j9ddr.vm29.pointer.generated.J9JVMTIObjectTagPointer;
 import com.ibm.j9ddr.vm29.types.UDATA;
 
 public class JVMTIObjectTagTable implements IHashTable<J9JVMTIObjectTagPointer>
 {	
-	protected HashTable<J9JVMTIObjectTagPointer> objectTagTable;
+	/* the shards of the tag table of an environment (a single table in older VMs) */
+	protected List<HashTable<J9JVMTIObjectTagPointer>> objectTagTables;
 
 	// Not intended for construction, use the factory
-	protected JVMTIObjectTagTable(HashTable<J9JVMTIObjectTagPointer> hashTable) throws CorruptDataException
+	protected JVMTIObjectTagTable(List<HashTable<J9JVMTIObjectTagPointer>> hashTables) throws CorruptDataException
 	{
-		objectTagTable = hashTable;
+		objectTagTables = hashTables;
 	}
 
 	protected static class ObjectTagHashFunction implements HashTable.HashFunction<J9JVMTIObjectTagPointer> 
@@ -72,29 +77,94 @@ public class JVMTIObjectTagTable implements IHashTable<J9JVMTIObjectTagPointer>
 		}
 	};
 	
+	/**
+	 * @return the tables holding the object tags of the given environment
+	 */
+	public static List<J9HashTablePointer> getObjectTagTables(J9JVMTIEnvPointer jvmtiEnv) throws CorruptDataException
+	{
+		List<J9HashTablePointer> tables = new ArrayList<J9HashTablePointer>();
+		try {
+			long shardCount = jvmtiEnv.objectTagShardCount().longValue();
+			for (long i = 0; i < shardCount; i++) {
+				tables.add(jvmtiEnv.objectTagShards().add(i).table());
+			}
+		} catch (NoSuchFieldError e) {
+			/* older VMs have a single object tag table */
+			tables.add(jvmtiEnv.objectTagTable());
+		}
+		return tables;
+	}
+
 	public static JVMTIObjectTagTable fromJ9JVMTIEnv(J9JVMTIEnvPointer jvmtiEnv) throws CorruptDataException
 	{
-		HashTable<J9JVMTIObjectTagPointer> hashTable = HashTable.fromJ9HashTable(
-				jvmtiEnv.objectTagTable(),
+		List<HashTable<J9JVMTIObjectTagPointer>> hashTables = new ArrayList<HashTable<J9JVMTIObjectTagPointer>>();
+		for (J9HashTablePointer table : getObjectTagTables(jvmtiEnv)) {
+			hashTables.add(newHashTable(table));
+		}
+		return new JVMTIObjectTagTable(hashTables);
+	}
+
+	public static JVMTIObjectTagTable fromJ9HashTable(J9HashTablePointer table) throws CorruptDataException
+	{
+		List<HashTable<J9JVMTIObjectTagPointer>> hashTables = new ArrayList<HashTable<J9JVMTIObjectTagPointer>>();
+		hashTables.add(newHashTable(table));
+		return new JVMTIObjectTagTable(hashTables);
+	}
+
+	private static HashTable<J9JVMTIObjectTagPointer> newHashTable(J9HashTablePointer table) throws CorruptDataException
+	{
+		return HashTable.fromJ9HashTable(
+				table,
 				true, 
 				J9JVMTIObjectTagPointer.class,
 				new ObjectTagEqualFunction(),
 				new ObjectTagHashFunction());
-		return new JVMTIObjectTagTable(hashTable);
 	}
 	
 	public Iterator<J9JVMTIObjectTagPointer> iterator()
 	{
-		return objectTagTable.iterator();
+		final Iterator<HashTable<J9JVMTIObjectTagPointer>> tableIterator = objectTagTables.iterator();
+
+		return new Iterator<J9JVMTIObjectTagPointer>() {
+			private Iterator<J9JVMTIObjectTagPointer> current = null;
+
+			public boolean hasNext()
+			{
+				while ((null == current) || !current.hasNext()) {
+					if (!tableIterator.hasNext()) {
+						return false;
+					}
+					current = tableIterator.next().iterator();
+				}
+				return true;
+			}
+
+			public J9JVMTIObjectTagPointer next()
+			{
+				if (!hasNext()) {
+					throw new NoSuchElementException("There are no more items available through this iterator");
+				}
+				return current.next();
+			}
+
+			public void remove()
+			{
+				throw new UnsupportedOperationException();
+			}
+		};
 	}
 
 	public long getCount()
 	{
-		return objectTagTable.getCount();
+		long count = 0;
+		for (HashTable<J9JVMTIObjectTagPointer> table : objectTagTables) {
+			count += table.getCount();
+		}
+		return count;
 	}
 
 	public String getTableName()
 	{
-		return objectTagTable.getTableName();
+		return objectTagTables.isEmpty() ? "JVMTI object tag table" : objectTagTables.get(0).getTableName();
 	}
 }
@@ -191,8 +191,14 @@ public class StringTable
 				// Instance initializer
 				cacheTableIndex = new UDATA(0);
 				try {
-					cacheSize = getCacheSize();
-					cache = _stringTable._cacheEA();
+					try {
+						cacheSize = _stringTable._cacheSize();
+						cache = _stringTable._cache();
+					} catch (NoSuchFieldError e) {
+						/* older VMs hold a fixed size cache in an array inside the table */
+						cacheSize = new UDATA(MM_StringTable.cacheSize);
+						cache = PointerPointer.cast(_stringTable._cacheEA());
+					}
 				} catch (CorruptDataException e) {
 					raiseCorruptDataEvent("Error getting next item", e, false);
 					cacheSize = new UDATA(0);
@@ -286,8 +292,13 @@ public class StringTable
 		return result;
 	}
 
-	protected UDATA getCacheSize()
+	protected UDATA getCacheSize() throws CorruptDataException
 	{
-		return new UDATA(MM_StringTable.cacheSize);
+		try {
+			return _stringTable._cacheSize();
+		} catch (NoSuchFieldError e) {
+			/* older VMs have a fixed size cache */
+			return new UDATA(MM_StringTable.cacheSize);
+		}
 	}
 }
@@ -29,6 +29,7 @@ import java.util.NoSuchElementException;
 import com.ibm.j9ddr.CorruptDataException;
 import com.ibm.j9ddr.vm29.j9.JVMTIObjectTagTable;
 import com.ibm.j9ddr.vm29.pointer.VoidPointer;
+import com.ibm.j9ddr.vm29.pointer.generated.J9HashTablePointer;
 import com.ibm.j9ddr.vm29.pointer.generated.J9JVMTIEnvPointer;
 import com.ibm.j9ddr.vm29.pointer.generated.J9JVMTIObjectTagPointer;
 import com.ibm.j9ddr.vm29.pointer.generated.J9ObjectPointer;
@@ -37,14 +38,22 @@ public class GCJVMTIObjectTagTableIterator extends GCIterator
 {
 	protected Iterator<J9JVMTIObjectTagPointer> hashTableIterator;
 
-	protected GCJVMTIObjectTagTableIterator(J9JVMTIEnvPointer jvmtiEnv) throws CorruptDataException
+	protected GCJVMTIObjectTagTableIterator(JVMTIObjectTagTable objectTagTable) throws CorruptDataException
 	{
-		hashTableIterator = JVMTIObjectTagTable.fromJ9JVMTIEnv(jvmtiEnv).iterator();
+		hashTableIterator = objectTagTable.iterator();
 	}
 
 	public static GCJVMTIObjectTagTableIterator fromJ9JVMTIEnv(J9JVMTIEnvPointer jvmtiEnv) throws CorruptDataException
 	{
-		return new GCJVMTIObjectTagTableIterator(jvmtiEnv);
+		return new GCJVMTIObjectTagTableIterator(JVMTIObjectTagTable.fromJ9JVMTIEnv(jvmtiEnv));
+	}
+
+	/**
+	 * Iterate over a single shard of the tag table of an environment
+	 */
+	public static GCJVMTIObjectTagTableIterator fromJ9HashTable(J9HashTablePointer objectTagTable) throws CorruptDataException
+	{
+		return new GCJVMTIObjectTagTableIterator(JVMTIObjectTagTable.fromJ9HashTable(objectTagTable));
 	}
 
 	public boolean hasNext()
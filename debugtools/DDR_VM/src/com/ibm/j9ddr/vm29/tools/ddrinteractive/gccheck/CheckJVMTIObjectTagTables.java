@@ -24,10 +24,12 @@ package com.ibm.j9ddr.vm29.tools.ddrinteractive.gccheck;
 import static com.ibm.j9ddr.vm29.tools.ddrinteractive.gccheck.CheckBase.J9MODRON_SLOT_ITERATOR_OK;
 
 import com.ibm.j9ddr.CorruptDataException;
+import com.ibm.j9ddr.vm29.j9.JVMTIObjectTagTable;
 import com.ibm.j9ddr.vm29.j9.gc.GCJVMTIObjectTagTableIterator;
 import com.ibm.j9ddr.vm29.j9.gc.GCJVMTIObjectTagTableListIterator;
 import com.ibm.j9ddr.vm29.pointer.PointerPointer;
 import com.ibm.j9ddr.vm29.pointer.VoidPointer;
+import com.ibm.j9ddr.vm29.pointer.generated.J9HashTablePointer;
 import com.ibm.j9ddr.vm29.pointer.generated.J9JVMTIDataPointer;
 import com.ibm.j9ddr.vm29.pointer.generated.J9JVMTIEnvPointer;
 
@@ -42,14 +44,16 @@ class CheckJVMTIObjectTagTables extends Check
 				GCJVMTIObjectTagTableListIterator objectTagTableList = GCJVMTIObjectTagTableListIterator.fromJ9JVMTIData(jvmtiData);
 				while(objectTagTableList.hasNext()) {
 					J9JVMTIEnvPointer list = objectTagTableList.next();
-					VoidPointer objectTagTable = VoidPointer.cast(list.objectTagTable());
-					GCJVMTIObjectTagTableIterator objectTagTableIterator = GCJVMTIObjectTagTableIterator.fromJ9JVMTIEnv(list);
-					while(objectTagTableIterator.hasNext()) {
-						PointerPointer slot = PointerPointer.cast(objectTagTableIterator.nextAddress());
-						if(slot.notNull()) {
-							if(_engine.checkSlotPool(slot, objectTagTable) != J9MODRON_SLOT_ITERATOR_OK ){
-								return;
-							} 
+					for (J9HashTablePointer table : JVMTIObjectTagTable.getObjectTagTables(list)) {
+						VoidPointer objectTagTable = VoidPointer.cast(table);
+						GCJVMTIObjectTagTableIterator objectTagTableIterator = GCJVMTIObjectTagTableIterator.fromJ9HashTable(table);
+						while(objectTagTableIterator.hasNext()) {
+							PointerPointer slot = PointerPointer.cast(objectTagTableIterator.nextAddress());
+							if(slot.notNull()) {
+								if(_engine.checkSlotPool(slot, objectTagTable) != J9MODRON_SLOT_ITERATOR_OK ){
+									return;
+								} 
+							}
 						}
 					}
 				}
@@ -807,6 +807,51 @@ public class MemoryMXBeanImpl implements MemoryMXBean, NotificationEmitter {
 		return getCurrentGCThreadsImpl();
 	}
 
+	/**
+	 * Returns the largest number of objects and references queued for finalization at once.
+	 * 
+	 * @return the finalizer queue high water mark
+	 * @see #getFinalizerQueueMaxDepth()
+	 */
+	private native long getFinalizerQueueMaxDepthImpl();
+
+	/**
+	 * {@inheritDoc}
+	 */
+	public long getFinalizerQueueMaxDepth() {
+		return getFinalizerQueueMaxDepthImpl();
+	}
+
+	/**
+	 * Returns the time taken to dequeue the most recent finalizer queue backlog, in milliseconds.
+	 * 
+	 * @return the most recent finalizer queue latency in milliseconds
+	 * @see #getFinalizerQueueLatency()
+	 */
+	private native long getFinalizerQueueLatencyImpl();
+
+	/**
+	 * {@inheritDoc}
+	 */
+	public long getFinalizerQueueLatency() {
+		return getFinalizerQueueLatencyImpl();
+	}
+
+	/**
+	 * Returns the longest time taken to dequeue a finalizer queue backlog, in milliseconds.
+	 * 
+	 * @return the largest finalizer queue latency in milliseconds
+	 * @see #getFinalizerQueueMaxLatency()
+	 */
+	private native long getFinalizerQueueMaxLatencyImpl();
+
+	/**
+	 * {@inheritDoc}
+	 */
+	public long getFinalizerQueueMaxLatency() {
+		return getFinalizerQueueMaxLatencyImpl();
+	}
+
 	/**
 	 * {@inheritDoc}
 	 */
@@ -274,4 +274,31 @@ public interface MemoryMXBean extends java.lang.management.MemoryMXBean {
      * @return number of active GC worker threads
      */
 	public int getCurrentGCThreads();
+
+	/**
+	 * Returns the largest number of objects and references that have been queued
+	 * for finalization (or reference enqueueing) at once.  The current depth is
+	 * reported by {@link #getObjectPendingFinalizationCount()}.
+	 * 
+	 * @return the finalizer queue high water mark
+	 */
+	public long getFinalizerQueueMaxDepth();
+
+	/**
+	 * Returns the time taken for the finalizer and reference worker threads to
+	 * dequeue the most recent backlog of finalizable objects and references,
+	 * measured from when the queue became non-empty until it was empty again.
+	 * 
+	 * @return the most recent finalizer queue latency in milliseconds
+	 */
+	public long getFinalizerQueueLatency();
+
+	/**
+	 * Returns the longest time taken to dequeue a backlog of finalizable objects
+	 * and references.
+	 * 
+	 * @return the largest finalizer queue latency in milliseconds
+	 * @see #getFinalizerQueueLatency()
+	 */
+	public long getFinalizerQueueMaxLatency();
 }
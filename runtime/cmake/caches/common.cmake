@@ -94,6 +94,7 @@ set(J9VM_MODULE_GC_STATS ON CACHE BOOL "")
 set(J9VM_MODULE_GC_STRUCTS ON CACHE BOOL "")
 set(J9VM_MODULE_GC_TRACE ON CACHE BOOL "")
 set(J9VM_MODULE_GCCHK ON CACHE BOOL "")
+set(J9VM_MODULE_GCEVTDUMP ON CACHE BOOL "")
 set(J9VM_MODULE_GDB ON CACHE BOOL "")
 set(J9VM_MODULE_GDB_PLUGIN ON CACHE BOOL "")
 set(J9VM_MODULE_GPTEST ON CACHE BOOL "")
@@ -109,6 +109,7 @@ J9MemoryManagerFunctions MemoryManagerFunctions = {
 	j9gc_ext_check_is_valid_heap_object,
 #if defined(J9VM_GC_FINALIZATION)
 	j9gc_get_objects_pending_finalization_count,
+	j9gc_get_finalizer_queue_statistics,
 #endif /* J9VM_GC_FINALIZATION */
 	j9gc_set_softmx,
 	j9gc_get_softmx,
@@ -258,5 +259,9 @@ J9MemoryManagerFunctions MemoryManagerFunctions = {
 	j9gc_notifyGCOfClassReplacement,
 	j9gc_get_jit_string_dedup_policy,
 	j9gc_stringHashFn,
-	j9gc_stringHashEqualFn
+	j9gc_stringHashEqualFn,
+	j9mm_iterate_allocation_profile,
+	j9mm_iterate_region_objects_in_range,
+	j9mm_iterate_all_objects_in_batches,
+	j9mm_iterate_regions_in_parallel
 };
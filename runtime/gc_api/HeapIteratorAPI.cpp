@@ -28,7 +28,10 @@
 #include "HeapIteratorAPI.h"
 #include "ModronAssertions.h"
 
+#include "AllocationProfiler.hpp"
 #include "ArrayletLeafIterator.hpp"
+#include "Dispatcher.hpp"
+#include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "HeapIteratorAPIRootIterator.hpp"
 #include "HeapIteratorAPIBufferedIterator.hpp"
@@ -41,8 +44,10 @@
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
 #include "MixedObjectIterator.hpp"
+#include "ModronTypes.hpp"
 #include "ObjectAccessBarrier.hpp"
 #include "OwnableSynchronizerObjectList.hpp"
+#include "ParallelTask.hpp"
 #include "PointerArrayIterator.hpp"
 #include "SlotObject.hpp"
 #include "VMInterface.hpp"
@@ -81,10 +86,41 @@ static jvmtiIterationControl
 iterateRegionObjects(
 	J9JavaVM *vm,
 	J9MM_IterateRegionDescriptor *region,
+	void *base,
+	void *top,
 	UDATA flags,
 	jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *objectDesc, void *userData),
 	void *userData);
 
+struct J9MM_BatchIteratorDataHolderPrivate;
+
+static void
+iterateObjectBatchRegions(J9JavaVM *vm, MM_EnvironmentBase *env, struct J9MM_BatchIteratorDataHolderPrivate *data);
+
+/**
+ * Walks the regions collected by j9mm_iterate_all_objects_in_batches or j9mm_iterate_regions_in_parallel on each of the GC threads.
+ */
+class HeapIteratorAPI_ObjectBatchTask : public MM_ParallelTask
+{
+private:
+	J9JavaVM *_javaVM; /**< The VM */
+	struct J9MM_BatchIteratorDataHolderPrivate *_data; /**< The walk whose regions are shared out */
+	UDATA _vmState; /**< The vmState of the thread which invoked the walk */
+
+public:
+	virtual UDATA getVMStateID() { return _vmState; }
+	virtual void run(MM_EnvironmentBase *env) { iterateObjectBatchRegions(_javaVM, env, _data); }
+
+	HeapIteratorAPI_ObjectBatchTask(MM_EnvironmentBase *env, MM_Dispatcher *dispatcher, J9JavaVM *javaVM, struct J9MM_BatchIteratorDataHolderPrivate *data, UDATA vmState)
+		: MM_ParallelTask(env, dispatcher)
+		, _javaVM(javaVM)
+		, _data(data)
+		, _vmState(vmState)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
 extern "C" {
 
 /* used by j9mm_iterate_all_objects */
@@ -92,6 +128,11 @@ static jvmtiIterationControl internalIterateHeaps(J9JavaVM *vm, J9MM_IterateHeap
 static jvmtiIterationControl internalIterateSpaces(J9JavaVM *vm, J9MM_IterateSpaceDescriptor *space, void *userData);
 static jvmtiIterationControl internalIterateRegions(J9JavaVM *vm, J9MM_IterateRegionDescriptor *region, void *userData);
 
+/* used by j9mm_iterate_all_objects_in_batches (the regions are also collected by j9mm_iterate_regions_in_parallel) */
+static jvmtiIterationControl internalCollectBatchHeaps(J9JavaVM *vm, J9MM_IterateHeapDescriptor *heap, void *userData);
+static jvmtiIterationControl internalCollectBatchSpaces(J9JavaVM *vm, J9MM_IterateSpaceDescriptor *space, void *userData);
+static jvmtiIterationControl internalCollectBatchRegions(J9JavaVM *vm, J9MM_IterateRegionDescriptor *region, void *userData);
+
 typedef struct J9MM_CallbackDataHolderPrivate{
 	jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *object, void *userData);
 	void *userData;
@@ -269,8 +310,11 @@ j9mm_iterate_region_objects(
 
 	switch (privateRegion->type) {
 	case j9mm_region_type_region:
-		returnCode = iterateRegionObjects(vm, region, flags, func, userData);
+	{
+		MM_HeapRegionDescriptor *heapRegion = (MM_HeapRegionDescriptor *)region->id;
+		returnCode = iterateRegionObjects(vm, region, heapRegion->getLowAddress(), heapRegion->getHighAddress(), flags, func, userData);
 		break;
+	}
 	default:
 		Assert_MM_unreachable();
 		break;
@@ -279,6 +323,33 @@ j9mm_iterate_region_objects(
 	return returnCode;
 }
 
+/**
+ * Walk the objects of the given region which start within [base, top), call user provided function.
+ * @param region The descriptor for the region that should be walked
+ * @param base The address of an object in the region at which to start the walk
+ * @param top The address at which to stop the walk
+ * @param flags The flags describing the walk (0 or j9mm_iterator_flag_include_holes)
+ * @param func The function to call on each object descriptor.
+ * @param userData Pointer to storage for userData.
+ */
+jvmtiIterationControl
+j9mm_iterate_region_objects_in_range(
+	J9JavaVM *vm,
+	J9PortLibrary *portLibrary,
+	J9MM_IterateRegionDescriptor *region,
+	void *base,
+	void *top,
+	UDATA flags,
+	jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *objectDesc, void *userData),
+	void *userData)
+{
+	if ((NULL == region) || (base >= top)) {
+		return JVMTI_ITERATION_CONTINUE;
+	}
+
+	return iterateRegionObjects(vm, region, base, top, flags, func, userData);
+}
+
 jvmtiIterationControl static
 iterateObjectSlotDo(
 		J9JavaVM *javaVM,
@@ -529,8 +600,349 @@ internalIterateRegions(J9JavaVM *vm, J9MM_IterateRegionDescriptor *region, void
 	return j9mm_iterate_region_objects(vm, data->portLibrary, region, data->flags, data->func, data->userData);
 }
 
+/**
+ * Largest address range of a region walked as a single unit by j9mm_iterate_all_objects_in_batches, so that the
+ * large regions of a flat heap are shared out among the GC threads too.
+ */
+#define HEAPITERATORAPI_BATCH_RANGE_SIZE ((UDATA)4 * 1024 * 1024)
+
+/* a slice of a region walked as one unit by j9mm_iterate_all_objects_in_batches */
+typedef struct J9MM_ObjectBatchRangePrivate {
+	UDATA regionIndex; /**< Index of the region containing the range */
+	void *base; /**< Nominal start of the range */
+	void *top; /**< Nominal end of the range (start of the next range or end of the region) */
+	void *firstObject; /**< First object (or hole) starting in [base, top), NULL if there is none */
+} J9MM_ObjectBatchRangePrivate;
+
+/* used by j9mm_iterate_all_objects_in_batches and j9mm_iterate_regions_in_parallel */
+typedef struct J9MM_BatchIteratorDataHolderPrivate {
+	jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *objects, UDATA count, void *userData);
+	jvmtiIterationControl (*regionFunc)(J9JavaVM *vm, J9MM_IterateRegionDescriptor *region, void *base, void *top, UDATA rangeIndex, void *userData); /**< Set if ranges of regions are handed out rather than batches of objects */
+	void *userData;
+	J9PortLibrary *portLibrary;
+	UDATA flags;
+	J9MM_IterateRegionDescriptorPrivate *regions; /**< The regions to walk (NULL while they are only counted) */
+	UDATA regionCount;
+	UDATA regionCapacity;
+	J9MM_ObjectBatchRangePrivate *ranges; /**< The ranges the regions are cut into (NULL if each region is walked as a whole) */
+	UDATA rangeCount;
+	volatile UDATA aborted; /**< Set once func has aborted the walk */
+} J9MM_BatchIteratorDataHolderPrivate;
+
+/* used to find the first object of each range of a region */
+typedef struct J9MM_RangeStartDataHolderPrivate {
+	J9MM_ObjectBatchRangePrivate *ranges;
+	UDATA nextRange; /**< The next range whose first object is being looked for */
+	UDATA lastRange; /**< The last range of the region */
+} J9MM_RangeStartDataHolderPrivate;
+
+/* the batch of objects accumulated by one thread */
+typedef struct J9MM_ObjectBatchPrivate {
+	J9MM_BatchIteratorDataHolderPrivate *data;
+	UDATA count;
+	J9MM_IterateObjectDescriptor objects[J9MM_OBJECT_BATCH_SIZE];
+} J9MM_ObjectBatchPrivate;
+
+static jvmtiIterationControl
+internalCollectBatchHeaps(J9JavaVM *vm, J9MM_IterateHeapDescriptor *heap, void *userData)
+{
+	J9MM_BatchIteratorDataHolderPrivate *data = (J9MM_BatchIteratorDataHolderPrivate *)userData;
+	return j9mm_iterate_spaces(vm, data->portLibrary, heap, data->flags, internalCollectBatchSpaces, userData);
+}
+
+static jvmtiIterationControl
+internalCollectBatchSpaces(J9JavaVM *vm, J9MM_IterateSpaceDescriptor *space, void *userData)
+{
+	J9MM_BatchIteratorDataHolderPrivate *data = (J9MM_BatchIteratorDataHolderPrivate *)userData;
+	/* the heap has already been made walkable */
+	return j9mm_iterate_regions(vm, data->portLibrary, space, data->flags | j9mm_iterator_flag_regions_read_only, internalCollectBatchRegions, userData);
+}
+
+static jvmtiIterationControl
+internalCollectBatchRegions(J9JavaVM *vm, J9MM_IterateRegionDescriptor *region, void *userData)
+{
+	J9MM_BatchIteratorDataHolderPrivate *data = (J9MM_BatchIteratorDataHolderPrivate *)userData;
+
+	if (NULL != data->regions) {
+		if (data->regionCount >= data->regionCapacity) {
+			return JVMTI_ITERATION_ABORT;
+		}
+		data->regions[data->regionCount] = *(J9MM_IterateRegionDescriptorPrivate *)region;
+	}
+	data->regionCount += 1;
+	return JVMTI_ITERATION_CONTINUE;
+}
+
+static void
+flushObjectBatch(J9JavaVM *vm, J9MM_ObjectBatchPrivate *batch)
+{
+	J9MM_BatchIteratorDataHolderPrivate *data = batch->data;
+
+	if ((0 != batch->count) && (0 == data->aborted)) {
+		if (JVMTI_ITERATION_ABORT == data->func(vm, batch->objects, batch->count, data->userData)) {
+			data->aborted = 1;
+		}
+	}
+	batch->count = 0;
+}
+
+/* used by j9mm_iterate_regions_in_parallel when the regions can not be recorded */
+typedef struct J9MM_RegionIndexDataHolderPrivate {
+	jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateRegionDescriptor *region, void *base, void *top, UDATA rangeIndex, void *userData);
+	void *userData;
+	UDATA regionIndex;
+} J9MM_RegionIndexDataHolderPrivate;
+
+static jvmtiIterationControl
+internalIterateIndexedRegions(J9JavaVM *vm, J9MM_IterateRegionDescriptor *region, void *userData)
+{
+	J9MM_RegionIndexDataHolderPrivate *data = (J9MM_RegionIndexDataHolderPrivate *)userData;
+	UDATA regionIndex = data->regionIndex;
+	data->regionIndex += 1;
+	return data->func(vm, region, region->regionStart, (U_8 *)region->regionStart + region->regionSize, regionIndex, data->userData);
+}
+
+static jvmtiIterationControl
+internalAddObjectToBatch(J9JavaVM *vm, J9MM_IterateObjectDescriptor *objectDesc, void *userData)
+{
+	J9MM_ObjectBatchPrivate *batch = (J9MM_ObjectBatchPrivate *)userData;
+
+	batch->objects[batch->count] = *objectDesc;
+	batch->count += 1;
+	if (J9MM_OBJECT_BATCH_SIZE == batch->count) {
+		flushObjectBatch(vm, batch);
+	}
+	return (0 == batch->data->aborted) ? JVMTI_ITERATION_CONTINUE : JVMTI_ITERATION_ABORT;
+}
+
+static jvmtiIterationControl
+internalFindRangeStarts(J9JavaVM *vm, J9MM_IterateObjectDescriptor *objectDesc, void *userData)
+{
+	J9MM_RangeStartDataHolderPrivate *data = (J9MM_RangeStartDataHolderPrivate *)userData;
+	void *object = objectDesc->object;
+
+	/* the object is the first object of the range it starts in; ranges it has skipped over have none */
+	while ((data->nextRange <= data->lastRange) && (object >= data->ranges[data->nextRange].base)) {
+		J9MM_ObjectBatchRangePrivate *range = &data->ranges[data->nextRange];
+		range->firstObject = (object < range->top) ? object : NULL;
+		data->nextRange += 1;
+	}
+	return (data->nextRange <= data->lastRange) ? JVMTI_ITERATION_CONTINUE : JVMTI_ITERATION_ABORT;
+}
+
+/**
+ * @return the number of ranges the region is cut into (regions which can not contain objects are not cut)
+ */
+static UDATA
+getObjectBatchRangeCount(J9MM_IterateRegionDescriptor *region)
+{
+	UDATA rangeCount = 1;
+	if (0 != region->objectAlignment) {
+		rangeCount = OMR_MAX(1, (region->regionSize + HEAPITERATORAPI_BATCH_RANGE_SIZE - 1) / HEAPITERATORAPI_BATCH_RANGE_SIZE);
+	}
+	return rangeCount;
+}
+
+/**
+ * Cut the collected regions into ranges of at most HEAPITERATORAPI_BATCH_RANGE_SIZE bytes.  Leaves data->ranges
+ * NULL, so that the regions are walked whole, if there is no room for the ranges.
+ */
+static void
+prepareObjectBatchRanges(MM_Forge *forge, J9MM_BatchIteratorDataHolderPrivate *data)
+{
+	UDATA rangeCount = 0;
+	for (UDATA i = 0; i < data->regionCount; i++) {
+		rangeCount += getObjectBatchRangeCount(&data->regions[i].descriptor);
+	}
+	if (rangeCount == data->regionCount) {
+		/* no region is large enough to be cut */
+		return;
+	}
+
+	data->ranges = (J9MM_ObjectBatchRangePrivate *)forge->allocate(sizeof(J9MM_ObjectBatchRangePrivate) * rangeCount, MM_AllocationCategory::OTHER, J9_GET_CALLSITE());
+	if (NULL != data->ranges) {
+		UDATA rangeIndex = 0;
+		for (UDATA i = 0; i < data->regionCount; i++) {
+			J9MM_IterateRegionDescriptor *region = &data->regions[i].descriptor;
+			U_8 *regionStart = (U_8 *)region->regionStart;
+			U_8 *regionEnd = regionStart + region->regionSize;
+			UDATA regionRanges = getObjectBatchRangeCount(region);
+			for (UDATA j = 0; j < regionRanges; j++) {
+				J9MM_ObjectBatchRangePrivate *range = &data->ranges[rangeIndex + j];
+				range->regionIndex = i;
+				range->base = regionStart + (j * HEAPITERATORAPI_BATCH_RANGE_SIZE);
+				range->top = (j + 1 == regionRanges) ? regionEnd : (U_8 *)range->base + HEAPITERATORAPI_BATCH_RANGE_SIZE;
+				/* the first object of every other range is only known once the region has been walked */
+				range->firstObject = (0 == j) ? range->base : NULL;
+			}
+			rangeIndex += regionRanges;
+		}
+		data->rangeCount = rangeCount;
+	}
+}
+
+static bool
+canIterateInParallel(J9VMThread *vmThread)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(vmThread->javaVM->omrVM);
+
+	/* Metronome GC threads can only run incremental tasks */
+	if (extensions->isMetronomeGC() || (NULL == extensions->dispatcher) || (1 >= extensions->dispatcher->threadCount())) {
+		return false;
+	}
+	/* a walk invoked from within a GC task can not dispatch another one */
+	return NULL == MM_EnvironmentBase::getEnvironment(vmThread->omrVMThread)->_currentTask;
+}
+
+/**
+ * Walk all objects for the given VM using the GC threads, call user provided function with batches of objects.
+ * @param flags The flags describing the walk (0 or j9mm_iterator_flag_include_holes)
+ * @param func The function to call on each batch of object descriptors.
+ * @param userData Pointer to storage for userData.
+ * @return JVMTI_ITERATION_ABORT if func aborted the walk, JVMTI_ITERATION_CONTINUE otherwise
+ */
+jvmtiIterationControl
+j9mm_iterate_all_objects_in_batches(J9VMThread *vmThread, J9PortLibrary *portLibrary, UDATA flags, jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *objects, UDATA count, void *userData), void *userData)
+{
+	J9JavaVM *javaVM = vmThread->javaVM;
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(javaVM->omrVM);
+	MM_Forge *forge = extensions->getForge();
+	J9MM_BatchIteratorDataHolderPrivate data;
+	data.func = func;
+	data.regionFunc = NULL;
+	data.userData = userData;
+	data.portLibrary = portLibrary;
+	data.flags = flags;
+	data.regions = NULL;
+	data.regionCount = 0;
+	data.regionCapacity = 0;
+	data.ranges = NULL;
+	data.rangeCount = 0;
+	data.aborted = 0;
+
+	javaVM->memoryManagerFunctions->j9gc_flush_caches_for_walk(javaVM);
+
+	/* count the regions, then record them */
+	j9mm_iterate_heaps(javaVM, portLibrary, flags, internalCollectBatchHeaps, &data);
+	data.regionCapacity = data.regionCount;
+	data.regionCount = 0;
+	data.regions = (J9MM_IterateRegionDescriptorPrivate *)forge->allocate(sizeof(J9MM_IterateRegionDescriptorPrivate) * data.regionCapacity, MM_AllocationCategory::OTHER, J9_GET_CALLSITE());
+
+	if (NULL == data.regions) {
+		/* no room to share out the regions: walk the heap on the calling thread */
+		J9MM_ObjectBatchPrivate batch;
+		batch.data = &data;
+		batch.count = 0;
+		j9mm_iterate_all_objects(javaVM, portLibrary, flags, internalAddObjectToBatch, &batch);
+		flushObjectBatch(javaVM, &batch);
+	} else {
+		j9mm_iterate_heaps(javaVM, portLibrary, flags, internalCollectBatchHeaps, &data);
+
+		if (canIterateInParallel(vmThread)) {
+			MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(vmThread->omrVMThread);
+			HeapIteratorAPI_ObjectBatchTask batchTask(env, extensions->dispatcher, javaVM, &data, vmThread->omrVMThread->vmState);
+			prepareObjectBatchRanges(forge, &data);
+			extensions->dispatcher->run(env, &batchTask);
+		} else {
+			iterateObjectBatchRegions(javaVM, NULL, &data);
+		}
+
+		if (NULL != data.ranges) {
+			forge->free(data.ranges);
+		}
+		forge->free(data.regions);
+	}
+
+	return (0 == data.aborted) ? JVMTI_ITERATION_CONTINUE : JVMTI_ITERATION_ABORT;
+}
+
+/**
+ * Walk the regions of the given space using the GC threads, call user provided function on each range of each region.
+ * @param space The descriptor for the space that should be walked
+ * @param flags The flags describing the walk (as for j9mm_iterate_regions)
+ * @param func The function to call on each range, with its region descriptor, its bounds and its index in the walk.
+ * @param userData Pointer to storage for userData.
+ * @return JVMTI_ITERATION_ABORT if func aborted the walk, JVMTI_ITERATION_CONTINUE otherwise
+ */
+jvmtiIterationControl
+j9mm_iterate_regions_in_parallel(J9VMThread *vmThread, J9PortLibrary *portLibrary, J9MM_IterateSpaceDescriptor *space, UDATA flags, jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateRegionDescriptor *regionDesc, void *base, void *top, UDATA rangeIndex, void *userData), void *userData)
+{
+	J9JavaVM *javaVM = vmThread->javaVM;
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(javaVM->omrVM);
+	MM_Forge *forge = extensions->getForge();
+	J9MM_BatchIteratorDataHolderPrivate data;
+	data.func = NULL;
+	data.regionFunc = func;
+	data.userData = userData;
+	data.portLibrary = portLibrary;
+	data.flags = flags;
+	data.regions = NULL;
+	data.regionCount = 0;
+	data.regionCapacity = 0;
+	data.ranges = NULL;
+	data.rangeCount = 0;
+	data.aborted = 0;
+
+	/* count the regions, then record them */
+	j9mm_iterate_regions(javaVM, portLibrary, space, flags, internalCollectBatchRegions, &data);
+	data.regionCapacity = data.regionCount;
+	data.regionCount = 0;
+	data.regions = (J9MM_IterateRegionDescriptorPrivate *)forge->allocate(sizeof(J9MM_IterateRegionDescriptorPrivate) * data.regionCapacity, MM_AllocationCategory::OTHER, J9_GET_CALLSITE());
+
+	if (NULL == data.regions) {
+		/* no room to share out the regions: hand them to func on the calling thread, in the same order */
+		J9MM_RegionIndexDataHolderPrivate indexData;
+		indexData.func = func;
+		indexData.userData = userData;
+		indexData.regionIndex = 0;
+		if (JVMTI_ITERATION_ABORT == j9mm_iterate_regions(javaVM, portLibrary, space, flags, internalIterateIndexedRegions, &indexData)) {
+			data.aborted = 1;
+		}
+	} else {
+		j9mm_iterate_regions(javaVM, portLibrary, space, flags, internalCollectBatchRegions, &data);
+
+		if (canIterateInParallel(vmThread)) {
+			MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(vmThread->omrVMThread);
+			prepareObjectBatchRanges(forge, &data);
+			HeapIteratorAPI_ObjectBatchTask regionTask(env, extensions->dispatcher, javaVM, &data, vmThread->omrVMThread->vmState);
+			extensions->dispatcher->run(env, &regionTask);
+		} else {
+			iterateObjectBatchRegions(javaVM, NULL, &data);
+		}
+
+		if (NULL != data.ranges) {
+			forge->free(data.ranges);
+		}
+		forge->free(data.regions);
+	}
+
+	return (0 == data.aborted) ? JVMTI_ITERATION_CONTINUE : JVMTI_ITERATION_ABORT;
+}
+
+typedef struct J9MM_OwnableSynchronizerDataHolderPrivate {
+	J9VMThread *vmThread;
+	jvmtiIterationControl (*func)(J9VMThread *vmThread, J9MM_IterateObjectDescriptor *object, void *userData);
+	void *userData;
+} J9MM_OwnableSynchronizerDataHolderPrivate;
+
+/* used by j9mm_iterate_all_ownable_synchronizer_objects when ownable synchronizers are discovered lazily */
+static jvmtiIterationControl
+internalIterateOwnableSynchronizerObjects(J9JavaVM *vm, J9MM_IterateObjectDescriptor *objectDesc, void *userData)
+{
+	J9MM_OwnableSynchronizerDataHolderPrivate *data = (J9MM_OwnableSynchronizerDataHolderPrivate *)userData;
+	jvmtiIterationControl returnCode = JVMTI_ITERATION_CONTINUE;
+
+	if (objectDesc->isObject && (0 != (J9CLASS_FLAGS(J9GC_J9OBJECT_CLAZZ(objectDesc->object)) & J9AccClassOwnableSynchronizer))) {
+		returnCode = data->func(data->vmThread, objectDesc, data->userData);
+	}
+	return returnCode;
+}
+
 /**
  * Walk all ownable synchronizer object, call user provided function.
+ * With -XXgc:lazyOwnableSynchronizerDiscovery the synchronizers are not kept on lists, so they are found by walking
+ * the heap instead (the caller must have exclusive VM access).  A global collection is run first so that the heap
+ * can be walked and only reachable synchronizers are reported.
  * @param flags The flags describing the walk (unused currently)
  * @param func The function to call on each object descriptor.
  * @param userData Pointer to storage for userData.
@@ -544,6 +956,26 @@ j9mm_iterate_all_ownable_synchronizer_objects(J9VMThread *vmThread, J9PortLibrar
 	MM_ObjectAccessBarrier *barrier = extensions->accessBarrier;
 	MM_OwnableSynchronizerObjectList *ownableSynchronizerObjectList = extensions->ownableSynchronizerObjectLists;
 
+	if (extensions->lazyOwnableSynchronizerDiscovery) {
+		J9MM_OwnableSynchronizerDataHolderPrivate data;
+		data.vmThread = vmThread;
+		data.func = func;
+		data.userData = userData;
+		/* collect with the heap fixed up for walking, so that the dead objects no longer look like objects */
+		UDATA savedHeapWalkFlag = javaVM->requiredDebugAttributes & J9VM_DEBUG_ATTRIBUTE_ALLOW_USER_HEAP_WALK;
+		javaVM->requiredDebugAttributes |= J9VM_DEBUG_ATTRIBUTE_ALLOW_USER_HEAP_WALK;
+		/* J9MMCONSTANT_EXPLICIT_GC_RASDUMP_COMPACT allows the GC to run while the current thread is holding exclusive VM access */
+		javaVM->memoryManagerFunctions->j9gc_modron_global_collect_with_overrides(vmThread, J9MMCONSTANT_EXPLICIT_GC_RASDUMP_COMPACT);
+		if (J9_GC_POLICY_METRONOME == javaVM->gcPolicy) {
+			/* the first call may only have finished the current cycle */
+			javaVM->memoryManagerFunctions->j9gc_modron_global_collect_with_overrides(vmThread, J9MMCONSTANT_EXPLICIT_GC_RASDUMP_COMPACT);
+		}
+		if (0 == savedHeapWalkFlag) {
+			javaVM->requiredDebugAttributes &= ~J9VM_DEBUG_ATTRIBUTE_ALLOW_USER_HEAP_WALK;
+		}
+		return j9mm_iterate_all_objects(javaVM, portLibrary, 0, internalIterateOwnableSynchronizerObjects, &data);
+	}
+
 	Assert_MM_true(NULL != ownableSynchronizerObjectList);
 
 	J9MM_IterateObjectDescriptor objectDescriptor;
@@ -570,8 +1002,120 @@ j9mm_iterate_all_ownable_synchronizer_objects(J9VMThread *vmThread, J9PortLibrar
 	return returnCode;
 }
 
+typedef struct AllocationProfileIteratorData {
+	J9JavaVM *javaVM;
+	jvmtiIterationControl (*func)(J9JavaVM *javaVM, J9MM_AllocationSiteDescriptor *siteDesc, void *userData);
+	void *userData;
+	jvmtiIterationControl returnCode;
+} AllocationProfileIteratorData;
+
+static bool
+internalIterateAllocationProfile(MM_AllocationSite *site, void *userData)
+{
+	AllocationProfileIteratorData *data = (AllocationProfileIteratorData *)userData;
+	J9MM_AllocationSiteDescriptor siteDesc;
+
+	siteDesc.id = site->id;
+	siteDesc.clazz = site->clazz;
+	siteDesc.frameCount = site->frameCount;
+	siteDesc.frames = site->frames;
+	siteDesc.samples = site->samples;
+	siteDesc.bytes = site->bytes;
+	data->returnCode = data->func(data->javaVM, &siteDesc, data->userData);
+	return JVMTI_ITERATION_ABORT != data->returnCode;
+}
+
+jvmtiIterationControl
+j9mm_iterate_allocation_profile(J9JavaVM *javaVM, UDATA flags, jvmtiIterationControl (*func)(J9JavaVM *javaVM, J9MM_AllocationSiteDescriptor *siteDesc, void *userData), void *userData)
+{
+	MM_AllocationProfiler *profiler = MM_GCExtensions::getExtensions(javaVM->omrVM)->allocationProfiler;
+	AllocationProfileIteratorData data = { javaVM, func, userData, JVMTI_ITERATION_CONTINUE };
+
+	if (NULL != profiler) {
+		if (J9_ARE_ANY_BITS_SET(flags, j9mm_allocation_profile_classes)) {
+			profiler->iterateClasses(internalIterateAllocationProfile, &data);
+		}
+		if ((JVMTI_ITERATION_ABORT != data.returnCode) && J9_ARE_ANY_BITS_SET(flags, j9mm_allocation_profile_sites)) {
+			profiler->iterateSites(internalIterateAllocationProfile, &data);
+		}
+	}
+	return data.returnCode;
+}
+
 } /* extern "C" */
 
+/**
+ * Walk the collected regions on the current thread, handing each one to the region function if there is one, or its
+ * objects to the batch function otherwise.  If the regions have been cut into ranges, the large regions are first
+ * walked (one per thread) to find the first object of each of their ranges, then the ranges are shared out.
+ * @param env The GC thread running the walk task, or NULL if the calling thread walks all the regions
+ */
+static void
+iterateObjectBatchRegions(J9JavaVM *vm, MM_EnvironmentBase *env, J9MM_BatchIteratorDataHolderPrivate *data)
+{
+	J9MM_ObjectBatchPrivate batch;
+	batch.data = data;
+	batch.count = 0;
+
+	if (NULL != data->ranges) {
+		/* a flat region has no index of its object starts, so only a walk of its object headers can find them */
+		UDATA firstRange = 0;
+		while (firstRange < data->rangeCount) {
+			UDATA lastRange = firstRange;
+			while (((lastRange + 1) < data->rangeCount) && (data->ranges[lastRange + 1].regionIndex == data->ranges[firstRange].regionIndex)) {
+				lastRange += 1;
+			}
+			if ((lastRange > firstRange) && ((NULL == env) || J9MODRON_HANDLE_NEXT_WORK_UNIT(env))) {
+				J9MM_RangeStartDataHolderPrivate startData;
+				startData.ranges = data->ranges;
+				startData.nextRange = firstRange + 1;
+				startData.lastRange = lastRange;
+				j9mm_iterate_region_objects(vm, data->portLibrary, &data->regions[data->ranges[firstRange].regionIndex].descriptor,
+						j9mm_iterator_flag_include_holes, internalFindRangeStarts, &startData);
+			}
+			firstRange = lastRange + 1;
+		}
+
+		if (NULL != env) {
+			env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+		}
+
+		for (UDATA i = 0; (i < data->rangeCount) && (0 == data->aborted); i++) {
+			if ((NULL == env) || J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+				J9MM_ObjectBatchRangePrivate *range = &data->ranges[i];
+				J9MM_IterateRegionDescriptor *region = &data->regions[range->regionIndex].descriptor;
+				if (NULL != data->regionFunc) {
+					/* every range is handed out so that the numbering has no gaps; one without a first object is empty */
+					void *base = (NULL != range->firstObject) ? range->firstObject : range->top;
+					if (JVMTI_ITERATION_ABORT == data->regionFunc(vm, region, base, range->top, i, data->userData)) {
+						data->aborted = 1;
+					}
+				} else if (NULL != range->firstObject) {
+					/* a range without a first object is covered by an object starting in an earlier range */
+					j9mm_iterate_region_objects_in_range(vm, data->portLibrary, region,
+							range->firstObject, range->top, data->flags, internalAddObjectToBatch, &batch);
+				}
+			}
+		}
+		flushObjectBatch(vm, &batch);
+		return;
+	}
+
+	for (UDATA i = 0; (i < data->regionCount) && (0 == data->aborted); i++) {
+		if ((NULL == env) || J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			if (NULL != data->regionFunc) {
+				J9MM_IterateRegionDescriptor *region = &data->regions[i].descriptor;
+				if (JVMTI_ITERATION_ABORT == data->regionFunc(vm, region, region->regionStart, (U_8 *)region->regionStart + region->regionSize, i, data->userData)) {
+					data->aborted = 1;
+				}
+			} else {
+				j9mm_iterate_region_objects(vm, data->portLibrary, &data->regions[i].descriptor, data->flags, internalAddObjectToBatch, &batch);
+			}
+		}
+	}
+	flushObjectBatch(vm, &batch);
+}
+
 /**
  * Initialize the specified descriptor with the specified values.
  * Invariant fields are initialized to the appropriate values for the JVM.
@@ -737,6 +1281,8 @@ static jvmtiIterationControl
 iterateRegionObjects(
 	J9JavaVM *vm,
 	J9MM_IterateRegionDescriptor *region,
+	void *base,
+	void *top,
 	UDATA flags,
 	jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *objectDesc, void *userData),
 	void *userData)
@@ -746,7 +1292,7 @@ iterateRegionObjects(
 	/* Iterate over live and dead objects */
 	MM_HeapRegionDescriptor* heapRegion = (MM_HeapRegionDescriptor*)region->id;
 	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(vm->omrVM);
-	HeapIteratorAPI_BufferedIterator objectHeapIterator(vm, PORTLIB, heapRegion, true);
+	HeapIteratorAPI_BufferedIterator objectHeapIterator(vm, PORTLIB, heapRegion, base, top, true);
 	J9Object* object = NULL;
 	while(NULL != (object = objectHeapIterator.nextObject())) {
 		J9MM_IterateObjectDescriptor objectDescriptor;
@@ -565,9 +565,11 @@ MM_HeapRootScanner::scanJVMTIObjectTagTables()
 	if (NULL != jvmtiData) {
 		GC_JVMTIObjectTagTableListIterator objectTagTableList( jvmtiData->environments);
 		while(NULL != (jvmtiEnv = (J9JVMTIEnv *)objectTagTableList.nextSlot())) {
-			GC_JVMTIObjectTagTableIterator objectTagTableIterator(jvmtiEnv->objectTagTable);
-			while(NULL != (slotPtr = (J9Object **)objectTagTableIterator.nextSlot())) {
-				doJVMTIObjectTagSlot(slotPtr, &objectTagTableIterator);
+			for (UDATA shardIndex = 0; shardIndex < jvmtiEnv->objectTagShardCount; shardIndex++) {
+				GC_JVMTIObjectTagTableIterator objectTagTableIterator(jvmtiEnv->objectTagShards[shardIndex].table);
+				while(NULL != (slotPtr = (J9Object **)objectTagTableIterator.nextSlot())) {
+					doJVMTIObjectTagSlot(slotPtr, &objectTagTableIterator);
+				}
 			}
 		}
 	}
@@ -0,0 +1,356 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "j9.h"
+#include "j9cfg.h"
+#include "j9port.h"
+#include "hashtable_api.h"
+#include "vmhook.h"
+
+#include <string.h>
+
+#include "AllocationProfiler.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "FrequentObjectsStats.hpp"
+#include "GCExtensions.hpp"
+#include "VMThreadListIterator.hpp"
+
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+static void allocationProfilerClassesUnloadHook(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData);
+#endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
+
+/**
+ * Stack walk callback recording the frames of an allocation sample.
+ */
+static UDATA
+recordAllocationSampleFrame(J9VMThread *vmThread, J9StackWalkState *walkState)
+{
+	MM_AllocationSample *sample = (MM_AllocationSample *)walkState->userData1;
+	UDATA maxFrames = (UDATA)walkState->userData2;
+
+	sample->frames[sample->frameCount] = walkState->method;
+	sample->frameCount += 1;
+	return (sample->frameCount < maxFrames) ? J9_STACKWALK_KEEP_ITERATING : J9_STACKWALK_STOP_ITERATING;
+}
+
+MM_AllocationProfiler *
+MM_AllocationProfiler::newInstance(MM_EnvironmentBase *env)
+{
+	MM_AllocationProfiler *profiler = (MM_AllocationProfiler *)env->getForge()->allocate(sizeof(MM_AllocationProfiler), MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+	if (NULL != profiler) {
+		new(profiler) MM_AllocationProfiler(env);
+		if (!profiler->initialize(env)) {
+			profiler->kill(env);
+			profiler = NULL;
+		}
+	}
+	return profiler;
+}
+
+void
+MM_AllocationProfiler::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+MM_AllocationProfiler::MM_AllocationProfiler(MM_EnvironmentBase *env)
+	: MM_BaseNonVirtual()
+	, _javaVM((J9JavaVM *)env->getOmrVM()->_language_vm)
+	, _extensions(MM_GCExtensions::getExtensions(env))
+	, _mutex(NULL)
+	, _classStats(NULL)
+	, _sites(NULL)
+	, _totalSamples(0)
+	, _droppedSamples(0)
+{
+	_typeId = __FUNCTION__;
+}
+
+bool
+MM_AllocationProfiler::initialize(MM_EnvironmentBase *env)
+{
+	PORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	if (0 != omrthread_monitor_init_with_name(&_mutex, 0, "MM_AllocationProfiler")) {
+		return false;
+	}
+
+	_classStats = MM_FrequentObjectsStats::newInstance(env);
+	if (NULL == _classStats) {
+		return false;
+	}
+
+	_sites = hashTableNew(OMRPORT_FROM_J9PORT(PORTLIB), J9_GET_CALLSITE(), 256, sizeof(MM_AllocationSite), 0, 0, OMRMEM_CATEGORY_MM, siteHashFn, siteEqualFn, NULL, this);
+	if (NULL == _sites) {
+		return false;
+	}
+
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+	J9HookInterface **vmHooks = _javaVM->internalVMFunctions->getVMHookInterface(_javaVM);
+	if (0 != (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_CLASSES_UNLOAD, allocationProfilerClassesUnloadHook, OMR_GET_CALLSITE(), this)) {
+		return false;
+	}
+#endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
+
+	return true;
+}
+
+void
+MM_AllocationProfiler::tearDown(MM_EnvironmentBase *env)
+{
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+	J9HookInterface **vmHooks = _javaVM->internalVMFunctions->getVMHookInterface(_javaVM);
+	(*vmHooks)->J9HookUnregister(vmHooks, J9HOOK_VM_CLASSES_UNLOAD, allocationProfilerClassesUnloadHook, this);
+#endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
+
+	if (NULL != _sites) {
+		hashTableFree(_sites);
+		_sites = NULL;
+	}
+	if (NULL != _classStats) {
+		_classStats->kill(env);
+		_classStats = NULL;
+	}
+	if (NULL != _mutex) {
+		omrthread_monitor_destroy(_mutex);
+		_mutex = NULL;
+	}
+}
+
+UDATA
+MM_AllocationProfiler::siteHashFn(void *entry, void *userData)
+{
+	MM_AllocationSite *site = (MM_AllocationSite *)entry;
+	UDATA hash = (UDATA)site->clazz;
+	for (UDATA i = 0; i < site->frameCount; i++) {
+		hash = (hash * 31) ^ (UDATA)site->frames[i];
+	}
+	return hash;
+}
+
+UDATA
+MM_AllocationProfiler::siteEqualFn(void *leftEntry, void *rightEntry, void *userData)
+{
+	MM_AllocationSite *left = (MM_AllocationSite *)leftEntry;
+	MM_AllocationSite *right = (MM_AllocationSite *)rightEntry;
+	if ((left->clazz != right->clazz) || (left->frameCount != right->frameCount)) {
+		return FALSE;
+	}
+	return 0 == memcmp(left->frames, right->frames, left->frameCount * sizeof(J9Method *));
+}
+
+MM_AllocationSampleBuffer *
+MM_AllocationProfiler::getThreadBuffer(MM_EnvironmentBase *env)
+{
+	GC_Environment *gcEnv = env->getGCEnvironment();
+	if (NULL == gcEnv->_allocationSampleBuffer) {
+		/* allocated on the first sample, so threads which never allocate much never pay for a buffer */
+		MM_AllocationSampleBuffer *buffer = (MM_AllocationSampleBuffer *)env->getForge()->allocate(sizeof(MM_AllocationSampleBuffer), MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+		if (NULL != buffer) {
+			buffer->count = 0;
+			gcEnv->_allocationSampleBuffer = buffer;
+		}
+	}
+	return gcEnv->_allocationSampleBuffer;
+}
+
+void
+MM_AllocationProfiler::sample(MM_EnvironmentBase *env, J9Class *clazz, UDATA size)
+{
+	MM_AllocationSampleBuffer *buffer = getThreadBuffer(env);
+	if (NULL == buffer) {
+		return;
+	}
+
+	J9VMThread *vmThread = (J9VMThread *)env->getLanguageVMThread();
+	MM_AllocationSample *sample = &buffer->samples[buffer->count];
+	sample->clazz = clazz;
+	sample->size = size;
+	sample->frameCount = 0;
+
+	UDATA depth = _extensions->allocationProfileDepth;
+	if (0 != depth) {
+		J9StackWalkState walkState;
+		walkState.walkThread = vmThread;
+		walkState.skipCount = 0;
+		walkState.maxFrames = depth;
+		walkState.userData1 = sample;
+		walkState.userData2 = (void *)depth;
+		walkState.frameWalkFunction = recordAllocationSampleFrame;
+		walkState.flags = J9_STACKWALK_ITERATE_FRAMES | J9_STACKWALK_VISIBLE_ONLY | J9_STACKWALK_INCLUDE_NATIVES | J9_STACKWALK_COUNT_SPECIFIED;
+		_javaVM->walkStackFrames(vmThread, &walkState);
+	}
+
+	buffer->count += 1;
+	if (ALLOCATION_SAMPLE_BUFFER_SIZE == buffer->count) {
+		flushThreadBuffer(env);
+	}
+}
+
+void
+MM_AllocationProfiler::flushThreadBuffer(MM_EnvironmentBase *env)
+{
+	MM_AllocationSampleBuffer *buffer = env->getGCEnvironment()->_allocationSampleBuffer;
+	if ((NULL != buffer) && (0 != buffer->count)) {
+		omrthread_monitor_enter(_mutex);
+		foldSamples(env, buffer);
+		omrthread_monitor_exit(_mutex);
+		buffer->count = 0;
+	}
+}
+
+void
+MM_AllocationProfiler::foldSamples(MM_EnvironmentBase *env, MM_AllocationSampleBuffer *buffer)
+{
+	UDATA maxSites = _extensions->allocationProfileMaxSites;
+
+	for (UDATA i = 0; i < buffer->count; i++) {
+		MM_AllocationSample *sample = &buffer->samples[i];
+		_classStats->update(sample->clazz, 1);
+		_totalSamples += 1;
+
+		MM_AllocationSite key;
+		memset(&key, 0, sizeof(key));
+		key.clazz = sample->clazz;
+		key.frameCount = sample->frameCount;
+		memcpy(key.frames, sample->frames, sample->frameCount * sizeof(J9Method *));
+
+		MM_AllocationSite *site = (MM_AllocationSite *)hashTableFind(_sites, &key);
+		if (NULL == site) {
+			if (hashTableGetCount(_sites) >= maxSites) {
+				_droppedSamples += 1;
+				continue;
+			}
+			key.id = siteHashFn(&key, this);
+			if (0 == key.id) {
+				/* an id of 0 identifies a class summary */
+				key.id = 1;
+			}
+			site = (MM_AllocationSite *)hashTableAdd(_sites, &key);
+			if (NULL == site) {
+				_droppedSamples += 1;
+				continue;
+			}
+		}
+		site->samples += 1;
+		site->bytes += sample->size;
+	}
+}
+
+void
+MM_AllocationProfiler::iterateClasses(bool (*func)(MM_AllocationSite *site, void *userData), void *userData)
+{
+	omrthread_monitor_enter(_mutex);
+	OMRSpaceSaving *spaceSaving = _classStats->_spaceSaving;
+	UDATA classCount = OMR_MIN(spaceSavingGetCurSize(spaceSaving), (UDATA)_classStats->_topKFrequent);
+	for (UDATA i = 1; i <= classCount; i++) {
+		MM_AllocationSite site;
+		memset(&site, 0, sizeof(site));
+		site.clazz = (J9Class *)spaceSavingGetKthMostFreq(spaceSaving, i);
+		site.samples = spaceSavingGetKthMostFreqCount(spaceSaving, i);
+		site.bytes = site.samples * _extensions->oolObjectSamplingBytesGranularity;
+		if (!func(&site, userData)) {
+			break;
+		}
+	}
+	omrthread_monitor_exit(_mutex);
+}
+
+void
+MM_AllocationProfiler::iterateSites(bool (*func)(MM_AllocationSite *site, void *userData), void *userData)
+{
+	J9HashTableState state;
+
+	omrthread_monitor_enter(_mutex);
+	MM_AllocationSite *site = (MM_AllocationSite *)hashTableStartDo(_sites, &state);
+	while (NULL != site) {
+		if (!func(site, userData)) {
+			break;
+		}
+		site = (MM_AllocationSite *)hashTableNextDo(&state);
+	}
+	omrthread_monitor_exit(_mutex);
+}
+
+/**
+ * @return true if the class, or the class of any of the frames, of the site is being unloaded
+ */
+static bool
+isSiteDying(MM_AllocationSite *site)
+{
+	if (J9_ARE_ANY_BITS_SET(J9CLASS_FLAGS(site->clazz), J9AccClassDying)) {
+		return true;
+	}
+	for (UDATA i = 0; i < site->frameCount; i++) {
+		J9Method *method = site->frames[i];
+		if ((NULL != method) && J9_ARE_ANY_BITS_SET(J9CLASS_FLAGS(J9_CLASS_FROM_METHOD(method)), J9AccClassDying)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void
+MM_AllocationProfiler::purgeDyingClasses(MM_EnvironmentBase *env)
+{
+	/* fold every thread's pending samples first, so that no buffer is left holding a dying class */
+	J9VMThread *walkThread = NULL;
+	GC_VMThreadListIterator threadIterator(_javaVM);
+	while (NULL != (walkThread = threadIterator.nextVMThread())) {
+		flushThreadBuffer(MM_EnvironmentBase::getEnvironment(walkThread->omrVMThread));
+	}
+
+	omrthread_monitor_enter(_mutex);
+
+	J9HashTableState state;
+	MM_AllocationSite *site = (MM_AllocationSite *)hashTableStartDo(_sites, &state);
+	while (NULL != site) {
+		if (isSiteDying(site)) {
+			hashTableDoRemove(&state);
+		}
+		site = (MM_AllocationSite *)hashTableNextDo(&state);
+	}
+
+	/* the sketch cannot remove single entries, so it starts over if it refers to a dying class */
+	OMRSpaceSaving *spaceSaving = _classStats->_spaceSaving;
+	for (UDATA i = 1; i <= spaceSavingGetCurSize(spaceSaving); i++) {
+		J9Class *clazz = (J9Class *)spaceSavingGetKthMostFreq(spaceSaving, i);
+		if (J9_ARE_ANY_BITS_SET(J9CLASS_FLAGS(clazz), J9AccClassDying)) {
+			_classStats->clear();
+			break;
+		}
+	}
+
+	omrthread_monitor_exit(_mutex);
+}
+
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+static void
+allocationProfilerClassesUnloadHook(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData)
+{
+	J9VMClassesUnloadEvent *event = (J9VMClassesUnloadEvent *)eventData;
+	MM_AllocationProfiler *profiler = (MM_AllocationProfiler *)userData;
+	profiler->purgeDyingClasses(MM_EnvironmentBase::getEnvironment(event->currentThread->omrVMThread));
+}
+#endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
@@ -0,0 +1,149 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(ALLOCATIONPROFILER_HPP_)
+#define ALLOCATIONPROFILER_HPP_
+
+#include "j9.h"
+#include "j9cfg.h"
+#include "modron.h"
+
+#include "BaseNonVirtual.hpp"
+
+class MM_EnvironmentBase;
+class MM_FrequentObjectsStats;
+class MM_GCExtensions;
+
+#define ALLOCATION_PROFILE_MAXIMUM_DEPTH 8
+#define ALLOCATION_SAMPLE_BUFFER_SIZE 16
+
+/**
+ * One allocation sample: the class and size of the sampled object and the top frames of the allocating stack.
+ */
+typedef struct MM_AllocationSample {
+	J9Class *clazz;
+	UDATA size;
+	UDATA frameCount;
+	J9Method *frames[ALLOCATION_PROFILE_MAXIMUM_DEPTH];
+} MM_AllocationSample;
+
+/**
+ * Per-thread buffer of samples.  Only the owning thread appends to it, so no synchronization is needed until it is
+ * flushed into the shared profile.
+ */
+typedef struct MM_AllocationSampleBuffer {
+	UDATA count;
+	MM_AllocationSample samples[ALLOCATION_SAMPLE_BUFFER_SIZE];
+} MM_AllocationSampleBuffer;
+
+/**
+ * An aggregated allocation site: a class allocated from a particular (truncated) stack.
+ */
+typedef struct MM_AllocationSite {
+	UDATA id; /**< Stack identifier (hash of the class and frames, never 0 which marks a class summary) */
+	J9Class *clazz;
+	UDATA frameCount;
+	J9Method *frames[ALLOCATION_PROFILE_MAXIMUM_DEPTH];
+	UDATA samples; /**< Number of samples taken at this site */
+	UDATA bytes; /**< Total size of the sampled objects */
+} MM_AllocationSite;
+
+/**
+ * Always-on allocation profile built from the out-of-line allocation samples (one sample each time a thread has
+ * allocated another oolObjectSamplingBytesGranularity bytes, checked when its TLH is refreshed).
+ *
+ * Each sample records the class, the size and up to allocationProfileDepth frames of the allocating stack into a
+ * buffer owned by the allocating thread.  Full buffers are folded, under a lock, into a top-k sketch of the most
+ * sampled classes and a table of allocation sites.  Because sampling is by bytes, sample counts are proportional to
+ * bytes allocated.  Entries referring to unloaded classes are purged when classes are unloaded.
+ * @ingroup GC_Base
+ */
+class MM_AllocationProfiler : public MM_BaseNonVirtual
+{
+private:
+	J9JavaVM *_javaVM; /**< The VM */
+	MM_GCExtensions *_extensions; /**< GC extensions */
+	omrthread_monitor_t _mutex; /**< Protects the aggregated profile */
+	MM_FrequentObjectsStats *_classStats; /**< Top-k sketch of sampled classes */
+	J9HashTable *_sites; /**< Aggregated allocation sites (MM_AllocationSite) */
+	UDATA _totalSamples; /**< Samples folded into the profile */
+	UDATA _droppedSamples; /**< Samples not recorded by site because the site table was full */
+
+public:
+	static MM_AllocationProfiler *newInstance(MM_EnvironmentBase *env);
+	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Record an allocation sample for the current thread.  Must be called from an allocation path which has
+	 * built a frame so that the Java stack can be walked.
+	 * @param env[in] the allocating thread
+	 * @param clazz[in] the class of the allocated object
+	 * @param size[in] the size of the allocated object, in bytes
+	 */
+	void sample(MM_EnvironmentBase *env, J9Class *clazz, UDATA size);
+
+	/**
+	 * Fold the samples buffered by a thread into the profile.
+	 * @param env[in] the thread whose buffer is flushed (the current thread, or any thread while mutators are stopped)
+	 */
+	void flushThreadBuffer(MM_EnvironmentBase *env);
+
+	/**
+	 * Report the top-k sampled classes (frameCount is 0 and id is 0 in the reported sites).
+	 * @param func[in] called for each class with the lock held; returns false to stop
+	 */
+	void iterateClasses(bool (*func)(MM_AllocationSite *site, void *userData), void *userData);
+
+	/**
+	 * Report every aggregated allocation site.
+	 * @param func[in] called for each site with the lock held; returns false to stop
+	 */
+	void iterateSites(bool (*func)(MM_AllocationSite *site, void *userData), void *userData);
+
+	/**
+	 * Drop the profile entries which refer to classes (or methods of classes) being unloaded.
+	 * Called while mutators are stopped, after flushing every thread buffer.
+	 */
+	void purgeDyingClasses(MM_EnvironmentBase *env);
+
+	UDATA getTotalSamples() const { return _totalSamples; }
+	UDATA getDroppedSamples() const { return _droppedSamples; }
+
+	MM_AllocationProfiler(MM_EnvironmentBase *env);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+private:
+	MM_AllocationSampleBuffer *getThreadBuffer(MM_EnvironmentBase *env);
+	void foldSamples(MM_EnvironmentBase *env, MM_AllocationSampleBuffer *buffer);
+	static UDATA siteHashFn(void *entry, void *userData);
+	static UDATA siteEqualFn(void *leftEntry, void *rightEntry, void *userData);
+};
+
+#endif /* ALLOCATIONPROFILER_HPP_ */
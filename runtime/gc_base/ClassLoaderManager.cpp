@@ -34,7 +34,9 @@
 #include "ClassHeapIterator.hpp"
 #include "ClassLoaderIterator.hpp"
 #include "ClassLoaderSegmentIterator.hpp"
+#include "ClassUnloadingTask.hpp"
 #include "ClassUnloadStats.hpp"
+#include "Dispatcher.hpp"
 #include "EnvironmentBase.hpp"
 #include "FinalizableClassLoaderBuffer.hpp"
 #include "GCExtensions.hpp"
@@ -302,6 +304,7 @@ MM_ClassLoaderManager::identifyClassLoadersToUnload(MM_EnvironmentBase *env, MM_
 void
 MM_ClassLoaderManager::cleanUpClassLoadersStart(MM_EnvironmentBase *env, J9ClassLoader* classLoaderUnloadList, MM_HeapMap *markMap, MM_ClassUnloadStats *classUnloadStats)
 {
+	PORT_ACCESS_FROM_ENVIRONMENT(env);
 	UDATA classUnloadCount = 0;
 	UDATA anonymousClassUnloadCount = 0;
 	UDATA classLoaderUnloadCount = 0;
@@ -311,9 +314,20 @@ MM_ClassLoaderManager::cleanUpClassLoadersStart(MM_EnvironmentBase *env, J9Class
 	J9Class *anonymousClassUnloadList = NULL;
 	
 	Trc_MM_cleanUpClassLoadersStart_Entry(env->getLanguageVMThread());
-	
+
+	/* Flag the dying classes and remove them from the subclass hierarchy across all GC threads */
+	_unloadPhaseStats.clear();
+	U_64 startTime = j9time_hires_clock();
+	MM_ClassUnloadingTask unloadingTask(env, _extensions->dispatcher, this, classLoaderUnloadList, markMap);
+	_extensions->dispatcher->run(env, &unloadingTask);
+	U_64 unlinkEndTime = j9time_hires_clock();
+	_unloadPhaseStats._threadCount = unloadingTask.getThreadCount();
+	_unloadPhaseStats._segmentsScanned = unloadingTask._segmentsScanned;
+	_unloadPhaseStats._identifyTime = j9time_hires_delta(startTime, unloadingTask._identifyEndTime, J9PORT_TIME_DELTA_IN_MICROSECONDS);
+	_unloadPhaseStats._unlinkTime = j9time_hires_delta(unloadingTask._identifyEndTime, unlinkEndTime, J9PORT_TIME_DELTA_IN_MICROSECONDS);
+
 	/*
-	 * Walk anonymous classes and set unmarked as dying
+	 * Walk anonymous classes and collect the dying ones
 	 *
 	 * Do this walk before classloaders to be unloaded walk to create list of anonymous classes to be unloaded and use it
 	 * as sublist to continue to build general list of classes to be unloaded
@@ -321,7 +335,7 @@ MM_ClassLoaderManager::cleanUpClassLoadersStart(MM_EnvironmentBase *env, J9Class
 	 * Anonymous classes suppose to be allocated one per segment
 	 * This is not relevant here however becomes important at segment removal time
 	 */
-	anonymousClassUnloadList = addDyingClassesToList(env, _javaVM->anonClassLoader, markMap, false, anonymousClassUnloadList, &anonymousClassUnloadCount);
+	anonymousClassUnloadList = addDyingClassesToList(env, _javaVM->anonClassLoader, anonymousClassUnloadList, &anonymousClassUnloadCount);
 
 	/* class unload list includes anonymous class unload list */
 	classUnloadList = anonymousClassUnloadList;
@@ -334,8 +348,8 @@ MM_ClassLoaderManager::cleanUpClassLoadersStart(MM_EnvironmentBase *env, J9Class
 		classLoaderUnloadCount += 1;
 		classLoader->gcFlags |= J9_GC_CLASS_LOADER_DEAD;
 
-		/* mark all of its classes as dying */
-		classUnloadList = addDyingClassesToList(env, classLoader, markMap, true, classUnloadList, &classUnloadCount);
+		/* all of its classes were flagged as dying by the unloading task */
+		classUnloadList = addDyingClassesToList(env, classLoader, classUnloadList, &classUnloadCount);
 
 		classLoader = classLoader->unloadLink;
 	}
@@ -365,11 +379,108 @@ MM_ClassLoaderManager::cleanUpClassLoadersStart(MM_EnvironmentBase *env, J9Class
 	/* Ensure that the vm has an accurate number of currently loaded anonymous classes  */
 	_javaVM->anonClassCount -= anonymousClassUnloadCount;
 
+	_unloadPhaseStats._hookTime = j9time_hires_delta(unlinkEndTime, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS);
+
 	Trc_MM_cleanUpClassLoadersStart_Exit(env->getLanguageVMThread());
 }
 
+J9ClassLoader *
+MM_ClassLoaderManager::nextClassLoaderToScan(J9ClassLoader *classLoader, J9ClassLoader *classLoaderUnloadList)
+{
+	/* the anonymous class loader (whose classes die individually) is scanned first, followed by each dying loader */
+	if (NULL == classLoader) {
+		classLoader = _javaVM->anonClassLoader;
+		if (NULL == classLoader) {
+			classLoader = classLoaderUnloadList;
+		}
+	} else if (classLoader == _javaVM->anonClassLoader) {
+		classLoader = classLoaderUnloadList;
+	} else {
+		classLoader = classLoader->unloadLink;
+	}
+	return classLoader;
+}
+
+UDATA
+MM_ClassLoaderManager::markDyingClasses(MM_EnvironmentBase *env, J9ClassLoader *classLoaderUnloadList, MM_HeapMap *markMap)
+{
+	UDATA segmentsScanned = 0;
+	J9ClassLoader *classLoader = nextClassLoaderToScan(NULL, classLoaderUnloadList);
+	while (NULL != classLoader) {
+		/* every class of a dying loader dies, while anonymous classes die only if unmarked */
+		bool setAll = (classLoader != _javaVM->anonClassLoader);
+		GC_ClassLoaderSegmentIterator segmentIterator(classLoader, MEMORY_TYPE_RAM_CLASS);
+		J9MemorySegment *segment = NULL;
+		while (NULL != (segment = segmentIterator.nextSegment())) {
+			if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+				segmentsScanned += 1;
+				GC_ClassHeapIterator classHeapIterator(_javaVM, segment);
+				J9Class *clazz = NULL;
+				while (NULL != (clazz = classHeapIterator.nextClass())) {
+					J9Object *classObject = clazz->classObject;
+					if (setAll || !markMap->isBitSet(classObject)) {
+
+						/* with setAll all classes must be unmarked */
+						Assert_MM_true(!markMap->isBitSet(classObject));
+
+						/* Mark class as dying */
+						clazz->classDepthAndFlags |= J9AccClassDying;
+
+						/* For CMVC 137275. For all dying classes we poison the classObject
+						 * field to J9_INVALID_OBJECT to investigate the origin of a class object
+						 * reference whose class has been unloaded.
+						 */
+						clazz->classObject = (j9object_t) J9_INVALID_OBJECT;
+					}
+				}
+			}
+		}
+		classLoader = nextClassLoaderToScan(classLoader, classLoaderUnloadList);
+	}
+	return segmentsScanned;
+}
+
+void
+MM_ClassLoaderManager::unlinkDyingClasses(MM_EnvironmentBase *env, J9ClassLoader *classLoaderUnloadList)
+{
+	J9ClassLoader *classLoader = nextClassLoaderToScan(NULL, classLoaderUnloadList);
+	while (NULL != classLoader) {
+		GC_ClassLoaderSegmentIterator segmentIterator(classLoader, MEMORY_TYPE_RAM_CLASS);
+		J9MemorySegment *segment = NULL;
+		while (NULL != (segment = segmentIterator.nextSegment())) {
+			if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+				GC_ClassHeapIterator classHeapIterator(_javaVM, segment);
+				J9Class *clazz = NULL;
+				while (NULL != (clazz = classHeapIterator.nextClass())) {
+					/* A run of adjacent dying classes in the subclass traversal list is unlinked by whichever thread owns
+					 * the first class of the run (the one whose predecessor survives).  The links of a surviving class
+					 * are each only written by the owner of the single run which touches them, and a thread looking at any
+					 * other class of the run sees a dying predecessor (or the class itself, once unlinked) and skips it.
+					 */
+					if ((J9AccClassDying == (J9CLASS_FLAGS(clazz) & J9AccClassDying))
+						&& (J9AccClassDying != (J9CLASS_FLAGS(clazz->subclassTraversalReverseLink) & J9AccClassDying))
+					) {
+						J9Class *survivingPredecessor = clazz->subclassTraversalReverseLink;
+						J9Class *runClass = clazz;
+						while (J9AccClassDying == (J9CLASS_FLAGS(runClass) & J9AccClassDying)) {
+							J9Class *nextClass = runClass->subclassTraversalLink;
+							/* link this obsolete class to itself so that it won't have dangling pointers into the subclass traversal list */
+							runClass->subclassTraversalLink = runClass;
+							runClass->subclassTraversalReverseLink = runClass;
+							runClass = nextClass;
+						}
+						survivingPredecessor->subclassTraversalLink = runClass;
+						runClass->subclassTraversalReverseLink = survivingPredecessor;
+					}
+				}
+			}
+		}
+		classLoader = nextClassLoaderToScan(classLoader, classLoaderUnloadList);
+	}
+}
+
 J9Class *
-MM_ClassLoaderManager::addDyingClassesToList(MM_EnvironmentBase *env, J9ClassLoader * classLoader, MM_HeapMap *markMap, bool setAll, J9Class *classUnloadListStart, UDATA *classUnloadCountResult)
+MM_ClassLoaderManager::addDyingClassesToList(MM_EnvironmentBase *env, J9ClassLoader * classLoader, J9Class *classUnloadListStart, UDATA *classUnloadCountResult)
 {
 	J9VMThread *vmThread = (J9VMThread *)env->getLanguageVMThread();
 	J9Class *classUnloadList = classUnloadListStart;
@@ -382,26 +493,9 @@ MM_ClassLoaderManager::addDyingClassesToList(MM_EnvironmentBase *env, J9ClassLoa
 			GC_ClassHeapIterator classHeapIterator(_javaVM, segment);
 			J9Class *clazz = NULL;
 			while(NULL != (clazz = classHeapIterator.nextClass())) {
-				J9Object *classObject = clazz->classObject;
-				if (setAll || !markMap->isBitSet(classObject)) {
-
-					/* with setAll all classes must be unmarked */
-					Assert_MM_true(!markMap->isBitSet(classObject));
-
+				if (J9AccClassDying == (J9CLASS_FLAGS(clazz) & J9AccClassDying)) {
 					classUnloadCount += 1;
 
-					/* Remove the class from the subclass traversal list */
-					removeFromSubclassHierarchy(env, clazz);
-
-					/* Mark class as dying */
-					clazz->classDepthAndFlags |= J9AccClassDying;
-
-					/* For CMVC 137275. For all dying classes we poison the classObject
-					 * field to J9_INVALID_OBJECT to investigate the origin of a class object
-					 * reference whose class has been unloaded.
-					 */
-					clazz->classObject = (j9object_t) J9_INVALID_OBJECT;
-
 					/* Call class unload hook */
 					Trc_MM_cleanUpClassLoadersStart_triggerClassUnload(env->getLanguageVMThread(),clazz,
 								(UDATA) J9UTF8_LENGTH(J9ROMCLASS_CLASSNAME(clazz->romClass)),
@@ -34,6 +34,7 @@
 
 
 #include "BaseNonVirtual.hpp"
+#include "ClassUnloadPhaseStats.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensions.hpp"
 
@@ -56,6 +57,7 @@ private:
 	UDATA _undeadSegmentsTotalSize;
 	UDATA _lastUnloadNumOfClassLoaders;  /**< number of class loaders last seen during a dynamic class unloading pass */
 	UDATA _lastUnloadNumOfAnonymousClasses; /**< number of anonymous classes last seen during a dynamic class unloading pass */
+	MM_ClassUnloadPhaseStats _unloadPhaseStats; /**< breakdown of the setup phase of the last class unloading pass */
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 	MM_GlobalCollector *_globalCollector; /**< Pointer to the global collector.  Used for yielding */
 	J9ClassLoader *_classLoaders; /**< Linked list of classloaders */
@@ -125,9 +127,15 @@ public:
 	 */
 	void setLastUnloadNumOfAnonymousClasses();
 
+	/**
+	 * Returns the breakdown of the setup phase of the last class unloading pass
+	 */
+	MM_ClassUnloadPhaseStats *getUnloadPhaseStats() { return &_unloadPhaseStats; }
+
 	/**
 	 * Perform initial cleanup for classloader unloading.  The current thread has exclusive access.
-	 * The J9AccClassDying bit is set and J9HOOK_VM_CLASS_UNLOAD is triggered for each class that will be unloaded.
+	 * The J9AccClassDying bit is set and the class is removed from the subclass hierarchy for each class that will be
+	 * unloaded (in parallel, by an MM_ClassUnloadingTask), then J9HOOK_VM_CLASS_UNLOAD is triggered for each of them.
 	 * The J9_GC_CLASS_LOADER_DEAD bit is set for each class loader that will be unloaded.
 	 * J9HOOK_VM_CLASSES_UNLOAD is triggered if any classes will be unloaded.
 	 * 
@@ -165,6 +173,24 @@ public:
 	 */
 	void cleanUpSegmentsAlongClassLoaderLink(J9JavaVM *javaVM, J9MemorySegment *segment, J9MemorySegment **reclaimedSegments);
 	
+	/**
+	 * Set J9AccClassDying in each class which will be unloaded, for the RAM class segments claimed by this thread.
+	 * Called by each thread of an MM_ClassUnloadingTask.
+	 * @param env[in] the current thread
+	 * @param classLoaderUnloadList[in] the linked list of loaders to unload, connected through the unloadLink field
+	 * @param markMap[in] the markMap to use to test for class liveness
+	 * @return the number of segments scanned by this thread
+	 */
+	UDATA markDyingClasses(MM_EnvironmentBase *env, J9ClassLoader *classLoaderUnloadList, MM_HeapMap *markMap);
+
+	/**
+	 * Remove the dying classes in the RAM class segments claimed by this thread from the subclass hierarchy.
+	 * Called by each thread of an MM_ClassUnloadingTask once every thread has finished markDyingClasses().
+	 * @param env[in] the current thread
+	 * @param classLoaderUnloadList[in] the linked list of loaders to unload, connected through the unloadLink field
+	 */
+	void unlinkDyingClasses(MM_EnvironmentBase *env, J9ClassLoader *classLoaderUnloadList);
+
 	/**
 	 * Remove the specified class from its subclass traversal list.
 	 * The class is moved into a trivial list consisting of itself.
@@ -237,16 +263,23 @@ private:
 
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 	/**
-	 * Scan classloader for dying classes and add them to the list
+	 * Add the classes of a class loader which have been flagged as dying to the list, triggering J9HOOK_VM_CLASS_UNLOAD for each
 	 * @param env[in] the current thread
-	 * @param classLoader[in] the list of class loaders to clean up
-	 * @param markMap[in] the markMap to use to test for class loader liveness
-	 * @param setAll[in] bool if true if all classes must be set dying, if false unmarked classes only
+	 * @param classLoader[in] the class loader to scan
 	 * @param classUnloadListStart[in] root of list dying classes should be added to
 	 * @param classUnloadCountOut[out] number of classes dying added to the list
 	 * @return new root to list of dying classes
 	 */
-	J9Class *addDyingClassesToList(MM_EnvironmentBase *env, J9ClassLoader * classLoader, MM_HeapMap *markMap, bool setAll, J9Class *classUnloadListStart, UDATA *classUnloadCountOut);
+	J9Class *addDyingClassesToList(MM_EnvironmentBase *env, J9ClassLoader * classLoader, J9Class *classUnloadListStart, UDATA *classUnloadCountOut);
+
+	/**
+	 * Step through the class loaders whose RAM class segments are scanned for dying classes: the anonymous class loader
+	 * followed by each loader in classLoaderUnloadList
+	 * @param classLoader[in] the current class loader, or NULL to start
+	 * @param classLoaderUnloadList[in] the linked list of loaders to unload, connected through the unloadLink field
+	 * @return the next class loader, or NULL when done
+	 */
+	J9ClassLoader *nextClassLoaderToScan(J9ClassLoader *classLoader, J9ClassLoader *classLoaderUnloadList);
 
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 
@@ -0,0 +1,55 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#include "j9.h"
+#include "j9cfg.h"
+#include "ModronAssertions.h"
+
+#include "ClassUnloadingTask.hpp"
+
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+
+#include "AtomicOperations.hpp"
+#include "ClassLoaderManager.hpp"
+
+void
+MM_ClassUnloadingTask::run(MM_EnvironmentBase *env)
+{
+	UDATA segmentsScanned = _classLoaderManager->markDyingClasses(env, _classLoaderUnloadList, _markMap);
+	MM_AtomicOperations::add(&_segmentsScanned, segmentsScanned);
+
+	/* every dying class must be flagged before any thread can tell where a run of dying classes in the hierarchy ends */
+	if (synchronizeGCThreadsAndReleaseSingleThread(env, UNIQUE_ID)) {
+		PORT_ACCESS_FROM_ENVIRONMENT(env);
+		_identifyEndTime = j9time_hires_clock();
+		releaseSynchronizedGCThreads(env);
+	}
+
+	_classLoaderManager->unlinkDyingClasses(env, _classLoaderUnloadList);
+}
+
+#endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
@@ -0,0 +1,80 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(CLASSUNLOADINGTASK_HPP_)
+#define CLASSUNLOADINGTASK_HPP_
+
+#include "j9.h"
+#include "j9cfg.h"
+#include "modronopt.h"
+
+#include "EnvironmentBase.hpp"
+#include "ParallelTask.hpp"
+
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+
+class MM_ClassLoaderManager;
+class MM_HeapMap;
+
+/**
+ * Identifies the classes which will be unloaded by a class unloading pass and removes them from the subclass
+ * hierarchy, in parallel across the GC threads.  The RAM class segments of the anonymous class loader and of each
+ * dying class loader are the units of work.  Building the dying class list and triggering the unload hooks is left
+ * to the master thread once the task completes.
+ * @ingroup GC_Base
+ */
+class MM_ClassUnloadingTask : public MM_ParallelTask
+{
+	/* Data Members */
+private:
+	MM_ClassLoaderManager * const _classLoaderManager;
+	J9ClassLoader * const _classLoaderUnloadList; /**< Dying class loaders, linked through unloadLink */
+	MM_HeapMap * const _markMap; /**< Mark map used to test class liveness */
+public:
+	U_64 _identifyEndTime; /**< Time at which all threads had finished marking dying classes */
+	volatile UDATA _segmentsScanned; /**< Number of RAM class segments scanned, summed across threads */
+
+	/* Member Functions */
+public:
+	virtual UDATA getVMStateID() { return OMRVMSTATE_GC_CLEANING_METADATA; }
+
+	virtual void run(MM_EnvironmentBase *env);
+
+	MM_ClassUnloadingTask(MM_EnvironmentBase *env, MM_Dispatcher *dispatcher, MM_ClassLoaderManager *classLoaderManager, J9ClassLoader *classLoaderUnloadList, MM_HeapMap *markMap)
+		: MM_ParallelTask(env, dispatcher)
+		, _classLoaderManager(classLoaderManager)
+		, _classLoaderUnloadList(classLoaderUnloadList)
+		, _markMap(markMap)
+		, _identifyEndTime(0)
+		, _segmentsScanned(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
+#endif /* CLASSUNLOADINGTASK_HPP_ */
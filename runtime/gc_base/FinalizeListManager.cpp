@@ -117,6 +117,7 @@ GC_FinalizeListManager::addSystemFinalizableObjects(j9object_t head, j9object_t
 	_extensions->accessBarrier->setFinalizeLink(tail, _systemFinalizableObjects);
 	_systemFinalizableObjects = head;
 	_systemFinalizableObjectCount += objectCount;
+	jobsAdded();
 
 	unlock();
 }
@@ -142,6 +143,7 @@ GC_FinalizeListManager::addDefaultFinalizableObjects(j9object_t head, j9object_t
 	_extensions->accessBarrier->setFinalizeLink(tail, _defaultFinalizableObjects);
 	_defaultFinalizableObjects = head;
 	_defaultFinalizableObjectCount += objectCount;
+	jobsAdded();
 
 	unlock();
 }
@@ -167,6 +169,7 @@ GC_FinalizeListManager::addReferenceObjects(j9object_t head, j9object_t tail, UD
 	_extensions->accessBarrier->setReferenceLink(tail, _referenceObjects);
 	_referenceObjects = head;
 	_referenceObjectCount += objectCount;
+	jobsAdded();
 
 	unlock();
 }
@@ -192,6 +195,7 @@ GC_FinalizeListManager::addClassLoaders(J9ClassLoader *head, J9ClassLoader *tail
 	tail->unloadLink = _classLoaders;
 	_classLoaders = head;
 	_classLoaderCount += count;
+	jobsAdded();
 
 	unlock();
 }
@@ -226,6 +230,7 @@ GC_FinalizeListManager::popRequiredClassLoaderForForcedClassLoaderUnload()
 
 			}
 			_classLoaderCount -= 1;
+			jobConsumed();
 			break;
 		}
 		previousLoader = classLoader;
@@ -247,6 +252,8 @@ GC_FinalizeListManager::consumeJob(J9VMThread *vmThread, GC_FinalizeJob * job)
 		if (NULL != referenceObject) {
 			job->type = FINALIZE_JOB_TYPE_REFERENCE;
 			job->reference = referenceObject;
+			_referencesInFlight += 1;
+			jobConsumed();
 
 			return job;
 		}
@@ -257,6 +264,7 @@ GC_FinalizeListManager::consumeJob(J9VMThread *vmThread, GC_FinalizeJob * job)
 		if (NULL != loader) {
 			job->type = FINALIZE_JOB_TYPE_CLASSLOADER;
 			job->classLoader = loader;
+			jobConsumed();
 
 			return job;
 		}
@@ -267,6 +275,7 @@ GC_FinalizeListManager::consumeJob(J9VMThread *vmThread, GC_FinalizeJob * job)
 		if (NULL != defaultObject) {
 			job->type = FINALIZE_JOB_TYPE_OBJECT;
 			job->object = defaultObject;
+			jobConsumed();
 
 			return job;
 		}
@@ -277,6 +286,7 @@ GC_FinalizeListManager::consumeJob(J9VMThread *vmThread, GC_FinalizeJob * job)
 		if (NULL != systemObject) {
 			job->type = FINALIZE_JOB_TYPE_OBJECT;
 			job->object = systemObject;
+			jobConsumed();
 
 			return job;
 		}
@@ -285,4 +295,75 @@ GC_FinalizeListManager::consumeJob(J9VMThread *vmThread, GC_FinalizeJob * job)
 	return NULL;
 }
 
+UDATA
+GC_FinalizeListManager::consumeReferenceObjects(J9VMThread *vmThread, j9object_t *references, UDATA maxCount)
+{
+	Assert_MM_true(J9_PUBLIC_FLAGS_VM_ACCESS == (vmThread->publicFlags & J9_PUBLIC_FLAGS_VM_ACCESS));
+	Assert_MM_true(1 == omrthread_monitor_owned_by_self(_mutex)); /* caller must be holding _mutex */
+
+	UDATA count = 0;
+	while (count < maxCount) {
+		j9object_t referenceObject = popReferenceObject();
+		if (NULL == referenceObject) {
+			break;
+		}
+		references[count] = referenceObject;
+		count += 1;
+	}
+
+	if (0 != count) {
+		_referencesInFlight += count;
+		jobConsumed();
+	}
+
+	return count;
+}
+
+void
+GC_FinalizeListManager::referencesProcessed(UDATA count)
+{
+	lock();
+	Assert_MM_true(_referencesInFlight >= count);
+	_referencesInFlight -= count;
+	unlock();
+}
+
+void
+GC_FinalizeListManager::jobsAdded()
+{
+	UDATA jobCount = getQueuedJobCount();
+
+	if (jobCount > _maxJobCount) {
+		_maxJobCount = jobCount;
+	}
+	/* the collectors empty and refill the lists to update them, so the timing is only ever restarted by a consumer */
+	if ((0 == _backlogStartTime) && (0 != jobCount)) {
+		PORT_ACCESS_FROM_JAVAVM(_extensions->getJavaVM());
+		_backlogStartTime = j9time_hires_clock();
+	}
+}
+
+void
+GC_FinalizeListManager::jobConsumed()
+{
+	if ((0 != _backlogStartTime) && (0 == getQueuedJobCount())) {
+		PORT_ACCESS_FROM_JAVAVM(_extensions->getJavaVM());
+		_lastDrainTime = j9time_hires_delta(_backlogStartTime, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS);
+		if (_lastDrainTime > _maxDrainTime) {
+			_maxDrainTime = _lastDrainTime;
+		}
+		_backlogStartTime = 0;
+	}
+}
+
+void
+GC_FinalizeListManager::getQueueStatistics(UDATA *maxJobCount, U_64 *lastDrainTime, U_64 *maxDrainTime)
+{
+	lock();
+	*maxJobCount = _maxJobCount;
+	*lastDrainTime = _lastDrainTime;
+	*maxDrainTime = _maxDrainTime;
+	unlock();
+}
+
 #endif /* J9VM_GC_FINALIZATION */
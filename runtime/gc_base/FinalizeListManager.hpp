@@ -75,6 +75,11 @@ private:
     UDATA _referenceObjectCount; /** count of the reference object */
     J9ClassLoader *_classLoaders; /**< head of the linked list of unloaded classloaders which have open native libraries  */
     UDATA _classLoaderCount; /** count of the class loaders */
+    UDATA _referencesInFlight; /**< reference objects popped by a consumer which have not yet been enqueued */
+    UDATA _maxJobCount; /**< the largest number of jobs queued at once */
+    U_64 _backlogStartTime; /**< hires time at which the queues last became non-empty (0 while no backlog is being timed) */
+    U_64 _lastDrainTime; /**< microseconds taken to dequeue the most recent backlog */
+    U_64 _maxDrainTime; /**< the most microseconds taken to dequeue any backlog */
 protected:
 public:
     
@@ -117,6 +122,28 @@ protected:
      */
     J9ClassLoader *popClassLoader();
 
+    /**
+     * Update the queue statistics after jobs have been added.
+     *
+     * @note Must be called while holding this class' _mutex
+     */
+    void jobsAdded();
+
+    /**
+     * Update the queue statistics after a job has been popped, completing the backlog timing if the queues are now empty.
+     *
+     * @note Must be called while holding this class' _mutex
+     */
+    void jobConsumed();
+
+    /**
+     * @return the number of jobs on the queue (the caller must hold this class' _mutex for a stable answer)
+     */
+    MMINLINE UDATA getQueuedJobCount() const
+    {
+        return _classLoaderCount + _defaultFinalizableObjectCount + _systemFinalizableObjectCount + _referenceObjectCount;
+    }
+
 public:
 	void lock() const;
 	void unlock() const;
@@ -128,7 +155,7 @@ public:
 	virtual UDATA getJobCount() const
 	{
 		lock();
-		UDATA count = _classLoaderCount + _defaultFinalizableObjectCount + _systemFinalizableObjectCount + _referenceObjectCount;
+		UDATA count = getQueuedJobCount();
 		unlock();
 		return count;
 	}
@@ -138,6 +165,20 @@ public:
 	MMINLINE UDATA getClassloaderCount() {return _classLoaderCount;}
 	MMINLINE UDATA getReferenceCount() {return _referenceObjectCount;}
 
+	/**
+	 * @return the number of references waiting to be enqueued, including those popped by a consumer which has not finished with them
+	 */
+	MMINLINE UDATA getPendingReferenceCount() {return _referenceObjectCount + _referencesInFlight;}
+
+	/**
+	 * Report the queue statistics gathered since startup.
+	 *
+	 * @param maxJobCount[out] the largest number of jobs queued at once
+	 * @param lastDrainTime[out] microseconds taken to dequeue the most recent backlog
+	 * @param maxDrainTime[out] the most microseconds taken to dequeue any backlog
+	 */
+	void getQueueStatistics(UDATA *maxJobCount, U_64 *lastDrainTime, U_64 *maxDrainTime);
+
 	static GC_FinalizeListManager	*newInstance(MM_EnvironmentBase *env);
 	virtual void kill(MM_EnvironmentBase *env);
 	bool initialize();
@@ -331,6 +372,26 @@ public:
 	 */
 	virtual GC_FinalizeJob *consumeJob(J9VMThread *vmThread, GC_FinalizeJob * job);
 
+	/**
+	 * Pop up to maxCount reference objects to be enqueued.  The references remain counted as pending until
+	 * referencesProcessed() is called for them.
+	 *
+	 * @note Must be called while holding this class' _mutex
+	 *
+	 * @param vmThread[in] the consuming thread, which must hold VM access
+	 * @param references[out] the popped references
+	 * @param maxCount[in] the capacity of references
+	 * @return the number of references popped
+	 */
+	UDATA consumeReferenceObjects(J9VMThread *vmThread, j9object_t *references, UDATA maxCount);
+
+	/**
+	 * Record that references popped by consumeJob() or consumeReferenceObjects() have been enqueued.
+	 *
+	 * @param count[in] the number of references processed
+	 */
+	void referencesProcessed(UDATA count);
+
 
 	/**
 	 * Create a FinalizeListManager object
@@ -346,6 +407,11 @@ public:
 	    ,_referenceObjectCount(0)
 	    ,_classLoaders(NULL)
 	    ,_classLoaderCount(0)
+	    ,_referencesInFlight(0)
+	    ,_maxJobCount(0)
+	    ,_backlogStartTime(0)
+	    ,_lastDrainTime(0)
+	    ,_maxDrainTime(0)
 	{
 		_typeId = __FUNCTION__;
 	};
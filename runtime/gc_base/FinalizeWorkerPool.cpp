@@ -0,0 +1,338 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#include <string.h>
+
+#include "j9.h"
+#include "j9cfg.h"
+#include "j9consts.h"
+#include "j9port.h"
+#include "jni.h"
+
+#if defined(J9VM_GC_FINALIZATION)
+
+#include "FinalizeWorkerPool.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "FinalizeListManager.hpp"
+#include "GCExtensions.hpp"
+
+GC_FinalizeWorkerPool *
+GC_FinalizeWorkerPool::newInstance(MM_EnvironmentBase *env, UDATA threadCount)
+{
+	GC_FinalizeWorkerPool *pool = (GC_FinalizeWorkerPool *)env->getForge()->allocate(sizeof(GC_FinalizeWorkerPool), MM_AllocationCategory::FINALIZE, J9_GET_CALLSITE());
+	if (NULL != pool) {
+		new(pool) GC_FinalizeWorkerPool(env, threadCount);
+		if (!pool->initialize(env)) {
+			pool->kill(env);
+			pool = NULL;
+		}
+	}
+	return pool;
+}
+
+void
+GC_FinalizeWorkerPool::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+GC_FinalizeWorkerPool::GC_FinalizeWorkerPool(MM_EnvironmentBase *env, UDATA threadCount)
+	: MM_BaseVirtual()
+	, _javaVM((J9JavaVM *)env->getLanguageVM())
+	, _extensions(MM_GCExtensions::getExtensions(env))
+	, _mutex(NULL)
+	, _threadCount(threadCount)
+	, _threadsStarted(0)
+	, _threadsActive(0)
+	, _threadStarting(false)
+	, _wakeUpCount(0)
+	, _shutdownRequested(false)
+{
+	_typeId = __FUNCTION__;
+	memset(_workerThreads, 0, sizeof(_workerThreads));
+}
+
+bool
+GC_FinalizeWorkerPool::initialize(MM_EnvironmentBase *env)
+{
+	if (0 != omrthread_monitor_init_with_name(&_mutex, 0, "GC Finalize Worker Pool")) {
+		_mutex = NULL;
+		return false;
+	}
+	return true;
+}
+
+void
+GC_FinalizeWorkerPool::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _mutex) {
+		omrthread_monitor_destroy(_mutex);
+		_mutex = NULL;
+	}
+}
+
+bool
+GC_FinalizeWorkerPool::startThreads()
+{
+	bool result = true;
+
+	omrthread_monitor_enter(_mutex);
+	while (result && (_threadsStarted < _threadCount)) {
+		_threadsStarted += 1;
+		_threadStarting = true;
+		IDATA rc = _javaVM->internalVMFunctions->createThreadWithCategory(
+							NULL,
+							_javaVM->defaultOSStackSize,
+							_extensions->finalizeSlavePriority,
+							0,
+							&GC_FinalizeWorkerPool::workerThreadEntryPoint,
+							this,
+							J9THREAD_CATEGORY_APPLICATION_THREAD);
+		if (0 != rc) {
+			_threadStarting = false;
+			result = false;
+		} else {
+			while (_threadStarting) {
+				omrthread_monitor_wait(_mutex);
+			}
+			result = (_threadsActive == _threadsStarted);
+		}
+	}
+	omrthread_monitor_exit(_mutex);
+
+	return result;
+}
+
+void
+GC_FinalizeWorkerPool::shutdownThreads(J9VMThread *currentThread)
+{
+	omrthread_monitor_enter(_mutex);
+	_shutdownRequested = true;
+	omrthread_monitor_notify_all(_mutex);
+	/* a worker suspended in Java won't terminate until it is resumed, so don't wait for it (as for the finalizer slave, see j9gc_finalizer_shutdown()) */
+	while (0 != workersToJoin(currentThread)) {
+		omrthread_monitor_wait_timed(_mutex, SHUTDOWN_POLL_MILLIS, 0);
+	}
+	omrthread_monitor_exit(_mutex);
+}
+
+UDATA
+GC_FinalizeWorkerPool::workersToJoin(J9VMThread *currentThread)
+{
+	/* a worker leaves _workerThreads before it detaches, but stays active until it is about to terminate */
+	UDATA unjoinable = 0;
+	for (UDATA i = 0; i < MAXIMUM_WORKERS; i++) {
+		J9VMThread *worker = _workerThreads[i];
+		if ((NULL != worker) && ((worker == currentThread) || J9_ARE_ANY_BITS_SET(worker->publicFlags, J9_PUBLIC_FLAGS_HALT_THREAD_JAVA_SUSPEND))) {
+			unjoinable += 1;
+		}
+	}
+	return _threadsActive - unjoinable;
+}
+
+bool
+GC_FinalizeWorkerPool::allThreadsTerminated()
+{
+	omrthread_monitor_enter(_mutex);
+	bool result = (0 == _threadsActive);
+	omrthread_monitor_exit(_mutex);
+	return result;
+}
+
+void
+GC_FinalizeWorkerPool::wakeUp()
+{
+	omrthread_monitor_enter(_mutex);
+	_wakeUpCount += 1;
+	omrthread_monitor_notify_all(_mutex);
+	omrthread_monitor_exit(_mutex);
+}
+
+UDATA
+GC_FinalizeWorkerPool::workerThreadGlue(J9PortLibrary *portLib, void *userData)
+{
+	((GC_FinalizeWorkerPool *)userData)->workerThreadMain();
+	return 0;
+}
+
+int J9THREAD_PROC
+GC_FinalizeWorkerPool::workerThreadEntryPoint(void *userData)
+{
+	GC_FinalizeWorkerPool *pool = (GC_FinalizeWorkerPool *)userData;
+	J9JavaVM *javaVM = pool->_javaVM;
+	PORT_ACCESS_FROM_JAVAVM(javaVM);
+	UDATA rc = 0;
+
+	j9sig_protect(GC_FinalizeWorkerPool::workerThreadGlue, pool,
+		javaVM->internalVMFunctions->structuredSignalHandlerVM, javaVM,
+		J9PORT_SIG_FLAG_SIGALLSYNC | J9PORT_SIG_FLAG_MAY_CONTINUE_EXECUTION,
+		&rc);
+
+	/* workerThreadMain() returns holding the mutex; exit it and terminate the thread */
+	omrthread_exit(pool->_mutex);
+
+	/* NO GUARDS AFTER THIS POINT */
+	return 0;
+}
+
+void
+GC_FinalizeWorkerPool::workerThreadMain()
+{
+	PORT_ACCESS_FROM_JAVAVM(_javaVM);
+	J9InternalVMFunctions const * const vmFuncs = _javaVM->internalVMFunctions;
+	J9VMThread *vmThread = NULL;
+	char threadName[64];
+	JavaVMAttachArgs attachArgs;
+
+	omrthread_monitor_enter(_mutex);
+	j9str_printf(PORTLIB, threadName, sizeof(threadName), "Finalizer reference worker-%zu", _threadsStarted);
+	omrthread_monitor_exit(_mutex);
+
+	attachArgs.version = JNI_VERSION_1_2;
+	attachArgs.name = threadName;
+	attachArgs.group = (jobject)_javaVM->systemThreadGroupRef;
+	bool attached = (JNI_OK == ((JavaVM *)_javaVM)->AttachCurrentThreadAsDaemon((void **)&vmThread, (void *)&attachArgs));
+
+	omrthread_monitor_enter(_mutex);
+	UDATA workerIndex = _threadsStarted - 1;
+	if (attached) {
+		_threadsActive += 1;
+		_workerThreads[workerIndex] = vmThread;
+	}
+	_threadStarting = false;
+	omrthread_monitor_notify_all(_mutex);
+	omrthread_monitor_exit(_mutex);
+
+	if (attached) {
+		JNIEnv *jniEnv = (JNIEnv *)vmThread;
+		jmethodID referenceEnqueueImplMID = NULL;
+
+		vmFuncs->internalEnterVMFromJNI(vmThread);
+		vmThread->privateFlags |= (J9_PRIVATE_FLAGS_FINALIZE_SLAVE | J9_PRIVATE_FLAGS_USE_BOOTSTRAP_LOADER);
+		vmFuncs->internalReleaseVMAccess(vmThread);
+
+		/* Remember that the thread was gpProtected -- important for the JIT */
+		vmThread->gpProtected = 1;
+
+		if (J9_ARE_ANY_BITS_SET(_javaVM->jclFlags, J9_JCL_FLAG_FINALIZATION)) {
+			jclass referenceClazz = jniEnv->FindClass("java/lang/ref/Reference");
+			if (NULL != referenceClazz) {
+				referenceEnqueueImplMID = jniEnv->GetMethodID(referenceClazz, "enqueueImpl", "()Z");
+			}
+			if (NULL == referenceEnqueueImplMID) {
+				jniEnv->ExceptionClear();
+			}
+		}
+
+		run(vmThread, referenceEnqueueImplMID);
+
+		omrthread_monitor_enter(_mutex);
+		_workerThreads[workerIndex] = NULL;
+		omrthread_monitor_exit(_mutex);
+		((JavaVM *)_javaVM)->DetachCurrentThread();
+	}
+
+	omrthread_monitor_enter(_mutex);
+	if (attached) {
+		_threadsActive -= 1;
+	}
+	omrthread_monitor_notify_all(_mutex);
+	/* return holding the mutex so that shutdownThreads() cannot complete until this thread has terminated */
+}
+
+void
+GC_FinalizeWorkerPool::run(J9VMThread *vmThread, jmethodID referenceEnqueueImplMID)
+{
+	UDATA wakeUpsSeen = 0;
+
+	omrthread_monitor_enter(_mutex);
+	while (!_shutdownRequested) {
+		if (wakeUpsSeen != _wakeUpCount) {
+			wakeUpsSeen = _wakeUpCount;
+			omrthread_monitor_exit(_mutex);
+
+			/* without Reference.enqueueImpl() the slave reports the references as it always has */
+			if (NULL != referenceEnqueueImplMID) {
+				enqueueReferences(vmThread, referenceEnqueueImplMID);
+			}
+
+			omrthread_monitor_enter(_mutex);
+		} else {
+			omrthread_monitor_wait(_mutex);
+		}
+	}
+	omrthread_monitor_exit(_mutex);
+}
+
+void
+GC_FinalizeWorkerPool::enqueueReferences(J9VMThread *vmThread, jmethodID referenceEnqueueImplMID)
+{
+	J9InternalVMFunctions const * const vmFuncs = _javaVM->internalVMFunctions;
+	GC_FinalizeListManager *finalizeListManager = _extensions->finalizeListManager;
+	JNIEnv *jniEnv = (JNIEnv *)vmThread;
+	j9object_t references[REFERENCE_BATCH_SIZE];
+	jobject localRefs[REFERENCE_BATCH_SIZE];
+
+	vmFuncs->internalEnterVMFromJNI(vmThread);
+	while (!_shutdownRequested) {
+		finalizeListManager->lock();
+		UDATA count = finalizeListManager->consumeReferenceObjects(vmThread, references, REFERENCE_BATCH_SIZE);
+		finalizeListManager->unlock();
+		if (0 == count) {
+			break;
+		}
+		finalizeReferenceProcessingStarted(_javaVM);
+
+		/* the local references keep the batch reachable (and up to date) once VM access is released */
+		for (UDATA i = 0; i < count; i++) {
+			localRefs[i] = vmFuncs->j9jni_createLocalRef(jniEnv, references[i]);
+		}
+		vmFuncs->internalReleaseVMAccess(vmThread);
+
+		for (UDATA i = 0; i < count; i++) {
+			if (NULL != localRefs[i]) {
+#if defined(J9VM_PORT_ZOS_CEEHDLRSUPPORT)
+				/* Tell the interpreter to not register a user condition handler for this callin */
+				vmThread->privateFlags |= J9_PRIVATE_FLAGS_SKIP_THREAD_SIGNAL_PROTECTION;
+#endif /* J9VM_PORT_ZOS_CEEHDLRSUPPORT */
+				jniEnv->CallBooleanMethod(localRefs[i], referenceEnqueueImplMID);
+				jniEnv->ExceptionClear();
+				jniEnv->DeleteLocalRef(localRefs[i]);
+			}
+		}
+
+		vmFuncs->internalEnterVMFromJNI(vmThread);
+		finalizeListManager->referencesProcessed(count);
+		finalizeReferenceProcessingProgress(_javaVM);
+		vmFuncs->jniResetStackReferences(jniEnv);
+	}
+	vmFuncs->internalReleaseVMAccess(vmThread);
+}
+
+#endif /* J9VM_GC_FINALIZATION */
@@ -0,0 +1,134 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(FINALIZEWORKERPOOL_HPP_)
+#define FINALIZEWORKERPOOL_HPP_
+
+#include "j9.h"
+#include "j9cfg.h"
+#include "modron.h"
+
+#if defined(J9VM_GC_FINALIZATION)
+
+#include "BaseVirtual.hpp"
+
+class MM_EnvironmentBase;
+class MM_GCExtensions;
+
+/**
+ * A pool of threads which enqueue cleared references alongside the finalizer slave thread.
+ *
+ * The finalizer slave runs finalize() methods, frees unloaded class loaders and enqueues references one job at a
+ * time.  When Cleaner or PhantomReference managed native resources are released at a high rate the reference backlog
+ * can outgrow it, and the native memory stays allocated until the backlog is drained.  Each worker pops references
+ * from the shared list in batches (taking the list lock once per batch) and calls Reference.enqueueImpl() for them
+ * without holding VM access.  Finalizable objects and class loaders are still processed only by the slave.
+ *
+ * The finalizer master wakes the workers whenever it finds references on the list.
+ * @ingroup GC_Base
+ */
+class GC_FinalizeWorkerPool : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+public:
+	enum {
+		MAXIMUM_WORKERS = 64, /**< The largest supported -Xgc:finalizeReferenceWorkers */
+		REFERENCE_BATCH_SIZE = 32, /**< The number of references a worker pops each time it takes the list lock */
+		SHUTDOWN_POLL_MILLIS = 100 /**< How often shutdownThreads() checks whether the workers left to join have been suspended */
+	};
+
+private:
+	J9JavaVM *_javaVM;
+	MM_GCExtensions *_extensions;
+	omrthread_monitor_t _mutex; /**< Protects the thread counts, the wake up count and the shutdown flag */
+	UDATA _threadCount; /**< The number of workers to start */
+	UDATA _threadsStarted; /**< The number of workers created so far (used to number their names) */
+	UDATA _threadsActive; /**< The number of workers attached to the VM and not yet terminated */
+	J9VMThread *_workerThreads[MAXIMUM_WORKERS]; /**< The attached workers (NULL entries are unused) */
+	bool _threadStarting; /**< Set while startThreads() waits for a new worker to attach */
+	volatile UDATA _wakeUpCount; /**< Incremented each time the workers are told that references have been queued */
+	volatile bool _shutdownRequested;
+
+	/*
+	 * Function members
+	 */
+public:
+	static GC_FinalizeWorkerPool *newInstance(MM_EnvironmentBase *env, UDATA threadCount);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Start the workers.
+	 * @return true if every worker started and attached to the VM
+	 */
+	bool startThreads();
+	/**
+	 * Stop the workers and wait for them to detach from the VM and terminate.  A worker can't be joined if it is the
+	 * calling thread (e.g. a Cleaner which exits the VM) or if it is suspended in Java; see allThreadsTerminated().
+	 * @param currentThread[in] the calling thread, or NULL if it is not attached
+	 */
+	void shutdownThreads(J9VMThread *currentThread);
+	/**
+	 * @return true if every worker has terminated, so the pool can be freed.  Otherwise a worker which shutdownThreads()
+	 * could not join may still use the pool, which must be left allocated.
+	 */
+	bool allThreadsTerminated();
+	/**
+	 * Tell the workers that references have been queued.
+	 */
+	void wakeUp();
+
+	GC_FinalizeWorkerPool(MM_EnvironmentBase *env, UDATA threadCount);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+private:
+	/**
+	 * @return the number of workers shutdownThreads() must still wait for.  Must be called holding _mutex.
+	 */
+	UDATA workersToJoin(J9VMThread *currentThread);
+	static int J9THREAD_PROC workerThreadEntryPoint(void *userData);
+	static UDATA workerThreadGlue(J9PortLibrary *portLib, void *userData);
+	/**
+	 * Attach the calling thread as a worker and process references until shutdown is requested.
+	 */
+	void workerThreadMain();
+	/**
+	 * Wait for wake ups and drain the reference list after each one.
+	 */
+	void run(J9VMThread *vmThread, jmethodID referenceEnqueueImplMID);
+	/**
+	 * Pop and enqueue batches of references until the list is empty.
+	 */
+	void enqueueReferences(J9VMThread *vmThread, jmethodID referenceEnqueueImplMID);
+};
+
+#endif /* J9VM_GC_FINALIZATION */
+#endif /* FINALIZEWORKERPOOL_HPP_ */
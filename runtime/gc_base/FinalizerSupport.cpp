@@ -38,6 +38,7 @@
 #include "EnvironmentBase.hpp"
 #include "FinalizeListManager.hpp"
 #include "FinalizableObjectBuffer.hpp"
+#include "FinalizeWorkerPool.hpp"
 #include "GCExtensions.hpp"
 #include "Heap.hpp"
 #include "ModronTypes.hpp"
@@ -151,6 +152,48 @@ finalizeForcedUnfinalizedToFinalizable(J9VMThread *vmThread)
 #endif /* J9VM_GC_FINALIZATION */
 }
 
+/**
+ * Mark reference processing as active, if any references are pending, so that Reference.waitForReferenceProcessing()
+ * waits for them to be enqueued.
+ */
+void
+finalizeReferenceProcessingStarted(J9JavaVM *vm)
+{
+	if (NULL != vm->processReferenceMonitor) {
+		GC_FinalizeListManager *finalizeListManager = MM_GCExtensions::getExtensions(vm)->finalizeListManager;
+		omrthread_monitor_enter(vm->processReferenceMonitor);
+		/* checked under the monitor so that a consumer which has just finished cannot leave the flag set */
+		if (0 != finalizeListManager->getPendingReferenceCount()) {
+			vm->processReferenceActive = 1;
+		}
+		omrthread_monitor_exit(vm->processReferenceMonitor);
+	}
+}
+
+/**
+ * Report that references have been enqueued, clearing the active flag once none are pending.
+ */
+void
+finalizeReferenceProcessingProgress(J9JavaVM *vm)
+{
+	if ((NULL != vm->processReferenceMonitor) && (0 != vm->processReferenceActive)) {
+		GC_FinalizeListManager *finalizeListManager = MM_GCExtensions::getExtensions(vm)->finalizeListManager;
+		omrthread_monitor_enter(vm->processReferenceMonitor);
+		/* references popped by the slave or a reference worker stay pending until they have been enqueued */
+		if (0 == finalizeListManager->getPendingReferenceCount()) {
+			/* There is no more pending reference. */
+			vm->processReferenceActive = 0;
+		}
+		/*
+		 * Notify any waiters that progress has been made.
+		 * This improves latency for Reference.waitForReferenceProcessing() and try to
+		 * avoid the performance issue if there are many of pending references in the queue.
+		 */
+		omrthread_monitor_notify_all(vm->processReferenceMonitor);
+		omrthread_monitor_exit(vm->processReferenceMonitor);
+	}
+}
+
 #define FINALIZE_SLAVE_STAY_ALIVE 0
 #define FINALIZE_SLAVE_SHOULD_DIE 1
 #define FINALIZE_SLAVE_ABANDONED 2
@@ -244,6 +287,11 @@ static int J9THREAD_PROC FinalizeMasterThread(void *javaVM)
 			noCycleWait = 0;
 		}
 
+		/* Let the reference workers (if any) share the queued references with the slave */
+		if ((NULL != extensions->finalizeWorkerPool) && (0 != finalizeListManager->getReferenceCount())) {
+			extensions->finalizeWorkerPool->wakeUp();
+		}
+
 		/* If RUN_FINALIZATION is set, make the interval time is set to -1 -> This will override any "wake up" request made by the garbage collector */
 		if(vm->finalizeMasterFlags & (J9_FINALIZE_FLAGS_RUN_FINALIZATION
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
@@ -557,11 +605,7 @@ static int J9THREAD_PROC FinalizeSlaveThread(void *arg)
 		if(slaveData->mode != FINALIZE_SLAVE_MODE_CL_UNLOAD)
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 		{
-			if ((NULL != vm->processReferenceMonitor) && (0 != finalizeListManager->getReferenceCount())) {
-				omrthread_monitor_enter(vm->processReferenceMonitor);
-				vm->processReferenceActive = 1;
-				omrthread_monitor_exit(vm->processReferenceMonitor);
-			}
+			finalizeReferenceProcessingStarted(vm);
 		}
 
 		do {
@@ -606,20 +650,10 @@ static int J9THREAD_PROC FinalizeSlaveThread(void *arg)
 			/* processing will release/acquire VM access */
 			process(env, finalizeJob, j9VMInternalsClass, runFinalizeMID, referenceEnqueueImplMID);
 
-			if ((NULL != vm->processReferenceMonitor) && (0 != vm->processReferenceActive)) {
-				omrthread_monitor_enter(vm->processReferenceMonitor);
-				if (0 == finalizeListManager->getReferenceCount()) {
-					/* There is no more pending reference. */
-					vm->processReferenceActive = 0;
-				}
-				/*
-				 * Notify any waiters that progress has been made.
-				 * This improves latency for Reference.waitForReferenceProcessing() and try to
-				 * avoid the performance issue if there are many of pending references in the queue.
-				 */
-				omrthread_monitor_notify_all(vm->processReferenceMonitor);
-				omrthread_monitor_exit(vm->processReferenceMonitor);
+			if (FINALIZE_JOB_TYPE_REFERENCE == finalizeJob->type) {
+				finalizeListManager->referencesProcessed(1);
 			}
+			finalizeReferenceProcessingProgress(vm);
 
 			fns->jniResetStackReferences((JNIEnv *)env);
 
@@ -902,10 +936,23 @@ UDATA j9gc_wait_for_reference_processing(J9JavaVM *vm)
 {
 	UDATA ret = 0;
 	if (NULL != vm->processReferenceMonitor) {
+		MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(vm);
+		UDATA backpressureThreshold = extensions->finalizeBackpressureThreshold;
+
 		omrthread_monitor_enter(vm->processReferenceMonitor);
 		if (0 != vm->processReferenceActive) {
 			omrthread_monitor_wait(vm->processReferenceMonitor);
 			ret = 1;
+			/*
+			 * Backpressure: while the backlog is over the threshold, hold the caller (typically a thread
+			 * reserving native memory for a direct buffer) until the consumers have caught up, rather than
+			 * letting it retry and queue more work after every reference.
+			 */
+			if (0 != backpressureThreshold) {
+				while ((0 != vm->processReferenceActive) && (extensions->finalizeListManager->getPendingReferenceCount() > backpressureThreshold)) {
+					omrthread_monitor_wait(vm->processReferenceMonitor);
+				}
+			}
 		}
 		omrthread_monitor_exit(vm->processReferenceMonitor);
 	}
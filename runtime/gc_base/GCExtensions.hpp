@@ -51,18 +51,22 @@
 #include "ScavengerJavaStats.hpp"
 #endif /* J9VM_GC_MODRON_SCAVENGER */
 
+class MM_AllocationProfiler;
 class MM_ClassLoaderManager;
 class MM_EnvironmentBase;
 class MM_HeapMap;
 class MM_MemorySubSpace;
 class MM_ObjectAccessBarrier;
 class MM_OwnableSynchronizerObjectList;
+class MM_StringDeduplicator;
 class MM_StringTable;
 class MM_UnfinalizedObjectList;
+class MM_VerboseBinaryStream;
 class MM_Wildcard;
 
 #if defined(J9VM_GC_FINALIZATION)
 class GC_FinalizeListManager;
+class GC_FinalizeWorkerPool;
 #endif /* J9VM_GC_FINALIZATION */
 
 #if defined(J9VM_GC_REALTIME)
@@ -80,6 +84,9 @@ class MM_IdleGCManager;
 class MM_GCExtensions : public MM_GCExtensionsBase {
 public:
 	MM_StringTable* stringTable; /**< top level String Table structure (internally organized as a set of hash sub-tables */
+	MM_StringDeduplicator* stringDeduplicator; /**< background String value deduplication (NULL unless enabled and supported by the collector) */
+	MM_AllocationProfiler* allocationProfiler; /**< allocation site profile built from out-of-line allocation samples (NULL unless enabled) */
+	MM_VerboseBinaryStream* verboseBinaryStream; /**< binary GC event stream mapped to verboseBinaryFileName (NULL unless enabled) */
 
 	void* gcchkExtensions;
 
@@ -119,6 +126,14 @@ public:
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 
 	U_32 _stringTableListToTreeThreshold; /**< Threshold at which we start using trees instead of lists for collision resolution in the String table */
+	UDATA _stringTableCacheSize; /**< Number of entries (a power of two) in the lock-free interned String lookup cache in front of the String table */
+	bool stringDeduplication; /**< Queue long lived Strings to a background thread which shares identical value arrays (gencon and balanced only) */
+	UDATA stringDeduplicationAgeThreshold; /**< The balanced region age at which a copied String becomes a deduplication candidate (gencon queues Strings when they are tenured) */
+	bool allocationProfile; /**< Aggregate the out-of-line allocation samples into a class and allocation site profile */
+	UDATA allocationProfileDepth; /**< Number of stack frames recorded with each allocation sample (at most ALLOCATION_PROFILE_MAXIMUM_DEPTH) */
+	UDATA allocationProfileMaxSites; /**< Maximum number of distinct allocation sites kept in the profile */
+	char *verboseBinaryFileName; /**< File the binary GC event stream is mapped to (NULL if the stream is disabled) */
+	UDATA verboseBinaryFileSize; /**< Size of the record ring of the binary GC event stream, in bytes */
 
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 	bool fvtest_forceFinalizeClassLoaders;
@@ -128,6 +143,7 @@ public:
 	UDATA dynamicMaxSoftReferenceAge; /**< The age which represents the clearing age of soft references for a globalGC cycle.  At the end of a GC cycle, it will be updated for the following cycle by taking the percentage of free heap in the oldest generation as a fraction of the maxSoftReferenceAge */
 #if defined(J9VM_GC_FINALIZATION)
 	GC_FinalizeListManager* finalizeListManager;
+	GC_FinalizeWorkerPool* finalizeWorkerPool; /**< threads which enqueue references alongside the finalizer slave (NULL unless finalizeReferenceWorkers is set) */
 #endif /* J9VM_GC_FINALIZATION */
 
 	J9ReferenceArrayCopyTable referenceArrayCopyTable;
@@ -140,6 +156,8 @@ public:
 #if defined(J9VM_GC_FINALIZATION)
 	UDATA finalizeMasterPriority; /**< cmd line option to set finalize master thread priority */
 	UDATA finalizeSlavePriority; /**< cmd line option to set finalize slave thread priority */
+	UDATA finalizeReferenceWorkers; /**< Number of threads enqueuing references in parallel with the finalizer slave (0 leaves all jobs to the slave) */
+	UDATA finalizeBackpressureThreshold; /**< Pending reference count above which Reference.waitForReferenceProcessing() holds its caller until the backlog drains (0 disables) */
 #endif /* J9VM_GC_FINALIZATION */
 
 	MM_ClassLoaderManager* classLoaderManager; /**< Pointer to the gc's classloader manager to process classloaders/classes */
@@ -151,6 +169,7 @@ public:
 
 	MM_UnfinalizedObjectList* unfinalizedObjectLists; /**< The global linked list of unfinalized object lists. */
 	MM_OwnableSynchronizerObjectList* ownableSynchronizerObjectLists; /**< The global linked list of ownable synchronizer object lists. */
+	bool lazyOwnableSynchronizerDiscovery; /**< True if ownable synchronizers are not kept on lists, but found by a heap walk when they are asked for (see j9mm_iterate_all_ownable_synchronizer_objects) */
 
 	UDATA objectListFragmentCount; /**< the size of Local Object Buffer(per gc thread), used by referenceObjectBuffer, UnfinalizedObjectBuffer and OwnableSynchronizerObjectBuffer */
 
@@ -181,11 +200,38 @@ public:
 
 #if defined(J9VM_GC_IDLE_HEAP_MANAGER)
 	MM_IdleGCManager* idleGCManager; /**< Manager which registers for VM Runtime State notification & manages free heap on notification */
+	bool idlePageRelease; /**< True if the pages of free heap memory are returned to the operating system when the JVM goes idle */
+	UDATA idlePageReleaseMinimumSize; /**< Free ranges smaller than this are not worth releasing */
+	UDATA idlePageReleaseBatchSize; /**< Maximum bytes of heap walked while holding exclusive VM access, before giving the mutator a chance to run */
+	UDATA idlePageReleaseBatchIntervalMillis; /**< Pause between release batches, in milliseconds */
 #endif
 
 	double maxRAMPercent; /**< Value of -XX:MaxRAMPercentage specified by the user */
 	double initialRAMPercent; /**< Value of -XX:InitialRAMPercentage specified by the user */
 
+	UDATA scanPrefetchDistance; /**< The number of pointer array slots whose targets are prefetched ahead of the slot being scanned by copy-forward and marking (0 disables prefetching) */
+
+	UDATA stackScanSplitThreshold; /**< Thread stacks using at least this many bytes are split into frame-range units shared by all GC threads (0 disables splitting) */
+	UDATA stackScanUnitFrames; /**< The number of frames in each unit of a split thread stack */
+	bool stackWatermark; /**< True if a scavenge or copy-forward skips the stacks of threads which have not run since an earlier one found them holding nothing it would have to process */
+
+	bool tarokEnablePretenuring; /**< True if copy-forward should copy objects of classes which consistently survive the nursery out of Eden directly into the first tenured age */
+	UDATA tarokPretenureSurvivalThreshold; /**< Percentage of sampled Eden bytes of a class which must go on to survive the nursery before the class is pretenured */
+	UDATA tarokPretenureSampleRate; /**< One in this many copied objects (a power of two) is sampled for pretenure profiling */
+	UDATA tarokCompactCount; /**< The number of compactions run by the Balanced collector, so copy-forward can tell whether objects moved outside of its own cycles */
+
+	bool tarokEnableAdaptiveTLHSizing; /**< True if each thread's TLH refresh size is derived from its share of recent TLH allocation rather than the global TLH growth policy */
+	UDATA tarokTLHTargetRefreshes; /**< The number of TLH refreshes an adaptively sized thread is expected to need to consume its share of Eden */
+	bool tarokEnableContiguousArrayletLeaves; /**< True if the leaves of a discontiguous array are allocated from adjacent free regions, when available, so its data can be addressed directly (e.g. by JNI critical sections) */
+
+#if defined(J9VM_GC_REALTIME)
+	UDATA criticalTargetUtilizationPercentage; /**< Mutator utilization Metronome maintains while critical threads are allocating (0 disables the critical group) */
+	UDATA criticalThreadPriority; /**< Java threads at or above this priority form the critical utilization group */
+	bool adaptiveBeat; /**< True if the Metronome quantum grows from adaptiveBeatMinimumMicro towards beatMicro as allocation pressure rises */
+	UDATA adaptiveBeatMinimumMicro; /**< The shortest quantum used by adaptive beat sizing, in microseconds (0 selects a quarter of beatMicro) */
+	bool realtimeIncrementalStackScan; /**< True if Metronome may split the scan of one thread stack across quanta, holding the thread until its scan completes */
+#endif /* J9VM_GC_REALTIME */
+
 protected:
 private:
 protected:
@@ -268,6 +314,9 @@ public:
 	MM_GCExtensions()
 		: MM_GCExtensionsBase()
 		, stringTable(NULL)
+		, stringDeduplicator(NULL)
+		, allocationProfiler(NULL)
+		, verboseBinaryStream(NULL)
 		, gcchkExtensions(NULL)
 		, tgcExtensions(NULL)
 #if defined(J9VM_GC_FINALIZATION)
@@ -283,16 +332,28 @@ public:
 		, classUnloadingAnonymousClassWeight(1.0)
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 		, _stringTableListToTreeThreshold(1024)
+		, _stringTableCacheSize(4096)
+		, stringDeduplication(false)
+		, stringDeduplicationAgeThreshold(3)
+		, allocationProfile(false)
+		, allocationProfileDepth(4)
+		, allocationProfileMaxSites(4096)
+		, verboseBinaryFileName(NULL)
+		, verboseBinaryFileSize(4 * 1024 * 1024)
 		, maxSoftReferenceAge(32)
 #if defined(J9VM_GC_FINALIZATION)
+		, finalizeWorkerPool(NULL)
 		, finalizeMasterPriority(J9THREAD_PRIORITY_NORMAL)
 		, finalizeSlavePriority(J9THREAD_PRIORITY_NORMAL)
+		, finalizeReferenceWorkers(0)
+		, finalizeBackpressureThreshold(0)
 #endif /* J9VM_GC_FINALIZATION */
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 		, deadClassLoaderCacheSize(1024 * 1024) /* default is one MiB */
 #endif /* defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
 		, unfinalizedObjectLists(NULL)
 		, ownableSynchronizerObjectLists(NULL)
+		, lazyOwnableSynchronizerDiscovery(false)
 		, objectListFragmentCount(0)
 		, numaCommonThreadClassNamePatterns(NULL)
 		, stringDedupPolicy(J9_JIT_STRING_DEDUP_POLICY_UNDEFINED)
@@ -301,9 +362,31 @@ public:
 		, _HeapManagementMXBeanBackCompatibilityEnabled(false)
 #if defined(J9VM_GC_IDLE_HEAP_MANAGER)
 		, idleGCManager(NULL)
+		, idlePageRelease(false)
+		, idlePageReleaseMinimumSize(1024 * 1024)
+		, idlePageReleaseBatchSize(64 * 1024 * 1024)
+		, idlePageReleaseBatchIntervalMillis(10)
 #endif
 		, maxRAMPercent(0.0) /* this would get overwritten by user specified value */
 		, initialRAMPercent(0.0) /* this would get overwritten by user specified value */
+		, scanPrefetchDistance(8)
+		, stackScanSplitThreshold(64 * 1024)
+		, stackScanUnitFrames(256)
+		, stackWatermark(true)
+		, tarokEnablePretenuring(false)
+		, tarokPretenureSurvivalThreshold(90)
+		, tarokPretenureSampleRate(16)
+		, tarokCompactCount(0)
+		, tarokEnableAdaptiveTLHSizing(false)
+		, tarokTLHTargetRefreshes(50)
+		, tarokEnableContiguousArrayletLeaves(false)
+#if defined(J9VM_GC_REALTIME)
+		, criticalTargetUtilizationPercentage(0)
+		, criticalThreadPriority(10) /* java.lang.Thread.MAX_PRIORITY */
+		, adaptiveBeat(false)
+		, adaptiveBeatMinimumMicro(0)
+		, realtimeIncrementalStackScan(true)
+#endif /* J9VM_GC_REALTIME */
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -0,0 +1,314 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "j9.h"
+#include "j9cfg.h"
+
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+
+#include "j9port.h"
+#include "mmhook.h"
+#include "ModronAssertions.h"
+
+#include "HeapPageReleaser.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensions.hpp"
+#include "Heap.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+#include "HeapRegionDescriptor.hpp"
+#include "HeapRegionIterator.hpp"
+#include "HeapRegionManager.hpp"
+#include "Math.hpp"
+#include "MemorySubSpace.hpp"
+#include "ObjectModel.hpp"
+#include "OMRVMInterface.hpp"
+
+/* number of objects walked between checks that the JVM is still idle */
+#define HEAPPAGERELEASER_STATE_CHECK_INTERVAL 1024
+
+MM_HeapPageReleaser *
+MM_HeapPageReleaser::newInstance(MM_EnvironmentBase *env)
+{
+	MM_HeapPageReleaser *releaser = (MM_HeapPageReleaser *)env->getForge()->allocate(sizeof(MM_HeapPageReleaser), MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
+	if (NULL != releaser) {
+		new(releaser) MM_HeapPageReleaser(env);
+		if (!releaser->initialize(env)) {
+			releaser->kill(env);
+			releaser = NULL;
+		}
+	}
+	return releaser;
+}
+
+void
+MM_HeapPageReleaser::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+MM_HeapPageReleaser::MM_HeapPageReleaser(MM_EnvironmentBase *env)
+	: MM_BaseNonVirtual()
+	, _javaVM((J9JavaVM *)env->getOmrVM()->_language_vm)
+	, _extensions(MM_GCExtensions::getExtensions(env))
+	, _pageSize(0)
+	, _cursor(NULL)
+	, _cursorGCCount(0)
+	, _interrupted(false)
+	, _bytesReleased(0)
+	, _rangesReleased(0)
+{
+	_typeId = __FUNCTION__;
+}
+
+bool
+MM_HeapPageReleaser::initialize(MM_EnvironmentBase *env)
+{
+	_pageSize = _extensions->heap->getPageSize();
+	return 0 != _pageSize;
+}
+
+void
+MM_HeapPageReleaser::tearDown(MM_EnvironmentBase *env)
+{
+}
+
+UDATA
+MM_HeapPageReleaser::getGCCount()
+{
+	UDATA gcCount = 0;
+#if defined(J9VM_GC_MODRON_STANDARD) || defined(J9VM_GC_REALTIME)
+	gcCount += _extensions->globalGCStats.gcCount;
+#endif /* J9VM_GC_MODRON_STANDARD || J9VM_GC_REALTIME */
+#if defined(J9VM_GC_MODRON_SCAVENGER)
+	gcCount += _extensions->scavengerStats._gcCount;
+#endif /* J9VM_GC_MODRON_SCAVENGER */
+#if defined(J9VM_GC_VLHGC)
+	gcCount += _extensions->globalVLHGCStats.gcCount;
+#endif /* J9VM_GC_VLHGC */
+	return gcCount;
+}
+
+bool
+MM_HeapPageReleaser::checkInterrupted()
+{
+	if (!_interrupted && (J9VM_RUNTIME_STATE_ACTIVE == _javaVM->internalVMFunctions->getVMRuntimeState(_javaVM))) {
+		_interrupted = true;
+	}
+	return _interrupted;
+}
+
+bool
+MM_HeapPageReleaser::isRegionWalkable(MM_HeapRegionDescriptor *region)
+{
+	MM_MemorySubSpace *subSpace = region->getSubSpace();
+	if (NULL == subSpace) {
+		/* not part of the committed heap */
+		return false;
+	}
+	if (_extensions->scavengerEnabled && (MEMORY_TYPE_NEW == (subSpace->getTypeFlags() & MEMORY_TYPE_NEW))) {
+		/* survivor space holds stale copies rather than holes, and allocate space is handed out as TLHs */
+		return false;
+	}
+
+	switch (region->getRegionType()) {
+	case MM_HeapRegionDescriptor::ADDRESS_ORDERED:
+	case MM_HeapRegionDescriptor::ADDRESS_ORDERED_MARKED:
+		return true;
+	default:
+		/* bump pointer, segregated and arraylet regions are only released once they are entirely free */
+		return false;
+	}
+}
+
+UDATA
+MM_HeapPageReleaser::releaseRange(MM_EnvironmentBase *env, void *low, void *high)
+{
+	void *pageLow = (void *)MM_Math::roundToCeiling(_pageSize, (UDATA)low);
+	void *pageHigh = (void *)MM_Math::roundToFloor(_pageSize, (UDATA)high);
+	if (pageLow >= pageHigh) {
+		return 0;
+	}
+
+	UDATA size = (UDATA)pageHigh - (UDATA)pageLow;
+	MM_Heap *heap = _extensions->heap;
+	if (!heap->decommitMemory(pageLow, size, low, high)) {
+		return 0;
+	}
+	/* the range is still part of a free list or free region; make it addressable again (the pages are faulted back in, zero-filled, when next touched) */
+	bool recommitted = heap->commitMemory(pageLow, size);
+	Assert_MM_true(recommitted);
+
+	_rangesReleased += 1;
+	return size;
+}
+
+void *
+MM_HeapPageReleaser::releaseRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptor *region, void *start, UDATA *budget)
+{
+	void *top = region->getHighAddress();
+
+	if (MM_HeapRegionDescriptor::FREE == region->getRegionType()) {
+		if (NULL != region->getSubSpace()) {
+			_bytesReleased += releaseRange(env, start, top);
+			*budget -= OMR_MIN((UDATA)top - (UDATA)start, *budget);
+		}
+		return top;
+	}
+
+	if (!isRegionWalkable(region)) {
+		return top;
+	}
+
+	GC_ObjectModel *objectModel = &_extensions->objectModel;
+	UDATA minimumSize = _extensions->idlePageReleaseMinimumSize;
+	J9Object *object = (J9Object *)start;
+	UDATA objectsUntilCheck = HEAPPAGERELEASER_STATE_CHECK_INTERVAL;
+	while ((object < (J9Object *)top) && (0 != *budget)) {
+		UDATA size = 0;
+		if (objectModel->isDeadObject(object)) {
+			size = objectModel->getSizeInBytesDeadObject(object);
+			if (size >= minimumSize) {
+				/* do not start a release (a pair of system calls) for a JVM which is no longer idle */
+				if (checkInterrupted()) {
+					break;
+				}
+				/* keep the free entry header intact, the free list still links through it */
+				void *low = (void *)((UDATA)object + sizeof(MM_HeapLinkedFreeHeader));
+				_bytesReleased += releaseRange(env, low, (void *)((UDATA)object + size));
+			}
+		} else {
+			size = objectModel->getConsumedSizeInBytesWithHeader(object);
+		}
+		object = (J9Object *)((UDATA)object + size);
+		*budget -= OMR_MIN(size, *budget);
+
+		objectsUntilCheck -= 1;
+		if (0 == objectsUntilCheck) {
+			if (checkInterrupted()) {
+				break;
+			}
+			objectsUntilCheck = HEAPPAGERELEASER_STATE_CHECK_INTERVAL;
+		}
+	}
+
+	/* if the budget ran out or the JVM became active, the walk resumes here: the start of an object or hole, which allocation cannot disturb */
+	return (void *)OMR_MIN((UDATA)object, (UDATA)top);
+}
+
+bool
+MM_HeapPageReleaser::releaseBatch(MM_EnvironmentBase *env)
+{
+	/* make thread-local allocation caches visible as holes */
+	GC_OMRVMInterface::flushCachesForWalk(env->getOmrVM());
+
+	UDATA gcCount = getGCCount();
+	if (gcCount != _cursorGCCount) {
+		/* objects may have moved or been coalesced since the last batch, start over */
+		_cursor = NULL;
+		_cursorGCCount = gcCount;
+	}
+
+	UDATA budget = _extensions->idlePageReleaseBatchSize;
+	GC_HeapRegionIterator regionIterator(_extensions->heap->getHeapRegionManager());
+	MM_HeapRegionDescriptor *region = NULL;
+	while (NULL != (region = regionIterator.nextRegion())) {
+		void *low = region->getLowAddress();
+		void *high = region->getHighAddress();
+		if ((NULL != _cursor) && (_cursor >= high)) {
+			/* released in an earlier batch */
+			continue;
+		}
+		void *start = ((NULL != _cursor) && (_cursor > low)) ? _cursor : low;
+		if ((0 == budget) || checkInterrupted()) {
+			_cursor = start;
+			return false;
+		}
+		_cursor = releaseRegion(env, region, start, &budget);
+		if ((_cursor < high) || _interrupted) {
+			return false;
+		}
+	}
+
+	_cursor = NULL;
+	return true;
+}
+
+void
+MM_HeapPageReleaser::releaseFreePages(MM_EnvironmentBase *env)
+{
+	PORT_ACCESS_FROM_ENVIRONMENT(env);
+	J9VMThread *vmThread = (J9VMThread *)env->getLanguageVMThread();
+	J9InternalVMFunctions const * const vmFuncs = _javaVM->internalVMFunctions;
+
+	U_64 rssBefore = 0;
+	U_64 rssAfter = 0;
+	if (0 != j9vmem_get_process_memory_size(J9PORT_VMEM_PROCESS_PHYSICAL, &rssBefore)) {
+		rssBefore = 0;
+	}
+	U_64 startTime = j9time_hires_clock();
+
+	_bytesReleased = 0;
+	_rangesReleased = 0;
+	_cursor = NULL;
+	_cursorGCCount = getGCCount();
+	_interrupted = false;
+	UDATA batches = 0;
+	bool done = false;
+
+	while (!done) {
+		if (checkInterrupted()) {
+			break;
+		}
+		vmFuncs->internalAcquireVMAccess(vmThread);
+		env->acquireExclusiveVMAccess();
+		done = releaseBatch(env);
+		env->releaseExclusiveVMAccess();
+		vmFuncs->internalReleaseVMAccess(vmThread);
+		batches += 1;
+
+		if (!done) {
+			omrthread_sleep(_extensions->idlePageReleaseBatchIntervalMillis);
+		}
+	}
+
+	U_64 endTime = j9time_hires_clock();
+	if (0 != j9vmem_get_process_memory_size(J9PORT_VMEM_PROCESS_PHYSICAL, &rssAfter)) {
+		rssAfter = 0;
+	}
+
+	TRIGGER_J9HOOK_MM_IDLE_PAGE_RELEASE(
+		_extensions->hookInterface,
+		vmThread,
+		endTime,
+		J9HOOK_MM_IDLE_PAGE_RELEASE,
+		_bytesReleased,
+		_rangesReleased,
+		batches,
+		rssBefore,
+		rssAfter,
+		j9time_hires_delta(startTime, endTime, J9PORT_TIME_DELTA_IN_MICROSECONDS),
+		_interrupted ? 1 : 0);
+}
+
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
@@ -0,0 +1,124 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(HEAPPAGERELEASER_HPP_)
+#define HEAPPAGERELEASER_HPP_
+
+#include "j9.h"
+#include "j9cfg.h"
+
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+
+#include "BaseNonVirtual.hpp"
+
+class MM_EnvironmentBase;
+class MM_GCExtensions;
+class MM_HeapRegionDescriptor;
+
+/**
+ * Returns the physical pages backing free heap memory to the operating system once the JVM has gone idle.
+ * The heap is walked in batches; each batch holds exclusive VM access only long enough to walk
+ * idlePageReleaseBatchSize bytes of heap, and the walk stops as soon as the JVM becomes active again.
+ * Released ranges stay committed: the pages are decommitted and immediately recommitted, so the next
+ * allocation that touches them simply faults in zero-filled pages.
+ * @ingroup GC_Base
+ */
+class MM_HeapPageReleaser : public MM_BaseNonVirtual
+{
+private:
+	J9JavaVM *_javaVM; /**< The VM */
+	MM_GCExtensions *_extensions; /**< GC extensions */
+	UDATA _pageSize; /**< Granularity of release */
+	void *_cursor; /**< Heap address the next batch resumes its walk from (NULL to start at the bottom of the heap) */
+	UDATA _cursorGCCount; /**< GC count when _cursor was recorded; a collection in between invalidates the cursor */
+	bool _interrupted; /**< Set once the JVM was seen to become active, which ends the release */
+
+	/* statistics for the current release */
+	UDATA _bytesReleased; /**< Bytes released so far */
+	UDATA _rangesReleased; /**< Free ranges released so far */
+
+public:
+	/**
+	 * Release free heap pages, batch by batch, until the whole heap has been walked or the JVM becomes active.
+	 * The caller must be an attached thread that does not hold VM access.
+	 * Reports J9HOOK_MM_IDLE_PAGE_RELEASE when done.
+	 * @param env[in] the current thread
+	 */
+	void releaseFreePages(MM_EnvironmentBase *env);
+
+	static MM_HeapPageReleaser *newInstance(MM_EnvironmentBase *env);
+	void kill(MM_EnvironmentBase *env);
+
+	MM_HeapPageReleaser(MM_EnvironmentBase *env);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+private:
+	/**
+	 * Walk up to idlePageReleaseBatchSize bytes of heap starting at _cursor, releasing the free ranges found.
+	 * Stops early, setting _interrupted, if the JVM becomes active.  Must be called with exclusive VM access.
+	 * @param env[in] the current thread
+	 * @return true if the end of the heap was reached
+	 */
+	bool releaseBatch(MM_EnvironmentBase *env);
+
+	/**
+	 * Release the free ranges in one region, starting at the given address.
+	 * @param env[in] the current thread
+	 * @param region[in] the region to walk
+	 * @param start[in] the first address to consider (the region base, or a resumed cursor inside the region)
+	 * @param budget[in/out] bytes still allowed to be walked in this batch
+	 * @return the address the walk stopped at (the top of the region if it was completed)
+	 */
+	void *releaseRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptor *region, void *start, UDATA *budget);
+
+	/**
+	 * Release the whole pages contained in [low, high).
+	 * @return the number of bytes released
+	 */
+	UDATA releaseRange(MM_EnvironmentBase *env, void *low, void *high);
+
+	/**
+	 * @return true if the free memory of the region can be found by walking it and is not in use by an allocator
+	 */
+	bool isRegionWalkable(MM_HeapRegionDescriptor *region);
+
+	/**
+	 * @return true, setting _interrupted, if the JVM has become active and the release should stop
+	 */
+	bool checkInterrupted();
+
+	/**
+	 * @return the total number of collections of any kind, used to detect that the heap moved under a cursor
+	 */
+	UDATA getGCCount();
+};
+
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
+#endif /* HEAPPAGERELEASER_HPP_ */
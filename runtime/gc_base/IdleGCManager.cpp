@@ -33,6 +33,7 @@
 #include "GCExtensions.hpp"
 #include "OMRVMInterface.hpp"
 #include "Heap.hpp"
+#include "HeapPageReleaser.hpp"
 
 MM_IdleGCManager *
 MM_IdleGCManager::newInstance(MM_EnvironmentBase* env)
@@ -62,11 +63,24 @@ MM_IdleGCManager::tearDown(MM_EnvironmentBase* env)
 	if (NULL != hookInterface) {
 		(*hookInterface)->J9HookUnregister(hookInterface, J9HOOK_VM_RUNTIME_STATE_CHANGED, idleGCManagerVMStateHook, this);
 	}
+	if (NULL != _pageReleaser) {
+		_pageReleaser->kill(env);
+		_pageReleaser = NULL;
+	}
 }
 
 bool
 MM_IdleGCManager::initialize(MM_EnvironmentBase* env)
 {
+	MM_GCExtensions* extensions = MM_GCExtensions::getExtensions(env);
+	_gcOnIdle = (extensions->gcOnIdle || extensions->compactOnIdle) && (gc_policy_gencon == extensions->configurationOptions._gcPolicy);
+	if (extensions->idlePageRelease) {
+		_pageReleaser = MM_HeapPageReleaser::newInstance(env);
+		if (NULL == _pageReleaser) {
+			return false;
+		}
+	}
+
 	J9HookInterface** hookInterface = _javaVM->internalVMFunctions->getVMHookInterface(_javaVM);
 	if (NULL != hookInterface && (*hookInterface)->J9HookRegister(hookInterface, J9HOOK_VM_RUNTIME_STATE_CHANGED, idleGCManagerVMStateHook, this)) {
 		return false;
@@ -80,9 +94,16 @@ MM_IdleGCManager::manageFreeHeap(J9VMThread* currentThread)
 	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(currentThread->omrVMThread);
 	MM_GCExtensions* _extensions = MM_GCExtensions::getExtensions(env);
 
-	_javaVM->internalVMFunctions->internalAcquireVMAccess(currentThread);
-	_extensions->heap->systemGarbageCollect(env, J9MMCONSTANT_EXPLICIT_GC_IDLE_GC);
-	_javaVM->internalVMFunctions->internalReleaseVMAccess(currentThread);
+	if (_gcOnIdle) {
+		_javaVM->internalVMFunctions->internalAcquireVMAccess(currentThread);
+		_extensions->heap->systemGarbageCollect(env, J9MMCONSTANT_EXPLICIT_GC_IDLE_GC);
+		_javaVM->internalVMFunctions->internalReleaseVMAccess(currentThread);
+	}
+
+	if (NULL != _pageReleaser) {
+		/* runs on the runtime state listener thread, so the release does not hold up the idle transition of any mutator */
+		_pageReleaser->releaseFreePages(env);
+	}
 }
 
 extern "C" {
@@ -34,6 +34,8 @@
 #include "EnvironmentBase.hpp"
 #include "GCExtensions.hpp"
 
+class MM_HeapPageReleaser;
+
 extern "C" {
 /**
  * Hook "J9HOOK_VM_RUNTIME_STATE_CHANGED" callback function
@@ -52,6 +54,14 @@ private:
 	 * reference to the language runtime
 	 */
 	J9JavaVM* _javaVM;
+	/*
+	 * true if an idle GC should be performed on idle (only supported by gencon)
+	 */
+	bool _gcOnIdle;
+	/*
+	 * releases free heap pages on idle (NULL if -XXgc:idlePageRelease is not enabled)
+	 */
+	MM_HeapPageReleaser* _pageReleaser;
 
 protected:
 public:
@@ -86,6 +96,8 @@ public:
 	MM_IdleGCManager(MM_EnvironmentBase* env)
 		: MM_BaseNonVirtual()
 		, _javaVM((J9JavaVM*)env->getOmrVM()->_language_vm)
+		, _gcOnIdle(false)
+		, _pageReleaser(NULL)
 	{
 		_typeId = __FUNCTION__;
 	}
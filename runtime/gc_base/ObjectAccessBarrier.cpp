@@ -31,6 +31,8 @@
 #include "j9protos.h"
 #include "rommeth.h"
 
+#include <string.h>
+
 #include "ArrayletObjectModel.hpp"
 #include "AtomicOperations.hpp"
 #include "HeapRegionManager.hpp"
@@ -1410,12 +1412,21 @@ MM_ObjectAccessBarrier::copyObjectFields(J9VMThread *vmThread, J9Class *objectCl
 		}
 	}
 
+	/* consecutive reference slots are gathered into runs so that each run is covered by a single bulk barrier */
+	UDATA runOffset = 0;
+	UDATA runLength = 0;
 	while (offset < limit) {
 		/* Determine if the slot contains an object pointer or not */
 		if(descriptionBits & 1) {
-			J9Object *objectPtr = mixedObjectReadObject(vmThread, srcObject, srcOffset + offset, false);
-			mixedObjectStoreObject(vmThread, destObject, destOffset + offset, objectPtr, false);
+			if (0 == runLength) {
+				runOffset = offset;
+			}
+			runLength += 1;
 		} else {
+			if (0 != runLength) {
+				copyObjectFieldRun(vmThread, srcObject, srcOffset + runOffset, destObject, destOffset + runOffset, runLength);
+				runLength = 0;
+			}
 			*(fj9object_t *)((UDATA)destObject + destOffset + offset) = *(fj9object_t *)((UDATA)srcObject + srcOffset + offset);
 		}
 		descriptionBits >>= 1;
@@ -1425,6 +1436,9 @@ MM_ObjectAccessBarrier::copyObjectFields(J9VMThread *vmThread, J9Class *objectCl
 		}
 		offset += sizeof(fj9object_t);
 	}
+	if (0 != runLength) {
+		copyObjectFieldRun(vmThread, srcObject, srcOffset + runOffset, destObject, destOffset + runOffset, runLength);
+	}
 
 	if (!isValueType) {
 		/* If an object was pre-hashed and a hash was stored within the fields of the object restore it.*/
@@ -1450,6 +1464,28 @@ MM_ObjectAccessBarrier::copyObjectFields(J9VMThread *vmThread, J9Class *objectCl
 	}
 }
 
+/**
+ * Copy a run of consecutive reference fields from one object to another, using the bulk store
+ * barriers if the current barrier supports them and a read and store barrier per field otherwise.
+ * @param srcOffset the offset of the first field in srcObject
+ * @param destOffset the offset of the first field in destObject
+ * @param slotCount the number of reference fields in the run
+ */
+void
+MM_ObjectAccessBarrier::copyObjectFieldRun(J9VMThread *vmThread, J9Object *srcObject, UDATA srcOffset, J9Object *destObject, UDATA destOffset, UDATA slotCount)
+{
+	fj9object_t *srcAddress = (fj9object_t *)((UDATA)srcObject + srcOffset);
+	fj9object_t *destAddress = (fj9object_t *)((UDATA)destObject + destOffset);
+
+	if (!copyObjectSlotRange(vmThread, srcAddress, destObject, destAddress, slotCount)) {
+		for (UDATA slot = 0; slot < slotCount; slot++) {
+			UDATA slotOffset = slot * sizeof(fj9object_t);
+			J9Object *objectPtr = mixedObjectReadObject(vmThread, srcObject, srcOffset + slotOffset, false);
+			mixedObjectStoreObject(vmThread, destObject, destOffset + slotOffset, objectPtr, false);
+		}
+	}
+}
+
 /**
  * Copy all of the fields of an indexable object into another indexable object.
  * The new object was just allocated inside the VM, so all fields are NULL.
@@ -1468,9 +1504,17 @@ MM_ObjectAccessBarrier::cloneIndexableObject(J9VMThread *vmThread, J9IndexableOb
 	
 	if (isObjectArray) {
 		I_32 size = (I_32)_extensions->indexableObjectModel.getSizeInElements(srcObject);
-		for (I_32 i = 0; i < size; i++) {
-			J9Object *objectPtr = J9JAVAARRAYOFOBJECT_LOAD(vmThread, srcObject, i);
-			J9JAVAARRAYOFOBJECT_STORE(vmThread, destObject, i, objectPtr);
+		bool copied = false;
+		if (_extensions->indexableObjectModel.isInlineContiguousArraylet(srcObject) && _extensions->indexableObjectModel.isInlineContiguousArraylet(destObject)) {
+			fj9object_t *srcAddress = (fj9object_t *)_extensions->indexableObjectModel.getDataPointerForContiguous(srcObject);
+			fj9object_t *destAddress = (fj9object_t *)_extensions->indexableObjectModel.getDataPointerForContiguous(destObject);
+			copied = copyObjectSlotRange(vmThread, srcAddress, (J9Object *)destObject, destAddress, (UDATA)size);
+		}
+		if (!copied) {
+			for (I_32 i = 0; i < size; i++) {
+				J9Object *objectPtr = J9JAVAARRAYOFOBJECT_LOAD(vmThread, srcObject, i);
+				J9JAVAARRAYOFOBJECT_STORE(vmThread, destObject, i, objectPtr);
+			}
 		}
 	} else {
 		_extensions->indexableObjectModel.memcpyArray(destObject, srcObject);
@@ -1903,6 +1947,56 @@ MM_ObjectAccessBarrier::preBatchObjectStore(J9VMThread *vmThread, J9Class *destC
 	return true;
 }
 
+/**
+ * Called before a contiguous run of reference slots within destObject is overwritten in bulk
+ * (arraycopy, clone).  Barriers that can cover the whole run at once (e.g. logging every
+ * overwritten value for a snapshot barrier) do so here and return true; the caller then copies
+ * the raw slots and calls postObjectStoreRange().  The default implementation does not support
+ * bulk stores, and the caller must fall back to a barrier per slot.
+ * @param destObject the object containing the slots
+ * @param destAddress the address of the first slot to be overwritten
+ * @param slotCount the number of consecutive reference slots to be overwritten
+ * @return true if the slots may be copied without per-slot barriers, false otherwise
+ */
+bool
+MM_ObjectAccessBarrier::preObjectStoreRange(J9VMThread *vmThread, J9Object *destObject, fj9object_t *destAddress, UDATA slotCount)
+{
+	return false;
+}
+
+/**
+ * Called after a contiguous run of reference slots within destObject has been overwritten in bulk.
+ * Only called if the matching preObjectStoreRange() returned true.
+ * @param destObject the object containing the slots
+ * @param destAddress the address of the first slot that was overwritten
+ * @param slotCount the number of consecutive reference slots that were overwritten
+ */
+void
+MM_ObjectAccessBarrier::postObjectStoreRange(J9VMThread *vmThread, J9Object *destObject, fj9object_t *destAddress, UDATA slotCount)
+{
+}
+
+/**
+ * Copy a contiguous run of reference slots using the bulk store barriers.  The source and destination
+ * may overlap.  Nothing is copied if the barrier does not support bulk stores in its current state.
+ * @param srcAddress the address of the first slot to copy from
+ * @param destObject the object containing the destination slots
+ * @param destAddress the address of the first slot to copy to
+ * @param slotCount the number of slots to copy
+ * @return true if the slots were copied, false if the caller must copy them one slot at a time
+ */
+bool
+MM_ObjectAccessBarrier::copyObjectSlotRange(J9VMThread *vmThread, fj9object_t *srcAddress, J9Object *destObject, fj9object_t *destAddress, UDATA slotCount)
+{
+	bool copied = false;
+	if (preObjectStoreRange(vmThread, destObject, destAddress, slotCount)) {
+		memmove(destAddress, srcAddress, slotCount * sizeof(fj9object_t));
+		postObjectStoreRange(vmThread, destObject, destAddress, slotCount);
+		copied = true;
+	}
+	return copied;
+}
+
 bool
 MM_ObjectAccessBarrier::preObjectRead(J9VMThread *vmThread, J9Object *srcObject, fj9object_t *srcAddress)
 {
@@ -2025,6 +2119,23 @@ MM_ObjectAccessBarrier::doCopyContiguousForward(J9VMThread *vmThread, J9Indexabl
 	
 	return ARRAY_COPY_SUCCESSFUL;	
 }
+
+/**
+ * Copy between contiguous reference arrays, covering the whole destination range with the bulk
+ * store barriers instead of a barrier per element.  The ranges may overlap.
+ * @return ARRAY_COPY_SUCCESSFUL if the copy was done, ARRAY_COPY_NOT_DONE if the barrier does not support bulk stores
+ */
+I_32
+MM_ObjectAccessBarrier::doCopyContiguousWithRangeBarriers(J9VMThread *vmThread, J9IndexableObject *srcObject, J9IndexableObject *destObject, I_32 srcIndex, I_32 destIndex, I_32 lengthInSlots)
+{
+	fj9object_t *srcSlot = (fj9object_t *)indexableEffectiveAddress(vmThread, srcObject, srcIndex, sizeof(fj9object_t));
+	fj9object_t *destSlot = (fj9object_t *)indexableEffectiveAddress(vmThread, destObject, destIndex, sizeof(fj9object_t));
+
+	if (copyObjectSlotRange(vmThread, srcSlot, (J9Object *)destObject, destSlot, (UDATA)lengthInSlots)) {
+		return ARRAY_COPY_SUCCESSFUL;
+	}
+	return ARRAY_COPY_NOT_DONE;
+}
 #endif /* J9VM_GC_ARRAYLETS */
 
 I_32
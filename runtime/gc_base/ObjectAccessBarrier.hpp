@@ -78,6 +78,8 @@ private:
 		return (fj9object_t*)((UDATA)object + fieldOffset);
 	}
 
+	void copyObjectFieldRun(J9VMThread *vmThread, J9Object *srcObject, UDATA srcOffset, J9Object *destObject, UDATA destOffset, UDATA slotCount);
+
 protected:
 	virtual bool initialize(MM_EnvironmentBase *env);
 	virtual void tearDown(MM_EnvironmentBase *env);
@@ -206,6 +208,7 @@ public:
 	};
 	virtual I_32 doCopyContiguousForward(J9VMThread *vmThread, J9IndexableObject *srcObject, J9IndexableObject *destObject, I_32 srcIndex, I_32 destIndex, I_32 lengthInSlots);	
 	virtual I_32 doCopyContiguousBackward(J9VMThread *vmThread, J9IndexableObject *srcObject, J9IndexableObject *destObject, I_32 srcIndex, I_32 destIndex, I_32 lengthInSlots);	
+	I_32 doCopyContiguousWithRangeBarriers(J9VMThread *vmThread, J9IndexableObject *srcObject, J9IndexableObject *destObject, I_32 srcIndex, I_32 destIndex, I_32 lengthInSlots);
 	virtual I_32 backwardReferenceArrayCopyIndex(J9VMThread *vmThread, J9IndexableObject *srcObject, J9IndexableObject *destObject, I_32 srcIndex, I_32 destIndex, I_32 lengthInSlots) { return -2; }
 	virtual I_32 forwardReferenceArrayCopyIndex(J9VMThread *vmThread, J9IndexableObject *srcObject, J9IndexableObject *destObject, I_32 srcIndex, I_32 destIndex, I_32 lengthInSlots) { return -2; }
 #endif	
@@ -257,6 +260,10 @@ public:
 	virtual bool preBatchObjectStore(J9VMThread *vmThread, J9Object *destObject, bool isVolatile=false);
 	virtual bool preBatchObjectStore(J9VMThread *vmThread, J9Class *destClass, bool isVolatile=false);
 
+	virtual bool preObjectStoreRange(J9VMThread *vmThread, J9Object *destObject, fj9object_t *destAddress, UDATA slotCount);
+	virtual void postObjectStoreRange(J9VMThread *vmThread, J9Object *destObject, fj9object_t *destAddress, UDATA slotCount);
+	bool copyObjectSlotRange(J9VMThread *vmThread, fj9object_t *srcAddress, J9Object *destObject, fj9object_t *destAddress, UDATA slotCount);
+
 	virtual bool preObjectRead(J9VMThread *vmThread, J9Object *srcObject, fj9object_t *srcAddress);
 	virtual bool preObjectRead(J9VMThread *vmThread, J9Class *srcClass, j9object_t *srcAddress);
 	virtual bool preMonitorTableSlotRead(J9VMThread *vmThread, j9object_t *srcAddress);
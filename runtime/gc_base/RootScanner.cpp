@@ -34,6 +34,7 @@
 
 #include "RootScanner.hpp"
 
+#include "AtomicOperations.hpp"
 #include "ClassIterator.hpp"
 #include "ClassHeapIterator.hpp"
 #include "ClassLoaderIterator.hpp"
@@ -62,10 +63,20 @@
 #include "StringTableIncrementalIterator.hpp"
 #include "Task.hpp"
 #include "UnfinalizedObjectList.hpp"
+#include "VMAccess.hpp"
 #include "VMClassSlotIterator.hpp"
 #include "VMInterface.hpp"
 #include "VMThreadListIterator.hpp"
 #include "VMThreadIterator.hpp"
+#include "VMThreadStackSlotIterator.hpp"
+
+/* A split stack has at most this many units, so the walk states at the unit boundaries fit in a fixed buffer */
+#define STACK_SCAN_MAX_UNITS 64
+/* The claim token of a split stack holds the unit count above this bit and the index of the next unit below it */
+#define STACK_SCAN_TOKEN_SHIFT 16
+#define STACK_SCAN_TOKEN(unitCount, nextUnit) (((UDATA)(unitCount) << STACK_SCAN_TOKEN_SHIFT) | (UDATA)(nextUnit))
+#define STACK_SCAN_TOKEN_UNIT_COUNT(token) ((UDATA)(token) >> STACK_SCAN_TOKEN_SHIFT)
+#define STACK_SCAN_TOKEN_NEXT_UNIT(token) ((UDATA)(token) & (((UDATA)1 << STACK_SCAN_TOKEN_SHIFT) - 1))
 
 /**
  * @todo Provide function documentation
@@ -471,6 +482,15 @@ MM_RootScanner::scanThreads(MM_EnvironmentBase *env)
 	localData.rootScanner = this;
 	localData.env = env;
 
+	/* A deep stack claimed by one thread would hold up the rest of the task, so deep stacks are split
+	 * into units which every thread helps to scan once it runs out of threads to claim.
+	 */
+	_splitThreadStacks = !_singleThread
+		&& !_trackVisibleStackFrameDepth
+		&& (0 != _extensions->stackScanSplitThreshold)
+		&& (NULL != env->_currentTask)
+		&& (1 < env->_currentTask->getThreadCount());
+
 	while(J9VMThread *walkThread = vmThreadListIterator.nextVMThread()) {
 		if (_singleThread || J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
 			if (scanOneThread(env, walkThread, (void*) &localData)) {
@@ -479,6 +499,11 @@ MM_RootScanner::scanThreads(MM_EnvironmentBase *env)
 		}
 	}
 
+	if (_splitThreadStacks) {
+		scanSplitThreadStacks(env, (void*) &localData);
+		_splitThreadStacks = false;
+	}
+
 	reportScanningEnded(RootScannerEntity_Threads);
 }
 
@@ -497,15 +522,182 @@ MM_RootScanner::scanThreads(MM_EnvironmentBase *env)
  **/
 bool
 MM_RootScanner::scanOneThread(MM_EnvironmentBase *env, J9VMThread* walkThread, void* localData)
+{
+	scanThreadSlots(walkThread);
+	scanThreadStack(env, walkThread, localData);
+	return false;
+}
+
+void
+MM_RootScanner::scanThreadSlots(J9VMThread *walkThread)
 {
 	GC_VMThreadIterator vmThreadIterator(walkThread);
 
 	while(J9Object **slot = vmThreadIterator.nextSlot()) {
 		doVMThreadSlot(slot, &vmThreadIterator);
 	}
+}
+
+bool
+MM_RootScanner::scanThreadStack(MM_EnvironmentBase *env, J9VMThread *walkThread, void *localData)
+{
+	if (_splitThreadStacks && (0 != splitThreadStack(env, walkThread))) {
+		return false;
+	}
 
+	U_64 startTime = 0;
+	if (_extensions->rootScannerStatsEnabled) {
+		OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
+		startTime = omrtime_hires_clock();
+	}
 	GC_VMThreadStackSlotIterator::scanSlots((J9VMThread *)env->getOmrVMThread()->_language_vmthread, walkThread, localData, stackSlotIterator, isStackFrameClassWalkNeeded(), _trackVisibleStackFrameDepth);
-	return false;
+	reportThreadStackScanned(walkThread, startTime, 1);
+	return true;
+}
+
+UDATA
+MM_RootScanner::splitThreadStack(MM_EnvironmentBase *env, J9VMThread *walkThread)
+{
+	if (((UDATA)walkThread->stackObject->end - (UDATA)walkThread->sp) < _extensions->stackScanSplitThreshold) {
+		return 0;
+	}
+
+	GC_Environment *gcEnv = MM_EnvironmentBase::getEnvironment(walkThread->omrVMThread)->getGCEnvironment();
+	if (NULL == gcEnv->_stackScanSplitStates) {
+		gcEnv->_stackScanSplitStates = (J9StackWalkState *)env->getForge()->allocate(sizeof(J9StackWalkState) * (STACK_SCAN_MAX_UNITS - 1), MM_AllocationCategory::OTHER, J9_GET_CALLSITE());
+		if (NULL == gcEnv->_stackScanSplitStates) {
+			/* Not fatal, the stack is just scanned in one go */
+			return 0;
+		}
+	}
+
+	U_64 startTime = 0;
+	if (_extensions->rootScannerStatsEnabled) {
+		OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
+		startTime = omrtime_hires_clock();
+	}
+	UDATA unitCount = GC_VMThreadStackSlotIterator::splitStack((J9VMThread *)env->getOmrVMThread()->_language_vmthread, walkThread, gcEnv->_stackScanSplitStates, STACK_SCAN_MAX_UNITS - 1, _extensions->stackScanUnitFrames);
+	reportThreadStackScanned(walkThread, startTime, 0);
+
+	if (0 != unitCount) {
+		if (_extensions->rootScannerStatsEnabled) {
+			gcEnv->_stackScanSplits += 1;
+		}
+		/* The walk states must be visible before any of the units can be claimed */
+		MM_AtomicOperations::storeSync();
+		gcEnv->_stackScanClaimToken = STACK_SCAN_TOKEN(unitCount, 0);
+	}
+	return unitCount;
+}
+
+void
+MM_RootScanner::scanThreadStackUnits(MM_EnvironmentBase *env, J9VMThread *walkThread, void *localData)
+{
+	GC_Environment *gcEnv = MM_EnvironmentBase::getEnvironment(walkThread->omrVMThread)->getGCEnvironment();
+	UDATA token = gcEnv->_stackScanClaimToken;
+
+	while (STACK_SCAN_TOKEN_NEXT_UNIT(token) < STACK_SCAN_TOKEN_UNIT_COUNT(token)) {
+		UDATA oldToken = MM_AtomicOperations::lockCompareExchange(&gcEnv->_stackScanClaimToken, token, token + 1);
+		if (oldToken != token) {
+			token = oldToken;
+			continue;
+		}
+		MM_AtomicOperations::loadSync();
+
+		UDATA unitCount = STACK_SCAN_TOKEN_UNIT_COUNT(token);
+		UDATA unit = STACK_SCAN_TOKEN_NEXT_UNIT(token);
+		J9StackWalkState *startState = (0 == unit) ? NULL : &gcEnv->_stackScanSplitStates[unit - 1];
+		UDATA endFrame = ((unit + 1) == unitCount) ? 0 : gcEnv->_stackScanSplitStates[unit].framesWalked;
+
+		U_64 startTime = 0;
+		if (_extensions->rootScannerStatsEnabled) {
+			OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
+			startTime = omrtime_hires_clock();
+		}
+		GC_VMThreadStackSlotIterator::scanSlotsInRange((J9VMThread *)env->getOmrVMThread()->_language_vmthread, walkThread, startState, endFrame, localData, stackSlotIterator, isStackFrameClassWalkNeeded());
+		reportThreadStackScanned(walkThread, startTime, 1);
+
+		token = gcEnv->_stackScanClaimToken;
+	}
+}
+
+void
+MM_RootScanner::scanSplitThreadStacks(MM_EnvironmentBase *env, void *localData)
+{
+	/* A thread which gets here before the owner of a stack has split it simply misses those units,
+	 * the owner itself comes through here after publishing them so no unit is left unscanned.
+	 */
+	GC_VMThreadListIterator vmThreadListIterator(static_cast<J9JavaVM*>(_omrVM->_language_vm));
+
+	while(J9VMThread *walkThread = vmThreadListIterator.nextVMThread()) {
+		scanThreadStackUnits(env, walkThread, localData);
+	}
+}
+
+void
+MM_RootScanner::reportThreadStackScanned(J9VMThread *walkThread, U_64 startTime, UDATA units)
+{
+	if (_extensions->rootScannerStatsEnabled) {
+		OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
+		U_64 endTime = omrtime_hires_clock();
+		GC_Environment *gcEnv = MM_EnvironmentBase::getEnvironment(walkThread->omrVMThread)->getGCEnvironment();
+
+		/* Units of one stack may be scanned by several threads at once */
+		if (endTime > startTime) {
+			MM_AtomicOperations::addU64(&gcEnv->_stackScanTime, endTime - startTime);
+		}
+		if (0 != units) {
+			MM_AtomicOperations::add(&gcEnv->_stackScanUnits, units);
+		}
+	}
+}
+
+void
+MM_RootScanner::reportThreadStackSkipped(J9VMThread *walkThread)
+{
+	if (_extensions->rootScannerStatsEnabled) {
+		GC_Environment *gcEnv = MM_EnvironmentBase::getEnvironment(walkThread->omrVMThread)->getGCEnvironment();
+		gcEnv->_stackScanSkips += 1;
+	}
+}
+
+bool
+MM_RootScanner::isThreadStackWatermarked(J9VMThread *walkThread, UDATA epoch)
+{
+	J9JavaVM *javaVM = static_cast<J9JavaVM*>(_omrVM->_language_vm);
+
+	if ((0 == epoch) || J9_ARE_ANY_BITS_SET(javaVM->requiredDebugAttributes, J9VM_DEBUG_ATTRIBUTE_CAN_ACCESS_LOCALS)) {
+		return false;
+	}
+	GC_Environment *gcEnv = MM_EnvironmentBase::getEnvironment(walkThread->omrVMThread)->getGCEnvironment();
+	return epoch == gcEnv->_stackWatermark;
+}
+
+void
+MM_RootScanner::setThreadStackWatermark(J9VMThread *walkThread, UDATA epoch)
+{
+	J9JavaVM *javaVM = static_cast<J9JavaVM*>(_omrVM->_language_vm);
+	GC_Environment *gcEnv = MM_EnvironmentBase::getEnvironment(walkThread->omrVMThread)->getGCEnvironment();
+
+	/* The thread holding VM access for this collection returns to Java code without reacquiring it.  A thread
+	 * in native code under atomic-free JNI still has the access bit set, but has to reacquire to return.
+	 * JVMTI agents able to set locals could change a stack without the thread running.
+	 */
+	bool mustReacquireAccess = J9_ARE_NO_BITS_SET(walkThread->publicFlags, J9_PUBLIC_FLAGS_VM_ACCESS);
+#if defined(J9VM_INTERP_ATOMIC_FREE_JNI)
+	mustReacquireAccess = mustReacquireAccess || (0 != walkThread->inNative);
+#endif /* J9VM_INTERP_ATOMIC_FREE_JNI */
+
+	if ((0 != epoch)
+		&& mustReacquireAccess
+		&& _extensions->stackWatermark
+		&& J9_ARE_NO_BITS_SET(javaVM->requiredDebugAttributes, J9VM_DEBUG_ATTRIBUTE_CAN_ACCESS_LOCALS)
+	) {
+		gcEnv->_stackWatermark = epoch;
+		VM_VMAccess::setPublicFlags(walkThread, J9_PUBLIC_FLAGS_DISABLE_INLINE_VM_ACCESS_ACQUIRE);
+	} else {
+		gcEnv->_stackWatermark = 0;
+	}
 }
 
 /**
@@ -623,11 +815,18 @@ MM_RootScanner::scanStringTable(MM_EnvironmentBase *env)
 		}
 	}
 
-	if(_singleThread || J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
-		j9object_t *stringCacheTable = stringTable->getStringInternCache();
-		UDATA cacheTableIndex = 0;
-		for (; cacheTableIndex < MM_StringTable::getCacheSize(); cacheTableIndex++) {
-			doStringCacheTableSlot(&stringCacheTable[cacheTableIndex]);
+	/* The cache is cleaned in chunks so that parallel threads can share it and metronome can yield between them */
+	j9object_t *stringCacheTable = stringTable->getStringInternCache();
+	UDATA cacheSize = stringTable->getCacheSize();
+	for (UDATA chunkStart = 0; chunkStart < cacheSize; chunkStart += MM_StringTable::cacheScanChunkSize) {
+		if(_singleThread || J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			UDATA chunkEnd = OMR_MIN(chunkStart + MM_StringTable::cacheScanChunkSize, cacheSize);
+			for (UDATA cacheTableIndex = chunkStart; cacheTableIndex < chunkEnd; cacheTableIndex++) {
+				doStringCacheTableSlot(&stringCacheTable[cacheTableIndex]);
+			}
+			if (isMetronomeGC && shouldYieldFromStringScan()) {
+				yield();
+			}
 		}
 	}
 
@@ -825,29 +1024,30 @@ MM_RootScanner::scanRememberedSet(MM_EnvironmentBase *env)
 void
 MM_RootScanner::scanJVMTIObjectTagTables(MM_EnvironmentBase *env)
 {
-	if(_singleThread || J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
-		reportScanningStarted(RootScannerEntity_JVMTIObjectTagTables);
-
-		J9JVMTIData * jvmtiData = J9JVMTI_DATA_FROM_VM(static_cast<J9JavaVM*>(_omrVM->_language_vm));
-		J9JVMTIEnv * jvmtiEnv;
-		J9Object **slotPtr;
-		if (NULL != jvmtiData) {
-			/* TODO: When JVMTI is supported in RTSJ, this structure needs to be locked
-			 * when it is being scanned
-			 */
-			GC_JVMTIObjectTagTableListIterator objectTagTableList(jvmtiData->environments);
-			while(NULL != (jvmtiEnv = (J9JVMTIEnv *)objectTagTableList.nextSlot())) {
-				if (NULL != jvmtiEnv->objectTagTable) {
-					GC_JVMTIObjectTagTableIterator objectTagTableIterator(jvmtiEnv->objectTagTable);
+	reportScanningStarted(RootScannerEntity_JVMTIObjectTagTables);
+
+	J9JVMTIData * jvmtiData = J9JVMTI_DATA_FROM_VM(static_cast<J9JavaVM*>(_omrVM->_language_vm));
+	J9JVMTIEnv * jvmtiEnv;
+	J9Object **slotPtr;
+	if (NULL != jvmtiData) {
+		/* TODO: When JVMTI is supported in RTSJ, this structure needs to be locked
+		 * when it is being scanned
+		 */
+		GC_JVMTIObjectTagTableListIterator objectTagTableList(jvmtiData->environments);
+		while(NULL != (jvmtiEnv = (J9JVMTIEnv *)objectTagTableList.nextSlot())) {
+			/* Each shard of the tag table of an environment is a separate unit of work */
+			for (UDATA shardIndex = 0; shardIndex < jvmtiEnv->objectTagShardCount; shardIndex++) {
+				if(_singleThread || J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+					GC_JVMTIObjectTagTableIterator objectTagTableIterator(jvmtiEnv->objectTagShards[shardIndex].table);
 					while(NULL != (slotPtr = (J9Object **)objectTagTableIterator.nextSlot())) {
 						doJVMTIObjectTagSlot(slotPtr, &objectTagTableIterator);
 					}
 				}
 			}
 		}
-
-		reportScanningEnded(RootScannerEntity_JVMTIObjectTagTables);
 	}
+
+	reportScanningEnded(RootScannerEntity_JVMTIObjectTagTables);
 }
 #endif /* J9VM_OPT_JVMTI */
 
@@ -957,7 +1157,10 @@ MM_RootScanner::scanClearable(MM_EnvironmentBase *env)
 		scanStringTable(env);
 	}
 
-	scanOwnableSynchronizerObjects(env);
+	/* the lists are always empty when ownable synchronizers are discovered lazily */
+	if (!_extensions->lazyOwnableSynchronizerDiscovery) {
+		scanOwnableSynchronizerObjects(env);
+	}
 
 #if defined(J9VM_GC_MODRON_SCAVENGER)
 	/* Remembered set is clearable in a generational system -- if an object in old
@@ -1024,7 +1227,9 @@ MM_RootScanner::scanAllSlots(MM_EnvironmentBase *env)
 	}
 #endif /* J9VM_OPT_JVMTI */
 
-	scanOwnableSynchronizerObjects(env);
+	if (!_extensions->lazyOwnableSynchronizerDiscovery) {
+		scanOwnableSynchronizerObjects(env);
+	}
 }
 
 bool
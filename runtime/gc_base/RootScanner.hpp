@@ -90,6 +90,7 @@ protected:
 	bool _classDataAsRoots; /**< Should all classes (and class loaders) be treated as roots. Default true, should set to false when class unloading */
 	bool _includeJVMTIObjectTagTables; /**< Should the iterator include the JVMTIObjectTagTables. Default true, should set to false when doing JVMTI object walks */
 	bool _trackVisibleStackFrameDepth; /**< Should the stack walker be told to track the visible frame depth. Default false, should set to true when doing JVMTI walks that report stack slots */
+	bool _splitThreadStacks; /**< Are deep thread stacks being split into units shared by all threads of the current task. Set only for the duration of scanThreads() */
 
 	U_64 _entityStartScanTime; /**< The start time of the scan of the current scanning entity, or 0 if no entity is being scanned.  Defaults to 0. */
 	U_64 _entityIncrementStartTime; /**< Start time of current increment with a scan entity (Metronome may have several increment for each entity) */
@@ -116,7 +117,77 @@ private:
 	 */
 	void scanArrayObject(MM_EnvironmentBase *env, J9Object *objectPtr, MM_MemoryPool *memoryPool, MM_HeapRegionManager *manager, UDATA memoryType);
 
+	/**
+	 * Split the stack of a thread into frame-range units and publish them to be claimed by all threads
+	 * of the current task (see scanSplitThreadStacks()).
+	 * @param walkThread the thread whose stack is to be split
+	 * @return the number of units published, or 0 if the stack is too shallow or could not be split
+	 */
+	UDATA splitThreadStack(MM_EnvironmentBase *env, J9VMThread *walkThread);
+
+	/**
+	 * Claim and scan units of the split stack of a thread until none are left.
+	 * @param walkThread the thread whose stack was split
+	 * @param localData opaque data to be passed to the stack walker callback function
+	 */
+	void scanThreadStackUnits(MM_EnvironmentBase *env, J9VMThread *walkThread, void *localData);
+
+	/**
+	 * Help scan the units of all stacks split during the current scanThreads().  Every thread of the task
+	 * calls this once it has claimed all of the threads it could, so the units of a deep stack are spread
+	 * over the threads that would otherwise be idle.
+	 * @param localData opaque data to be passed to the stack walker callback function
+	 */
+	void scanSplitThreadStacks(MM_EnvironmentBase *env, void *localData);
+
 protected:
+	/**
+	 * Scan the slots of a thread that are not on its stack.
+	 * @param walkThread the thread to be scanned
+	 */
+	void scanThreadSlots(J9VMThread *walkThread);
+
+	/**
+	 * Scan the stack of a thread.  While scanThreads() is splitting stacks, a stack deeper than
+	 * stackScanSplitThreshold is only split here, its units are scanned later by all threads of the task.
+	 * @param walkThread the thread whose stack is to be scanned
+	 * @param localData opaque data to be passed to the stack walker callback function
+	 * @return true if the stack was scanned in full by the calling thread, false if it was split
+	 */
+	bool scanThreadStack(MM_EnvironmentBase *env, J9VMThread *walkThread, void *localData);
+
+	/**
+	 * Charge the time spent scanning (part of) the stack of a thread to that thread, for TGC rootscanner.
+	 * @param walkThread the thread whose stack was scanned
+	 * @param startTime the hires clock time at which the scan started
+	 * @param units the number of units scanned
+	 */
+	void reportThreadStackScanned(J9VMThread *walkThread, U_64 startTime, UDATA units);
+
+	/**
+	 * Record that the stack of a thread did not need to be scanned, for TGC rootscanner.
+	 * @param walkThread the thread whose stack was skipped
+	 */
+	void reportThreadStackSkipped(J9VMThread *walkThread);
+
+	/**
+	 * Determine whether the stack of a thread still carries the watermark stamped on it by an earlier
+	 * collection, meaning the thread has not run since.
+	 * @param walkThread the thread whose stack is about to be scanned
+	 * @param epoch the collection epoch of stamps the caller can trust, or 0 if there are none
+	 * @return true if the stack carries a watermark for <code>epoch</code>
+	 */
+	bool isThreadStackWatermarked(J9VMThread *walkThread, UDATA epoch);
+
+	/**
+	 * Stamp the stack of a thread with a watermark, which is cleared by the slow path of VM access acquire
+	 * (see hookAcquireVMAccess()) once the thread is about to run again.  Only a thread which has to take that
+	 * path before running Java code again is stamped.
+	 * @param walkThread the thread whose stack was scanned or skipped
+	 * @param epoch the collection epoch to stamp, or 0 to clear the watermark
+	 */
+	void setThreadStackWatermark(J9VMThread *walkThread, UDATA epoch);
+
 	/**
 	 * Determine whether running method classes in stack frames should be walked.
 	 * @return boolean determining whether running method classes in stack frames should be walked
@@ -303,6 +374,7 @@ public:
 		, _classDataAsRoots(true)
 		, _includeJVMTIObjectTagTables(true)
 		, _trackVisibleStackFrameDepth(false)
+		, _splitThreadStacks(false)
 		, _entityStartScanTime(0)
 		, _entityIncrementStartTime(0)
 		, _entityIncrementEndTime(0)		
@@ -0,0 +1,518 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#include "j9.h"
+#include "j9cfg.h"
+#include "j9consts.h"
+#include "j9protos.h"
+#include "hashtable_api.h"
+#include "mmhook.h"
+#include "mmomrhook.h"
+#include "mmprivatehook.h"
+#include "ModronAssertions.h"
+
+#include <string.h>
+
+#include "StringDeduplicator.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensions.hpp"
+
+/* Multiplier used to mix each word into the hash (the 64 bit golden ratio) */
+#define STRING_DEDUPLICATION_HASH_MULTIPLIER J9CONST64(0x9E3779B97F4A7C15)
+
+typedef struct StringDeduplicationEntry {
+	jobject valueRef; /**< Weak reference to the canonical (or, in _releasedArrays, the released) value array (NULL for a lookup probe) */
+	j9object_t probe; /**< The value array being looked up (NULL for a table entry) */
+	U_32 hash; /**< Hash of the array contents */
+	UDATA size; /**< Size of the array including its header (only used in _releasedArrays) */
+} StringDeduplicationEntry;
+
+/**
+ * Find the contents of an array which can be deduplicated.
+ * @return the start of the array data, or NULL if the array is not contiguous
+ */
+static U_8 *
+getContiguousArrayData(MM_GCExtensions *extensions, j9object_t array, UDATA *dataSize)
+{
+	J9IndexableObject *indexable = (J9IndexableObject *)array;
+#if defined(J9VM_GC_ARRAYLETS)
+	if (!extensions->indexableObjectModel.isInlineContiguousArraylet(indexable)) {
+		return NULL;
+	}
+#endif /* J9VM_GC_ARRAYLETS */
+	*dataSize = extensions->indexableObjectModel.getDataSizeInBytes(indexable);
+	return (U_8 *)extensions->indexableObjectModel.getDataPointerForContiguous(indexable);
+}
+
+static j9object_t
+getEntryArray(StringDeduplicationEntry *entry)
+{
+	if (NULL != entry->probe) {
+		return entry->probe;
+	}
+	return J9_JNI_UNWRAP_REFERENCE(entry->valueRef);
+}
+
+MM_StringDeduplicator *
+MM_StringDeduplicator::newInstance(MM_EnvironmentBase *env)
+{
+	MM_StringDeduplicator *deduplicator = (MM_StringDeduplicator *)env->getForge()->allocate(sizeof(MM_StringDeduplicator), MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
+	if (NULL != deduplicator) {
+		new(deduplicator) MM_StringDeduplicator(env);
+		if (!deduplicator->initialize(env)) {
+			deduplicator->kill(env);
+			deduplicator = NULL;
+		}
+	}
+	return deduplicator;
+}
+
+void
+MM_StringDeduplicator::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+MM_StringDeduplicator::MM_StringDeduplicator(MM_EnvironmentBase *env)
+	: MM_BaseVirtual()
+	, _javaVM((J9JavaVM *)env->getLanguageVM())
+	, _extensions(MM_GCExtensions::getExtensions(env))
+	, _mutex(NULL)
+	, _threadState(THREAD_STATE_INACTIVE)
+	, _workPending(false)
+	, _vmThread(NULL)
+	, _candidates(NULL)
+	, _candidateCount(0)
+	, _candidateCursor(0)
+	, _table(NULL)
+	, _releasedArrays(NULL)
+	, _candidatesQueued(0)
+	, _candidatesDropped(0)
+	, _candidatesDiscarded(0)
+	, _stringsInspected(0)
+	, _stringsDeduplicated(0)
+	, _bytesDeduplicated(0)
+{
+	_typeId = __FUNCTION__;
+}
+
+bool
+MM_StringDeduplicator::initialize(MM_EnvironmentBase *env)
+{
+	PORT_ACCESS_FROM_JAVAVM(_javaVM);
+
+	if (0 != omrthread_monitor_init_with_name(&_mutex, 0, "GC String Deduplication")) {
+		return false;
+	}
+
+	_candidates = (j9object_t *)env->getForge()->allocate(sizeof(j9object_t) * CANDIDATE_QUEUE_SIZE, MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
+	if (NULL == _candidates) {
+		return false;
+	}
+
+	_table = hashTableNew(OMRPORT_FROM_J9PORT(PORTLIB), J9_GET_CALLSITE(), 1024, sizeof(StringDeduplicationEntry), 0, 0, OMRMEM_CATEGORY_MM, tableHashFn, tableEqualFn, NULL, this);
+	if (NULL == _table) {
+		return false;
+	}
+
+	_releasedArrays = hashTableNew(OMRPORT_FROM_J9PORT(PORTLIB), J9_GET_CALLSITE(), 1024, sizeof(StringDeduplicationEntry), 0, 0, OMRMEM_CATEGORY_MM, tableHashFn, releasedArraysEqualFn, NULL, this);
+	if (NULL == _releasedArrays) {
+		return false;
+	}
+
+	J9HookInterface** omrHooks = J9_HOOK_INTERFACE(_extensions->omrHookInterface);
+	J9HookInterface** privateHooks = J9_HOOK_INTERFACE(_extensions->privateHookInterface);
+	if ((0 != (*omrHooks)->J9HookRegisterWithCallSite(omrHooks, J9HOOK_MM_OMR_LOCAL_GC_START, hookCollectionStart, OMR_GET_CALLSITE(), this))
+		|| (0 != (*omrHooks)->J9HookRegisterWithCallSite(omrHooks, J9HOOK_MM_OMR_GLOBAL_GC_START, hookCollectionStart, OMR_GET_CALLSITE(), this))
+		|| (0 != (*privateHooks)->J9HookRegisterWithCallSite(privateHooks, J9HOOK_MM_PRIVATE_TAROK_INCREMENT_START, hookCollectionStart, OMR_GET_CALLSITE(), this))
+		|| (0 != (*omrHooks)->J9HookRegisterWithCallSite(omrHooks, J9HOOK_MM_OMR_LOCAL_GC_END, hookCollectionEnd, OMR_GET_CALLSITE(), this))
+		|| (0 != (*omrHooks)->J9HookRegisterWithCallSite(omrHooks, J9HOOK_MM_OMR_GLOBAL_GC_END, hookCollectionEnd, OMR_GET_CALLSITE(), this))
+		|| (0 != (*privateHooks)->J9HookRegisterWithCallSite(privateHooks, J9HOOK_MM_PRIVATE_TAROK_INCREMENT_END, hookCollectionEnd, OMR_GET_CALLSITE(), this))
+	) {
+		return false;
+	}
+
+	return true;
+}
+
+void
+MM_StringDeduplicator::tearDown(MM_EnvironmentBase *env)
+{
+	J9HookInterface** omrHooks = J9_HOOK_INTERFACE(_extensions->omrHookInterface);
+	J9HookInterface** privateHooks = J9_HOOK_INTERFACE(_extensions->privateHookInterface);
+	(*omrHooks)->J9HookUnregister(omrHooks, J9HOOK_MM_OMR_LOCAL_GC_START, hookCollectionStart, this);
+	(*omrHooks)->J9HookUnregister(omrHooks, J9HOOK_MM_OMR_GLOBAL_GC_START, hookCollectionStart, this);
+	(*privateHooks)->J9HookUnregister(privateHooks, J9HOOK_MM_PRIVATE_TAROK_INCREMENT_START, hookCollectionStart, this);
+	(*omrHooks)->J9HookUnregister(omrHooks, J9HOOK_MM_OMR_LOCAL_GC_END, hookCollectionEnd, this);
+	(*omrHooks)->J9HookUnregister(omrHooks, J9HOOK_MM_OMR_GLOBAL_GC_END, hookCollectionEnd, this);
+	(*privateHooks)->J9HookUnregister(privateHooks, J9HOOK_MM_PRIVATE_TAROK_INCREMENT_END, hookCollectionEnd, this);
+
+	/* the weak references held by the tables are released with the rest of the JNI global references */
+	if (NULL != _table) {
+		hashTableFree(_table);
+		_table = NULL;
+	}
+
+	if (NULL != _releasedArrays) {
+		hashTableFree(_releasedArrays);
+		_releasedArrays = NULL;
+	}
+
+	if (NULL != _candidates) {
+		env->getForge()->free(_candidates);
+		_candidates = NULL;
+	}
+
+	if (NULL != _mutex) {
+		omrthread_monitor_destroy(_mutex);
+		_mutex = NULL;
+	}
+}
+
+bool
+MM_StringDeduplicator::startThread()
+{
+	omrthread_t thread = NULL;
+	if (J9THREAD_SUCCESS != createThreadWithCategory(
+				&thread,
+				_javaVM->defaultOSStackSize,
+				J9THREAD_PRIORITY_NORMAL,
+				0,
+				MM_StringDeduplicator::deduplicationThreadEntryPoint,
+				this,
+				J9THREAD_CATEGORY_SYSTEM_GC_THREAD)) {
+		return false;
+	}
+
+	omrthread_monitor_enter(_mutex);
+	while (THREAD_STATE_INACTIVE == _threadState) {
+		omrthread_monitor_wait(_mutex);
+	}
+	bool result = (THREAD_STATE_ACTIVE == _threadState);
+	omrthread_monitor_exit(_mutex);
+
+	return result;
+}
+
+void
+MM_StringDeduplicator::shutdownThread()
+{
+	omrthread_monitor_enter(_mutex);
+	if (THREAD_STATE_ACTIVE == _threadState) {
+		_threadState = THREAD_STATE_SHUTDOWN_REQUESTED;
+		omrthread_monitor_notify_all(_mutex);
+		while (THREAD_STATE_TERMINATED != _threadState) {
+			omrthread_monitor_wait(_mutex);
+		}
+	}
+	omrthread_monitor_exit(_mutex);
+}
+
+int J9THREAD_PROC
+MM_StringDeduplicator::deduplicationThreadEntryPoint(void *userData)
+{
+	MM_StringDeduplicator *deduplicator = (MM_StringDeduplicator *)userData;
+	J9JavaVM *javaVM = deduplicator->_javaVM;
+
+	if (JNI_OK == javaVM->internalVMFunctions->attachSystemDaemonThread(javaVM, &deduplicator->_vmThread, "GC String Deduplication")) {
+		deduplicator->run();
+		javaVM->internalVMFunctions->DetachCurrentThread((JavaVM *)javaVM);
+		deduplicator->_vmThread = NULL;
+	}
+
+	omrthread_monitor_enter(deduplicator->_mutex);
+	deduplicator->_threadState = THREAD_STATE_TERMINATED;
+	omrthread_monitor_notify_all(deduplicator->_mutex);
+	/* exit the monitor and terminate the thread */
+	omrthread_exit(deduplicator->_mutex);
+
+	/* NO GUARDS AFTER THIS POINT */
+	return 0;
+}
+
+void
+MM_StringDeduplicator::run()
+{
+	J9InternalVMFunctions const * const vmFuncs = _javaVM->internalVMFunctions;
+
+	omrthread_monitor_enter(_mutex);
+	_threadState = THREAD_STATE_ACTIVE;
+	omrthread_monitor_notify_all(_mutex);
+
+	while (THREAD_STATE_SHUTDOWN_REQUESTED != _threadState) {
+		if (_workPending) {
+			_workPending = false;
+			omrthread_monitor_exit(_mutex);
+
+			vmFuncs->internalAcquireVMAccess(_vmThread);
+			processCandidates();
+			purgeTable();
+			vmFuncs->internalReleaseVMAccess(_vmThread);
+
+			omrthread_monitor_enter(_mutex);
+		} else {
+			omrthread_monitor_wait(_mutex);
+		}
+	}
+	omrthread_monitor_exit(_mutex);
+}
+
+void
+MM_StringDeduplicator::processCandidates()
+{
+	J9InternalVMFunctions const * const vmFuncs = _javaVM->internalVMFunctions;
+	UDATA processedInBatch = 0;
+
+	/* The queue is only modified by collections (which discard it) so it is stable while VM access is held */
+	while (_candidateCursor < OMR_MIN(_candidateCount, (UDATA)CANDIDATE_QUEUE_SIZE)) {
+		j9object_t string = _candidates[_candidateCursor];
+		_candidateCursor += 1;
+		deduplicate(string);
+
+		processedInBatch += 1;
+		if (BATCH_SIZE == processedInBatch) {
+			processedInBatch = 0;
+			if (J9_ARE_ANY_BITS_SET(_vmThread->publicFlags, J9_PUBLIC_FLAGS_HALT_THREAD_EXCLUSIVE)) {
+				/* let the collector (or other exclusive requester) in; a collection will discard what is left */
+				vmFuncs->internalReleaseVMAccess(_vmThread);
+				vmFuncs->internalAcquireVMAccess(_vmThread);
+			}
+		}
+	}
+}
+
+void
+MM_StringDeduplicator::deduplicate(j9object_t string)
+{
+	J9VMThread *vmThread = _vmThread;
+	_stringsInspected += 1;
+
+	j9object_t value = J9VMJAVALANGSTRING_VALUE(vmThread, string);
+	if (NULL == value) {
+		return;
+	}
+	UDATA dataSize = 0;
+	if (NULL == getContiguousArrayData(_extensions, value, &dataSize)) {
+		return;
+	}
+
+	StringDeduplicationEntry probe;
+	probe.valueRef = NULL;
+	probe.probe = value;
+	probe.hash = hashArray(value);
+	probe.size = 0;
+
+	StringDeduplicationEntry *entry = (StringDeduplicationEntry *)hashTableFind(_table, &probe);
+	if (NULL == entry) {
+		/* a released array can become canonical again once the previous canonical array has been collected */
+		StringDeduplicationEntry *released = (StringDeduplicationEntry *)hashTableFind(_releasedArrays, &probe);
+		if (NULL != released) {
+			jobject releasedRef = released->valueRef;
+			hashTableRemove(_releasedArrays, &probe);
+			_javaVM->internalVMFunctions->j9jni_deleteGlobalRef((JNIEnv *)vmThread, releasedRef, JNI_TRUE);
+		}
+		jobject valueRef = _javaVM->internalVMFunctions->j9jni_createGlobalRef((JNIEnv *)vmThread, value, JNI_TRUE);
+		if (NULL != valueRef) {
+			StringDeduplicationEntry newEntry;
+			newEntry.valueRef = valueRef;
+			newEntry.probe = NULL;
+			newEntry.hash = probe.hash;
+			newEntry.size = 0;
+			if (NULL == hashTableAdd(_table, &newEntry)) {
+				_javaVM->internalVMFunctions->j9jni_deleteGlobalRef((JNIEnv *)vmThread, valueRef, JNI_TRUE);
+			}
+		}
+	} else {
+		j9object_t canonical = J9_JNI_UNWRAP_REFERENCE(entry->valueRef);
+		if (canonical != value) {
+			J9VMJAVALANGSTRING_SET_VALUE(vmThread, string, canonical);
+			_stringsDeduplicated += 1;
+			/* other Strings (or anything else) may still use the old array, so it is not counted until it has been collected */
+			addReleasedArray(value, probe.hash);
+		}
+	}
+}
+
+void
+MM_StringDeduplicator::addReleasedArray(j9object_t value, U_32 hash)
+{
+	StringDeduplicationEntry probe;
+	probe.valueRef = NULL;
+	probe.probe = value;
+	probe.hash = hash;
+	probe.size = 0;
+
+	/* an array shared by several deduplicated Strings is counted once */
+	if ((hashTableGetCount(_releasedArrays) < RELEASED_ARRAY_LIMIT) && (NULL == hashTableFind(_releasedArrays, &probe))) {
+		jobject valueRef = _javaVM->internalVMFunctions->j9jni_createGlobalRef((JNIEnv *)_vmThread, value, JNI_TRUE);
+		if (NULL != valueRef) {
+			StringDeduplicationEntry newEntry;
+			newEntry.valueRef = valueRef;
+			newEntry.probe = NULL;
+			newEntry.hash = hash;
+			newEntry.size = _extensions->indexableObjectModel.getSizeInBytesWithHeader((J9IndexableObject *)value);
+			if (NULL == hashTableAdd(_releasedArrays, &newEntry)) {
+				_javaVM->internalVMFunctions->j9jni_deleteGlobalRef((JNIEnv *)_vmThread, valueRef, JNI_TRUE);
+			}
+		}
+	}
+}
+
+void
+MM_StringDeduplicator::purgeTable()
+{
+	J9HashTableState walkState;
+	StringDeduplicationEntry *entry = (StringDeduplicationEntry *)hashTableStartDo(_table, &walkState);
+	while (NULL != entry) {
+		if (NULL == J9_JNI_UNWRAP_REFERENCE(entry->valueRef)) {
+			_javaVM->internalVMFunctions->j9jni_deleteGlobalRef((JNIEnv *)_vmThread, entry->valueRef, JNI_TRUE);
+			hashTableDoRemove(&walkState);
+		}
+		entry = (StringDeduplicationEntry *)hashTableNextDo(&walkState);
+	}
+
+	entry = (StringDeduplicationEntry *)hashTableStartDo(_releasedArrays, &walkState);
+	while (NULL != entry) {
+		if (NULL == J9_JNI_UNWRAP_REFERENCE(entry->valueRef)) {
+			_bytesDeduplicated += entry->size;
+			_javaVM->internalVMFunctions->j9jni_deleteGlobalRef((JNIEnv *)_vmThread, entry->valueRef, JNI_TRUE);
+			hashTableDoRemove(&walkState);
+		}
+		entry = (StringDeduplicationEntry *)hashTableNextDo(&walkState);
+	}
+}
+
+U_32
+MM_StringDeduplicator::hashArray(j9object_t array)
+{
+	UDATA dataSize = 0;
+	U_8 *data = getContiguousArrayData(_extensions, array, &dataSize);
+	U_64 hash = (U_64)dataSize;
+
+	/* mix a word at a time rather than a character at a time */
+	UDATA wordCount = dataSize / sizeof(U_64);
+	for (UDATA i = 0; i < wordCount; i++) {
+		U_64 word = 0;
+		memcpy(&word, data + (i * sizeof(U_64)), sizeof(U_64));
+		hash = (hash ^ word) * STRING_DEDUPLICATION_HASH_MULTIPLIER;
+		hash ^= hash >> 29;
+	}
+	for (UDATA i = wordCount * sizeof(U_64); i < dataSize; i++) {
+		hash = (hash ^ data[i]) * STRING_DEDUPLICATION_HASH_MULTIPLIER;
+	}
+
+	return (U_32)(hash ^ (hash >> 32));
+}
+
+UDATA
+MM_StringDeduplicator::getTableEntryCount()
+{
+	return hashTableGetCount(_table);
+}
+
+UDATA
+MM_StringDeduplicator::getTableOverheadBytes()
+{
+	/* each entry also owns one weak global reference slot */
+	return (getTableEntryCount() + hashTableGetCount(_releasedArrays)) * (sizeof(StringDeduplicationEntry) + sizeof(j9object_t));
+}
+
+UDATA
+MM_StringDeduplicator::tableHashFn(void *entry, void *userData)
+{
+	return ((StringDeduplicationEntry *)entry)->hash;
+}
+
+UDATA
+MM_StringDeduplicator::tableEqualFn(void *leftEntry, void *rightEntry, void *userData)
+{
+	MM_StringDeduplicator *deduplicator = (MM_StringDeduplicator *)userData;
+	StringDeduplicationEntry *left = (StringDeduplicationEntry *)leftEntry;
+	StringDeduplicationEntry *right = (StringDeduplicationEntry *)rightEntry;
+
+	if (left->hash != right->hash) {
+		return FALSE;
+	}
+	j9object_t leftArray = getEntryArray(left);
+	j9object_t rightArray = getEntryArray(right);
+	if ((NULL == leftArray) || (NULL == rightArray)) {
+		/* a cleared entry never matches; it is removed by the next purge */
+		return FALSE;
+	}
+	if (leftArray == rightArray) {
+		return TRUE;
+	}
+	if (J9GC_J9OBJECT_CLAZZ(leftArray) != J9GC_J9OBJECT_CLAZZ(rightArray)) {
+		return FALSE;
+	}
+
+	UDATA leftSize = 0;
+	UDATA rightSize = 0;
+	U_8 *leftData = getContiguousArrayData(deduplicator->_extensions, leftArray, &leftSize);
+	U_8 *rightData = getContiguousArrayData(deduplicator->_extensions, rightArray, &rightSize);
+	return (leftSize == rightSize) && (0 == memcmp(leftData, rightData, leftSize));
+}
+
+UDATA
+MM_StringDeduplicator::releasedArraysEqualFn(void *leftEntry, void *rightEntry, void *userData)
+{
+	j9object_t leftArray = getEntryArray((StringDeduplicationEntry *)leftEntry);
+	/* released arrays are the same only if they are the same object, and a cleared entry never matches */
+	return (NULL != leftArray) && (leftArray == getEntryArray((StringDeduplicationEntry *)rightEntry));
+}
+
+void
+MM_StringDeduplicator::hookCollectionStart(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	MM_StringDeduplicator *deduplicator = (MM_StringDeduplicator *)userData;
+
+	/* the collection is about to move objects, so raw pointers to any unprocessed candidates become stale */
+	UDATA queued = OMR_MIN(deduplicator->_candidateCount, (UDATA)CANDIDATE_QUEUE_SIZE);
+	deduplicator->_candidatesDiscarded += queued - deduplicator->_candidateCursor;
+	deduplicator->_candidateCount = 0;
+	deduplicator->_candidateCursor = 0;
+}
+
+void
+MM_StringDeduplicator::hookCollectionEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	MM_StringDeduplicator *deduplicator = (MM_StringDeduplicator *)userData;
+	UDATA candidateCount = deduplicator->_candidateCount;
+
+	if (0 != candidateCount) {
+		UDATA queued = OMR_MIN(candidateCount, (UDATA)CANDIDATE_QUEUE_SIZE);
+		deduplicator->_candidatesQueued += queued;
+		deduplicator->_candidatesDropped += candidateCount - queued;
+
+		omrthread_monitor_enter(deduplicator->_mutex);
+		deduplicator->_workPending = true;
+		omrthread_monitor_notify_all(deduplicator->_mutex);
+		omrthread_monitor_exit(deduplicator->_mutex);
+	}
+}
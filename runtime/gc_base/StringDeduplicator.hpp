@@ -0,0 +1,176 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(STRINGDEDUPLICATOR_HPP_)
+#define STRINGDEDUPLICATOR_HPP_
+
+#include "j9.h"
+#include "j9cfg.h"
+#include "modron.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseVirtual.hpp"
+
+class MM_EnvironmentBase;
+class MM_GCExtensions;
+
+/**
+ * Background deduplication of the value arrays of long lived Strings.
+ *
+ * While objects are being copied the collector queues Strings which have just reached the deduplication age as
+ * candidates.  Once the collection completes a VM-attached daemon thread hashes the value array of each candidate
+ * and looks it up in a table of canonical value arrays.  When an identical array is found the String is pointed at it
+ * (through the normal write barrier) so that its own array can be collected; otherwise its array becomes canonical.
+ *
+ * The table holds its arrays through weak JNI references so that each collector clears or updates them with the
+ * rest of the weak JNI roots.  A value array a String no longer uses may still be referenced elsewhere, so it is only
+ * counted as reclaimed once a weak reference to it has been cleared by a collector.  The candidate queue holds raw object pointers: it is only read by the deduplication
+ * thread while it holds VM access, and it is discarded at the start of every collection, so it never needs to be
+ * scanned or updated by the collector.
+ * @ingroup GC_Base
+ */
+class MM_StringDeduplicator : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	enum ThreadState {
+		THREAD_STATE_INACTIVE = 0, /**< The deduplication thread has not been started */
+		THREAD_STATE_ACTIVE, /**< The deduplication thread is running */
+		THREAD_STATE_SHUTDOWN_REQUESTED, /**< The deduplication thread has been asked to exit */
+		THREAD_STATE_TERMINATED /**< The deduplication thread has exited (or failed to attach) */
+	};
+
+	enum {
+		CANDIDATE_QUEUE_SIZE = 64 * 1024, /**< The number of candidate Strings which can be queued by a single collection */
+		RELEASED_ARRAY_LIMIT = 64 * 1024, /**< The number of released value arrays which can be waiting to be collected */
+		BATCH_SIZE = 256 /**< The number of candidates processed between checks for a pending exclusive access request */
+	};
+
+	J9JavaVM *_javaVM;
+	MM_GCExtensions *_extensions;
+	omrthread_monitor_t _mutex; /**< Protects the thread state and the pending work flag */
+	volatile ThreadState _threadState;
+	volatile bool _workPending; /**< Set when a collection has queued candidates which the thread has not yet started on */
+	J9VMThread *_vmThread; /**< The deduplication thread, once attached */
+
+	j9object_t *_candidates; /**< Strings queued by the last collection */
+	volatile UDATA _candidateCount; /**< Number of slots of _candidates claimed (may exceed CANDIDATE_QUEUE_SIZE if candidates were dropped) */
+	UDATA _candidateCursor; /**< Index of the next candidate to be processed */
+
+	J9HashTable *_table; /**< Canonical value arrays, keyed by content hash */
+	J9HashTable *_releasedArrays; /**< Value arrays no longer used by a deduplicated String, until a collector clears them (keyed by identity) */
+
+public:
+	UDATA _candidatesQueued; /**< Total Strings queued as candidates */
+	UDATA _candidatesDropped; /**< Total candidates dropped since the queue was full */
+	UDATA _candidatesDiscarded; /**< Total candidates discarded since a collection started before they were processed */
+	UDATA _stringsInspected; /**< Total candidates inspected by the deduplication thread */
+	UDATA _stringsDeduplicated; /**< Total Strings pointed at a canonical value array */
+	UDATA _bytesDeduplicated; /**< Total size of the value arrays released by deduplication which have since been collected.  A lower bound, since arrays released while _releasedArrays is full are not counted */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_StringDeduplicator *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Start the deduplication thread.
+	 * @return true if the thread started and attached to the VM
+	 */
+	bool startThread();
+	/**
+	 * Stop the deduplication thread and wait for it to detach from the VM.
+	 */
+	void shutdownThread();
+
+	/**
+	 * Queue a String as a deduplication candidate.  Called by collector threads while the String is being copied.
+	 * @param string[in] the (new address of the) String
+	 */
+	MMINLINE void
+	addCandidate(j9object_t string)
+	{
+		UDATA index = MM_AtomicOperations::add(&_candidateCount, 1) - 1;
+		if (index < CANDIDATE_QUEUE_SIZE) {
+			_candidates[index] = string;
+		}
+	}
+
+	/**
+	 * @return the number of canonical value arrays in the table
+	 */
+	UDATA getTableEntryCount();
+	/**
+	 * @return the native memory used by the table and its weak references, in bytes
+	 */
+	UDATA getTableOverheadBytes();
+
+	MM_StringDeduplicator(MM_EnvironmentBase *env);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+private:
+	static int J9THREAD_PROC deduplicationThreadEntryPoint(void *userData);
+	void run();
+
+	/**
+	 * Deduplicate the candidates queued by the last collection.  Called with VM access; returns early (discarding the
+	 * remaining candidates) if another thread requests exclusive access.
+	 */
+	void processCandidates();
+	/**
+	 * Deduplicate the value array of a single String.
+	 */
+	void deduplicate(j9object_t string);
+	/**
+	 * Remember a value array which a String no longer uses, so its size is counted once it has been collected.
+	 */
+	void addReleasedArray(j9object_t value, U_32 hash);
+	/**
+	 * Remove table entries whose canonical array has been collected and count the released arrays which have been collected.
+	 */
+	void purgeTable();
+	/**
+	 * Hash the contents of a contiguous array, a word at a time.
+	 */
+	U_32 hashArray(j9object_t array);
+
+	static UDATA tableHashFn(void *entry, void *userData);
+	static UDATA tableEqualFn(void *leftEntry, void *rightEntry, void *userData);
+	static UDATA releasedArraysEqualFn(void *leftEntry, void *rightEntry, void *userData);
+
+	static void hookCollectionStart(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
+	static void hookCollectionEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
+};
+
+#endif /* STRINGDEDUPLICATOR_HPP_ */
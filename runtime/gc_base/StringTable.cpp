@@ -72,6 +72,8 @@ MM_StringTable::initialize(MM_EnvironmentBase *env)
 	U_32 initialSize = 128;
 	U_32 listToTreeThreshold = MM_GCExtensions::getExtensions(env)->_stringTableListToTreeThreshold;
 
+	_cacheSize = MM_GCExtensions::getExtensions(env)->_stringTableCacheSize;
+
 	_table = (J9HashTable **)j9mem_allocate_memory(sizeof(J9HashTable *) * _tableCount, OMRMEM_CATEGORY_MM);
 	if (NULL == _table) {
 		return false;
@@ -94,7 +96,17 @@ MM_StringTable::initialize(MM_EnvironmentBase *env)
 		}
 	}
 
-	memset(_cache, 0, sizeof(_cache));
+	_cache = (j9object_t *)j9mem_allocate_memory(sizeof(j9object_t) * _cacheSize, OMRMEM_CATEGORY_MM);
+	if (NULL == _cache) {
+		return false;
+	}
+	memset(_cache, 0, sizeof(j9object_t) * _cacheSize);
+
+	_cacheHash = (U_32 *)j9mem_allocate_memory(sizeof(U_32) * _cacheSize, OMRMEM_CATEGORY_MM);
+	if (NULL == _cacheHash) {
+		return false;
+	}
+	memset(_cacheHash, 0, sizeof(U_32) * _cacheSize);
 
 	return true;
 }
@@ -126,6 +138,16 @@ MM_StringTable::tearDown(MM_EnvironmentBase *env)
 		j9mem_free_memory(_mutex);
 		_mutex = NULL;
 	}
+
+	if (NULL != _cache) {
+		j9mem_free_memory(_cache);
+		_cache = NULL;
+	}
+
+	if (NULL != _cacheHash) {
+		j9mem_free_memory(_cacheHash);
+		_cacheHash = NULL;
+	}
 }
 
 
@@ -169,6 +191,64 @@ MM_StringTable::hashAtUTF8(UDATA tableIndex, U_8 *utf8Data, UDATA utf8Length, U_
 	return hashAt(tableIndex, (j9object_t)ptr);
 }
 
+j9object_t
+MM_StringTable::cacheAt(J9JavaVM *javaVM, UDATA hash, void *key)
+{
+	UDATA cacheIndex = getCacheIndex(hash);
+
+	for (UDATA probe = 0; probe < cacheProbeLimit; probe++) {
+		/* the cached hash only filters candidates: the entry may be updated under us, so the characters decide */
+		if ((U_32)hash == _cacheHash[cacheIndex]) {
+			j9object_t candidate = _cache[cacheIndex];
+			if ((NULL != candidate) && stringHashEqualFn(&candidate, key, javaVM)) {
+				return candidate;
+			}
+		}
+		cacheIndex = (cacheIndex + 1) & (_cacheSize - 1);
+	}
+
+	return NULL;
+}
+
+j9object_t
+MM_StringTable::cacheAtUTF8(J9JavaVM *javaVM, U_8 *utf8Data, UDATA utf8Length, U_32 hash)
+{
+	stringTableUTF8Query query;
+	void *ptr;
+
+	query.utf8Data = utf8Data;
+	query.utf8Length = utf8Length;
+	query.hash = hash;
+	ptr = &query;
+	ptr = (void *) ((UDATA) ptr | TYPE_UTF8); /* Least significant bit indicates that this is a pointer to a stringTableUTF8Query */
+	return cacheAt(javaVM, hash, &ptr);
+}
+
+void
+MM_StringTable::cacheAtPut(UDATA hash, j9object_t string)
+{
+	UDATA firstIndex = getCacheIndex(hash);
+	UDATA cacheIndex = firstIndex;
+	bool found = false;
+
+	for (UDATA probe = 0; probe < cacheProbeLimit; probe++) {
+		j9object_t entry = _cache[cacheIndex];
+		if ((NULL == entry) || (string == entry)) {
+			found = true;
+			break;
+		}
+		cacheIndex = (cacheIndex + 1) & (_cacheSize - 1);
+	}
+
+	if (!found) {
+		/* all probed entries are in use: evict one, picked by address so that competing strings spread over the probe window */
+		cacheIndex = (firstIndex + (((UDATA)string >> 4) % cacheProbeLimit)) & (_cacheSize - 1);
+	}
+
+	_cacheHash[cacheIndex] = (U_32)hash;
+	_cache[cacheIndex] = string;
+}
+
 j9object_t
 MM_StringTable::hashAtPut(UDATA tableIndex, j9object_t string)
 {
@@ -201,6 +281,8 @@ MM_StringTable::addStringToInternTable(J9VMThread *vmThread, j9object_t string)
 
 	if (NULL == internedString) {
 		Trc_MM_StringTable_stringAddToInternTableFailed(vmThread, string, _table, tableIndex);
+	} else {
+		cacheAtPut(hash, internedString);
 	}
 
 	return internedString;
@@ -251,11 +333,17 @@ stringComparatorFn(struct J9AVLTree *tree, struct J9AVLTreeNode *leftNode, struc
 			U_16 rightChar = 0;
 			U_32 consumed = 0;
 
-			consumed = decodeUTF8CharN(u8Ptr+left_i, &leftChar, leftLength-left_i);
-			if (0 == consumed) { 
-				/* reached the end of the left string early */
-				rc = -1;
-				goto done;
+			if ((left_i < leftLength) && (0 != u8Ptr[left_i]) && (0 == (u8Ptr[left_i] & 0x80))) {
+				/* single byte (ASCII) encoding needs no decoding */
+				leftChar = (U_16)u8Ptr[left_i];
+				consumed = 1;
+			} else {
+				consumed = decodeUTF8CharN(u8Ptr+left_i, &leftChar, leftLength-left_i);
+				if (0 == consumed) { 
+					/* reached the end of the left string early */
+					rc = -1;
+					goto done;
+				}
 			}
 			left_i += consumed;
 			if (rightCompressed) {
@@ -403,9 +491,15 @@ stringHashEqualFn(void *leftKey, void *rightKey, void *userData)
 			U_16 leftChar, rightChar;
 			U_32 consumed;
 
-			consumed = decodeUTF8CharN(u8Ptr+right_i, &rightChar, rightLength-right_i);
-			if (0 == consumed) { /* reached the end of the string early */
-				return FALSE;
+			if ((right_i < rightLength) && (0 != u8Ptr[right_i]) && (0 == (u8Ptr[right_i] & 0x80))) {
+				/* single byte (ASCII) encoding needs no decoding */
+				rightChar = (U_16)u8Ptr[right_i];
+				consumed = 1;
+			} else {
+				consumed = decodeUTF8CharN(u8Ptr+right_i, &rightChar, rightLength-right_i);
+				if (0 == consumed) { /* reached the end of the string early */
+					return FALSE;
+				}
 			}
 			right_i += consumed;
 			if (leftCompressed) {
@@ -563,11 +657,19 @@ j9gc_createJavaLangString(J9VMThread *vmThread, U_8 *data, UDATA length, UDATA s
 
 	if ((stringFlags & (J9_STR_XLAT | J9_STR_UNICODE)) == 0) {
 		U_32 hash = (U_32)vm->internalVMFunctions->computeHashForUTF8(data, length);
-		UDATA tableIndex = stringTable->getTableIndex(hash);
 
-		stringTable->lockTable(tableIndex);
-		result = stringTable->hashAtUTF8(tableIndex, data, length, hash);
-		stringTable->unlockTable(tableIndex);
+		result = stringTable->cacheAtUTF8(vm, data, length, hash);
+		if (NULL == result) {
+			UDATA tableIndex = stringTable->getTableIndex(hash);
+
+			stringTable->lockTable(tableIndex);
+			result = stringTable->hashAtUTF8(tableIndex, data, length, hash);
+			stringTable->unlockTable(tableIndex);
+
+			if (NULL != result) {
+				stringTable->cacheAtPut(hash, result);
+			}
+		}
 	}
 
 	if (NULL == result) {
@@ -784,35 +886,15 @@ j9gc_internString(J9VMThread *vmThread, j9object_t sourceString)
 	J9JavaVM *vm = vmThread->javaVM;
 	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(vm->omrVM);
 	MM_StringTable *stringTable = extensions->getStringTable();
-	bool isMetronome = extensions->isMetronomeGC();
 	j9object_t internedString = NULL;
-	j9object_t *candidatePtr = NULL;
-	j9object_t candidate = NULL;
 
 	UDATA hash = stringHashFn(&sourceString, vm);
 
-	candidatePtr = stringTable->getStringInternCache(hash);
-	candidate = *candidatePtr;
-
-	if ((NULL != candidate) && stringHashEqualFn(&candidate, &sourceString, vm)) {
-		if (isMetronome) {
-#if defined(J9VM_GC_REALTIME) 
-			/*
-			 * This can only be used if the current candidate pointer is live.
-			 * Pass in candidate twice since we only have one string.
-			 */
-			if (FALSE != j9gc_objaccess_checkStringConstantsLive(vm, candidate, candidate)) {
-				Trc_MM_stringTableCacheHit(vmThread, candidate);
-				return candidate;
-			}
-#else
-			Trc_MM_stringTableCacheHit(vmThread, candidate);
-			return candidate;
-#endif
-		} else {
-			Trc_MM_stringTableCacheHit(vmThread, candidate);
-			return candidate;
-		}
+	/* the cache comparison includes the liveness check of string constants required by metronome */
+	internedString = stringTable->cacheAt(vm, hash, &sourceString);
+	if (NULL != internedString) {
+		Trc_MM_stringTableCacheHit(vmThread, internedString);
+		return internedString;
 	}
 
 	UDATA tableIndex = stringTable->getTableIndex(hash);
@@ -831,6 +913,7 @@ j9gc_internString(J9VMThread *vmThread, j9object_t sourceString)
 			/* newString may move because setupCharArray may trigger a GC */
 			newString = setupCharArray(vmThread, sourceString, newString);
 			if (NULL != newString) {
+				/* caches the interned string on success */
 				internedString = stringTable->addStringToInternTable(vmThread, newString);
 			}
 		}
@@ -838,9 +921,10 @@ j9gc_internString(J9VMThread *vmThread, j9object_t sourceString)
 		if (NULL == internedString) {
 			vm->internalVMFunctions->setHeapOutOfMemoryError(vmThread);
 		}
+	} else {
+		stringTable->cacheAtPut(hash, internedString);
 	}
 
-	*candidatePtr = internedString;
 	Trc_MM_stringTableCacheMiss(vmThread, internedString);
 	return internedString;
 }
@@ -858,16 +942,22 @@ j9gc_allocStringWithSharedCharData(J9VMThread *vmThread, U_8 *data, UDATA length
 	bool isCompressable = false;
 
 	U_32 hash = (U_32) vm->internalVMFunctions->computeHashForUTF8(data, length);
-	UDATA tableIndex = stringTable->getTableIndex(hash);
 
 	/* see if the string is already in the table. Race condition where another thread may add the string
 	 * before this one is not fatal and is ignored.
 	 */
+	internedString = stringTable->cacheAtUTF8(vm, data, length, hash);
+	if (internedString != NULL) {
+		return internedString;
+	}
+
+	UDATA tableIndex = stringTable->getTableIndex(hash);
 	stringTable->lockTable(tableIndex);
 	internedString = stringTable->hashAtUTF8(tableIndex, data, length, hash);
 	stringTable->unlockTable(tableIndex);
 
 	if (internedString != NULL) {
+		stringTable->cacheAtPut(hash, internedString);
 		return internedString;
 	}
 
@@ -41,9 +41,14 @@ private:
 	J9HashTable **_table;			/**< pointer to an array  of hash sub-tables */
 	omrthread_monitor_t *_mutex;		/**< pointer to an array  of monitors associated with each hash sub-table */
 
-	enum { cacheSize = 511 };
-	j9object_t _cache[cacheSize];	/**< interned string table cash */
+	UDATA _cacheSize;				/**< number of entries in the interned string cache (a power of two) */
+	j9object_t *_cache;				/**< open-addressed interned string cache, probed without taking any sub-table monitor */
+	U_32 *_cacheHash;				/**< full hash of the string last stored in the corresponding _cache entry */
 public:
+	enum {
+		cacheProbeLimit = 4, /**< the number of consecutive cache entries examined for a given hash */
+		cacheScanChunkSize = 1024 /**< the number of cache entries cleaned per GC work unit */
+	};
 
 private:
 	bool initialize(MM_EnvironmentBase *env);
@@ -52,18 +57,46 @@ private:
 public:
 
 	/**
-	 * @return size of interned strin cache size
+	 * @return size of interned string cache
 	 */
-	static UDATA getCacheSize() { return cacheSize; }
+	UDATA getCacheSize() { return _cacheSize; }
 	/**
 	 * @return the address of cache (represented as an array)
 	 */
 	j9object_t *getStringInternCache() { return  _cache; }
 	/**
-	 * @param hash hash value of the string being cached
-	 * @return the address of an entry into the cache array
+	 * @param hash hash value of a string
+	 * @return the index of the first cache entry probed for the string
 	 */
-	j9object_t *getStringInternCache(UDATA hash) { return  &_cache[hash % cacheSize]; }
+	UDATA getCacheIndex(UDATA hash) {
+		U_32 hash32 = (U_32)hash;
+		/* String hashes of short strings differ mostly in their low bits: fold the high half in as well */
+		return (UDATA)(hash32 ^ (hash32 >> 16)) & (_cacheSize - 1);
+	}
+
+	/**
+	 * Look up a string in the interned string cache.  No lock is taken: racing updates of an entry can only cause a miss,
+	 * since a candidate is returned only after its characters have been compared.
+	 * @param javaVM pointer to the J9JavaVM
+	 * @param hash full hash value of the string
+	 * @param key pointer to a String object or pointer to a low-tagged pointer to a stringTableUTF8Query
+	 * @return the cached interned string or NULL if it is not in the cache
+	 */
+	j9object_t cacheAt(J9JavaVM *javaVM, UDATA hash, void *key);
+	/**
+	 * wrapper function to allow user to look up UTF8 strings in the interned string cache
+	 * @param javaVM pointer to the J9JavaVM
+	 * @param utf8Data pointer to UTF8 string data
+	 * @param utf8Length length of the string
+	 * @param hash hash value of the string
+	 */
+	j9object_t cacheAtUTF8(J9JavaVM *javaVM, U_8 *utf8Data, UDATA utf8Length, U_32 hash);
+	/**
+	 * Record an interned string in the cache, replacing an older entry if all of the probed entries are in use.
+	 * @param hash full hash value of the string
+	 * @param string the interned string
+	 */
+	void cacheAtPut(UDATA hash, j9object_t string);
 
 	/**
 	 * @return hash sub-table count
@@ -137,7 +170,10 @@ public:
 		MM_BaseVirtual(),
 		_tableCount(tableCount),
 		_table(NULL),
-		_mutex(NULL)
+		_mutex(NULL),
+		_cacheSize(0),
+		_cache(NULL),
+		_cacheHash(NULL)
 	{
 		_typeId = __FUNCTION__;
 	}
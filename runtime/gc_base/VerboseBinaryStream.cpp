@@ -0,0 +1,605 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "j9.h"
+#include "j9cfg.h"
+#include "j9port.h"
+#include "mmhook.h"
+#include "mmomrhook.h"
+#include "mmprivatehook.h"
+
+#include <string.h>
+
+#include "VerboseBinaryStream.hpp"
+
+#include "AtomicOperations.hpp"
+#include "CycleState.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensions.hpp"
+#include "Heap.hpp"
+#include "Math.hpp"
+#include "ModronAssertions.h"
+
+static void verboseBinaryCycleStart(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData);
+static void verboseBinaryCycleEnd(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData);
+static void verboseBinaryIncrementStart(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData);
+static void verboseBinaryIncrementEnd(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData);
+static void verboseBinaryClassUnloadingEnd(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData);
+static void verboseBinaryIdlePageRelease(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData);
+static void verboseBinaryPhaseBoundary(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData);
+static void verboseBinaryAllocationFailure(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData);
+static void verboseBinaryExclusiveAccess(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData);
+
+typedef struct VerboseBinaryPhase {
+	const char *name; /**< The name recorded for the phase */
+	UDATA startHooks; /**< VERBOSE_BINARY_HOOKS_* of startEvent */
+	UDATA startEvent; /**< The event starting the phase */
+	UDATA endHooks; /**< VERBOSE_BINARY_HOOKS_* of endEvent */
+	UDATA endEvent; /**< The event ending the phase */
+} VerboseBinaryPhase;
+
+/* the phases timed, by the hooks bracketing them (a collector records the phases it has) */
+static const VerboseBinaryPhase phases[] = {
+	{ "scavenge", VERBOSE_BINARY_HOOKS_OMR, J9HOOK_MM_OMR_LOCAL_GC_START, VERBOSE_BINARY_HOOKS_OMR, J9HOOK_MM_OMR_LOCAL_GC_END },
+	{ "mark", VERBOSE_BINARY_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_MARK_START, VERBOSE_BINARY_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_MARK_END },
+	{ "sweep", VERBOSE_BINARY_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_SWEEP_START, VERBOSE_BINARY_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_SWEEP_END },
+	{ "compact", VERBOSE_BINARY_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_COMPACT_START, VERBOSE_BINARY_HOOKS_OMR, J9HOOK_MM_OMR_COMPACT_END },
+	{ "copy forward", VERBOSE_BINARY_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_COPY_FORWARD_START, VERBOSE_BINARY_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_COPY_FORWARD_END },
+	{ "pgc mark", VERBOSE_BINARY_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_PGC_MARK_START, VERBOSE_BINARY_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_PGC_MARK_END },
+	{ "gmp mark", VERBOSE_BINARY_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_GMP_MARK_START, VERBOSE_BINARY_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_GMP_MARK_END },
+	{ "global mark", VERBOSE_BINARY_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_VLHGC_GLOBAL_GC_MARK_START, VERBOSE_BINARY_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_VLHGC_GLOBAL_GC_MARK_END },
+	{ "reclaim sweep", VERBOSE_BINARY_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_RECLAIM_SWEEP_START, VERBOSE_BINARY_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_RECLAIM_SWEEP_END },
+	{ "reclaim compact", VERBOSE_BINARY_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_RECLAIM_COMPACT_START, VERBOSE_BINARY_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_RECLAIM_COMPACT_END },
+};
+#define VERBOSE_BINARY_PHASE_COUNT (sizeof(phases) / sizeof(phases[0]))
+
+MM_VerboseBinaryStream *
+MM_VerboseBinaryStream::newInstance(MM_EnvironmentBase *env, const char *fileName, UDATA ringSize)
+{
+	MM_VerboseBinaryStream *stream = (MM_VerboseBinaryStream *)env->getForge()->allocate(sizeof(MM_VerboseBinaryStream), MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+	if (NULL != stream) {
+		new(stream) MM_VerboseBinaryStream(env);
+		if (!stream->initialize(env, fileName, ringSize)) {
+			stream->kill(env);
+			stream = NULL;
+		}
+	}
+	return stream;
+}
+
+void
+MM_VerboseBinaryStream::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+MM_VerboseBinaryStream::MM_VerboseBinaryStream(MM_EnvironmentBase *env)
+	: MM_BaseNonVirtual()
+	, _javaVM((J9JavaVM *)env->getOmrVM()->_language_vm)
+	, _extensions(MM_GCExtensions::getExtensions(env))
+	, _mutex(NULL)
+	, _mapping(NULL)
+	, _header(NULL)
+	, _stringTable(NULL)
+	, _ring(NULL)
+	, _cycleTypeCount(0)
+	, _lastId(0)
+	, _incrementId(0)
+	, _incrementCycleId(0)
+	, _hooksRegistered(false)
+{
+	_typeId = __FUNCTION__;
+	memset(_phaseStartTimes, 0, sizeof(_phaseStartTimes));
+}
+
+bool
+MM_VerboseBinaryStream::initialize(MM_EnvironmentBase *env, const char *fileName, UDATA ringSize)
+{
+	PORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	if (0 != omrthread_monitor_init_with_name(&_mutex, 0, "MM_VerboseBinaryStream")) {
+		return false;
+	}
+
+	ringSize = MM_Math::roundToCeiling(J9GCEVT_MINIMUM_RING_SIZE, OMR_MAX(ringSize, (UDATA)J9GCEVT_MINIMUM_RING_SIZE));
+	UDATA headerSize = MM_Math::roundToCeiling(J9GCEVT_RECORD_ALIGNMENT, sizeof(J9GCEventStreamHeader));
+	UDATA fileSize = headerSize + J9GCEVT_STRING_TABLE_SIZE + ringSize;
+
+	IDATA fd = j9file_open(fileName, EsOpenCreate | EsOpenTruncate | EsOpenRead | EsOpenWrite, 0666);
+	if (-1 == fd) {
+		return false;
+	}
+	if (0 != j9file_set_length(fd, (I_64)fileSize)) {
+		j9file_close(fd);
+		return false;
+	}
+	_mapping = (J9MmapHandle *)j9mmap_map_file(fd, 0, fileSize, fileName, J9PORT_MMAP_FLAG_WRITE, OMRMEM_CATEGORY_MM);
+	/* the mapping stays valid once the file is closed */
+	j9file_close(fd);
+	if ((NULL == _mapping) || (NULL == _mapping->pointer)) {
+		_mapping = NULL;
+		return false;
+	}
+
+	_header = (J9GCEventStreamHeader *)_mapping->pointer;
+	_stringTable = (U_8 *)_header + headerSize;
+	_ring = _stringTable + J9GCEVT_STRING_TABLE_SIZE;
+
+	memset(_header, 0, headerSize);
+	strcpy(_header->eyecatcher, J9GCEVT_EYECATCHER);
+	_header->version = J9GCEVT_VERSION;
+	_header->byteOrderMark = J9GCEVT_BYTE_ORDER_MARK;
+	_header->headerSize = (U_32)headerSize;
+	_header->stringTableSize = J9GCEVT_STRING_TABLE_SIZE;
+	_header->ringSize = ringSize;
+	_header->hiresFrequency = j9time_hires_frequency();
+	_header->startHiresClock = j9time_hires_clock();
+	_header->startTimeMillis = (U_64)j9time_current_time_millis();
+
+	J9HookInterface **omrHooks = J9_HOOK_INTERFACE(_extensions->omrHookInterface);
+	J9HookInterface **privateHooks = J9_HOOK_INTERFACE(_extensions->privateHookInterface);
+	J9HookInterface **mmHooks = J9_HOOK_INTERFACE(_extensions->hookInterface);
+	_hooksRegistered = true;
+	if ((0 != (*omrHooks)->J9HookRegisterWithCallSite(omrHooks, J9HOOK_MM_OMR_GC_CYCLE_START, verboseBinaryCycleStart, OMR_GET_CALLSITE(), this))
+		|| (0 != (*privateHooks)->J9HookRegisterWithCallSite(privateHooks, J9HOOK_MM_PRIVATE_GC_POST_CYCLE_END, verboseBinaryCycleEnd, OMR_GET_CALLSITE(), this))
+		|| (0 != (*privateHooks)->J9HookRegisterWithCallSite(privateHooks, J9HOOK_MM_PRIVATE_GC_INCREMENT_START, verboseBinaryIncrementStart, OMR_GET_CALLSITE(), this))
+		|| (0 != (*privateHooks)->J9HookRegisterWithCallSite(privateHooks, J9HOOK_MM_PRIVATE_GC_INCREMENT_END, verboseBinaryIncrementEnd, OMR_GET_CALLSITE(), this))
+		|| (0 != (*mmHooks)->J9HookRegisterWithCallSite(mmHooks, J9HOOK_MM_CLASS_UNLOADING_END, verboseBinaryClassUnloadingEnd, OMR_GET_CALLSITE(), this))
+		|| (0 != (*mmHooks)->J9HookRegisterWithCallSite(mmHooks, J9HOOK_MM_IDLE_PAGE_RELEASE, verboseBinaryIdlePageRelease, OMR_GET_CALLSITE(), this))
+		|| (0 != (*privateHooks)->J9HookRegisterWithCallSite(privateHooks, J9HOOK_MM_PRIVATE_ALLOCATION_FAILURE_START, verboseBinaryAllocationFailure, OMR_GET_CALLSITE(), this))
+		|| (0 != (*privateHooks)->J9HookRegisterWithCallSite(privateHooks, J9HOOK_MM_PRIVATE_EXCLUSIVE_ACCESS, verboseBinaryExclusiveAccess, OMR_GET_CALLSITE(), this))
+	) {
+		return false;
+	}
+
+	Assert_MM_true(VERBOSE_BINARY_PHASE_COUNT <= VERBOSE_BINARY_MAXIMUM_PHASES);
+	for (UDATA i = 0; i < VERBOSE_BINARY_PHASE_COUNT; i++) {
+		J9HookInterface **startHooks = getHooks(phases[i].startHooks);
+		J9HookInterface **endHooks = getHooks(phases[i].endHooks);
+		if ((0 != (*startHooks)->J9HookRegisterWithCallSite(startHooks, phases[i].startEvent, verboseBinaryPhaseBoundary, OMR_GET_CALLSITE(), this))
+			|| (0 != (*endHooks)->J9HookRegisterWithCallSite(endHooks, phases[i].endEvent, verboseBinaryPhaseBoundary, OMR_GET_CALLSITE(), this))
+		) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void
+MM_VerboseBinaryStream::tearDown(MM_EnvironmentBase *env)
+{
+	PORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	if (_hooksRegistered) {
+		J9HookInterface **omrHooks = J9_HOOK_INTERFACE(_extensions->omrHookInterface);
+		J9HookInterface **privateHooks = J9_HOOK_INTERFACE(_extensions->privateHookInterface);
+		J9HookInterface **mmHooks = J9_HOOK_INTERFACE(_extensions->hookInterface);
+		(*omrHooks)->J9HookUnregister(omrHooks, J9HOOK_MM_OMR_GC_CYCLE_START, verboseBinaryCycleStart, this);
+		(*privateHooks)->J9HookUnregister(privateHooks, J9HOOK_MM_PRIVATE_GC_POST_CYCLE_END, verboseBinaryCycleEnd, this);
+		(*privateHooks)->J9HookUnregister(privateHooks, J9HOOK_MM_PRIVATE_GC_INCREMENT_START, verboseBinaryIncrementStart, this);
+		(*privateHooks)->J9HookUnregister(privateHooks, J9HOOK_MM_PRIVATE_GC_INCREMENT_END, verboseBinaryIncrementEnd, this);
+		(*mmHooks)->J9HookUnregister(mmHooks, J9HOOK_MM_CLASS_UNLOADING_END, verboseBinaryClassUnloadingEnd, this);
+		(*mmHooks)->J9HookUnregister(mmHooks, J9HOOK_MM_IDLE_PAGE_RELEASE, verboseBinaryIdlePageRelease, this);
+		(*privateHooks)->J9HookUnregister(privateHooks, J9HOOK_MM_PRIVATE_ALLOCATION_FAILURE_START, verboseBinaryAllocationFailure, this);
+		(*privateHooks)->J9HookUnregister(privateHooks, J9HOOK_MM_PRIVATE_EXCLUSIVE_ACCESS, verboseBinaryExclusiveAccess, this);
+		for (UDATA i = 0; i < VERBOSE_BINARY_PHASE_COUNT; i++) {
+			J9HookInterface **startHooks = getHooks(phases[i].startHooks);
+			J9HookInterface **endHooks = getHooks(phases[i].endHooks);
+			(*startHooks)->J9HookUnregister(startHooks, phases[i].startEvent, verboseBinaryPhaseBoundary, this);
+			(*endHooks)->J9HookUnregister(endHooks, phases[i].endEvent, verboseBinaryPhaseBoundary, this);
+		}
+		_hooksRegistered = false;
+	}
+
+	if (NULL != _mapping) {
+		j9mmap_msync(_mapping->pointer, _mapping->size, J9PORT_MMAP_SYNC_WAIT);
+		j9mmap_unmap_file(_mapping);
+		_mapping = NULL;
+	}
+
+	if (NULL != _mutex) {
+		omrthread_monitor_destroy(_mutex);
+		_mutex = NULL;
+	}
+}
+
+void
+MM_VerboseBinaryStream::writeRecord(U_16 type, U_32 stringId, U_64 timestamp, const U_64 *fields, UDATA fieldCount)
+{
+	U_64 ringSize = _header->ringSize;
+	UDATA recordSize = sizeof(J9GCEventRecordHeader) + (fieldCount * sizeof(U_64));
+
+	omrthread_monitor_enter(_mutex);
+
+	U_64 writeCursor = _header->writeCursor;
+	U_64 tail = ringSize - (writeCursor % ringSize);
+	/* a record never straddles the end of the ring: pad the tail instead */
+	U_64 padSize = (tail < recordSize) ? tail : 0;
+	U_64 newCursor = writeCursor + padSize + recordSize;
+
+	/* retire the records about to be overwritten before touching their bytes */
+	U_64 readCursor = _header->readCursor;
+	while ((newCursor - readCursor) > ringSize) {
+		J9GCEventRecordHeader *oldest = (J9GCEventRecordHeader *)(_ring + (readCursor % ringSize));
+		readCursor += oldest->size;
+	}
+	if (readCursor != _header->readCursor) {
+		_header->readCursor = readCursor;
+		MM_AtomicOperations::storeSync();
+	}
+
+	if (0 != padSize) {
+		J9GCEventRecordHeader *pad = (J9GCEventRecordHeader *)(_ring + (writeCursor % ringSize));
+		pad->size = (U_16)padSize;
+		pad->type = J9GCEVT_RECORD_PAD;
+		writeCursor += padSize;
+	}
+
+	J9GCEventRecordHeader *record = (J9GCEventRecordHeader *)(_ring + (writeCursor % ringSize));
+	record->size = (U_16)recordSize;
+	record->type = type;
+	record->stringId = stringId;
+	record->timestamp = timestamp;
+	memcpy(record + 1, fields, fieldCount * sizeof(U_64));
+
+	/* publish the record only once it is complete */
+	MM_AtomicOperations::storeSync();
+	_header->writeCursor = newCursor;
+	_header->recordCount += 1;
+
+	omrthread_monitor_exit(_mutex);
+}
+
+U_32
+MM_VerboseBinaryStream::internString(const char *string)
+{
+	U_32 id = 0;
+	UDATA count = _header->stringCount;
+	/* pairs with the storeSync publishing stringCount: the first count entries of _strings are visible */
+	MM_AtomicOperations::loadSync();
+
+	/* the table only grows, so a lock-free lookup by address finds every string interned before */
+	for (UDATA i = 0; i < count; i++) {
+		if (string == _strings[i]) {
+			return (U_32)(i + 1);
+		}
+	}
+
+	omrthread_monitor_enter(_mutex);
+	count = _header->stringCount;
+	for (UDATA i = 0; i < count; i++) {
+		if ((string == _strings[i]) || (0 == strcmp(string, _strings[i]))) {
+			id = (U_32)(i + 1);
+			break;
+		}
+	}
+	if (0 == id) {
+		UDATA length = strlen(string);
+		UDATA entrySize = sizeof(U_16) + MM_Math::roundToCeiling(sizeof(U_16), length);
+		if ((count < VERBOSE_BINARY_MAXIMUM_STRINGS) && ((_header->stringTableUsed + entrySize) <= _header->stringTableSize)) {
+			U_8 *entry = _stringTable + _header->stringTableUsed;
+			U_16 entryLength = (U_16)length;
+			memcpy(entry, &entryLength, sizeof(U_16));
+			memcpy(entry + sizeof(U_16), string, length);
+			_strings[count] = string;
+			MM_AtomicOperations::storeSync();
+			_header->stringTableUsed += (U_32)entrySize;
+			_header->stringCount = (U_32)(count + 1);
+			id = (U_32)(count + 1);
+		}
+	}
+	omrthread_monitor_exit(_mutex);
+
+	return id;
+}
+
+const char *
+MM_VerboseBinaryStream::getCycleTypeName(UDATA cycleType)
+{
+	const char *name = NULL;
+
+	switch (cycleType) {
+	case OMR_GC_CYCLE_TYPE_DEFAULT:
+		name = "default";
+		break;
+	case OMR_GC_CYCLE_TYPE_GLOBAL:
+		name = "global";
+		break;
+	case OMR_GC_CYCLE_TYPE_SCAVENGE:
+		name = "scavenge";
+		break;
+	case OMR_GC_CYCLE_TYPE_VLHGC_PARTIAL_GARBAGE_COLLECT:
+		name = "partial gc";
+		break;
+	case OMR_GC_CYCLE_TYPE_VLHGC_GLOBAL_MARK_PHASE:
+		name = "global mark phase";
+		break;
+	case OMR_GC_CYCLE_TYPE_VLHGC_GLOBAL_GARBAGE_COLLECT:
+		name = "global garbage collect";
+		break;
+	default:
+		name = "unknown";
+		break;
+	}
+
+	return name;
+}
+
+U_64 *
+MM_VerboseBinaryStream::getCycleIdSlot(UDATA cycleType)
+{
+	/* only called with the exclusive access of a collection, so the table needs no lock */
+	for (UDATA i = 0; i < _cycleTypeCount; i++) {
+		if (cycleType == _cycleTypes[i]) {
+			return &_cycleIds[i];
+		}
+	}
+	if (_cycleTypeCount < VERBOSE_BINARY_MAXIMUM_CYCLE_TYPES) {
+		_cycleTypes[_cycleTypeCount] = cycleType;
+		_cycleIds[_cycleTypeCount] = 0;
+		_cycleTypeCount += 1;
+		return &_cycleIds[_cycleTypeCount - 1];
+	}
+	return &_cycleIds[VERBOSE_BINARY_MAXIMUM_CYCLE_TYPES - 1];
+}
+
+J9HookInterface **
+MM_VerboseBinaryStream::getHooks(UDATA kind)
+{
+	if (VERBOSE_BINARY_HOOKS_OMR == kind) {
+		return J9_HOOK_INTERFACE(_extensions->omrHookInterface);
+	}
+	return J9_HOOK_INTERFACE(_extensions->privateHookInterface);
+}
+
+U_64
+MM_VerboseBinaryStream::getReason(MM_EnvironmentBase *env)
+{
+	U_64 reason = J9GCEVT_REASON_IMPLICIT;
+
+	if (NULL != env->_cycleState) {
+		if (env->_cycleState->_gcCode.isExplicitGC()) {
+			reason = J9GCEVT_REASON_EXPLICIT;
+		} else if (env->_cycleState->_gcCode.isOutOfMemoryGC()) {
+			reason = J9GCEVT_REASON_OUT_OF_MEMORY;
+		} else if (env->_cycleState->_gcCode.isAggressiveGC()) {
+			reason = J9GCEVT_REASON_AGGRESSIVE;
+		}
+	}
+
+	return reason;
+}
+
+void
+MM_VerboseBinaryStream::cycleStart(MM_EnvironmentBase *env, U_64 timestamp, UDATA cycleType)
+{
+	MM_Heap *heap = _extensions->getHeap();
+	U_64 *cycleId = getCycleIdSlot(cycleType);
+	U_64 fields[J9GCEVT_FIELD_CYCLE_COUNT];
+
+	_lastId += 1;
+	*cycleId = _lastId;
+	fields[J9GCEVT_FIELD_CYCLE_ID] = *cycleId;
+	fields[J9GCEVT_FIELD_CYCLE_FREE_BYTES] = heap->getApproximateActiveFreeMemorySize();
+	fields[J9GCEVT_FIELD_CYCLE_TOTAL_BYTES] = heap->getActiveMemorySize();
+	fields[J9GCEVT_FIELD_CYCLE_REASON] = getReason(env);
+	writeRecord(J9GCEVT_RECORD_CYCLE_START, internString(getCycleTypeName(cycleType)), timestamp, fields, J9GCEVT_FIELD_CYCLE_COUNT);
+}
+
+void
+MM_VerboseBinaryStream::cycleEnd(MM_EnvironmentBase *env, U_64 timestamp, UDATA cycleType)
+{
+	MM_Heap *heap = _extensions->getHeap();
+	U_64 fields[J9GCEVT_FIELD_CYCLE_COUNT];
+
+	fields[J9GCEVT_FIELD_CYCLE_ID] = *getCycleIdSlot(cycleType);
+	fields[J9GCEVT_FIELD_CYCLE_FREE_BYTES] = heap->getApproximateActiveFreeMemorySize();
+	fields[J9GCEVT_FIELD_CYCLE_TOTAL_BYTES] = heap->getActiveMemorySize();
+	fields[J9GCEVT_FIELD_CYCLE_REASON] = getReason(env);
+	writeRecord(J9GCEVT_RECORD_CYCLE_END, internString(getCycleTypeName(cycleType)), timestamp, fields, J9GCEVT_FIELD_CYCLE_COUNT);
+}
+
+void
+MM_VerboseBinaryStream::incrementStart(MM_EnvironmentBase *env, U_64 timestamp)
+{
+	MM_Heap *heap = _extensions->getHeap();
+	UDATA cycleType = (NULL != env->_cycleState) ? env->_cycleState->_type : OMR_GC_CYCLE_TYPE_DEFAULT;
+	U_64 fields[J9GCEVT_FIELD_INCREMENT_COUNT];
+
+	_lastId += 1;
+	_incrementId = _lastId;
+	_incrementCycleId = *getCycleIdSlot(cycleType);
+	fields[J9GCEVT_FIELD_INCREMENT_CYCLE_ID] = _incrementCycleId;
+	fields[J9GCEVT_FIELD_INCREMENT_ID] = _incrementId;
+	fields[J9GCEVT_FIELD_INCREMENT_FREE_BYTES] = heap->getApproximateActiveFreeMemorySize();
+	fields[J9GCEVT_FIELD_INCREMENT_TOTAL_BYTES] = heap->getActiveMemorySize();
+	fields[J9GCEVT_FIELD_INCREMENT_NURSERY_FREE_BYTES] = heap->getApproximateActiveFreeMemorySize(MEMORY_TYPE_NEW);
+	fields[J9GCEVT_FIELD_INCREMENT_NURSERY_TOTAL_BYTES] = heap->getActiveMemorySize(MEMORY_TYPE_NEW);
+	fields[J9GCEVT_FIELD_INCREMENT_TENURE_FREE_BYTES] = heap->getApproximateActiveFreeMemorySize(MEMORY_TYPE_OLD);
+	fields[J9GCEVT_FIELD_INCREMENT_TENURE_TOTAL_BYTES] = heap->getActiveMemorySize(MEMORY_TYPE_OLD);
+	writeRecord(J9GCEVT_RECORD_INCREMENT_START, internString(getCycleTypeName(cycleType)), timestamp, fields, J9GCEVT_FIELD_INCREMENT_COUNT);
+}
+
+void
+MM_VerboseBinaryStream::incrementEnd(MM_EnvironmentBase *env, U_64 timestamp)
+{
+	MM_Heap *heap = _extensions->getHeap();
+	UDATA cycleType = (NULL != env->_cycleState) ? env->_cycleState->_type : OMR_GC_CYCLE_TYPE_DEFAULT;
+	U_64 fields[J9GCEVT_FIELD_INCREMENT_COUNT];
+
+	fields[J9GCEVT_FIELD_INCREMENT_CYCLE_ID] = *getCycleIdSlot(cycleType);
+	fields[J9GCEVT_FIELD_INCREMENT_ID] = _incrementId;
+	fields[J9GCEVT_FIELD_INCREMENT_FREE_BYTES] = heap->getApproximateActiveFreeMemorySize();
+	fields[J9GCEVT_FIELD_INCREMENT_TOTAL_BYTES] = heap->getActiveMemorySize();
+	fields[J9GCEVT_FIELD_INCREMENT_NURSERY_FREE_BYTES] = heap->getApproximateActiveFreeMemorySize(MEMORY_TYPE_NEW);
+	fields[J9GCEVT_FIELD_INCREMENT_NURSERY_TOTAL_BYTES] = heap->getActiveMemorySize(MEMORY_TYPE_NEW);
+	fields[J9GCEVT_FIELD_INCREMENT_TENURE_FREE_BYTES] = heap->getApproximateActiveFreeMemorySize(MEMORY_TYPE_OLD);
+	fields[J9GCEVT_FIELD_INCREMENT_TENURE_TOTAL_BYTES] = heap->getActiveMemorySize(MEMORY_TYPE_OLD);
+	writeRecord(J9GCEVT_RECORD_INCREMENT_END, internString(getCycleTypeName(cycleType)), timestamp, fields, J9GCEVT_FIELD_INCREMENT_COUNT);
+}
+
+void
+MM_VerboseBinaryStream::classUnloadingEnd(U_64 timestamp, U_64 duration, UDATA classLoaderCount, UDATA classCount)
+{
+	PORT_ACCESS_FROM_JAVAVM(_javaVM);
+	U_64 fields[J9GCEVT_FIELD_CLASS_UNLOADING_COUNT];
+
+	fields[J9GCEVT_FIELD_CLASS_UNLOADING_DURATION] = j9time_hires_delta(0, duration, J9PORT_TIME_DELTA_IN_MICROSECONDS);
+	fields[J9GCEVT_FIELD_CLASS_UNLOADING_LOADERS] = classLoaderCount;
+	fields[J9GCEVT_FIELD_CLASS_UNLOADING_CLASSES] = classCount;
+	writeRecord(J9GCEVT_RECORD_CLASS_UNLOADING_END, 0, timestamp, fields, J9GCEVT_FIELD_CLASS_UNLOADING_COUNT);
+}
+
+void
+MM_VerboseBinaryStream::idlePageRelease(U_64 timestamp, UDATA bytesReleased, UDATA rangesReleased, UDATA batches, U_64 rssBefore, U_64 rssAfter, U_64 duration, bool interrupted)
+{
+	U_64 fields[J9GCEVT_FIELD_IDLE_RELEASE_COUNT];
+
+	fields[J9GCEVT_FIELD_IDLE_RELEASE_BYTES] = bytesReleased;
+	fields[J9GCEVT_FIELD_IDLE_RELEASE_RANGES] = rangesReleased;
+	fields[J9GCEVT_FIELD_IDLE_RELEASE_RSS_BEFORE] = rssBefore;
+	fields[J9GCEVT_FIELD_IDLE_RELEASE_RSS_AFTER] = rssAfter;
+	fields[J9GCEVT_FIELD_IDLE_RELEASE_DURATION] = duration;
+	fields[J9GCEVT_FIELD_IDLE_RELEASE_BATCHES] = batches;
+	fields[J9GCEVT_FIELD_IDLE_RELEASE_INTERRUPTED] = interrupted ? 1 : 0;
+	writeRecord(J9GCEVT_RECORD_IDLE_PAGE_RELEASE, 0, timestamp, fields, J9GCEVT_FIELD_IDLE_RELEASE_COUNT);
+}
+
+void
+MM_VerboseBinaryStream::phaseBoundary(J9HookInterface **hook, UDATA eventNum)
+{
+	PORT_ACCESS_FROM_JAVAVM(_javaVM);
+	U_64 now = j9time_hires_clock();
+
+	/* the phase events carry no common timestamp, so the phases are timed here (as by the benchtests harness) */
+	for (UDATA i = 0; i < VERBOSE_BINARY_PHASE_COUNT; i++) {
+		if ((eventNum == phases[i].startEvent) && (hook == getHooks(phases[i].startHooks))) {
+			_phaseStartTimes[i] = now;
+		} else if ((eventNum == phases[i].endEvent) && (hook == getHooks(phases[i].endHooks))) {
+			/* an end without a start is the end of a phase which began before the stream was created */
+			if (0 != _phaseStartTimes[i]) {
+				U_64 fields[J9GCEVT_FIELD_PHASE_COUNT];
+				fields[J9GCEVT_FIELD_PHASE_CYCLE_ID] = _incrementCycleId;
+				fields[J9GCEVT_FIELD_PHASE_DURATION] = j9time_hires_delta(_phaseStartTimes[i], now, J9PORT_TIME_DELTA_IN_MICROSECONDS);
+				writeRecord(J9GCEVT_RECORD_PHASE_END, internString(phases[i].name), now, fields, J9GCEVT_FIELD_PHASE_COUNT);
+				_phaseStartTimes[i] = 0;
+			}
+		}
+	}
+}
+
+void
+MM_VerboseBinaryStream::allocationFailure(U_64 timestamp, UDATA requestedBytes, UDATA subSpaceType)
+{
+	U_64 fields[J9GCEVT_FIELD_ALLOCATION_FAILURE_COUNT];
+
+	fields[J9GCEVT_FIELD_ALLOCATION_FAILURE_BYTES] = requestedBytes;
+	if (MEMORY_TYPE_NEW == subSpaceType) {
+		fields[J9GCEVT_FIELD_ALLOCATION_FAILURE_SPACE] = J9GCEVT_SPACE_NURSERY;
+	} else if (MEMORY_TYPE_OLD == subSpaceType) {
+		fields[J9GCEVT_FIELD_ALLOCATION_FAILURE_SPACE] = J9GCEVT_SPACE_TENURE;
+	} else {
+		fields[J9GCEVT_FIELD_ALLOCATION_FAILURE_SPACE] = J9GCEVT_SPACE_UNKNOWN;
+	}
+	writeRecord(J9GCEVT_RECORD_ALLOCATION_FAILURE, 0, timestamp, fields, J9GCEVT_FIELD_ALLOCATION_FAILURE_COUNT);
+}
+
+void
+MM_VerboseBinaryStream::exclusiveAccess(MM_EnvironmentBase *env)
+{
+	PORT_ACCESS_FROM_JAVAVM(_javaVM);
+	U_64 fields[J9GCEVT_FIELD_EXCLUSIVE_ACCESS_COUNT];
+
+	fields[J9GCEVT_FIELD_EXCLUSIVE_ACCESS_DURATION] = j9time_hires_delta(0, env->getExclusiveAccessTime(), J9PORT_TIME_DELTA_IN_MICROSECONDS);
+	fields[J9GCEVT_FIELD_EXCLUSIVE_ACCESS_MEAN_IDLE] = j9time_hires_delta(0, env->getMeanExclusiveAccessIdleTime(), J9PORT_TIME_DELTA_IN_MICROSECONDS);
+	fields[J9GCEVT_FIELD_EXCLUSIVE_ACCESS_THREADS] = env->getExclusiveAccessHaltedThreads();
+	writeRecord(J9GCEVT_RECORD_EXCLUSIVE_ACCESS, 0, j9time_hires_clock(), fields, J9GCEVT_FIELD_EXCLUSIVE_ACCESS_COUNT);
+}
+
+static void
+verboseBinaryCycleStart(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData)
+{
+	MM_GCCycleStartEvent *event = (MM_GCCycleStartEvent *)eventData;
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->omrVMThread);
+	((MM_VerboseBinaryStream *)userData)->cycleStart(env, event->timestamp, event->cycleType);
+}
+
+static void
+verboseBinaryCycleEnd(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData)
+{
+	MM_GCPostCycleEndEvent *event = (MM_GCPostCycleEndEvent *)eventData;
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	((MM_VerboseBinaryStream *)userData)->cycleEnd(env, event->timestamp, event->cycleType);
+}
+
+static void
+verboseBinaryIncrementStart(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData)
+{
+	MM_GCIncrementStartEvent *event = (MM_GCIncrementStartEvent *)eventData;
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	((MM_VerboseBinaryStream *)userData)->incrementStart(env, event->timestamp);
+}
+
+static void
+verboseBinaryIncrementEnd(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData)
+{
+	MM_GCIncrementEndEvent *event = (MM_GCIncrementEndEvent *)eventData;
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	((MM_VerboseBinaryStream *)userData)->incrementEnd(env, event->timestamp);
+}
+
+static void
+verboseBinaryClassUnloadingEnd(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData)
+{
+	MM_ClassUnloadingEndEvent *event = (MM_ClassUnloadingEndEvent *)eventData;
+	((MM_VerboseBinaryStream *)userData)->classUnloadingEnd(event->timestamp, event->duration, event->classLoaderCount, event->classesCount);
+}
+
+static void
+verboseBinaryIdlePageRelease(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData)
+{
+	MM_IdlePageReleaseEvent *event = (MM_IdlePageReleaseEvent *)eventData;
+	((MM_VerboseBinaryStream *)userData)->idlePageRelease(event->timestamp, event->bytesReleased, event->rangesReleased, event->batches, event->rssBefore, event->rssAfter, event->duration, 0 != event->interrupted);
+}
+
+static void
+verboseBinaryPhaseBoundary(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData)
+{
+	((MM_VerboseBinaryStream *)userData)->phaseBoundary(hook, eventNum);
+}
+
+static void
+verboseBinaryAllocationFailure(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData)
+{
+	MM_AllocationFailureStartEvent *event = (MM_AllocationFailureStartEvent *)eventData;
+	((MM_VerboseBinaryStream *)userData)->allocationFailure(event->timestamp, event->requestedBytes, event->subSpaceType);
+}
+
+static void
+verboseBinaryExclusiveAccess(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData)
+{
+	MM_ExclusiveAccessEvent *event = (MM_ExclusiveAccessEvent *)eventData;
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	((MM_VerboseBinaryStream *)userData)->exclusiveAccess(env);
+}
@@ -0,0 +1,148 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(VERBOSEBINARYSTREAM_HPP_)
+#define VERBOSEBINARYSTREAM_HPP_
+
+#include "j9.h"
+#include "j9cfg.h"
+#include "modron.h"
+#include "VerboseBinaryFormat.h"
+
+#include "BaseNonVirtual.hpp"
+
+class MM_EnvironmentBase;
+class MM_GCExtensions;
+
+#define VERBOSE_BINARY_MAXIMUM_STRINGS 64
+#define VERBOSE_BINARY_MAXIMUM_CYCLE_TYPES 8
+#define VERBOSE_BINARY_MAXIMUM_PHASES 16
+
+/* the hook interfaces of the phase events */
+#define VERBOSE_BINARY_HOOKS_OMR 0
+#define VERBOSE_BINARY_HOOKS_PRIVATE 1
+
+/**
+ * Writes GC events as compact binary records into a memory-mapped ring file (see VerboseBinaryFormat.h).
+ *
+ * Unlike the XML verbose GC output, nothing is formatted while the GC runs: each hooked event copies a handful of
+ * integers into the ring, and strings are interned once in the string table of the file.  The file is decoded
+ * offline (to the verbose GC XML or to JSON) by the gcevtdump tool, and because it is a shared mapping it survives a
+ * crash of the JVM and can be read by a log shipper while the JVM is running.
+ * @ingroup GC_Base
+ */
+class MM_VerboseBinaryStream : public MM_BaseNonVirtual
+{
+private:
+	J9JavaVM *_javaVM; /**< The VM */
+	MM_GCExtensions *_extensions; /**< GC extensions */
+	omrthread_monitor_t _mutex; /**< Serializes writers of the ring and of the string table */
+	J9MmapHandle *_mapping; /**< The mapped file */
+	J9GCEventStreamHeader *_header; /**< Header at the start of the mapping */
+	U_8 *_stringTable; /**< String table, following the header */
+	U_8 *_ring; /**< Record ring, following the string table */
+	const char *_strings[VERBOSE_BINARY_MAXIMUM_STRINGS]; /**< Strings interned so far (index + 1 is the string id) */
+	UDATA _cycleTypes[VERBOSE_BINARY_MAXIMUM_CYCLE_TYPES]; /**< Cycle types seen so far (cycles of different types may overlap) */
+	U_64 _cycleIds[VERBOSE_BINARY_MAXIMUM_CYCLE_TYPES]; /**< Identifier of the current (or last) cycle of each type in _cycleTypes */
+	UDATA _cycleTypeCount; /**< The number of entries in _cycleTypes */
+	U_64 _lastId; /**< The last cycle or increment identifier handed out */
+	U_64 _incrementId; /**< Identifier of the current (or last) increment (increments never overlap) */
+	U_64 _incrementCycleId; /**< Identifier of the cycle of the current (or last) increment */
+	U_64 _phaseStartTimes[VERBOSE_BINARY_MAXIMUM_PHASES]; /**< Hires clock time each phase started (0 if not started) */
+	bool _hooksRegistered; /**< True once the GC hooks have been registered */
+
+public:
+	/**
+	 * Create the stream, map fileName (created or truncated) with a ring of ringSize bytes, and start recording events.
+	 * @param env[in] the current thread
+	 * @param fileName[in] the file to map
+	 * @param ringSize[in] the size of the record ring (rounded up to J9GCEVT_MINIMUM_RING_SIZE)
+	 * @return the new stream, or NULL if the file could not be mapped
+	 */
+	static MM_VerboseBinaryStream *newInstance(MM_EnvironmentBase *env, const char *fileName, UDATA ringSize);
+	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Append a record to the ring, overwriting the oldest records if the ring is full.
+	 * @param type[in] the J9GCEVT_RECORD_* type of the record
+	 * @param stringId[in] the interned string qualifying the record (0 if none)
+	 * @param timestamp[in] the hires clock time of the event
+	 * @param fields[in] the fields of the record
+	 * @param fieldCount[in] the number of fields (at most J9GCEVT_MAXIMUM_FIELD_COUNT)
+	 */
+	void writeRecord(U_16 type, U_32 stringId, U_64 timestamp, const U_64 *fields, UDATA fieldCount);
+
+	/**
+	 * Find or add a string in the string table of the file.  Strings are expected to be literals: they are matched
+	 * by address before they are compared.
+	 * @param string[in] the string to intern
+	 * @return the identifier of the string, or 0 if the string table is full
+	 */
+	U_32 internString(const char *string);
+
+	/**
+	 * @return the name of the given OMR_GC_CYCLE_TYPE_*
+	 */
+	static const char *getCycleTypeName(UDATA cycleType);
+
+	/**
+	 * Hooked event handlers (called through the static hook functions in the implementation).
+	 */
+	void cycleStart(MM_EnvironmentBase *env, U_64 timestamp, UDATA cycleType);
+	void cycleEnd(MM_EnvironmentBase *env, U_64 timestamp, UDATA cycleType);
+	void incrementStart(MM_EnvironmentBase *env, U_64 timestamp);
+	void incrementEnd(MM_EnvironmentBase *env, U_64 timestamp);
+	void classUnloadingEnd(U_64 timestamp, U_64 duration, UDATA classLoaderCount, UDATA classCount);
+	void idlePageRelease(U_64 timestamp, UDATA bytesReleased, UDATA rangesReleased, UDATA batches, U_64 rssBefore, U_64 rssAfter, U_64 duration, bool interrupted);
+	void phaseBoundary(J9HookInterface **hook, UDATA eventNum);
+	void allocationFailure(U_64 timestamp, UDATA requestedBytes, UDATA subSpaceType);
+	void exclusiveAccess(MM_EnvironmentBase *env);
+
+	MM_VerboseBinaryStream(MM_EnvironmentBase *env);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env, const char *fileName, UDATA ringSize);
+	void tearDown(MM_EnvironmentBase *env);
+
+private:
+	/**
+	 * @return the identifier slot of the current cycle of the given type (shared by the overflow types if the table is full)
+	 */
+	U_64 *getCycleIdSlot(UDATA cycleType);
+
+	/**
+	 * @return the hook interface of the given VERBOSE_BINARY_HOOKS_* kind
+	 */
+	J9HookInterface **getHooks(UDATA kind);
+
+	/**
+	 * @return the J9GCEVT_REASON_* of the collection the given thread is running
+	 */
+	static U_64 getReason(MM_EnvironmentBase *env);
+};
+
+#endif /* VERBOSEBINARYSTREAM_HPP_ */
@@ -164,6 +164,7 @@ extern J9_CFUNC void j9gc_objaccess_indexableStoreU64Split(J9VMThread *vmThread,
 extern J9_CFUNC void cleanupMutatorModelJava(J9VMThread* vmThread);
 extern J9_CFUNC j9object_t j9gc_objaccess_mixedObjectReadObject(J9VMThread *vmThread, j9object_t srcObject, UDATA offset, UDATA isVolatile);
 extern J9_CFUNC UDATA j9gc_get_objects_pending_finalization_count(J9JavaVM* vm);
+extern J9_CFUNC void j9gc_get_finalizer_queue_statistics(J9JavaVM* vm, UDATA *maxJobCount, U_64 *lastDrainMillis, U_64 *maxDrainMillis);
 extern J9_CFUNC void j9gc_objaccess_indexableStoreU16(J9VMThread *vmThread, J9IndexableObject *destObject, I_32 index, U_32 value, UDATA isVolatile);
 extern J9_CFUNC void j9gc_objaccess_jniDeleteGlobalReference(J9VMThread *vmThread, j9object_t reference);
 extern J9_CFUNC UDATA isObjectInMemorySpace(J9VMThread *vmThread, void *memorySpace, j9object_t objectPtr);
@@ -259,6 +260,8 @@ extern J9_CFUNC UDATA finalizeObjectCreated(J9VMThread *vmThread, j9object_t obj
 extern J9_CFUNC UDATA forceClassLoaderUnload(J9VMThread *vmThread, J9ClassLoader *classLoader);
 extern J9_CFUNC void finalizeForcedUnfinalizedToFinalizable(J9VMThread *vmThread);
 extern J9_CFUNC void* finalizeForcedClassLoaderUnload(J9VMThread *vmThread);
+extern J9_CFUNC void finalizeReferenceProcessingStarted(J9JavaVM *vm);
+extern J9_CFUNC void finalizeReferenceProcessingProgress(J9JavaVM *vm);
 extern J9_CFUNC void j9gc_runFinalizersOnExit(J9VMThread* vmThread, UDATA run);
 extern J9_CFUNC void j9gc_finalizer_completeFinalizersOnExit(J9VMThread* vmThread);
 
@@ -891,7 +891,10 @@ ownableSynchronizerObjectCreated(J9VMThread *vmThread, j9object_t object)
 {
 	Assert_MM_true(NULL != object);
 	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(vmThread->omrVMThread);
-	env->getGCEnvironment()->_ownableSynchronizerObjectBuffer->add(env, object);
+	/* with lazy discovery the object is left off the lists (its link stays NULL), so no collection ever processes it */
+	if (!MM_GCExtensions::getExtensions(env)->lazyOwnableSynchronizerDiscovery) {
+		env->getGCEnvironment()->_ownableSynchronizerObjectBuffer->add(env, object);
+	}
 	MM_ObjectAllocationInterface *objectAllocation = env->_objectAllocationInterface;
 	if (NULL != objectAllocation) {
 		objectAllocation->getAllocationStats()->_ownableSynchronizerObjectCount += 1;
@@ -101,6 +101,8 @@
 #define J9MODRON_GCCHK_MISC_ALWAYS_DUMP_STACK ((UDATA)0x00004000)
 #define J9MODRON_GCCHK_MISC_DARKMATTER ((UDATA)0x00008000)
 #define J9MODRON_GCCHK_MISC_MIDSCAVENGE ((UDATA)0x00010000)
+#define J9MODRON_GCCHK_MISC_PARALLEL ((UDATA)0x00020000)
+#define J9MODRON_GCCHK_MISC_SAMPLE ((UDATA)0x00040000)
 /** @} */
 
 /**
@@ -112,6 +112,9 @@ GC_CheckCycle::printHelp(J9PortLibrary *portLib)
 	j9tty_printf(PORTLIB, "  check\n");
 	j9tty_printf(PORTLIB, "  nocheck\n");
 	j9tty_printf(PORTLIB, "  maxErrors=X\n");
+	j9tty_printf(PORTLIB, "  parallel          verify the object heap on the GC threads\n");
+	j9tty_printf(PORTLIB, "  sample=X          verify a random X%% of the object heap at each check\n");
+	j9tty_printf(PORTLIB, "  budget=X          stop verifying the object heap after X ms\n");
 
 	j9tty_printf(PORTLIB, "  abort\n");
 	j9tty_printf(PORTLIB, "  noabort\n");
@@ -173,6 +176,10 @@ GC_CheckCycle::initialize(const char *options)
 	UDATA scanFlags = 0, checkFlags = 0, miscFlags;
 	char *scan_start = (char *)options;
 	const char *scan_limit = options + strlen(options);
+	PORT_ACCESS_FROM_PORT(_portLibrary);
+
+	/* seed the generator used by sample= (xorshift requires a non-zero state) */
+	_randomState = j9time_hires_clock() | 1;
 
 	/* set the default miscFlags */
 	miscFlags = J9MODRON_GCCHK_VERBOSE | J9MODRON_GCCHK_MISC_CHECK;
@@ -293,6 +300,27 @@ top:
 							continue;
 						}
 
+						if (try_scan(&scan_start, "parallel")) {
+							miscFlags |= J9MODRON_GCCHK_MISC_PARALLEL;
+							continue;
+						}
+
+						if (try_scan(&scan_start, "sample=")) {
+							if ((0 != scan_udata(&scan_start, &_samplePercent)) || (0 == _samplePercent) || (_samplePercent > 100)) {
+								goto failure;
+							}
+							miscFlags |= J9MODRON_GCCHK_MISC_SAMPLE;
+							continue;
+						}
+
+						if (try_scan(&scan_start, "budget=")) {
+							if (0 != scan_udata(&scan_start, &_timeBudget)) {
+								goto failure;
+							}
+							miscFlags |= J9MODRON_GCCHK_MISC_SAMPLE;
+							continue;
+						}
+
 						if (try_scan(&scan_start, "darkmatter")) {
 							miscFlags |= J9MODRON_GCCHK_MISC_DARKMATTER;
 							continue;
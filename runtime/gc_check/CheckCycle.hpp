@@ -32,6 +32,7 @@
 #include "j9.h"
 #include "j9cfg.h"
 
+#include "AtomicOperations.hpp"
 #include "Base.hpp"
 #include "CheckBase.hpp"
 
@@ -56,7 +57,10 @@ private:
 	UDATA _miscFlags;
 	GCCheckInvokedBy _invokedBy; /**< What stage of GC invoked the check */
 	UDATA _manualCheckInvocation; /**< Allow user to identify which installed GCCheck triggered message */
-	UDATA _errorCount; /**< Number of errors encountered  */
+	volatile UDATA _errorCount; /**< Number of errors encountered  */
+	UDATA _samplePercent; /**< Percentage of the heap units verified by each object heap check (sample=X) */
+	UDATA _timeBudget; /**< Time, in milliseconds, after which an object heap check stops verifying heap units (budget=X, 0 for no limit) */
+	U_64 _randomState; /**< State of the generator used to select the sampled heap units */
 	
 	GC_Check *_checks; /**< Pointer to head of linked list of checks to run in this cycle */
 	
@@ -84,8 +88,23 @@ public:
 	UDATA getMiscFlags() { return _miscFlags; };
 	GCCheckInvokedBy getInvoker() { return _invokedBy; };
 	UDATA getManualCheckNumber() { return _manualCheckInvocation; };
+	UDATA getSamplePercent() { return _samplePercent; };
+	UDATA getTimeBudget() { return _timeBudget; };
 	
-	UDATA nextErrorCount() { return ++_errorCount; };
+	/* Errors may be reported by several threads at once when the object heap is checked in parallel */
+	UDATA nextErrorCount() { return MM_AtomicOperations::add(&_errorCount, 1); };
+
+	/**
+	 * @return the next value from a xorshift generator, used to select and order the sampled heap units
+	 */
+	UDATA
+	nextRandom()
+	{
+		_randomState ^= _randomState << 13;
+		_randomState ^= _randomState >> 7;
+		_randomState ^= _randomState << 17;
+		return (UDATA)_randomState;
+	}
 	
 	/**
 	 * Run the checks
@@ -105,6 +124,9 @@ public:
 		, _invokedBy(invocation_unknown)
 		, _manualCheckInvocation(manualCountInvocation)
 		, _errorCount(0)
+		, _samplePercent(100)
+		, _timeBudget(0)
+		, _randomState(0)
 		, _checks(NULL)
 		, _javaVM(javaVM)
 		, _portLibrary(javaVM->portLibrary)
@@ -41,6 +41,7 @@
 #include "ArrayletLeafIterator.hpp"
 #endif /* defined(J9VM_GC_ARRAYLETS) */
 #include "CheckEngine.hpp"
+#include "AtomicOperations.hpp"
 #include "Base.hpp"
 #include "CheckBase.hpp"
 #include "CheckCycle.hpp"
@@ -114,7 +115,8 @@ GC_CheckEngine::verifyOwnableSynchronizerObjectCounts()
 {
 	bool ret = true;
 
-	if (!MM_GCExtensions::getExtensions(_javaVM)->isConcurrentScavengerEnabled()) {
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(_javaVM);
+	if (!extensions->isConcurrentScavengerEnabled() && !extensions->lazyOwnableSynchronizerDiscovery) {
 		if ((UNINITIALIZED_SIZE_FOR_OWNABLESYNCHRONIER != _ownableSynchronizerObjectCountOnList) && (UNINITIALIZED_SIZE_FOR_OWNABLESYNCHRONIER != _ownableSynchronizerObjectCountOnHeap)) {
 			if (_ownableSynchronizerObjectCountOnList != _ownableSynchronizerObjectCountOnHeap) {
 				PORT_ACCESS_FROM_PORT(_portLibrary);
@@ -1105,7 +1107,7 @@ GC_CheckEngine::checkObjectHeap(J9JavaVM *javaVM, J9MM_IterateObjectDescriptor *
 		result = userData.result;
 	}
 
-	if (!extensions->isConcurrentScavengerEnabled()) {
+	if (!extensions->isConcurrentScavengerEnabled() && !extensions->lazyOwnableSynchronizerDiscovery) {
 		/* check Ownable Synchronizer Object consistency */
 		if ((OBJECT_HEADER_SHAPE_MIXED == J9GC_CLASS_SHAPE(clazz)) && (0 != (J9CLASS_FLAGS(clazz) & J9AccClassOwnableSynchronizer))) {
 			if (NULL == extensions->accessBarrier->isObjectInOwnableSynchronizerList(objectDesc->object)) {
@@ -1389,6 +1391,23 @@ GC_CheckEngine::startNewCheck(GC_Check *check)
 	clearPreviousObjects();
 }
 
+void
+GC_CheckEngine::startWorker(GC_CheckEngine *masterEngine)
+{
+	_cycle = masterEngine->_cycle;
+	_currentCheck = masterEngine->_currentCheck;
+	clearPreviousObjects();
+	clearRegionDescription(&_regionDesc);
+	clearCheckedCache();
+	initializeOwnableSynchronizerCountOnHeap();
+}
+
+void
+GC_CheckEngine::mergeWorker(GC_CheckEngine *workerEngine)
+{
+	MM_AtomicOperations::add(&_ownableSynchronizerObjectCountOnHeap, workerEngine->_ownableSynchronizerObjectCountOnHeap);
+}
+
 /**
  * Ensure the GC internal scope pointers refer to objects within the scope.
  *
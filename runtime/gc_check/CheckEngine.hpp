@@ -123,6 +123,8 @@ protected:
 
 public:
 	MMINLINE J9JavaVM *getJavaVM() { return _javaVM; };
+	MMINLINE GC_CheckReporter *getReporter() { return _reporter; };
+	MMINLINE GC_CheckCycle *getCycle() { return _cycle; };
 
 	void clearPreviousObjects();
 	void pushPreviousObject(J9Object *objectPtr);
@@ -161,6 +163,19 @@ public:
 	void startCheckCycle(J9JavaVM *javaVM, GC_CheckCycle *checkCycle);
 	void endCheckCycle(J9JavaVM *javaVM);
 	void startNewCheck(GC_Check *check);	
+
+	/**
+	 * Prepare this engine to verify part of the current check of masterEngine from another thread.
+	 * The engine shares the reporter and cycle of masterEngine but has its own caches and counts.
+	 * @param masterEngine the engine running the check
+	 */
+	void startWorker(GC_CheckEngine *masterEngine);
+
+	/**
+	 * Fold the counts gathered by a worker engine into this engine.  May be called by several workers at once.
+	 * @param workerEngine an engine prepared with startWorker(this)
+	 */
+	void mergeWorker(GC_CheckEngine *workerEngine);
 	bool isStackDumpAlwaysDisplayed();
 	void copyRegionDescription(J9MM_IterateRegionDescriptor* from, J9MM_IterateRegionDescriptor* to);
 	void clearRegionDescription(J9MM_IterateRegionDescriptor* toClear);
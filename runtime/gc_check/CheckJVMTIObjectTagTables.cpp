@@ -59,10 +59,13 @@ GC_CheckJVMTIObjectTagTables::check()
 	if (NULL != jvmtiData) {
 		GC_JVMTIObjectTagTableListIterator objectTagTableList(jvmtiData->environments);
 		while(NULL != (jvmtiEnv = (J9JVMTIEnv *)objectTagTableList.nextSlot())) {
-			GC_JVMTIObjectTagTableIterator objectTagTableIterator(jvmtiEnv->objectTagTable);
-			while(NULL != (slotPtr = (J9Object **)objectTagTableIterator.nextSlot())) {
-				if (_engine->checkSlotPool(_javaVM, slotPtr, jvmtiEnv->objectTagTable) != J9MODRON_SLOT_ITERATOR_OK ){
-					return;
+			for (UDATA shardIndex = 0; shardIndex < jvmtiEnv->objectTagShardCount; shardIndex++) {
+				J9HashTable *objectTagTable = jvmtiEnv->objectTagShards[shardIndex].table;
+				GC_JVMTIObjectTagTableIterator objectTagTableIterator(objectTagTable);
+				while(NULL != (slotPtr = (J9Object **)objectTagTableIterator.nextSlot())) {
+					if (_engine->checkSlotPool(_javaVM, slotPtr, objectTagTable) != J9MODRON_SLOT_ITERATOR_OK ){
+						return;
+					}
 				}
 			}
 		}
@@ -81,9 +84,11 @@ GC_CheckJVMTIObjectTagTables::print()
 
 		GC_JVMTIObjectTagTableListIterator objectTagTableList(jvmtiData->environments);
 		while(NULL != (jvmtiEnv = (J9JVMTIEnv *)objectTagTableList.nextSlot())) {
-			GC_JVMTIObjectTagTableIterator objectTagTableIterator(jvmtiEnv->objectTagTable);
-			while(NULL != (slotPtr = (J9Object **)objectTagTableIterator.nextSlot())) {
-				formatter.entry((void *)*slotPtr);
+			for (UDATA shardIndex = 0; shardIndex < jvmtiEnv->objectTagShardCount; shardIndex++) {
+				GC_JVMTIObjectTagTableIterator objectTagTableIterator(jvmtiEnv->objectTagShards[shardIndex].table);
+				while(NULL != (slotPtr = (J9Object **)objectTagTableIterator.nextSlot())) {
+					formatter.entry((void *)*slotPtr);
+				}
 			}
 		}
 
@@ -20,10 +20,23 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include "j9.h"
+#include "j9cfg.h"
+#include "j9port.h"
+
+#if !defined(UT_TRACE_OVERHEAD)
+#define UT_TRACE_OVERHEAD -1 /* disable assertions and tracepoints since we're not in the GC module proper */
+#endif
+
+#include "AtomicOperations.hpp"
+#include "CheckCycle.hpp"
 #include "CheckEngine.hpp"
 #include "CheckObjectHeap.hpp"
+#include "Dispatcher.hpp"
+#include "EnvironmentBase.hpp"
 #include "MemorySubSpace.hpp"
 #include "ModronTypes.hpp"
+#include "ParallelTask.hpp"
 #include "ScanFormatter.hpp"
 #include "HeapIteratorAPI.h"
 
@@ -37,6 +50,29 @@ typedef struct ObjectIteratorCallbackUserData {
 	J9MM_IterateRegionDescriptor* regionDesc; /* Temp - used internally by iterator functions */
 } ObjectIteratorCallbackUserData;
 
+/**
+ * Private struct used as the user data for the iterator callbacks which build the region table.
+ * While regions is NULL the regions are only counted.
+ */
+typedef struct RegionCollectorUserData {
+	J9PortLibrary* portLibrary; /* Input */
+	GC_CheckHeapRegion* regions; /* Input */
+	UDATA capacity; /* Input */
+	UDATA count; /* Output */
+} RegionCollectorUserData;
+
+/**
+ * Private struct used as the user data for the walk which finds the first object of each unit of a region.
+ */
+typedef struct FirstObjectIteratorUserData {
+	GC_CheckObjectHeap* check; /* Input */
+	GC_CheckHeapUnit* units; /* Input */
+	UDATA nextUnit; /* Temp - the next unit whose first object is being looked for */
+	UDATA lastUnit; /* Input - the last unit whose first object is needed */
+	UDATA objectCount; /* Temp - objects walked, used to pace the budget checks */
+	bool budgetExhausted; /* Output - true if the walk was abandoned because the budget ran out */
+} FirstObjectIteratorUserData;
+
 /**
  * Iterator callbacks, these are chained to eventually get to objects and their regions.
  */
@@ -44,6 +80,32 @@ static jvmtiIterationControl check_heapIteratorCallback(J9JavaVM* vm, J9MM_Itera
 static jvmtiIterationControl check_spaceIteratorCallback(J9JavaVM* vm, J9MM_IterateSpaceDescriptor* spaceDesc, void* userData);
 static jvmtiIterationControl check_regionIteratorCallback(J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDesc, void* userData);
 static jvmtiIterationControl check_objectIteratorCallback(J9JavaVM* vm, J9MM_IterateObjectDescriptor* objectDesc, void* userData);
+static jvmtiIterationControl collect_heapIteratorCallback(J9JavaVM* vm, J9MM_IterateHeapDescriptor* heapDesc, void* userData);
+static jvmtiIterationControl collect_spaceIteratorCallback(J9JavaVM* vm, J9MM_IterateSpaceDescriptor* spaceDesc, void* userData);
+static jvmtiIterationControl collect_regionIteratorCallback(J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDesc, void* userData);
+static jvmtiIterationControl check_firstObjectIteratorCallback(J9JavaVM* vm, J9MM_IterateObjectDescriptor* objectDesc, void* userData);
+
+/**
+ * Verifies the selected units of the object heap on each of the GC threads.
+ */
+class GC_CheckObjectHeapTask : public MM_ParallelTask
+{
+private:
+	GC_CheckObjectHeap *_check; /**< The check whose units are verified */
+	UDATA _vmState; /**< The vmState of the thread which invoked the check */
+
+public:
+	virtual UDATA getVMStateID() { return _vmState; }
+	virtual void run(MM_EnvironmentBase *env) { _check->checkUnits(env, false); }
+
+	GC_CheckObjectHeapTask(MM_EnvironmentBase *env, MM_Dispatcher *dispatcher, GC_CheckObjectHeap *check, UDATA vmState)
+		: MM_ParallelTask(env, dispatcher)
+		, _check(check)
+		, _vmState(vmState)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
 
 GC_Check *
 GC_CheckObjectHeap::newInstance(J9JavaVM *javaVM, GC_CheckEngine *engine)
@@ -66,6 +128,41 @@ GC_CheckObjectHeap::kill()
 
 void
 GC_CheckObjectHeap::check()
+{
+	GC_CheckCycle *cycle = _engine->getCycle();
+
+	if ((0 == (cycle->getMiscFlags() & (J9MODRON_GCCHK_MISC_PARALLEL | J9MODRON_GCCHK_MISC_SAMPLE))) || !prepareUnits()) {
+		checkAllRegions();
+		return;
+	}
+
+	PORT_ACCESS_FROM_PORT(_portLibrary);
+	I_64 startTime = j9time_current_time_millis();
+	J9VMThread *vmThread = _javaVM->internalVMFunctions->currentVMThread(_javaVM);
+
+	if (canCheckInParallel(vmThread)) {
+		MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(vmThread->omrVMThread);
+		GC_CheckObjectHeapTask checkTask(env, _extensions->dispatcher, this, vmThread->omrVMThread->vmState);
+		_extensions->dispatcher->run(env, &checkTask);
+	} else {
+		checkUnits(NULL, true);
+	}
+
+	if (J9MODRON_GCCHK_MISC_SAMPLE == (cycle->getMiscFlags() & J9MODRON_GCCHK_MISC_SAMPLE)) {
+		/* only part of the heap was verified, so its ownable synchronizer count can not be compared with the lists */
+		_engine->clearCountsForOwnableSynchronizerObjects();
+	}
+
+	if (J9MODRON_GCCHK_VERBOSE == (cycle->getMiscFlags() & J9MODRON_GCCHK_VERBOSE)) {
+		j9tty_printf(PORTLIB, "  <gc check: verified %zu of %zu heap units (%zu selected) in %lld ms>\n",
+				_unitsChecked, _unitCount, _selectedUnitCount, j9time_current_time_millis() - startTime);
+	}
+
+	freeUnits();
+}
+
+void
+GC_CheckObjectHeap::checkAllRegions()
 {
 	/* Check by using the HeapIteratorAPI */
 	ObjectIteratorCallbackUserData userData;
@@ -75,6 +172,217 @@ GC_CheckObjectHeap::check()
 	_javaVM->memoryManagerFunctions->j9mm_iterate_heaps(_javaVM, _portLibrary, 0, check_heapIteratorCallback, &userData);
 }
 
+bool
+GC_CheckObjectHeap::prepareUnits()
+{
+	MM_Forge *forge = _extensions->getForge();
+	GC_CheckCycle *cycle = _engine->getCycle();
+	UDATA samplePercent = cycle->getSamplePercent();
+	RegionCollectorUserData userData;
+	userData.portLibrary = _portLibrary;
+	userData.regions = NULL;
+	userData.capacity = 0;
+	userData.count = 0;
+
+	/* count the regions, then record them */
+	_javaVM->memoryManagerFunctions->j9mm_iterate_heaps(_javaVM, _portLibrary, 0, collect_heapIteratorCallback, &userData);
+	userData.capacity = userData.count;
+	userData.count = 0;
+	_regions = (GC_CheckHeapRegion *)forge->allocate(sizeof(GC_CheckHeapRegion) * userData.capacity, MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+	if (NULL == _regions) {
+		return false;
+	}
+	userData.regions = _regions;
+	_javaVM->memoryManagerFunctions->j9mm_iterate_heaps(_javaVM, _portLibrary, 0, collect_heapIteratorCallback, &userData);
+	_regionCount = userData.count;
+
+	/* cut each object region into units of at most J9MODRON_GCCHK_HEAP_UNIT_SIZE bytes */
+	_unitCount = 0;
+	for (UDATA i = 0; i < _regionCount; i++) {
+		GC_CheckHeapRegion *region = &_regions[i];
+		region->firstUnit = _unitCount;
+		region->unitCount = 1;
+		if (0 != region->regionDesc.objectAlignment) {
+			region->unitCount = OMR_MAX(1, (region->regionDesc.regionSize + J9MODRON_GCCHK_HEAP_UNIT_SIZE - 1) / J9MODRON_GCCHK_HEAP_UNIT_SIZE);
+		}
+		_unitCount += region->unitCount;
+	}
+	_units = (GC_CheckHeapUnit *)forge->allocate(sizeof(GC_CheckHeapUnit) * _unitCount, MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+	_selectedUnits = (UDATA *)forge->allocate(sizeof(UDATA) * _unitCount, MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+	if ((NULL == _units) || (NULL == _selectedUnits)) {
+		freeUnits();
+		return false;
+	}
+
+	_selectedUnitCount = 0;
+	for (UDATA i = 0; i < _regionCount; i++) {
+		GC_CheckHeapRegion *region = &_regions[i];
+		U_8 *regionStart = (U_8 *)region->regionDesc.regionStart;
+		U_8 *regionEnd = regionStart + region->regionDesc.regionSize;
+		for (UDATA j = 0; j < region->unitCount; j++) {
+			GC_CheckHeapUnit *unit = &_units[region->firstUnit + j];
+			unit->regionIndex = i;
+			unit->base = regionStart + (j * J9MODRON_GCCHK_HEAP_UNIT_SIZE);
+			unit->top = (j + 1 == region->unitCount) ? regionEnd : (U_8 *)unit->base + J9MODRON_GCCHK_HEAP_UNIT_SIZE;
+			/* the first object of every other unit is found by the thread which first needs it */
+			unit->firstObject = (0 == j) ? unit->base : NULL;
+			unit->found = (0 == j);
+			unit->selected = (samplePercent >= 100) || ((cycle->nextRandom() % 100) < samplePercent);
+			if (unit->selected) {
+				_selectedUnits[_selectedUnitCount] = region->firstUnit + j;
+				_selectedUnitCount += 1;
+			}
+		}
+	}
+
+	_deadline = 0;
+	if (0 != cycle->getTimeBudget()) {
+		PORT_ACCESS_FROM_PORT(_portLibrary);
+		/* verify the units in a random order so that a budget which runs out part way does not always favour the low end of the heap */
+		for (UDATA i = _selectedUnitCount; i > 1; i--) {
+			UDATA j = cycle->nextRandom() % i;
+			UDATA swap = _selectedUnits[i - 1];
+			_selectedUnits[i - 1] = _selectedUnits[j];
+			_selectedUnits[j] = swap;
+		}
+		_deadline = j9time_current_time_millis() + (I_64)cycle->getTimeBudget();
+	}
+	_unitsChecked = 0;
+
+	return true;
+}
+
+void
+GC_CheckObjectHeap::freeUnits()
+{
+	MM_Forge *forge = _extensions->getForge();
+
+	if (NULL != _selectedUnits) {
+		forge->free(_selectedUnits);
+		_selectedUnits = NULL;
+	}
+	if (NULL != _units) {
+		forge->free(_units);
+		_units = NULL;
+	}
+	if (NULL != _regions) {
+		forge->free(_regions);
+		_regions = NULL;
+	}
+	_selectedUnitCount = 0;
+	_unitCount = 0;
+	_regionCount = 0;
+}
+
+bool
+GC_CheckObjectHeap::canCheckInParallel(J9VMThread *vmThread)
+{
+	GC_CheckCycle *cycle = _engine->getCycle();
+
+	if ((0 == (cycle->getMiscFlags() & J9MODRON_GCCHK_MISC_PARALLEL)) || (NULL == vmThread) || (invocation_debugger == cycle->getInvoker())) {
+		return false;
+	}
+	/* Metronome GC threads can only run incremental tasks */
+	if (_extensions->isMetronomeGC() || (NULL == _extensions->dispatcher) || (1 >= _extensions->dispatcher->threadCount())) {
+		return false;
+	}
+	/* a check invoked from within a GC task (J9HOOK_MM_PRIVATE_INVOKE_GC_CHECK) can not dispatch another one */
+	return NULL == MM_EnvironmentBase::getEnvironment(vmThread->omrVMThread)->_currentTask;
+}
+
+bool
+GC_CheckObjectHeap::isBudgetExhausted()
+{
+	PORT_ACCESS_FROM_PORT(_portLibrary);
+	return (0 != _deadline) && (j9time_current_time_millis() >= _deadline);
+}
+
+void
+GC_CheckObjectHeap::checkUnits(MM_EnvironmentBase *env, bool singleThread)
+{
+	/* each thread verifies with its own engine, so the engine caches and counts need no synchronization */
+	GC_CheckEngine engine(_javaVM, _engine->getReporter());
+	engine.startWorker(_engine);
+
+	for (UDATA i = 0; i < _selectedUnitCount; i++) {
+		if (singleThread || J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			if (isBudgetExhausted()) {
+				break;
+			}
+			checkUnit(&engine, &_units[_selectedUnits[i]]);
+		}
+	}
+
+	_engine->mergeWorker(&engine);
+}
+
+void
+GC_CheckObjectHeap::setFirstObject(GC_CheckHeapUnit *unit, void *object)
+{
+	if (!unit->found) {
+		unit->firstObject = object;
+		/* publish the object before the flag which says it is valid */
+		MM_AtomicOperations::storeSync();
+		unit->found = true;
+	}
+}
+
+bool
+GC_CheckObjectHeap::findFirstObject(GC_CheckHeapUnit *unit)
+{
+	if (unit->found) {
+		MM_AtomicOperations::loadSync();
+		return true;
+	}
+
+	/* walk from the nearest earlier unit which has an object starting in it (the first unit of a region always does) */
+	UDATA unitIndex = unit - _units;
+	UDATA startIndex = unitIndex - 1;
+	while (!_units[startIndex].found || (NULL == _units[startIndex].firstObject)) {
+		startIndex -= 1;
+	}
+	MM_AtomicOperations::loadSync();
+
+	FirstObjectIteratorUserData userData;
+	userData.check = this;
+	userData.units = _units;
+	userData.nextUnit = startIndex + 1;
+	userData.lastUnit = unitIndex;
+	userData.objectCount = 0;
+	userData.budgetExhausted = false;
+	_javaVM->memoryManagerFunctions->j9mm_iterate_region_objects_in_range(_javaVM, _portLibrary, &_regions[unit->regionIndex].regionDesc,
+			_units[startIndex].firstObject, unit->top, j9mm_iterator_flag_include_holes, check_firstObjectIteratorCallback, &userData);
+	if (userData.budgetExhausted) {
+		return false;
+	}
+
+	/* no object starts in the units left after walking to the top of this one: they are covered by an earlier object */
+	for (UDATA i = userData.nextUnit; i <= unitIndex; i++) {
+		setFirstObject(&_units[i], NULL);
+	}
+	return true;
+}
+
+void
+GC_CheckObjectHeap::checkUnit(GC_CheckEngine *engine, GC_CheckHeapUnit *unit)
+{
+	if (!findFirstObject(unit)) {
+		return;
+	}
+
+	/* a unit without a first object is covered by an object starting in an earlier unit */
+	if (NULL != unit->firstObject) {
+		ObjectIteratorCallbackUserData userData;
+		userData.engine = engine;
+		userData.portLibrary = _portLibrary;
+		userData.regionDesc = &_regions[unit->regionIndex].regionDesc;
+		engine->clearPreviousObjects();
+		_javaVM->memoryManagerFunctions->j9mm_iterate_region_objects_in_range(_javaVM, _portLibrary, userData.regionDesc,
+				unit->firstObject, unit->top, j9mm_iterator_flag_include_holes, check_objectIteratorCallback, &userData);
+		MM_AtomicOperations::add(&_unitsChecked, 1);
+	}
+}
+
 void
 GC_CheckObjectHeap::print()
 {
@@ -118,3 +426,58 @@ check_objectIteratorCallback(J9JavaVM* vm, J9MM_IterateObjectDescriptor* objectD
 	castUserData->engine->pushPreviousObject(objectDesc->object);
 	return JVMTI_ITERATION_CONTINUE;
 }
+
+static jvmtiIterationControl
+collect_heapIteratorCallback(J9JavaVM* vm, J9MM_IterateHeapDescriptor* heapDesc, void* userData)
+{
+	RegionCollectorUserData* castUserData = (RegionCollectorUserData*)userData;
+	vm->memoryManagerFunctions->j9mm_iterate_spaces(vm, castUserData->portLibrary, heapDesc, 0, collect_spaceIteratorCallback, castUserData);
+	return JVMTI_ITERATION_CONTINUE;
+}
+
+static jvmtiIterationControl
+collect_spaceIteratorCallback(J9JavaVM* vm, J9MM_IterateSpaceDescriptor* spaceDesc, void* userData)
+{
+	RegionCollectorUserData* castUserData = (RegionCollectorUserData*)userData;
+	vm->memoryManagerFunctions->j9mm_iterate_regions(vm, castUserData->portLibrary, spaceDesc, 0, collect_regionIteratorCallback, castUserData);
+	return JVMTI_ITERATION_CONTINUE;
+}
+
+static jvmtiIterationControl
+collect_regionIteratorCallback(J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDesc, void* userData)
+{
+	RegionCollectorUserData* castUserData = (RegionCollectorUserData*)userData;
+	if (NULL != castUserData->regions) {
+		if (castUserData->count >= castUserData->capacity) {
+			return JVMTI_ITERATION_ABORT;
+		}
+		castUserData->regions[castUserData->count].regionDesc = *regionDesc;
+	}
+	castUserData->count += 1;
+	return JVMTI_ITERATION_CONTINUE;
+}
+
+static jvmtiIterationControl
+check_firstObjectIteratorCallback(J9JavaVM* vm, J9MM_IterateObjectDescriptor* objectDesc, void* userData)
+{
+	FirstObjectIteratorUserData* castUserData = (FirstObjectIteratorUserData*)userData;
+	GC_CheckHeapUnit* units = castUserData->units;
+	void* object = objectDesc->object;
+
+	/* the object is the first object of the unit it starts in; units it has skipped over have none */
+	while ((castUserData->nextUnit <= castUserData->lastUnit) && (object >= units[castUserData->nextUnit].base)) {
+		GC_CheckHeapUnit* unit = &units[castUserData->nextUnit];
+		castUserData->check->setFirstObject(unit, (object < unit->top) ? object : NULL);
+		castUserData->nextUnit += 1;
+	}
+	if (castUserData->nextUnit > castUserData->lastUnit) {
+		return JVMTI_ITERATION_ABORT;
+	}
+
+	castUserData->objectCount += 1;
+	if ((0 == (castUserData->objectCount % 1024)) && castUserData->check->isBudgetExhausted()) {
+		castUserData->budgetExhausted = true;
+		return JVMTI_ITERATION_ABORT;
+	}
+	return JVMTI_ITERATION_CONTINUE;
+}
@@ -32,24 +32,124 @@
 #include "j9cfg.h"
 
 #include "Check.hpp"
+#include "HeapIteratorAPI.h"
+
+class MM_EnvironmentBase;
+
+/**
+ * Largest slice of a heap region verified as a single unit when the object heap is checked in parallel or sampled.
+ */
+#define J9MODRON_GCCHK_HEAP_UNIT_SIZE ((UDATA)16 * 1024 * 1024)
+
+/**
+ * A heap region as reported by the heap iterator API, and the range of units which cover it.
+ */
+typedef struct GC_CheckHeapRegion {
+	J9MM_IterateRegionDescriptor regionDesc; /**< Copy of the region descriptor */
+	UDATA firstUnit; /**< Index of the first unit of the region */
+	UDATA unitCount; /**< Number of units covering the region */
+} GC_CheckHeapRegion;
+
+/**
+ * A slice of a heap region which is verified as one work unit.
+ */
+typedef struct GC_CheckHeapUnit {
+	UDATA regionIndex; /**< Index of the region containing the unit */
+	void *base; /**< Nominal start of the unit */
+	void *top; /**< Nominal end of the unit (start of the next unit or end of the region) */
+	void *volatile firstObject; /**< First object starting in [base, top), NULL if there is none (only valid once found) */
+	volatile bool found; /**< True once firstObject has been found */
+	bool selected; /**< True if the unit is verified by this check */
+} GC_CheckHeapUnit;
 
 /**
- * 
+ * Verify every object in the heap.
+ * By default the heap is walked region by region on the invoking thread.  With the parallel or sample=/budget=
+ * options, the regions are cut into units of at most J9MODRON_GCCHK_HEAP_UNIT_SIZE bytes which are verified by
+ * the GC threads and/or sampled, so that the check remains affordable on large heaps.
  */
 class GC_CheckObjectHeap : public GC_Check
 {
 private:
+	GC_CheckHeapRegion *_regions; /**< The regions of the heap (unit mode only) */
+	UDATA _regionCount; /**< The number of entries in _regions */
+	GC_CheckHeapUnit *_units; /**< The units covering the regions, in address order within each region */
+	UDATA _unitCount; /**< The number of entries in _units */
+	UDATA *_selectedUnits; /**< Indices of the units to verify, in the order they should be verified */
+	UDATA _selectedUnitCount; /**< The number of entries in _selectedUnits */
+	I_64 _deadline; /**< Time (in milliseconds) after which no further units are verified, 0 if there is no budget */
+	volatile UDATA _unitsChecked; /**< The number of units verified so far by this check */
+
 	virtual void check(); /**< run the check */
 	virtual void print(); /**< dump the check structure to tty */
 
+	/**
+	 * Walk every region of the heap on the current thread.
+	 */
+	void checkAllRegions();
+
+	/**
+	 * Build the region and unit tables and select the units to verify.
+	 * @return false if the tables could not be allocated
+	 */
+	bool prepareUnits();
+
+	/**
+	 * Free the tables built by prepareUnits().
+	 */
+	void freeUnits();
+
+	/**
+	 * @return true if the object heap can be checked by the GC threads on behalf of vmThread
+	 */
+	bool canCheckInParallel(J9VMThread *vmThread);
+
+	/**
+	 * Find the first object of a unit, walking its region from the nearest earlier unit whose first object is
+	 * already known.  The first object of every unit passed on the way is recorded for the other threads.
+	 * @return true if the first object of the unit was found, false if the budget ran out first
+	 */
+	bool findFirstObject(GC_CheckHeapUnit *unit);
+
+	/**
+	 * Verify the objects starting in a unit.
+	 */
+	void checkUnit(GC_CheckEngine *engine, GC_CheckHeapUnit *unit);
+
 public:
 	static GC_Check *newInstance(J9JavaVM *javaVM, GC_CheckEngine *engine);
 	virtual void kill();
 
 	virtual const char *getCheckName() { return "HEAP"; };
 
+	/**
+	 * Verify the selected units.  Called by each GC thread of the parallel check, or by the invoking thread alone.
+	 * @param env the calling thread (may be NULL if singleThread)
+	 * @param singleThread true if no other thread is sharing the work
+	 */
+	void checkUnits(MM_EnvironmentBase *env, bool singleThread);
+
+	/**
+	 * @return true if the time budget of the check has expired
+	 */
+	bool isBudgetExhausted();
+
+	/**
+	 * Record the first object of a unit (NULL if no object starts in the unit).
+	 * Threads walking overlapping parts of a region find the same objects, so the unit may be recorded more than once.
+	 */
+	void setFirstObject(GC_CheckHeapUnit *unit, void *object);
+
 	GC_CheckObjectHeap(J9JavaVM *javaVM, GC_CheckEngine *engine) :
 		GC_Check(javaVM, engine)
+		, _regions(NULL)
+		, _regionCount(0)
+		, _units(NULL)
+		, _unitCount(0)
+		, _selectedUnits(NULL)
+		, _selectedUnitCount(0)
+		, _deadline(0)
+		, _unitsChecked(0)
 	{}
 };
 
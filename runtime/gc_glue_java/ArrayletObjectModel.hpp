@@ -166,6 +166,39 @@ public:
 		return numberArraylets * _omrVM->_arrayletLeafSize;
 	}
 
+	/**
+	 * Get the data of an array whose external arraylet leaves are adjacent in the heap, in arrayoid order, so that the
+	 * data can be addressed as a single block starting at the first leaf (see -XXgc:tarokEnableContiguousArrayletLeaves).
+	 * Leaves never move once they are attached to a spine, so the result does not change over the life of the array.
+	 * @param objPtr Pointer to an array object
+	 * @return the address of the first element, or NULL if the data of the array is not all held in adjacent leaves
+	 */
+	MMINLINE void *
+	getDataPointerForContiguousLeaves(J9IndexableObject *objPtr)
+	{
+		ArrayLayout layout = getArrayLayout(objPtr);
+		UDATA arrayletLeafSize = _omrVM->_arrayletLeafSize;
+		if ((Discontiguous != layout) && ((Hybrid != layout) || (0 != (getDataSizeInBytes(objPtr) & (arrayletLeafSize - 1))))) {
+			/* some of the data is held in the spine */
+			return NULL;
+		}
+
+		UDATA leafCount = numExternalArraylets(objPtr);
+		if (0 == leafCount) {
+			return NULL;
+		}
+		fj9object_t *arrayoidPtr = getArrayoidPointer(objPtr);
+		GC_SlotObject firstLeafSlot(_omrVM, &arrayoidPtr[0]);
+		U_8 *firstLeaf = (U_8 *)firstLeafSlot.readReferenceFromSlot();
+		for (UDATA i = 1; i < leafCount; i++) {
+			GC_SlotObject leafSlot(_omrVM, &arrayoidPtr[i]);
+			if ((void *)(firstLeaf + (i * arrayletLeafSize)) != (void *)leafSlot.readReferenceFromSlot()) {
+				return NULL;
+			}
+		}
+		return firstLeaf;
+	}
+
 	/**
 	 * Determine if the specified array object includes any arraylet leaf pointers.
 	 * @param objPtr[in] the object to test
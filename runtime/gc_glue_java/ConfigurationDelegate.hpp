@@ -41,6 +41,7 @@
 #include "HeapRegionManager.hpp"
 #include "ObjectAccessBarrier.hpp"
 #include "ObjectAllocationInterface.hpp"
+#include "StringDeduplicator.hpp"
 #include "StringTable.hpp"
 
 
@@ -144,6 +145,11 @@ public:
 			extensions->classLoaderManager = NULL;
 		}
 
+		if (NULL != extensions->stringDeduplicator) {
+			extensions->stringDeduplicator->kill(env);
+			extensions->stringDeduplicator = NULL;
+		}
+
 		if (NULL != extensions->stringTable) {
 			extensions->stringTable->kill(env);
 			extensions->stringTable = NULL;
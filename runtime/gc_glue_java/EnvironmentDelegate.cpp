@@ -22,6 +22,7 @@
 #include "j9protos.h"
 #include "ModronAssertions.h"
 
+#include "AllocationProfiler.hpp"
 #include "EnvironmentBase.hpp"
 #include "EnvironmentDelegate.hpp"
 #include "GCExtensions.hpp"
@@ -100,6 +101,20 @@ MM_EnvironmentDelegate::tearDown()
 		_gcEnv._ownableSynchronizerObjectBuffer->kill(_env);
 		_gcEnv._ownableSynchronizerObjectBuffer = NULL;
 	}
+
+	if (NULL != _gcEnv._allocationSampleBuffer) {
+		MM_AllocationProfiler *allocationProfiler = MM_GCExtensions::getExtensions(_env)->allocationProfiler;
+		if (NULL != allocationProfiler) {
+			allocationProfiler->flushThreadBuffer(_env);
+		}
+		_env->getForge()->free(_gcEnv._allocationSampleBuffer);
+		_gcEnv._allocationSampleBuffer = NULL;
+	}
+
+	if (NULL != _gcEnv._stackScanSplitStates) {
+		_env->getForge()->free(_gcEnv._stackScanSplitStates);
+		_gcEnv._stackScanSplitStates = NULL;
+	}
 }
 
 OMR_VMThread *
@@ -31,7 +31,10 @@
 
 struct OMR_VMThread;
 
+struct J9StackWalkState;
+struct MM_AllocationSampleBuffer;
 class MM_EnvironmentBase;
+class MM_HeapRegionDescriptor;
 class MM_OwnableSynchronizerObjectBuffer;
 class MM_ReferenceObjectBuffer;
 class MM_UnfinalizedObjectBuffer;
@@ -44,6 +47,10 @@ private:
 protected:
 
 public:
+	enum {
+		STACK_WATERMARK_MAX_REGIONS = 8 /**< A stack referring to more heap regions than this is not stamped by copy-forward */
+	};
+
 	MM_MarkJavaStats _markJavaStats;
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	MM_ScavengerJavaStats _scavengerJavaStats;
@@ -51,6 +58,18 @@ public:
 	MM_ReferenceObjectBuffer *_referenceObjectBuffer; /**< The thread-specific buffer of recently discovered reference objects */
 	MM_UnfinalizedObjectBuffer *_unfinalizedObjectBuffer; /**< The thread-specific buffer of recently allocated unfinalized objects */
 	MM_OwnableSynchronizerObjectBuffer *_ownableSynchronizerObjectBuffer; /**< The thread-specific buffer of recently allocated ownable synchronizer objects */
+	MM_AllocationSampleBuffer *_allocationSampleBuffer; /**< The thread-specific buffer of allocation profile samples (NULL until the thread is first sampled) */
+
+	/* The following describe the stack of this (mutator) thread as seen by the GC threads scanning it */
+	J9StackWalkState *_stackScanSplitStates; /**< Walk states at the unit boundaries of the stack (NULL until the stack is first split) */
+	volatile UDATA _stackScanClaimToken; /**< Claim token for the units of a split stack: the unit count in the high half and the index of the next unit to be scanned in the low half */
+	UDATA _stackWatermark; /**< Epoch of the scavenge or copy-forward which last stamped the stack, 0 once the thread has run since */
+	UDATA _stackWatermarkRegionCount; /**< The number of heap regions the stamped stack refers to (copy-forward only) */
+	MM_HeapRegionDescriptor *_stackWatermarkRegions[STACK_WATERMARK_MAX_REGIONS]; /**< The heap regions the stamped stack refers to (copy-forward only) */
+	U_64 _stackScanTime; /**< Time spent scanning the stack since last reported (maintained only while root scanner stats are enabled) */
+	UDATA _stackScanUnits; /**< The number of stack units scanned since last reported (maintained only while root scanner stats are enabled) */
+	UDATA _stackScanSkips; /**< The number of stack scans skipped since last reported (maintained only while root scanner stats are enabled) */
+	UDATA _stackScanSplits; /**< The number of times the stack was split since last reported (maintained only while root scanner stats are enabled) */
 
 	/* Function members */
 private:
@@ -60,6 +79,15 @@ public:
 		:_referenceObjectBuffer(NULL)
 		,_unfinalizedObjectBuffer(NULL)
 		,_ownableSynchronizerObjectBuffer(NULL)
+		,_allocationSampleBuffer(NULL)
+		,_stackScanSplitStates(NULL)
+		,_stackScanClaimToken(0)
+		,_stackWatermark(0)
+		,_stackWatermarkRegionCount(0)
+		,_stackScanTime(0)
+		,_stackScanUnits(0)
+		,_stackScanSkips(0)
+		,_stackScanSplits(0)
 	{}
 };
 
@@ -66,6 +66,43 @@ public:
 #endif /* defined(J9VM_GC_NON_ZERO_TLH) */
 		return &static_cast<J9VMThread*>(env->getLanguageVMThread())->tlhPrefetchFTA;
 	}
+
+	/**
+	 * Set the size requested by the next refresh of the thread's TLHs (both zeroed and non-zeroed, if enabled).
+	 */
+	void setRefreshSize(MM_EnvironmentBase* env, UDATA refreshSize) {
+		getLanguageThreadLocalHeapStruct(env, true)->refreshSize = refreshSize;
+#if defined(J9VM_GC_NON_ZERO_TLH)
+		getLanguageThreadLocalHeapStruct(env, false)->refreshSize = refreshSize;
+#endif /* defined(J9VM_GC_NON_ZERO_TLH) */
+	}
+
+	/**
+	 * @return the number of bytes not yet allocated from the thread's current TLHs (both zeroed and non-zeroed, if enabled)
+	 */
+	UDATA getUnusedBytes(MM_EnvironmentBase* env) {
+		UDATA unusedBytes = (UDATA)(*getPointerToHeapTop(env, true) - *getPointerToHeapAlloc(env, true));
+#if defined(J9VM_GC_NON_ZERO_TLH)
+		unusedBytes += (UDATA)(*getPointerToHeapTop(env, false) - *getPointerToHeapAlloc(env, false));
+#endif /* defined(J9VM_GC_NON_ZERO_TLH) */
+		return unusedBytes;
+	}
+
+	/**
+	 * @param base[in] the base of a TLH which has just been refreshed, before anything was allocated from it
+	 * @return the size of whichever of the thread's TLHs (zeroed or non-zeroed) starts at base, or 0 if neither does
+	 */
+	UDATA getRefreshedBytes(MM_EnvironmentBase* env, void *base) {
+		if (*getPointerToHeapAlloc(env, true) == (U_8 *)base) {
+			return (UDATA)(*getPointerToHeapTop(env, true) - (U_8 *)base);
+		}
+#if defined(J9VM_GC_NON_ZERO_TLH)
+		if (*getPointerToHeapAlloc(env, false) == (U_8 *)base) {
+			return (UDATA)(*getPointerToHeapTop(env, false) - (U_8 *)base);
+		}
+#endif /* defined(J9VM_GC_NON_ZERO_TLH) */
+		return 0;
+	}
 };
 
 #endif /* LANGUAGETHREADLOCALHEAP_HPP_ */
@@ -102,6 +102,7 @@
 #include "SlotObject.hpp"
 #include "StandardAccessBarrier.hpp"
 #include "SublistFragment.hpp"
+#include "StringDeduplicator.hpp"
 #include "StringTable.hpp"
 #include "Task.hpp"
 #include "UnfinalizedObjectBuffer.hpp"
@@ -162,6 +163,13 @@ MM_ScavengerDelegate::masterSetupForGC(MM_EnvironmentBase * envBase)
 
 	private_setupForOwnableSynchronizerProcessing(MM_EnvironmentStandard::getEnvironment(envBase));
 
+	/* A global collection may have moved or cleared anything referenced from a stamped stack */
+	if (_stackWatermarkGlobalGCCount != _extensions->globalGCStats.gcCount) {
+		_validStackWatermarkEpoch = 0;
+		_stackWatermarkGlobalGCCount = _extensions->globalGCStats.gcCount;
+	}
+	_stackWatermarkEpoch += 1;
+
 	return;
 }
 
@@ -184,6 +192,9 @@ MM_ScavengerDelegate::reportScavengeEnd(MM_EnvironmentBase * envBase, bool scave
 
 		_extensions->scavengerJavaStats._ownableSynchronizerNurserySurvived = _extensions->scavengerJavaStats._ownableSynchronizerCandidates;
 	}
+
+	/* Stamps from a backed out scavenge can not be trusted */
+	_validStackWatermarkEpoch = scavengeSuccessful ? _stackWatermarkEpoch : 0;
 }
 
 void
@@ -271,6 +282,17 @@ MM_ScavengerDelegate::getObjectScanner(MM_EnvironmentStandard *env, omrobjectptr
 	case GC_ObjectModel::SCAN_MIXED_OBJECT:
 	case GC_ObjectModel::SCAN_CLASS_OBJECT:
 	case GC_ObjectModel::SCAN_CLASSLOADER_OBJECT:
+		if ((NULL != _extensions->stringDeduplicator) && GC_ObjectScanner::isHeapScan(flags)
+			&& (J9GC_J9OBJECT_CLAZZ(objectPtr) == J9VMJAVALANGSTRING_OR_NULL(_javaVM))
+		) {
+			/* Strings are queued once, when they have just been tenured:  a tenured String scanned again in a later scavenge
+			 * (because it is in the remembered set) is already remembered, while a String copied by this scavenge is only
+			 * remembered once its slots have been scanned
+			 */
+			if (!_extensions->scavenger->isObjectInNewSpace(objectPtr) && !_extensions->objectModel.isRemembered(objectPtr)) {
+				_extensions->stringDeduplicator->addCandidate(objectPtr);
+			}
+		}
 		objectScanner = GC_MixedObjectScanner::newInstance(env, objectPtr, allocSpace, flags);
 		break;
 	case GC_ObjectModel::SCAN_REFERENCE_MIXED_OBJECT:
@@ -748,6 +770,9 @@ MM_ScavengerDelegate::MM_ScavengerDelegate(MM_EnvironmentBase* env)
 #if defined(J9VM_GC_FINALIZATION)
 	, _finalizationRequired(false)
 #endif /* J9VM_GC_FINALIZATION */
+	, _stackWatermarkEpoch(0)
+	, _validStackWatermarkEpoch(0)
+	, _stackWatermarkGlobalGCCount(0)
 {
 	_typeId = __FUNCTION__;
 }
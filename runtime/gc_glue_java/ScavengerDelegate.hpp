@@ -73,6 +73,9 @@ private:
 #if defined(J9VM_GC_FINALIZATION)
 	bool _finalizationRequired; /**< Scavenger variable used to determine if finalization should be triggered */
 #endif /* J9VM_GC_FINALIZATION */
+	UDATA _stackWatermarkEpoch; /**< Incremented at the start of each scavenge and stamped on the stacks it finds free of nursery references */
+	UDATA _validStackWatermarkEpoch; /**< Epoch of the previous scavenge while stacks stamped by it can be skipped, 0 otherwise */
+	UDATA _stackWatermarkGlobalGCCount; /**< Global GC count at the previous scavenge (a global collection in between invalidates every stamp) */
 
 protected:
 public:
@@ -129,6 +132,16 @@ public:
 	bool shouldYield();
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
+	/**
+	 * @return the epoch to stamp on stacks the current scavenge finds free of nursery references, or 0 if stacks can not be stamped
+	 */
+	UDATA getStackWatermarkEpoch() { return _extensions->isConcurrentScavengerEnabled() ? 0 : _stackWatermarkEpoch; }
+
+	/**
+	 * @return the epoch of the stack stamps the current scavenge can trust, or 0 if there are none
+	 */
+	UDATA getValidStackWatermarkEpoch() { return _validStackWatermarkEpoch; }
+
 	void setShouldScavengeUnfinalizedObjects(bool shouldScavenge) { _shouldScavengeUnfinalizedObjects = shouldScavenge; }
 
 	volatile bool getShouldScavengeFinalizableObjects() { return _shouldScavengeFinalizableObjects; }
@@ -44,6 +44,25 @@
 
 #include "ScavengerRootScanner.hpp"
 
+bool
+MM_ScavengerRootScanner::scanOneThread(MM_EnvironmentBase *env, J9VMThread* walkThread, void* localData)
+{
+	MM_ScavengerDelegate *delegate = _scavenger->getDelegate();
+
+	scanThreadSlots(walkThread);
+
+	if (isThreadStackWatermarked(walkThread, delegate->getValidStackWatermarkEpoch())) {
+		reportThreadStackSkipped(walkThread);
+		setThreadStackWatermark(walkThread, delegate->getStackWatermarkEpoch());
+	} else {
+		_unstableStackSlotFound = false;
+		/* The slots of a split stack are seen by several scanners, so it is never stamped */
+		bool scannedInFull = scanThreadStack(env, walkThread, localData);
+		setThreadStackWatermark(walkThread, (scannedInFull && !_unstableStackSlotFound) ? delegate->getStackWatermarkEpoch() : 0);
+	}
+	return false;
+}
+
 #if defined(J9VM_GC_FINALIZATION)
 void
 MM_ScavengerRootScanner::startUnfinalizedProcessing(MM_EnvironmentBase *env)
@@ -56,6 +56,7 @@ class MM_ScavengerRootScanner : public MM_RootScanner
 private:
 	MM_Scavenger *_scavenger;
 	MM_ScavengerRootClearer _rootClearer;
+	bool _unstableStackSlotFound; /**< Set if the stack being scanned refers to an object that keeps the next scavenge from skipping it */
 
 protected:
 
@@ -77,6 +78,7 @@ public:
 		: MM_RootScanner(env)
 		, _scavenger(scavenger)
 		, _rootClearer(env, scavenger)
+		, _unstableStackSlotFound(false)
 	{
 		_typeId = __FUNCTION__;
 		setNurseryReferencesOnly(true);
@@ -99,6 +101,12 @@ public:
 		if (_scavenger->isHeapObject(*slotPtr) && !_extensions->heap->objectIsInGap(*slotPtr)) {
 			/* heap object - validate and mark */
 			Assert_MM_validStackSlot(MM_StackSlotValidator(MM_StackSlotValidator::COULD_BE_FORWARDED, *slotPtr, stackLocation, walkState).validate(_env));
+			/* An object copied by this scavenge, or an old object kept remembered because stacks refer to it,
+			 * has to be seen again by the next scavenge
+			 */
+			if (_scavenger->isObjectInEvacuateMemory(*slotPtr) || _extensions->objectModel.isRemembered(*slotPtr)) {
+				_unstableStackSlotFound = true;
+			}
 			_scavenger->copyAndForwardThreadSlot(MM_EnvironmentStandard::getEnvironment(_env), slotPtr);
 		} else if (NULL != *slotPtr) {
 			/* stack object - just validate */
@@ -121,6 +129,13 @@ public:
 		}
 	}
 
+	/**
+	 * Scan a thread, skipping its stack if the thread has not run since an earlier scavenge found
+	 * the stack free of nursery references, and stamping the stack for the next scavenge if it still is.
+	 * @see MM_RootScanner::scanOneThread()
+	 */
+	virtual bool scanOneThread(MM_EnvironmentBase *env, J9VMThread* walkThread, void* localData);
+
 	virtual void
 	doSlot(omrobjectptr_t *slotPtr)
 	{
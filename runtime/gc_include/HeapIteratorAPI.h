@@ -62,6 +62,11 @@ extern "C" {
 #define SCAN_OWNABLE_SYNCHRONIZER 0x20000
 #define SCAN_ALL 0x3FFFF
 
+/**
+ * The most objects handed to the user function of j9mm_iterate_all_objects_in_batches at once
+ */
+#define J9MM_OBJECT_BATCH_SIZE 256
+
 #define HEAP_ROOT_SLOT_DESCRIPTOR_OBJECT 0
 #define HEAP_ROOT_SLOT_DESCRIPTOR_CLASS 1
 
@@ -157,6 +162,21 @@ typedef struct J9MM_IterateObjectRefDescriptor {
 	J9MM_IteratorObjectRefType type; /**< The type of reference */
 } J9MM_IterateObjectRefDescriptor;
 
+typedef enum J9MM_AllocationProfileFlags {
+	j9mm_allocation_profile_classes = 1, /**< Report the most frequently sampled classes (frameCount is 0) */
+	j9mm_allocation_profile_sites = 2, /**< Report every allocation site */
+	j9mm_allocation_profile_flag_max = 0x1000000
+} J9MM_AllocationProfileFlags;
+
+typedef struct J9MM_AllocationSiteDescriptor {
+	UDATA id; /**< Stack identifier of the site (0 for a class summary) */
+	J9Class *clazz; /**< Class of the sampled objects */
+	UDATA frameCount; /**< Number of entries in frames */
+	J9Method **frames; /**< Allocating stack, innermost frame first */
+	UDATA samples; /**< Number of allocation samples */
+	UDATA bytes; /**< Bytes sampled (estimated bytes allocated for a class summary) */
+} J9MM_AllocationSiteDescriptor;
+
 typedef struct J9MM_HeapRootSlotDescriptor {
 	UDATA slotType; /**< Type of slot */
 	UDATA scanType; /**< What is being scanned, class or object */
@@ -233,6 +253,22 @@ j9mm_iterate_regions(J9JavaVM *vm, J9PortLibrary *portLibrary, J9MM_IterateSpace
 jvmtiIterationControl
 j9mm_iterate_region_objects(J9JavaVM *vm, J9PortLibrary *portLibrary, J9MM_IterateRegionDescriptor *region, UDATA flags, jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *objectDesc, void *userData), void *userData);
 
+/**
+ * Walk the objects of the given region which start within [base, top), call user provided function.
+ *
+ * The caller must have exclusive VM access. base must be the start of an object (or hole) in the region,
+ * as previously reported by a walk of the region; the last object reported may extend beyond top.
+ *
+ * @param region The descriptor for the region that should be walked
+ * @param base The address at which to start the walk
+ * @param top The address at which to stop the walk
+ * @param flags The flags describing the walk (0 or j9mm_iterator_flag_include_holes)
+ * @param func The function to call on each object descriptor.
+ * @param userData Pointer to storage for userData.
+ */
+jvmtiIterationControl
+j9mm_iterate_region_objects_in_range(J9JavaVM *vm, J9PortLibrary *portLibrary, J9MM_IterateRegionDescriptor *region, void *base, void *top, UDATA flags, jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *objectDesc, void *userData), void *userData);
+
 /**
  * Walk all object slots for the given object, call user provided function.
  * @param object The descriptor for the object that should be walked
@@ -274,8 +310,50 @@ j9mm_initialize_object_descriptor(J9JavaVM *javaVM, J9MM_IterateObjectDescriptor
 jvmtiIterationControl
 j9mm_iterate_all_objects(J9JavaVM *vn, J9PortLibrary *portLibrary, UDATA flags, jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *object, void *userData), void *userData);
 
+/**
+ * Walk all objects for the given VM using the GC threads, call user provided function with batches of objects.
+ *
+ * The caller must have exclusive VM access.  The heap regions (large ones cut into address ranges, whose first objects
+ * are found by walking the object headers of the region) are shared out among the GC threads, and each thread
+ * hands the objects of the regions it walks to func in batches of at most J9MM_OBJECT_BATCH_SIZE objects, so func
+ * may be called concurrently and must synchronize itself.  The objects are not reported in address order.  func may
+ * overwrite the descriptors of its batch.  If the walk can not be shared out (no GC threads, or the caller is a GC
+ * thread) all the batches are handed to func on the calling thread.
+ *
+ * @param flags The flags describing the walk (0 or j9mm_iterator_flag_include_holes)
+ * @param func The function to call on each batch of object descriptors.
+ * @param userData Pointer to storage for userData.
+ * @return JVMTI_ITERATION_ABORT if func aborted the walk (once it has, no more batches are handed out), JVMTI_ITERATION_CONTINUE otherwise
+ */
+jvmtiIterationControl
+j9mm_iterate_all_objects_in_batches(J9VMThread *vmThread, J9PortLibrary *portLibrary, UDATA flags, jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *objects, UDATA count, void *userData), void *userData);
+
+/**
+ * Walk the regions of the given space using the GC threads, call user provided function on each range of each region.
+ *
+ * The caller must have exclusive VM access.  Large regions are cut into address ranges (as for
+ * j9mm_iterate_all_objects_in_batches), and func is passed the region descriptor, the bounds of the range and its
+ * number.  The ranges are numbered in address order within each region, and the regions in the order in which
+ * j9mm_iterate_regions reports them (with the same flags).  The base of a range is the start of its first object (or
+ * hole), so the objects of a range can be walked with j9mm_iterate_region_objects_in_range; a range in which no object
+ * starts has base equal to top.  The ranges are shared out among the GC threads in that order, so func may be called
+ * concurrently and must synchronize itself.  The descriptor is only valid for the duration of the call.  If the walk
+ * can not be shared out (no GC threads, or the caller is a GC thread) each region is handed to func whole, as a
+ * single range, on the calling thread, in order.
+ *
+ * @param space The descriptor for the space that should be walked
+ * @param flags The flags describing the walk (as for j9mm_iterate_regions)
+ * @param func The function to call on each range.
+ * @param userData Pointer to storage for userData.
+ * @return JVMTI_ITERATION_ABORT if func aborted the walk (once it has, no more ranges are handed out), JVMTI_ITERATION_CONTINUE otherwise
+ */
+jvmtiIterationControl
+j9mm_iterate_regions_in_parallel(J9VMThread *vmThread, J9PortLibrary *portLibrary, J9MM_IterateSpaceDescriptor *space, UDATA flags, jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateRegionDescriptor *regionDesc, void *base, void *top, UDATA rangeIndex, void *userData), void *userData);
+
 /**
  * Walk all ownable synchronizer object, call user provided function.
+ * With -XXgc:lazyOwnableSynchronizerDiscovery this runs a global collection first (the caller must have exclusive
+ * VM access), so objects may move: the caller must not hold object pointers across the call.
  * @param flags The flags describing the walk (unused currently)
  * @param func The function to call on each object descriptor.
  * @param userData Pointer to storage for userData.
@@ -284,6 +362,20 @@ j9mm_iterate_all_objects(J9JavaVM *vn, J9PortLibrary *portLibrary, UDATA flags,
 jvmtiIterationControl
 j9mm_iterate_all_ownable_synchronizer_objects(J9VMThread *vmThread, J9PortLibrary *portLibrary, UDATA flags, jvmtiIterationControl (*func)(J9VMThread *vmThread, J9MM_IterateObjectDescriptor *object, void *userData), void *userData);
 
+/**
+ * Walk the allocation profile built with -Xgc:allocationProfile, call user provided function.
+ *
+ * This function acquires the profile lock, which is held while the callback function is executed.
+ * Nothing is reported if the profile is not enabled.
+ *
+ * @param flags j9mm_allocation_profile_classes and/or j9mm_allocation_profile_sites
+ * @param func The function to call on each class summary or allocation site.
+ * @param userData Pointer to storage for userData.
+ * @return JVMTI_ITERATION_ABORT if the user function aborted the walk, JVMTI_ITERATION_CONTINUE otherwise
+ */
+jvmtiIterationControl
+j9mm_iterate_allocation_profile(J9JavaVM *javaVM, UDATA flags, jvmtiIterationControl (*func)(J9JavaVM *javaVM, J9MM_AllocationSiteDescriptor *siteDesc, void *userData), void *userData);
+
 /**
  * Shortcut specific for Segregated heap to find the page the pointer belongs to
  * This is instead of iterating pages, which may be very time consuming.
@@ -2295,7 +2295,9 @@ protected:
 	preStaticReadObject(J9VMThread *vmThread, J9Class *clazz, j9object_t *srcAddress)
 	{
 		if (j9gc_modron_readbar_none != _readBarrierType) {
-			vmThread->javaVM->memoryManagerFunctions->J9ReadBarrierJ9Class(vmThread, srcAddress);
+			if ((j9gc_modron_readbar_range_check != _readBarrierType) || isStaticSlotInEvacuateRange(vmThread, srcAddress)) {
+				vmThread->javaVM->memoryManagerFunctions->J9ReadBarrierJ9Class(vmThread, srcAddress);
+			}
 		}
 	}
 	
@@ -2832,10 +2834,53 @@ private:
 	internalPreReadObject(J9VMThread *vmThread, j9object_t object, fj9object_t *srcAddress)
 	{
 		if (j9gc_modron_readbar_none != _readBarrierType) {
-			vmThread->javaVM->memoryManagerFunctions->J9ReadBarrier(vmThread, srcAddress);
+			if ((j9gc_modron_readbar_range_check != _readBarrierType) || isSlotInEvacuateRange(vmThread, srcAddress)) {
+				vmThread->javaVM->memoryManagerFunctions->J9ReadBarrier(vmThread, srcAddress);
+			}
 		}
 	}
 
+	/**
+	 * Check if a reference slot refers into the evacuate space of an active concurrent scavenge, i.e. if the read
+	 * barrier must be called for it (the JIT inlines the same check).  The range of the thread is empty while no
+	 * concurrent scavenge is active, so the barrier is only ever called for slots it has to copy or heal.
+	 *
+	 * @param srcAddress the address of the slot being read
+	 * @return true if the slot refers into the evacuate space
+	 */
+	static VMINLINE bool
+	isSlotInEvacuateRange(J9VMThread *vmThread, fj9object_t *srcAddress)
+	{
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+		fj9object_t value = *(volatile fj9object_t *)srcAddress;
+#if defined(J9VM_GC_COMPRESSED_POINTERS)
+		return (value >= vmThread->readBarrierRangeCheckBaseCompressed) && (value <= vmThread->readBarrierRangeCheckTopCompressed);
+#else /* J9VM_GC_COMPRESSED_POINTERS */
+		return ((UDATA)value >= vmThread->readBarrierRangeCheckBase) && ((UDATA)value <= vmThread->readBarrierRangeCheckTop);
+#endif /* J9VM_GC_COMPRESSED_POINTERS */
+#else /* OMR_GC_CONCURRENT_SCAVENGER */
+		return true;
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+	}
+
+	/**
+	 * Check if a class static slot refers into the evacuate space of an active concurrent scavenge.
+	 * @see isSlotInEvacuateRange()
+	 *
+	 * @param srcAddress the address of the static slot being read
+	 * @return true if the slot refers into the evacuate space
+	 */
+	static VMINLINE bool
+	isStaticSlotInEvacuateRange(J9VMThread *vmThread, j9object_t *srcAddress)
+	{
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+		UDATA value = (UDATA)*(volatile j9object_t *)srcAddress;
+		return (value >= vmThread->readBarrierRangeCheckBase) && (value <= vmThread->readBarrierRangeCheckTop);
+#else /* OMR_GC_CONCURRENT_SCAVENGER */
+		return true;
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+	}
+
 	/**
 	 * Dirty the appropriate card for card table barriers
 	 *
@@ -0,0 +1,165 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEBINARYFORMAT_H_)
+#define VERBOSEBINARYFORMAT_H_
+
+/*
+ * Layout of the binary GC event stream file written with -Xgc:verboseBinaryFile=<file>.
+ *
+ * The file holds a J9GCEventStreamHeader, an interned string table and a ring of records:
+ *
+ *   [header (headerSize bytes)][string table (stringTableSize bytes)][ring (ringSize bytes)]
+ *
+ * Every record starts with a J9GCEventRecordHeader and is followed by (size - sizeof(J9GCEventRecordHeader)) / 8
+ * U_64 fields whose meaning depends on the record type (see the J9GCEVT_FIELD_* lists below).  A later version may
+ * append fields to a record type, so readers must use the record size rather than assume a field count.
+ * Records are 8 byte aligned and never straddle the end of the ring: a J9GCEVT_RECORD_PAD record fills the tail.
+ * A pad record may be as short as 8 bytes, so only its size and type are valid.
+ *
+ * Offsets into the ring are kept as cursors which only ever grow; the position of a cursor in the ring is
+ * cursor % ringSize.  The records between readCursor and writeCursor are complete.  The writer advances readCursor
+ * past any record it is about to overwrite before writing, and publishes writeCursor after the record is written,
+ * so a reader copying the ring out of a live file must re-check readCursor after the copy.
+ *
+ * Strings (cycle type and phase names) are interned in the string table rather than repeated in the records.  Entry n
+ * (starting from 1, 0 meaning "none") is a U_16 length followed by that many bytes, padded to an even length.
+ *
+ * All values are in the byte order of the writing platform; the eyecatcher and byteOrderMark identify it.
+ *
+ * The stream covers the events common to every collector: cycles and increments (with the reason of the cycle and
+ * the memory of each space), the timing of the collection phases, allocation failures, exclusive access, class
+ * unloading and idle page release.  The collector-specific stanzas of the XML output (scavenger tilt and tenure
+ * ages, copy-forward and remembered set statistics, concurrent kickoff and Metronome heartbeats) are not recorded.
+ */
+
+#include "j9comp.h"
+
+#define J9GCEVT_EYECATCHER "J9GCEVT"
+#define J9GCEVT_VERSION 1
+#define J9GCEVT_BYTE_ORDER_MARK 0x01020304
+#define J9GCEVT_STRING_TABLE_SIZE 4096
+#define J9GCEVT_MINIMUM_RING_SIZE (64 * 1024)
+#define J9GCEVT_RECORD_ALIGNMENT 8
+
+/* record types */
+#define J9GCEVT_RECORD_PAD 0
+#define J9GCEVT_RECORD_CYCLE_START 1
+#define J9GCEVT_RECORD_CYCLE_END 2
+#define J9GCEVT_RECORD_INCREMENT_START 3
+#define J9GCEVT_RECORD_INCREMENT_END 4
+#define J9GCEVT_RECORD_CLASS_UNLOADING_END 5
+#define J9GCEVT_RECORD_IDLE_PAGE_RELEASE 6
+#define J9GCEVT_RECORD_PHASE_END 7
+#define J9GCEVT_RECORD_ALLOCATION_FAILURE 8
+#define J9GCEVT_RECORD_EXCLUSIVE_ACCESS 9
+#define J9GCEVT_RECORD_TYPE_COUNT 10
+
+/* fields of J9GCEVT_RECORD_CYCLE_START and J9GCEVT_RECORD_CYCLE_END */
+#define J9GCEVT_FIELD_CYCLE_ID 0
+#define J9GCEVT_FIELD_CYCLE_FREE_BYTES 1
+#define J9GCEVT_FIELD_CYCLE_TOTAL_BYTES 2
+#define J9GCEVT_FIELD_CYCLE_REASON 3 /* J9GCEVT_REASON_* */
+#define J9GCEVT_FIELD_CYCLE_COUNT 4
+
+/* values of J9GCEVT_FIELD_CYCLE_REASON */
+#define J9GCEVT_REASON_IMPLICIT 0
+#define J9GCEVT_REASON_EXPLICIT 1
+#define J9GCEVT_REASON_AGGRESSIVE 2
+#define J9GCEVT_REASON_OUT_OF_MEMORY 3
+
+/* fields of J9GCEVT_RECORD_INCREMENT_START and J9GCEVT_RECORD_INCREMENT_END */
+#define J9GCEVT_FIELD_INCREMENT_CYCLE_ID 0
+#define J9GCEVT_FIELD_INCREMENT_ID 1
+#define J9GCEVT_FIELD_INCREMENT_FREE_BYTES 2
+#define J9GCEVT_FIELD_INCREMENT_TOTAL_BYTES 3
+#define J9GCEVT_FIELD_INCREMENT_NURSERY_FREE_BYTES 4
+#define J9GCEVT_FIELD_INCREMENT_NURSERY_TOTAL_BYTES 5 /* 0 if the heap has no nursery */
+#define J9GCEVT_FIELD_INCREMENT_TENURE_FREE_BYTES 6
+#define J9GCEVT_FIELD_INCREMENT_TENURE_TOTAL_BYTES 7
+#define J9GCEVT_FIELD_INCREMENT_COUNT 8
+
+/* fields of J9GCEVT_RECORD_CLASS_UNLOADING_END */
+#define J9GCEVT_FIELD_CLASS_UNLOADING_DURATION 0 /* microseconds */
+#define J9GCEVT_FIELD_CLASS_UNLOADING_LOADERS 1
+#define J9GCEVT_FIELD_CLASS_UNLOADING_CLASSES 2
+#define J9GCEVT_FIELD_CLASS_UNLOADING_COUNT 3
+
+/* fields of J9GCEVT_RECORD_IDLE_PAGE_RELEASE */
+#define J9GCEVT_FIELD_IDLE_RELEASE_BYTES 0
+#define J9GCEVT_FIELD_IDLE_RELEASE_RANGES 1
+#define J9GCEVT_FIELD_IDLE_RELEASE_RSS_BEFORE 2
+#define J9GCEVT_FIELD_IDLE_RELEASE_RSS_AFTER 3
+#define J9GCEVT_FIELD_IDLE_RELEASE_DURATION 4 /* microseconds */
+#define J9GCEVT_FIELD_IDLE_RELEASE_BATCHES 5
+#define J9GCEVT_FIELD_IDLE_RELEASE_INTERRUPTED 6
+#define J9GCEVT_FIELD_IDLE_RELEASE_COUNT 7
+
+/* fields of J9GCEVT_RECORD_PHASE_END (the string is the name of the phase) */
+#define J9GCEVT_FIELD_PHASE_CYCLE_ID 0
+#define J9GCEVT_FIELD_PHASE_DURATION 1 /* microseconds */
+#define J9GCEVT_FIELD_PHASE_COUNT 2
+
+/* fields of J9GCEVT_RECORD_ALLOCATION_FAILURE */
+#define J9GCEVT_FIELD_ALLOCATION_FAILURE_BYTES 0 /* bytes requested */
+#define J9GCEVT_FIELD_ALLOCATION_FAILURE_SPACE 1 /* J9GCEVT_SPACE_* */
+#define J9GCEVT_FIELD_ALLOCATION_FAILURE_COUNT 2
+
+/* values of J9GCEVT_FIELD_ALLOCATION_FAILURE_SPACE */
+#define J9GCEVT_SPACE_UNKNOWN 0
+#define J9GCEVT_SPACE_NURSERY 1
+#define J9GCEVT_SPACE_TENURE 2
+
+/* fields of J9GCEVT_RECORD_EXCLUSIVE_ACCESS */
+#define J9GCEVT_FIELD_EXCLUSIVE_ACCESS_DURATION 0 /* microseconds to acquire exclusive access */
+#define J9GCEVT_FIELD_EXCLUSIVE_ACCESS_MEAN_IDLE 1 /* mean microseconds the halted threads were idle */
+#define J9GCEVT_FIELD_EXCLUSIVE_ACCESS_THREADS 2 /* threads halted */
+#define J9GCEVT_FIELD_EXCLUSIVE_ACCESS_COUNT 3
+
+#define J9GCEVT_MAXIMUM_FIELD_COUNT 8
+
+typedef struct J9GCEventStreamHeader {
+	char eyecatcher[8]; /* J9GCEVT_EYECATCHER, NUL terminated */
+	U_32 version; /* J9GCEVT_VERSION of the writer */
+	U_32 byteOrderMark; /* J9GCEVT_BYTE_ORDER_MARK */
+	U_32 headerSize; /* offset of the string table */
+	U_32 stringTableSize; /* bytes reserved for the string table */
+	U_32 stringTableUsed; /* bytes of the string table in use */
+	U_32 stringCount; /* number of interned strings */
+	U_64 ringSize; /* bytes in the ring, which follows the string table */
+	U_64 writeCursor; /* cursor just past the newest complete record */
+	U_64 readCursor; /* cursor of the oldest complete record */
+	U_64 recordCount; /* number of records written, including overwritten ones (pad records excluded) */
+	U_64 hiresFrequency; /* ticks per second of the record timestamps */
+	U_64 startTimeMillis; /* wall clock time (milliseconds since the epoch) at startHiresClock */
+	U_64 startHiresClock; /* record timestamp corresponding to startTimeMillis */
+	U_64 reserved[4];
+} J9GCEventStreamHeader;
+
+typedef struct J9GCEventRecordHeader {
+	U_16 size; /* bytes in the record, including this header */
+	U_16 type; /* J9GCEVT_RECORD_* */
+	U_32 stringId; /* interned string qualifying the event (the cycle type or phase name), 0 if none */
+	U_64 timestamp; /* hires clock ticks */
+} J9GCEventRecordHeader;
+
+#endif /* VERBOSEBINARYFORMAT_H_ */
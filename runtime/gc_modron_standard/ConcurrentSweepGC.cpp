@@ -24,12 +24,18 @@
 #include "j9.h"
 #include "j9cfg.h"
 #include "j9port.h"
+#include "mmhook.h"
 
 #if defined(J9VM_GC_CONCURRENT_SWEEP)
 
 #include "ConcurrentSweepGC.hpp"
 
+#include "AtomicOperations.hpp"
 #include "ConcurrentSweepScheme.hpp"
+#include "GCExtensions.hpp"
+#include "Heap.hpp"
+#include "MemoryPool.hpp"
+#include "MemorySubSpace.hpp"
 
 MM_ConcurrentSweepGC *
 MM_ConcurrentSweepGC::newInstance(MM_EnvironmentBase *env)
@@ -53,7 +59,14 @@ MM_ConcurrentSweepGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSp
 	/* Finish off any sweep work that was still in progress */
 	MM_ConcurrentSweepScheme *concurrentSweep = (MM_ConcurrentSweepScheme *)_sweepScheme;
 	if(concurrentSweep->isConcurrentSweepActive()) {
+		PORT_ACCESS_FROM_ENVIRONMENT(env);
+		/* no mutator runs during the pause, so the change in free memory is what completing the sweep recovered */
+		UDATA freeBefore = _extensions->heap->getApproximateActiveFreeMemorySize();
+		U_64 startTime = j9time_hires_clock();
 		concurrentSweep->completeSweep(env, ABOUT_TO_GC);
+		U_64 pauseTime = j9time_hires_delta(startTime, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS);
+		UDATA freeAfter = _extensions->heap->getApproximateActiveFreeMemorySize();
+		reportSweepSummary(env, (freeAfter > freeBefore) ? (freeAfter - freeBefore) : 0, pauseTime);
 	}
 
 	MM_ParallelGlobalGC::internalPreCollect(env, subSpace, allocDescription, gcCode);
@@ -65,7 +78,22 @@ MM_ConcurrentSweepGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSp
 void
 MM_ConcurrentSweepGC::payAllocationTax(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, MM_MemorySubSpace *baseSubSpace, MM_AllocateDescription *allocDescription)
 {
-	((MM_ConcurrentSweepScheme *)_sweepScheme)->payAllocationTax(env, baseSubSpace, allocDescription);
+	MM_ConcurrentSweepScheme *concurrentSweep = (MM_ConcurrentSweepScheme *)_sweepScheme;
+	if (concurrentSweep->isConcurrentSweepActive()) {
+		PORT_ACCESS_FROM_ENVIRONMENT(env);
+		/* the swept chunks are connected to pools which other threads may be allocating from, so this can under count */
+		UDATA freeBefore = _extensions->heap->getApproximateActiveFreeMemorySize();
+		U_64 startTime = j9time_hires_clock();
+		concurrentSweep->payAllocationTax(env, baseSubSpace, allocDescription);
+		MM_AtomicOperations::addU64(&_concurrentSweepTime, j9time_hires_delta(startTime, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS));
+		UDATA freeAfter = _extensions->heap->getApproximateActiveFreeMemorySize();
+		if (freeAfter > freeBefore) {
+			MM_AtomicOperations::add(&_concurrentSweepBytes, freeAfter - freeBefore);
+		}
+		MM_AtomicOperations::add(&_concurrentSweepRequests, 1);
+	} else {
+		concurrentSweep->payAllocationTax(env, baseSubSpace, allocDescription);
+	}
 }
 
 /**
@@ -79,7 +107,54 @@ MM_ConcurrentSweepGC::payAllocationTax(MM_EnvironmentBase *env, MM_MemorySubSpac
 bool
 MM_ConcurrentSweepGC::replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, UDATA size)
 {
-	return _sweepScheme->replenishPoolForAllocate(env, memoryPool, size);
+	MM_ConcurrentSweepScheme *concurrentSweep = (MM_ConcurrentSweepScheme *)_sweepScheme;
+	bool result = false;
+	if (concurrentSweep->isConcurrentSweepActive()) {
+		PORT_ACCESS_FROM_ENVIRONMENT(env);
+		/* the pool's allocation lock is held, so the growth of its free memory is exactly what the sweep recovered into it */
+		UDATA freeBefore = memoryPool->getActualFreeMemorySize();
+		U_64 startTime = j9time_hires_clock();
+		result = concurrentSweep->replenishPoolForAllocate(env, memoryPool, size);
+		MM_AtomicOperations::addU64(&_lazySweepTime, j9time_hires_delta(startTime, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS));
+		UDATA freeAfter = memoryPool->getActualFreeMemorySize();
+		if (freeAfter > freeBefore) {
+			MM_AtomicOperations::add(&_lazySweepBytes, freeAfter - freeBefore);
+		}
+		MM_AtomicOperations::add(&_lazySweepRequests, 1);
+		if (result) {
+			MM_AtomicOperations::add(&_lazySweepSatisfied, 1);
+		}
+	} else {
+		result = concurrentSweep->replenishPoolForAllocate(env, memoryPool, size);
+	}
+	return result;
+}
+
+void
+MM_ConcurrentSweepGC::reportSweepSummary(MM_EnvironmentBase *env, UDATA pauseBytes, U_64 pauseTime)
+{
+	PORT_ACCESS_FROM_ENVIRONMENT(env);
+	TRIGGER_J9HOOK_MM_CONCURRENT_SWEEP_SUMMARY(
+		MM_GCExtensions::getExtensions(env)->hookInterface,
+		(J9VMThread *)env->getLanguageVMThread(),
+		j9time_hires_clock(),
+		J9HOOK_MM_CONCURRENT_SWEEP_SUMMARY,
+		_lazySweepRequests,
+		_lazySweepSatisfied,
+		_lazySweepBytes,
+		_lazySweepTime,
+		_concurrentSweepRequests,
+		_concurrentSweepBytes,
+		_concurrentSweepTime,
+		pauseBytes,
+		pauseTime);
+	_lazySweepRequests = 0;
+	_lazySweepSatisfied = 0;
+	_lazySweepBytes = 0;
+	_lazySweepTime = 0;
+	_concurrentSweepRequests = 0;
+	_concurrentSweepBytes = 0;
+	_concurrentSweepTime = 0;
 }
 
 #endif /* J9VM_GC_CONCURRENT_SWEEP */
@@ -43,10 +43,24 @@ class MM_ConcurrentSweepGC : public MM_ParallelGlobalGC
 {
 private:
 	J9JavaVM *_javaVM;
+	volatile UDATA _lazySweepRequests; /**< Number of allocation misses which swept inline since the last collection */
+	volatile UDATA _lazySweepSatisfied; /**< Number of those misses which the inline sweep satisfied */
+	volatile UDATA _lazySweepBytes; /**< Free bytes recovered by sweeping inline after allocation misses since the last collection */
+	volatile U_64 _lazySweepTime; /**< Time spent sweeping inline after allocation misses since the last collection, in microseconds */
+	volatile UDATA _concurrentSweepRequests; /**< Number of allocation tax payments which swept since the last collection */
+	volatile UDATA _concurrentSweepBytes; /**< Free bytes recovered by sweeping to pay the allocation tax since the last collection (approximate) */
+	volatile U_64 _concurrentSweepTime; /**< Time spent sweeping to pay the allocation tax since the last collection, in microseconds */
 protected:
 public:
 
 private:
+	/**
+	 * Report how the sweep which has just been completed was done, and reset the counts.
+	 * @param pauseBytes[in] free bytes recovered by completing the sweep in this collection's pause
+	 * @param pauseTime[in] time spent completing the sweep in this collection's pause, in microseconds
+	 */
+	void reportSweepSummary(MM_EnvironmentBase *env, UDATA pauseBytes, U_64 pauseTime);
+
 protected:
 	virtual void internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription, U_32 gcCode);
 
@@ -62,6 +76,13 @@ public:
 	MM_ConcurrentSweepGC(MM_EnvironmentBase *env)
 		: MM_ParallelGlobalGC(env)
 		, _javaVM((J9JavaVM*)env->getOmrVM()->_language_vm)
+		, _lazySweepRequests(0)
+		, _lazySweepSatisfied(0)
+		, _lazySweepBytes(0)
+		, _lazySweepTime(0)
+		, _concurrentSweepRequests(0)
+		, _concurrentSweepBytes(0)
+		, _concurrentSweepTime(0)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -129,6 +129,23 @@ MM_StandardAccessBarrier::rememberObjectToRescan(MM_EnvironmentBase *env, J9Obje
 	}
 }
 
+/**
+ * Batch version of rememberObjectToRescan() for a run of consecutive reference slots, used by the
+ * bulk store barriers to log every non-NULL value in the run in a single pass.
+ */
+void
+MM_StandardAccessBarrier::rememberObjectRangeToRescan(MM_EnvironmentBase *env, fj9object_t *startAddress, UDATA slotCount)
+{
+	fj9object_t *endAddress = startAddress + slotCount;
+	for (fj9object_t *slot = startAddress; slot < endAddress; slot++) {
+		GC_SlotObject slotObject(env->getOmrVM(), slot);
+		J9Object *object = slotObject.readReferenceFromSlot();
+		if (NULL != object) {
+			rememberObjectToRescan(env, object);
+		}
+	}
+}
+
 /**
  * Unmarked, heap reference, about to be deleted (or overwritten), while marking
  * is in progress is to be remembered for later marking and scanning.
@@ -263,6 +280,47 @@ MM_StandardAccessBarrier::preBatchObjectStore(J9VMThread *vmThread, J9Class *des
 	return true;
 }
 
+/**
+ * @copydoc MM_ObjectAccessBarrier::preObjectStoreRange()
+ *
+ * The snapshot barrier logs every value about to be overwritten in one pass over the range.
+ * During an active concurrent scavenge every copied slot needs its own read barrier, so bulk
+ * stores are refused and the caller falls back to the per-slot barriers.
+ */
+bool
+MM_StandardAccessBarrier::preObjectStoreRange(J9VMThread *vmThread, J9Object *destObject, fj9object_t *destAddress, UDATA slotCount)
+{
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	if (_extensions->isConcurrentScavengerInProgress()) {
+		return false;
+	}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(vmThread->omrVMThread);
+	if (isSATBBarrierActive(env)) {
+		rememberObjectRangeToRescan(env, destAddress, slotCount);
+	}
+
+	return true;
+}
+
+/**
+ * @copydoc MM_ObjectAccessBarrier::postObjectStoreRange()
+ *
+ * The new values are remembered if this thread has not been scanned yet (double barrier), and the
+ * destination object is remembered or has its card dirtied once for the whole range.
+ */
+void
+MM_StandardAccessBarrier::postObjectStoreRange(J9VMThread *vmThread, J9Object *destObject, fj9object_t *destAddress, UDATA slotCount)
+{
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(vmThread->omrVMThread);
+	if (isSATBBarrierActive(env) && isDoubleBarrierActiveOnThread(vmThread)) {
+		rememberObjectRangeToRescan(env, destAddress, slotCount);
+	}
+
+	preBatchObjectStoreImpl(vmThread, destObject);
+}
+
 /**
  * Generational write barrier call when a single object is stored into another.
  * The remembered set system consists of a physical list of objects in the OLD area that
@@ -648,13 +706,12 @@ I_32
 MM_StandardAccessBarrier::backwardReferenceArrayCopyIndex(J9VMThread *vmThread, J9IndexableObject *srcObject, J9IndexableObject *destObject, I_32 srcIndex, I_32 destIndex, I_32 lengthInSlots)
 {
 	I_32 retValue = ARRAY_COPY_NOT_DONE;
-	//TODO SATB re-enable opt?
-	if (_extensions->configuration->isSnapshotAtTheBeginningBarrierEnabled()) {
-		return retValue;
-	}
 
 	if(0 == lengthInSlots) {
 		retValue = ARRAY_COPY_SUCCESSFUL;
+	} else if (_extensions->configuration->isSnapshotAtTheBeginningBarrierEnabled()) {
+		/* every overwritten value must be logged, which the range barriers do in one pass */
+		retValue = doCopyContiguousWithRangeBarriers(vmThread, srcObject, destObject, srcIndex, destIndex, lengthInSlots);
 	} else {
 		/* a high level caller ensured destObject == srcObject */
 		Assert_MM_true(destObject == srcObject);
@@ -685,15 +742,13 @@ MM_StandardAccessBarrier::backwardReferenceArrayCopyIndex(J9VMThread *vmThread,
 I_32
 MM_StandardAccessBarrier::forwardReferenceArrayCopyIndex(J9VMThread *vmThread, J9IndexableObject *srcObject, J9IndexableObject *destObject, I_32 srcIndex, I_32 destIndex, I_32 lengthInSlots)
 {
-	//TODO SATB re-enable opt
 	I_32 retValue = ARRAY_COPY_NOT_DONE;
 
-	if (_extensions->configuration->isSnapshotAtTheBeginningBarrierEnabled()) {
-		return retValue;
-	}
-
 	if(0 == lengthInSlots) {
 		retValue = ARRAY_COPY_SUCCESSFUL;
+	} else if (_extensions->configuration->isSnapshotAtTheBeginningBarrierEnabled()) {
+		/* every overwritten value must be logged, which the range barriers do in one pass */
+		retValue = doCopyContiguousWithRangeBarriers(vmThread, srcObject, destObject, srcIndex, destIndex, lengthInSlots);
 	} else {
 		Assert_MM_true(_extensions->indexableObjectModel.isInlineContiguousArraylet(destObject));
 		Assert_MM_true(_extensions->indexableObjectModel.isInlineContiguousArraylet(srcObject));
@@ -84,6 +84,8 @@ public:
 	virtual void postObjectStore(J9VMThread *vmThread, J9Class *destClass, J9Object **destAddress, J9Object *value, bool isVolatile=false);
 	virtual bool preBatchObjectStore(J9VMThread *vmThread, J9Object *destObject, bool isVolatile=false);
 	virtual bool preBatchObjectStore(J9VMThread *vmThread, J9Class *destClass, bool isVolatile=false);
+	virtual bool preObjectStoreRange(J9VMThread *vmThread, J9Object *destObject, fj9object_t *destAddress, UDATA slotCount);
+	virtual void postObjectStoreRange(J9VMThread *vmThread, J9Object *destObject, fj9object_t *destAddress, UDATA slotCount);
 	virtual void recentlyAllocatedObject(J9VMThread *vmThread, J9Object *object); 
 
 	virtual void* jniGetPrimitiveArrayCritical(J9VMThread* vmThread, jarray array, jboolean *isCopy);
@@ -110,6 +112,7 @@ public:
 	bool preObjectStoreImpl(J9VMThread *vmThread, J9Object **destAddress, J9Object *value, bool isVolatile);
 
 	void rememberObjectToRescan(MM_EnvironmentBase *env, J9Object *object);
+	void rememberObjectRangeToRescan(MM_EnvironmentBase *env, fj9object_t *startAddress, UDATA slotCount);
 
 	MMINLINE bool isSATBBarrierActive(MM_EnvironmentBase* env)
 	{
@@ -40,6 +40,7 @@
 #include "modronapi.hpp"
 
 #include "AllocateDescription.hpp"
+#include "AllocationProfiler.hpp"
 #include "AtomicOperations.hpp"
 #include "EnvironmentBase.hpp"
 #include "IndexableObjectAllocationModel.hpp"
@@ -242,6 +243,10 @@ traceAllocateObject(J9VMThread *vmThread, J9Object * object, J9Class* clazz, uin
 			clazz,
 			objSize);
 
+		if (NULL != extensions->allocationProfiler) {
+			extensions->allocationProfiler->sample(env, clazz, objSize);
+		}
+
 		/* Keep the remainder, want this to happen so that we don't miss objects
 		 * after seeing large objects
 		 */
@@ -188,6 +188,23 @@ j9gc_get_objects_pending_finalization_count(J9JavaVM *javaVM)
 {
 	return MM_GCExtensions::getExtensions(javaVM)->finalizeListManager->getJobCount();
 }
+
+/**
+ * Return statistics on the finalize queue, to support the com.ibm.lang.management.MemoryMXBean finalizer queue attributes.
+ * @param maxJobCount[out] the largest number of jobs queued at once
+ * @param lastDrainMillis[out] milliseconds taken to dequeue the most recent backlog
+ * @param maxDrainMillis[out] the most milliseconds taken to dequeue any backlog
+ */
+void
+j9gc_get_finalizer_queue_statistics(J9JavaVM *javaVM, UDATA *maxJobCount, U_64 *lastDrainMillis, U_64 *maxDrainMillis)
+{
+	U_64 lastDrainMicros = 0;
+	U_64 maxDrainMicros = 0;
+
+	MM_GCExtensions::getExtensions(javaVM)->finalizeListManager->getQueueStatistics(maxJobCount, &lastDrainMicros, &maxDrainMicros);
+	*lastDrainMillis = lastDrainMicros / 1000;
+	*maxDrainMillis = maxDrainMicros / 1000;
+}
 #endif /* J9VM_GC_FINALIZATION */
 
 UDATA
@@ -52,6 +52,7 @@
 #include "Tgc.hpp"
 #endif /* J9VM_GC_MODRON_TRACE && !defined(J9VM_GC_REALTIME) */
 
+#include "AllocationProfiler.hpp"
 #if defined (J9VM_GC_HEAP_CARD_TABLE)
 #include "CardTable.hpp"
 #endif /* defined (J9VM_GC_HEAP_CARD_TABLE) */
@@ -77,6 +78,7 @@
 #include "EnvironmentBase.hpp"
 #if defined(J9VM_GC_FINALIZATION)
 #include "FinalizeListManager.hpp"
+#include "FinalizeWorkerPool.hpp"
 #endif /* J9VM_GC_FINALIZATION */
 #include "GCExtensions.hpp"
 #include "GlobalAllocationManager.hpp"
@@ -103,8 +105,10 @@
 #include "RememberedSetSATB.hpp"
 #endif /* J9VM_GC_STACCATO */
 #include "Scavenger.hpp"
+#include "StringDeduplicator.hpp"
 #include "StringTable.hpp"
 #include "Validator.hpp"
+#include "VerboseBinaryStream.hpp"
 #if defined(J9VM_GC_IDLE_HEAP_MANAGER)
 #include "IdleGCManager.hpp"
 #endif
@@ -290,12 +294,34 @@ gcCleanupHeapStructures(J9JavaVM * vm)
 	}
 
 #if defined(J9VM_GC_FINALIZATION)
+	if (NULL != extensions->finalizeWorkerPool) {
+		/* a worker which could not be joined (the thread shutting down the VM, or one suspended in Java) may still use the pool, so it is left allocated */
+		if (extensions->finalizeWorkerPool->allThreadsTerminated()) {
+			extensions->finalizeWorkerPool->kill(&env);
+		}
+		extensions->finalizeWorkerPool = NULL;
+	}
 	if (extensions->finalizeListManager) {
 		extensions->finalizeListManager->kill(&env);
 		extensions->finalizeListManager = NULL;
 	}
 #endif /* J9VM_GC_FINALIZATION */
 
+	if (NULL != extensions->allocationProfiler) {
+		extensions->allocationProfiler->kill(&env);
+		extensions->allocationProfiler = NULL;
+	}
+
+	if (NULL != extensions->verboseBinaryStream) {
+		extensions->verboseBinaryStream->kill(&env);
+		extensions->verboseBinaryStream = NULL;
+	}
+	if (NULL != extensions->verboseBinaryFileName) {
+		PORT_ACCESS_FROM_JAVAVM(vm);
+		j9mem_free_memory(extensions->verboseBinaryFileName);
+		extensions->verboseBinaryFileName = NULL;
+	}
+
 	if (vm->mainThread && vm->mainThread->threadObject) {
 		/* main thread has not been deallocated yet, but heap has gone */
 		vm->mainThread->threadObject = NULL;
@@ -476,6 +502,33 @@ j9gc_initialize_heap(J9JavaVM *vm, IDATA *memoryParameterTable, UDATA heapBytesR
 		goto error_no_memory;
 	}
 
+	if (extensions->stringDeduplication) {
+		/* candidates are queued while copying, so only the copying generational collectors support deduplication */
+		bool isGencon = (gc_policy_gencon == extensions->configurationOptions._gcPolicy) && !extensions->isConcurrentScavengerEnabled();
+		bool isBalanced = (gc_policy_balanced == extensions->configurationOptions._gcPolicy);
+		if (isGencon || isBalanced) {
+			extensions->stringDeduplicator = MM_StringDeduplicator::newInstance(&env);
+			if (NULL == extensions->stringDeduplicator) {
+				goto error_no_memory;
+			}
+		}
+	}
+
+	if (extensions->allocationProfile) {
+		extensions->allocationProfiler = MM_AllocationProfiler::newInstance(&env);
+		if (NULL == extensions->allocationProfiler) {
+			goto error_no_memory;
+		}
+	}
+
+	if (NULL != extensions->verboseBinaryFileName) {
+		/* like verbose GC logging, an unusable file is reported but does not stop the VM */
+		extensions->verboseBinaryStream = MM_VerboseBinaryStream::newInstance(&env, extensions->verboseBinaryFileName, extensions->verboseBinaryFileSize);
+		if (NULL == extensions->verboseBinaryStream) {
+			j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_UNABLE_TO_OPEN_FILE, extensions->verboseBinaryFileName);
+		}
+	}
+
 	/* Initialize statistic locks */
 	if (omrthread_monitor_init_with_name(&extensions->gcStatsMutex, 0, "MM_GCExtensions::gcStats")) {
 		loadInfo->fatalErrorStr = (char *)j9nls_lookup_message(J9NLS_DO_NOT_PRINT_MESSAGE_TAG | J9NLS_DO_NOT_APPEND_NEWLINE, J9NLS_GC_FAILED_TO_INITIALIZE_MUTEX, "Failed to initialize mutex for GC statistics.");
@@ -483,9 +536,15 @@ j9gc_initialize_heap(J9JavaVM *vm, IDATA *memoryParameterTable, UDATA heapBytesR
 	}
 
 #if defined(J9VM_GC_IDLE_HEAP_MANAGER)
-	if (extensions->gcOnIdle || extensions->compactOnIdle) {
-		/* Enable idle tuning only for gencon policy */
-		if (gc_policy_gencon == extensions->configurationOptions._gcPolicy) {
+	{
+		/* Enable idle GC only for gencon policy; idle page release is supported by gencon, balanced and metronome */
+		bool idleGC = (extensions->gcOnIdle || extensions->compactOnIdle) && (gc_policy_gencon == extensions->configurationOptions._gcPolicy);
+		bool idlePageRelease = extensions->idlePageRelease
+			&& ((gc_policy_gencon == extensions->configurationOptions._gcPolicy)
+				|| (gc_policy_balanced == extensions->configurationOptions._gcPolicy)
+				|| (gc_policy_metronome == extensions->configurationOptions._gcPolicy));
+		extensions->idlePageRelease = idlePageRelease;
+		if (idleGC || idlePageRelease) {
 			extensions->idleGCManager = MM_IdleGCManager::newInstance(&env);
 			if (NULL == extensions->idleGCManager) {
 				goto error_no_memory;
@@ -543,6 +602,12 @@ gcInitializeHeapStructures(J9JavaVM *vm)
 			loadInfo->fatalErrorStr = (char *)j9nls_lookup_message(J9NLS_DO_NOT_PRINT_MESSAGE_TAG | J9NLS_DO_NOT_APPEND_NEWLINE, J9NLS_GC_FAILED_TO_INITIALIZE_FINALIZER_MANAGEMENT, "Failed to initialize finalizer management.");
 			goto error;
 		}
+		if (0 != extensions->finalizeReferenceWorkers) {
+			if(!(extensions->finalizeWorkerPool = GC_FinalizeWorkerPool::newInstance(&env, extensions->finalizeReferenceWorkers))) {
+				loadInfo->fatalErrorStr = (char *)j9nls_lookup_message(J9NLS_DO_NOT_PRINT_MESSAGE_TAG | J9NLS_DO_NOT_APPEND_NEWLINE, J9NLS_GC_FAILED_TO_INITIALIZE_FINALIZER_MANAGEMENT, "Failed to initialize finalizer management.");
+				goto error;
+			}
+		}
 #endif /* J9VM_GC_FINALIZATION */
 
 	/* install hooks for the Validator */
@@ -575,6 +640,14 @@ gcStartupHeapManagement(J9JavaVM *javaVM)
 		j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_FAILED_TO_INITIALIZE_FINALIZE_SUPPORT);
 		return result;
 	}
+	if (NULL != extensions->finalizeWorkerPool) {
+		if (!extensions->finalizeWorkerPool->startThreads()) {
+			PORT_ACCESS_FROM_JAVAVM(javaVM);
+			extensions->finalizeWorkerPool->shutdownThreads(NULL);
+			j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_FAILED_TO_INITIALIZE_FINALIZE_SUPPORT);
+			return JNI_ENOMEM;
+		}
+	}
 #endif /* J9VM_GC_FINALIZATION */
 
 	/* Kickoff secondary initialization for the global collector */
@@ -587,6 +660,12 @@ gcStartupHeapManagement(J9JavaVM *javaVM)
 		result = JNI_ENOMEM;
 	}
 
+	if ((JNI_OK == result) && (NULL != extensions->stringDeduplicator)) {
+		if (!extensions->stringDeduplicator->startThread()) {
+			result = JNI_ENOMEM;
+		}
+	}
+
 	if (JNI_OK != result) {
 		PORT_ACCESS_FROM_JAVAVM(javaVM);
 		extensions->getGlobalCollector()->collectorShutdown(extensions);
@@ -708,8 +787,15 @@ gcShutdownHeapManagement(J9JavaVM *javaVM)
 #if defined(J9VM_GC_FINALIZATION)
 	/* wait for finalizer shutdown */
 	j9gc_finalizer_shutdown(javaVM);
+	if (NULL != extensions->finalizeWorkerPool) {
+		extensions->finalizeWorkerPool->shutdownThreads(javaVM->internalVMFunctions->currentVMThread(javaVM));
+	}
 #endif /* J9VM_GC_FINALIZATION */
 
+	if (NULL != extensions->stringDeduplicator) {
+		extensions->stringDeduplicator->shutdownThread();
+	}
+
 	/* Kickoff shutdown of global collector */
 	if (NULL != globalCollector) {
 		globalCollector->collectorShutdown(extensions);
@@ -3051,21 +3137,24 @@ error:
 	return J9VMDLLMAIN_FAILED;
 }
 
-#if defined(OMR_GC_CONCURRENT_SCAVENGER)
 static void
 hookAcquireVMAccess(J9HookInterface** hook, UDATA eventNum, void* voidEventData, void* userData)
 {
 	J9VMAcquireVMAccessEvent* eventData = (J9VMAcquireVMAccessEvent*)voidEventData;
 
 	J9VMThread *vmThread = eventData->currentThread;
-	MM_EnvironmentStandard *env = MM_EnvironmentStandard::getEnvironment(vmThread->omrVMThread);
-	MM_GCExtensions* ext = MM_GCExtensions::getExtensions(vmThread);
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(vmThread->omrVMThread);
 
-	Assert_MM_true(ext->concurrentScavenger);
+	/* The thread is about to run again, so the next scavenge or copy-forward can no longer skip its stack */
+	env->getGCEnvironment()->_stackWatermark = 0;
 
-	ext->scavenger->switchConcurrentForThread(env);
-}
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	MM_GCExtensions* ext = MM_GCExtensions::getExtensions(vmThread);
+	if (ext->concurrentScavenger) {
+		ext->scavenger->switchConcurrentForThread(MM_EnvironmentStandard::getEnvironment(vmThread->omrVMThread));
+	}
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
+}
 
 /**
  * Report an event indicating that the GC is initialized
@@ -3168,6 +3257,11 @@ gcInitializeVMHooks(MM_GCExtensionsBase *extensions)
 {
 	bool result = true;
 	J9JavaVM* javaVM = (J9JavaVM *)extensions->getOmrVM()->_language_vm;
+	/* Both stack watermarks and concurrent scavenger need to know when a thread takes the slow path of VM access acquire */
+	bool hookAcquireVMAccessRequired = MM_GCExtensions::getExtensions(javaVM)->stackWatermark && (extensions->scavengerEnabled || extensions->isVLHGC());
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	hookAcquireVMAccessRequired = hookAcquireVMAccessRequired || extensions->concurrentScavenger;
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
 	J9HookInterface **vmHookInterface = javaVM->internalVMFunctions->getVMHookInterface(javaVM);
 	if (NULL == vmHookInterface) {
@@ -3177,11 +3271,9 @@ gcInitializeVMHooks(MM_GCExtensionsBase *extensions)
 	} else if ((*vmHookInterface)->J9HookRegisterWithCallSite(vmHookInterface, J9HOOK_REGISTRATION_EVENT, hookVMRegistrationEvent, OMR_GET_CALLSITE(), javaVM)) {
 		result = false;
 	}
-#if defined(OMR_GC_CONCURRENT_SCAVENGER)
-	else if (extensions->concurrentScavenger && (*vmHookInterface)->J9HookRegisterWithCallSite(vmHookInterface, J9HOOK_VM_ACQUIREVMACCESS, hookAcquireVMAccess, OMR_GET_CALLSITE(), NULL)) {
+	else if (hookAcquireVMAccessRequired && (*vmHookInterface)->J9HookRegisterWithCallSite(vmHookInterface, J9HOOK_VM_ACQUIREVMACCESS, hookAcquireVMAccess, OMR_GET_CALLSITE(), NULL)) {
 		result = false;
 	}
-#endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
 	return result;
 }
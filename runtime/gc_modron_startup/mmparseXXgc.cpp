@@ -159,6 +159,13 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			}
 			continue;
 		}
+		if (try_scan(&scan_start, "adaptiveBeatMinimumMicro=")) {
+			if(!scan_udata_helper(vm, &scan_start, &(extensions->adaptiveBeatMinimumMicro), "adaptiveBeatMinimumMicro=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
 		if (try_scan(&scan_start, "verboseExtensions")) {
 			extensions->verboseExtensions = true;
 			continue;
@@ -377,6 +384,66 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			extensions->tarokPGCShouldCopyForward = false;
 			continue;
 		}
+		if (try_scan(&scan_start, "tarokEnablePretenuring")) {
+			extensions->tarokEnablePretenuring = true;
+			continue;
+		}
+		if (try_scan(&scan_start, "tarokDisablePretenuring")) {
+			extensions->tarokEnablePretenuring = false;
+			continue;
+		}
+		if (try_scan(&scan_start, "tarokPretenureSurvivalThreshold=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->tarokPretenureSurvivalThreshold, "tarokPretenureSurvivalThreshold=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if (extensions->tarokPretenureSurvivalThreshold > 100) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_INTEGER_OUT_OF_RANGE, "tarokPretenureSurvivalThreshold=", (UDATA)0, (UDATA)100);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+		if (try_scan(&scan_start, "tarokPretenureSampleRate=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->tarokPretenureSampleRate, "tarokPretenureSampleRate=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if ((0 == extensions->tarokPretenureSampleRate) || (0 != (extensions->tarokPretenureSampleRate & (extensions->tarokPretenureSampleRate - 1)))) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_VALUE_MUST_BE_POWER_OF_TWO, "tarokPretenureSampleRate=");
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+		if (try_scan(&scan_start, "tarokEnableAdaptiveTLHSizing")) {
+			extensions->tarokEnableAdaptiveTLHSizing = true;
+			continue;
+		}
+		if (try_scan(&scan_start, "tarokDisableAdaptiveTLHSizing")) {
+			extensions->tarokEnableAdaptiveTLHSizing = false;
+			continue;
+		}
+		if (try_scan(&scan_start, "tarokTLHTargetRefreshes=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->tarokTLHTargetRefreshes, "tarokTLHTargetRefreshes=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if (0 == extensions->tarokTLHTargetRefreshes) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_VALUE_MUST_BE_ABOVE, "-XXgc:tarokTLHTargetRefreshes", (UDATA)0);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+		if (try_scan(&scan_start, "tarokEnableContiguousArrayletLeaves")) {
+			extensions->tarokEnableContiguousArrayletLeaves = true;
+			continue;
+		}
+		if (try_scan(&scan_start, "tarokDisableContiguousArrayletLeaves")) {
+			extensions->tarokEnableContiguousArrayletLeaves = false;
+			continue;
+		}
 		if (try_scan(&scan_start, "tarokEnableDynamicCollectionSetSelection")) {
 			extensions->tarokEnableDynamicCollectionSetSelection = true;
 			continue;
@@ -1245,6 +1312,92 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			continue;
 		}
 
+		if (try_scan(&scan_start, "stringTableCacheSize=")) {
+			if(!scan_udata_helper(vm, &scan_start, &(extensions->_stringTableCacheSize), "stringTableCacheSize=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if ((0 == extensions->_stringTableCacheSize) || (0 != (extensions->_stringTableCacheSize & (extensions->_stringTableCacheSize - 1)))) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_VALUE_MUST_BE_POWER_OF_TWO, "stringTableCacheSize=");
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+		if (try_scan(&scan_start, "idlePageReleaseMinimumSize=")) {
+			if(!scan_udata_memory_size_helper(vm, &scan_start, &(extensions->idlePageReleaseMinimumSize), "idlePageReleaseMinimumSize=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
+		if (try_scan(&scan_start, "idlePageReleaseBatchSize=")) {
+			if(!scan_udata_memory_size_helper(vm, &scan_start, &(extensions->idlePageReleaseBatchSize), "idlePageReleaseBatchSize=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if (0 == extensions->idlePageReleaseBatchSize) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_VALUE_MUST_BE_ABOVE, "idlePageReleaseBatchSize=", (UDATA)0);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
+		if (try_scan(&scan_start, "idlePageReleaseBatchInterval=")) {
+			if(!scan_udata_helper(vm, &scan_start, &(extensions->idlePageReleaseBatchIntervalMillis), "idlePageReleaseBatchInterval=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
+		if (try_scan(&scan_start, "idlePageRelease")) {
+			extensions->idlePageRelease = true;
+			continue;
+		}
+
+		if (try_scan(&scan_start, "noIdlePageRelease")) {
+			extensions->idlePageRelease = false;
+			continue;
+		}
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
+
+		if (try_scan(&scan_start, "enableStringDeduplication")) {
+			extensions->stringDeduplication = true;
+			continue;
+		}
+
+		if (try_scan(&scan_start, "disableStringDeduplication")) {
+			extensions->stringDeduplication = false;
+			continue;
+		}
+
+		if (try_scan(&scan_start, "stringDeduplicationAgeThreshold=")) {
+			if(!scan_udata_helper(vm, &scan_start, &(extensions->stringDeduplicationAgeThreshold), "stringDeduplicationAgeThreshold=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if ((0 == extensions->stringDeduplicationAgeThreshold) || (extensions->stringDeduplicationAgeThreshold > OBJECT_HEADER_AGE_MAX)) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_INTEGER_OUT_OF_RANGE, "stringDeduplicationAgeThreshold=", (UDATA)1, (UDATA)OBJECT_HEADER_AGE_MAX);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
+		if (try_scan(&scan_start, "lazyOwnableSynchronizerDiscovery")) {
+			extensions->lazyOwnableSynchronizerDiscovery = true;
+			continue;
+		}
+		if (try_scan(&scan_start, "noLazyOwnableSynchronizerDiscovery")) {
+			extensions->lazyOwnableSynchronizerDiscovery = false;
+			continue;
+		}
+
 		if (try_scan(&scan_start, "objectListFragmentCount=")) {
 			if(!scan_udata_helper(vm, &scan_start, &(extensions->objectListFragmentCount), "objectListFragmentCount=")) {
 				returnValue = JNI_EINVAL;
@@ -1265,6 +1418,40 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			}
 			continue;
 		}
+		if (try_scan(&scan_start, "scanPrefetchDistance=")) {
+			if(!scan_udata_helper(vm, &scan_start, &(extensions->scanPrefetchDistance), "scanPrefetchDistance=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+		if (try_scan(&scan_start, "stackScanSplitThreshold=")) {
+			if(!scan_udata_memory_size_helper(vm, &scan_start, &(extensions->stackScanSplitThreshold), "stackScanSplitThreshold=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+		if (try_scan(&scan_start, "stackScanUnitFrames=")) {
+			if(!scan_udata_helper(vm, &scan_start, &(extensions->stackScanUnitFrames), "stackScanUnitFrames=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if (0 == extensions->stackScanUnitFrames) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_VALUE_MUST_BE_ABOVE, "stackScanUnitFrames=", (UDATA)0);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+		if (try_scan(&scan_start, "stackWatermark")) {
+			extensions->stackWatermark = true;
+			continue;
+		}
+		if (try_scan(&scan_start, "noStackWatermark")) {
+			extensions->stackWatermark = false;
+			continue;
+		}
 		if (try_scan(&scan_start, "darkMatterSampleRate=")) {
 			if(!scan_udata_helper(vm, &scan_start, &(extensions->darkMatterSampleRate), "darkMatterSampleRate=")) {
 				returnValue = JNI_EINVAL;
@@ -40,6 +40,8 @@ static const char *versionString = "Modron $Name: not supported by cvs2svn $";
 
 #include "mmparse.h"
 
+#include "AllocationProfiler.hpp"
+#include "FinalizeWorkerPool.hpp"
 #include "GCExtensions.hpp"
 #include "Math.hpp"
 
@@ -183,6 +185,49 @@ j9gc_initialize_parse_gc_colon(J9JavaVM *javaVM, char **scan_start)
 		goto _exit;
 	}
 
+	if (try_scan(scan_start, "criticalTargetUtilization=")) {
+		if(!scan_udata_helper(javaVM, scan_start, &(extensions->criticalTargetUtilizationPercentage), "criticalTargetUtilization=")) {
+			goto _error;
+		}
+		if ((extensions->criticalTargetUtilizationPercentage < 1) || (99 < extensions->criticalTargetUtilizationPercentage)) {
+			j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_INTEGER_OUT_OF_RANGE, "criticalTargetUtilization=", (UDATA)1, (UDATA)99);
+			goto _error;
+		}
+		goto _exit;
+	}
+
+	if (try_scan(scan_start, "criticalThreadPriority=")) {
+		if(!scan_udata_helper(javaVM, scan_start, &(extensions->criticalThreadPriority), "criticalThreadPriority=")) {
+			goto _error;
+		}
+		/* the priority is a java.lang.Thread priority */
+		if ((extensions->criticalThreadPriority < 1) || (10 < extensions->criticalThreadPriority)) {
+			j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_INTEGER_OUT_OF_RANGE, "criticalThreadPriority=", (UDATA)1, (UDATA)10);
+			goto _error;
+		}
+		goto _exit;
+	}
+
+	if (try_scan(scan_start, "adaptiveBeat")) {
+		extensions->adaptiveBeat = true;
+		goto _exit;
+	}
+
+	if (try_scan(scan_start, "noAdaptiveBeat")) {
+		extensions->adaptiveBeat = false;
+		goto _exit;
+	}
+
+	if (try_scan(scan_start, "incrementalStackScan")) {
+		extensions->realtimeIncrementalStackScan = true;
+		goto _exit;
+	}
+
+	if (try_scan(scan_start, "noIncrementalStackScan")) {
+		extensions->realtimeIncrementalStackScan = false;
+		goto _exit;
+	}
+
 #endif /* J9VM_GC_REALTIME */
 
 //todo tempoary option to allow LOA to be enabled for testing with non-default gc policies
@@ -1241,6 +1286,25 @@ gcParseXgcArguments(J9JavaVM *vm, char *optArg)
 			}
 			continue;
 		}
+		if (try_scan(&scan_start, "finalizeReferenceWorkers=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->finalizeReferenceWorkers, "finalizeReferenceWorkers=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if(extensions->finalizeReferenceWorkers > GC_FinalizeWorkerPool::MAXIMUM_WORKERS) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_INTEGER_OUT_OF_RANGE, "-Xgc:finalizeReferenceWorkers", (UDATA)0, (UDATA)GC_FinalizeWorkerPool::MAXIMUM_WORKERS);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+		if (try_scan(&scan_start, "finalizeBackpressureThreshold=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->finalizeBackpressureThreshold, "finalizeBackpressureThreshold=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
 #endif /* J9VM_GC_FINALIZATION */
 
 #if defined(J9MODRON_USE_CUSTOM_SPINLOCKS)
@@ -1332,6 +1396,55 @@ gcParseXgcArguments(J9JavaVM *vm, char *optArg)
 			continue;
 		}
 
+		if (try_scan(&scan_start, "allocationProfileDepth=")) {
+			if (!scan_udata_helper(vm, &scan_start, &extensions->allocationProfileDepth, "allocationProfileDepth=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if (ALLOCATION_PROFILE_MAXIMUM_DEPTH < extensions->allocationProfileDepth) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_INTEGER_OUT_OF_RANGE, "allocationProfileDepth=", (UDATA)0, (UDATA)ALLOCATION_PROFILE_MAXIMUM_DEPTH);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
+		if (try_scan(&scan_start, "allocationProfileMaxSites=")) {
+			if (!scan_udata_helper(vm, &scan_start, &extensions->allocationProfileMaxSites, "allocationProfileMaxSites=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
+		/* the profile is built from the out-of-line allocation samples, so it enables them */
+		if (try_scan(&scan_start, "allocationProfile")) {
+			extensions->allocationProfile = true;
+			extensions->doOutOfLineAllocationTrace = true;
+			continue;
+		}
+
+		if (try_scan(&scan_start, "verboseBinaryFileSize=")) {
+			if (!scan_udata_memory_size_helper(vm, &scan_start, &extensions->verboseBinaryFileSize, "verboseBinaryFileSize=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
+		if (try_scan(&scan_start, "verboseBinaryFile=")) {
+			char *fileName = scan_to_delim(PORTLIB, &scan_start, ',');
+			if ((NULL == fileName) || ('\0' == *fileName)) {
+				j9mem_free_memory(fileName);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			/* the last occurrence wins */
+			j9mem_free_memory(extensions->verboseBinaryFileName);
+			extensions->verboseBinaryFileName = fileName;
+			continue;
+		}
+
 		/* see if we are forcing shifting to a specific value */
 		if (try_scan(&scan_start, "preferredHeapBase=")) {
 			UDATA preferredHeapBase = 0;
@@ -80,6 +80,7 @@ MM_EnvironmentRealtime::initialize(MM_GCExtensionsBase *extensionsBase)
 	_monitorCacheCleared = FALSE;
 	
 	_distanceToYieldTimeCheck = extensions->distanceToYieldTimeCheck;
+	_traceCostToCheckYield = OMR_MAX(extensions->traceCostToCheckYield, (UDATA)1);
 
 	_overflowCache = (MM_HeapRegionDescriptorRealtime**)getForge()->allocate(sizeof(MM_HeapRegionDescriptorRealtime *) * extensions->overflowCacheCount, MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
 	if (NULL == _overflowCache) {
@@ -118,6 +119,32 @@ void MM_EnvironmentRealtime::enableYield()
 	assert1(_yieldDisableDepth >= 0);
 }
 
+/**
+ * Called at each tracing yield check.  A fixed tracing cost between checks translates into very
+ * different amounts of time depending on object shapes and cache behaviour, so rescale the cost
+ * from the time measured since the previous check, aiming for checks a small fraction of a beat
+ * apart (and never further apart than INTER_YIELD_WARNING_THRESHOLD_NS).
+ */
+void
+MM_EnvironmentRealtime::paceTraceYieldCheck()
+{
+	U_64 now = _timer->getTimeInNanos();
+
+	if ((0 != _lastTraceYieldCheckNanos) && (now > _lastTraceYieldCheckNanos)) {
+		MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(this);
+		U_64 elapsed = now - _lastTraceYieldCheckNanos;
+		U_64 target = OMR_MIN(_scheduler->beatNanos / 16, (U_64)INTER_YIELD_WARNING_THRESHOLD_NS);
+		UDATA scaled = (UDATA)OMR_MAX(((U_64)_traceCostToCheckYield * target) / elapsed, (U_64)1);
+		UDATA minimumCost = OMR_MAX(extensions->traceCostToCheckYield / 16, (UDATA)1);
+		UDATA maximumCost = OMR_MAX(extensions->traceCostToCheckYield * 4, minimumCost);
+
+		/* Move half way towards the new estimate to damp noise from individual intervals */
+		_traceCostToCheckYield = (_traceCostToCheckYield + scaled) / 2;
+		_traceCostToCheckYield = OMR_MIN(OMR_MAX(_traceCostToCheckYield, minimumCost), maximumCost);
+	}
+	_lastTraceYieldCheckNanos = now;
+}
+
 void
 MM_EnvironmentRealtime::reportScanningSuspended() {
 	if (NULL != _rootScanner) {
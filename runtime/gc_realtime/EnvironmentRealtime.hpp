@@ -28,6 +28,7 @@
 
 #include "Base.hpp"
 #include "EnvironmentBase.hpp"
+#include "Metronome.hpp"
 #include "OSInterface.hpp"
 #include "OwnableSynchronizerObjectBufferRealtime.hpp"
 #include "ReferenceObjectBufferRealtime.hpp"
@@ -68,6 +69,10 @@ private:
 	U_32 _distanceToYieldTimeCheck; /**< Number of condYield that can be skipped before actual checking for yield, when the quanta time has been relaxed */
 	U_32 _currentDistanceToYieldTimeCheck; /**< The current remaining number of condYield calls to be skipped before the next actual yield check */
 
+	UDATA _gcActivity; /**< GC_ACTIVITY_* the thread is currently busy with, used to attribute quantum overshoot */
+	UDATA _traceCostToCheckYield; /**< Tracing cost between yield checks, rescaled from the time actually measured between checks */
+	U_64 _lastTraceYieldCheckNanos; /**< Time of the last tracing yield check (0 if none since the last yield) */
+
 /* Functionality Section */
 	
 public:
@@ -109,6 +114,22 @@ public:
 		return shouldSkipTimeCheck;
 	}
 	
+	MMINLINE UDATA getGCActivity() const { return _gcActivity; }
+	/**
+	 * Record what the thread is busy with.
+	 * @return the previous activity, to be restored by the caller when done
+	 */
+	MMINLINE UDATA setGCActivity(UDATA activity)
+	{
+		UDATA previous = _gcActivity;
+		_gcActivity = activity;
+		return previous;
+	}
+
+	MMINLINE UDATA getTraceCostToCheckYield() const { return _traceCostToCheckYield; }
+	void paceTraceYieldCheck();
+	MMINLINE void resetTraceYieldCheck() { _lastTraceYieldCheckNanos = 0; }
+
 	void reportScanningSuspended();
 	void reportScanningResumed();
 	
@@ -142,7 +163,10 @@ public:
 		_overflowCacheCount(0),
 		_timer(NULL),
 		_distanceToYieldTimeCheck(0),
-		_currentDistanceToYieldTimeCheck(0)
+		_currentDistanceToYieldTimeCheck(0),
+		_gcActivity(GC_ACTIVITY_OTHER),
+		_traceCostToCheckYield(0),
+		_lastTraceYieldCheckNanos(0)
 	{ 
 		_typeId = __FUNCTION__;
 	}
@@ -156,7 +180,10 @@ public:
 		_overflowCacheCount(0),
 		_timer(NULL),
 		_distanceToYieldTimeCheck(0),
-		_currentDistanceToYieldTimeCheck(0)
+		_currentDistanceToYieldTimeCheck(0),
+		_gcActivity(GC_ACTIVITY_OTHER),
+		_traceCostToCheckYield(0),
+		_lastTraceYieldCheckNanos(0)
 	{ 
 		_typeId = __FUNCTION__;
 	}
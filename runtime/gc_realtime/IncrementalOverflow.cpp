@@ -213,6 +213,7 @@ MM_IncrementalOverflow::fillFromOverflow(MM_EnvironmentBase *env, MM_Packet *pac
 	MM_RealtimeMarkingScheme *markingScheme = realtimeGC->getMarkingScheme();
 #endif /* defined(OMR_GC_ARRAYLETS) */
 	bool roomLeft = true;
+	UDATA previousActivity = envRealtime->setGCActivity(GC_ACTIVITY_OVERFLOW);
 	
 	while (roomLeft && ((region = pop(envRealtime)) != NULL)) {
 #if defined(OMR_GC_ARRAYLETS)
@@ -291,6 +292,8 @@ MM_IncrementalOverflow::fillFromOverflow(MM_EnvironmentBase *env, MM_Packet *pac
 			}
 		}
 	}
+
+	envRealtime->setGCActivity(previousActivity);
 }
 
 /**
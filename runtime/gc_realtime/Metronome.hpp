@@ -59,6 +59,20 @@
 #define	GC_PHASE_CONCURRENT_SWEEP 0x00000010
 #define GC_PHASE_UNLOADING_CLASS_LOADERS  0x00000020
 
+/*
+ *	Activities a GC thread can be busy with when it notices its quantum has run out.
+ *	Used to attribute quantum overshoot to a cause; GC_ACTIVITY_OTHER defers to the
+ *	current GC phase.
+ */
+#define GC_ACTIVITY_OTHER		0
+#define GC_ACTIVITY_ROOTS		1
+#define GC_ACTIVITY_STACKS		2
+#define GC_ACTIVITY_TRACE		3
+#define GC_ACTIVITY_OVERFLOW	4
+#define GC_ACTIVITY_UNLOADING	5
+#define GC_ACTIVITY_SWEEP		6
+#define GC_ACTIVITY_COUNT		7
+
 #define MINIMUM_FREE_CHUNK_SIZE 64
 
 #endif /* METRONOME_HPP_ */
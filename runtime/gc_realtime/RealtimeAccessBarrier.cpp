@@ -29,6 +29,7 @@
 #include "RealtimeAccessBarrier.hpp"
 #include "RealtimeGC.hpp"
 #include "RealtimeMarkingScheme.hpp"
+#include "SlotObject.hpp"
 
 #if defined(J9VM_GC_REALTIME)
 
@@ -311,6 +312,23 @@ MM_RealtimeAccessBarrier::rememberObject(MM_EnvironmentBase *env, J9Object *obje
 	}
 }
 
+/**
+ * Remember every non-NULL object referenced from a run of consecutive reference slots.
+ * Batch version of rememberObject() used by the bulk store barriers.
+ */
+void
+MM_RealtimeAccessBarrier::rememberObjectRange(MM_EnvironmentBase *env, fj9object_t *startAddress, UDATA slotCount)
+{
+	fj9object_t *endAddress = startAddress + slotCount;
+	for (fj9object_t *slot = startAddress; slot < endAddress; slot++) {
+		GC_SlotObject slotObject(env->getOmrVM(), slot);
+		J9Object *object = slotObject.readReferenceFromSlot();
+		if (NULL != object) {
+			rememberObject(env, object);
+		}
+	}
+}
+
 /**
  * Read an object from an internal VM slot (J9VMThread, J9JavaVM, named field of J9Class).
  * This function is only concerned with moving the actual data. Do not re-implement
@@ -107,6 +107,7 @@ protected:
 	
 	/* New methods */
 	void rememberObject(MM_EnvironmentBase *env, J9Object *object);
+	void rememberObjectRange(MM_EnvironmentBase *env, fj9object_t *startAddress, UDATA slotCount);
 	void rememberObjectIfBarrierEnabled(J9VMThread *vmThread, J9Object* object);
 	
 private:
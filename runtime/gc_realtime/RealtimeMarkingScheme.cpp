@@ -76,16 +76,16 @@ public:
 	/**
 	 * Wraps the scanning of one thread to only happen if it hasn't already occured in this phase of this GC,
 	 * also sets the thread up for the upcoming forwarding phase.
-	 * @return true if the thread was scanned (the caller should offer to yield), false otherwise.
+	 * @return true if the scan of the thread yielded, false otherwise.
 	 * @see MM_RootScanner::scanOneThread()
 	 */
-	virtual void
+	virtual bool
 	scanOneThreadImpl(MM_EnvironmentRealtime *env, J9VMThread* walkThread, void* localData)
 	{
 		MM_EnvironmentRealtime* walkThreadEnv = MM_EnvironmentRealtime::getEnvironment(walkThread);
 		MM_RealtimeGC* realtimeGC = (MM_RealtimeGC*)_realtimeGC;
-		/* Scan the thread by invoking superclass */
-		MM_RootScanner::scanOneThread(env, walkThread, localData);
+		/* Scan the thread, possibly across several quanta (the double barrier stays on until it completes) */
+		bool yielded = scanOneThreadIncrementally(env, walkThread, localData);
 
 		/*
 		 * TODO CRGTMP we should be able to premark the cache instead of flushing the cache
@@ -96,6 +96,7 @@ public:
 		walkThreadEnv->_objectAllocationInterface->flushCache(walkThreadEnv);
 		/* Disable the double barrier on the scanned thread. */
 		realtimeGC->disableDoubleBarrierOnThread(env, walkThread->omrVMThread);
+		return yielded;
 	}
 	
 #if defined(J9VM_GC_FINALIZATION)
@@ -984,6 +985,10 @@ MM_RealtimeMarkingScheme::incrementalConsumeQueue(MM_EnvironmentRealtime *env, U
 	UDATA item;
 	UDATA count = 0, countSinceLastYieldCheck = 0;
 	UDATA scannedPointersSumSinceLastYieldCheck = 0;
+	UDATA previousActivity = env->setGCActivity(GC_ACTIVITY_TRACE);
+
+	/* Only time between yield checks within this call is used to pace the checks */
+	env->resetTraceYieldCheck();
   
 	while(0 != (item = (UDATA)env->getWorkStack()->pop(env))) {
 		UDATA scannedPointers;
@@ -998,7 +1003,8 @@ MM_RealtimeMarkingScheme::incrementalConsumeQueue(MM_EnvironmentRealtime *env, U
 		countSinceLastYieldCheck += 1;
 		scannedPointersSumSinceLastYieldCheck += scannedPointers;
 		
-		if (((countSinceLastYieldCheck * 2) + scannedPointersSumSinceLastYieldCheck) > _gcExtensions->traceCostToCheckYield) {
+		if (((countSinceLastYieldCheck * 2) + scannedPointersSumSinceLastYieldCheck) > env->getTraceCostToCheckYield()) {
+			env->paceTraceYieldCheck();
 			_scheduler->condYieldFromGC(env);
 			
 			scannedPointersSumSinceLastYieldCheck = 0;
@@ -1006,9 +1012,12 @@ MM_RealtimeMarkingScheme::incrementalConsumeQueue(MM_EnvironmentRealtime *env, U
 		}
 		
 		if (++count >= maxCount) {
+			env->setGCActivity(previousActivity);
 			return false;
 		}
 	}
+
+	env->setGCActivity(previousActivity);
 	
 	if (maxCount == MAX_UINT) {
 		return (count != 0);
@@ -47,6 +47,26 @@
 #include "Scheduler.hpp"
 #include "SublistSlotIterator.hpp"
 #include "Task.hpp"
+#include "VMThreadIterator.hpp"
+#include "VMThreadStackSlotIterator.hpp"
+
+extern "C" {
+
+static void
+realtimeStackSlotIterator(J9JavaVM *javaVM, J9Object **slot, void *localData, J9StackWalkState *walkState, const void *stackLocation)
+{
+	StackIteratorData *data = (StackIteratorData *)localData;
+	data->rootScanner->doStackSlot(slot, walkState, stackLocation);
+}
+
+static bool
+realtimeStackScanShouldSuspend(J9VMThread *vmThread, void *localData)
+{
+	StackIteratorData *data = (StackIteratorData *)localData;
+	return ((MM_RealtimeRootScanner *)data->rootScanner)->shouldSuspendStackScan();
+}
+
+} /* extern "C" */
 
 void
 MM_RealtimeRootScanner::doClass(J9Class *clazz)
@@ -125,7 +145,8 @@ MM_RealtimeRootScanner::scanOneThread(MM_EnvironmentBase *envBase, J9VMThread* w
 {
 	MM_EnvironmentRealtime *env = MM_EnvironmentRealtime::getEnvironment(envBase);
 	
-	scanOneThreadImpl(env, walkThread, localData);
+	/* If the scan itself yielded the thread list may have changed, so the iterator must restart */
+	bool yielded = scanOneThreadImpl(env, walkThread, localData);
 
 	/* Thead count is used under verbose only.
 	 * Avoid the atomic add in the regular path.
@@ -144,12 +165,93 @@ MM_RealtimeRootScanner::scanOneThread(MM_EnvironmentBase *envBase, J9VMThread* w
 		return true;
 	}
 
-	return false;
+	return yielded;
 }
 
-void
+/**
+ * Scan one thread.
+ * @return true if the scan yielded, false otherwise
+ */
+bool
 MM_RealtimeRootScanner::scanOneThreadImpl(MM_EnvironmentRealtime *env, J9VMThread* walkThread, void* localData)
 {
+	return false;
+}
+
+/**
+ * Scan the slots of one thread, splitting the walk of its stack across quanta if it does not fit in
+ * the time left in the current one.
+ *
+ * There is no way to trap a thread returning into a frame that has not been scanned yet, so a thread
+ * whose stack scan is suspended is instead halted (the same way threads are halted for inspection)
+ * before the mutators are restarted, and only released once the rest of its stack has been walked.
+ * Its stack is therefore unchanged when the walk resumes, and only that one thread waits for the GC.
+ * GC threads, and walks that report visible frame depth, are always scanned in one go.
+ *
+ * @return true if the scan yielded, false otherwise
+ */
+bool
+MM_RealtimeRootScanner::scanOneThreadIncrementally(MM_EnvironmentRealtime *env, J9VMThread* walkThread, void* localData)
+{
+	J9VMThread *vmThread = (J9VMThread *)env->getLanguageVMThread();
+	MM_EnvironmentRealtime *walkThreadEnv = MM_EnvironmentRealtime::getEnvironment(walkThread);
+	UDATA previousActivity = env->setGCActivity(GC_ACTIVITY_STACKS);
+	bool yielded = false;
+
+	if (_trackVisibleStackFrameDepth || !_extensions->realtimeIncrementalStackScan || (MUTATOR_THREAD != walkThreadEnv->getThreadType())) {
+		MM_RootScanner::scanOneThread(env, walkThread, localData);
+	} else {
+		GC_VMThreadIterator vmThreadIterator(walkThread);
+		while(J9Object **slot = vmThreadIterator.nextSlot()) {
+			doVMThreadSlot(slot, &vmThreadIterator);
+		}
+
+		J9StackWalkState walkState;
+		bool halted = false;
+		_stackFramesToYieldCheck = ROOT_GRANULARITY;
+		bool complete = GC_VMThreadStackSlotIterator::scanSlotsIncrementally(vmThread, walkThread, &walkState, false, localData, realtimeStackSlotIterator, realtimeStackScanShouldSuspend, isStackFrameClassWalkNeeded());
+		while (!complete) {
+			if (!halted) {
+				/* Still inside the increment, so the thread cannot run before the halt takes effect */
+				omrthread_monitor_enter(walkThread->publicFlagsMutex);
+				walkThread->inspectionSuspendCount += 1;
+				vmThread->javaVM->internalVMFunctions->setHaltFlag(walkThread, J9_PUBLIC_FLAGS_HALT_THREAD_INSPECTION);
+				omrthread_monitor_exit(walkThread->publicFlagsMutex);
+				halted = true;
+			}
+			if (condYield()) {
+				yielded = true;
+			}
+			_stackFramesToYieldCheck = ROOT_GRANULARITY;
+			complete = GC_VMThreadStackSlotIterator::scanSlotsIncrementally(vmThread, walkThread, &walkState, true, localData, realtimeStackSlotIterator, realtimeStackScanShouldSuspend, isStackFrameClassWalkNeeded());
+		}
+		if (halted) {
+			omrthread_monitor_enter(walkThread->publicFlagsMutex);
+			walkThread->inspectionSuspendCount -= 1;
+			if (0 == walkThread->inspectionSuspendCount) {
+				vmThread->javaVM->internalVMFunctions->clearHaltFlag(walkThread, J9_PUBLIC_FLAGS_HALT_THREAD_INSPECTION);
+			}
+			omrthread_monitor_exit(walkThread->publicFlagsMutex);
+		}
+	}
+
+	env->setGCActivity(previousActivity);
+	return yielded;
+}
+
+/**
+ * Called after each frame of an incremental stack scan.
+ * @return true if the walk should be suspended so that the GC can yield
+ */
+bool
+MM_RealtimeRootScanner::shouldSuspendStackScan()
+{
+	_stackFramesToYieldCheck -= 1;
+	if (_stackFramesToYieldCheck < 0) {
+		_stackFramesToYieldCheck = ROOT_GRANULARITY;
+		return (_env->getYieldDisableDepth() <= 0) && _realtimeGC->_sched->shouldGCYield(_env, 0);
+	}
+	return false;
 }
 
 void
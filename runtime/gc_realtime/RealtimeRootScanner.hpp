@@ -62,6 +62,7 @@ protected:
 public:
 	UDATA _threadCount;
 	I_32 _yieldCount;
+	I_32 _stackFramesToYieldCheck; /**< Frames left to walk before the next yield check of an incremental stack scan */
 
 	/*
 	 * Function members
@@ -78,7 +79,9 @@ public:
 
 	virtual void scanThreads(MM_EnvironmentBase *env);
 	virtual bool scanOneThread(MM_EnvironmentBase *env, J9VMThread* walkThread, void* localData);
-	virtual void scanOneThreadImpl(MM_EnvironmentRealtime *env, J9VMThread* walkThread, void* localData);
+	virtual bool scanOneThreadImpl(MM_EnvironmentRealtime *env, J9VMThread* walkThread, void* localData);
+	bool scanOneThreadIncrementally(MM_EnvironmentRealtime *env, J9VMThread* walkThread, void* localData);
+	bool shouldSuspendStackScan();
 	void reportThreadCount(MM_EnvironmentBase *env);
 	void scanAtomicRoots(MM_EnvironmentRealtime *env);
 
@@ -108,6 +111,7 @@ public:
 		, _env(env)
 		, _threadCount(0)
 		, _yieldCount(0)
+		, _stackFramesToYieldCheck(ROOT_GRANULARITY)
 	{
 		_typeId = __FUNCTION__;
 #if defined(J9VM_GC_REALTIME) 
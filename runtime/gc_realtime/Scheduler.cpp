@@ -25,6 +25,7 @@
 #include "j9protos.h"
 #include "j9consts.h"
 #include "modronopt.h"
+#include "mmhook.h"
 #include "ModronAssertions.h"
 
 #include <string.h>
@@ -160,6 +161,22 @@ MM_Scheduler::getParameter(UDATA which, char *keyBuffer, I_32 keyBufferSize, cha
 			j9str_printf(PORTLIB, keyBuffer, keyBufferSize, "Regionsize");
 			j9str_printf(PORTLIB, valueBuffer, valueBufferSize, "%d", _extensions->regionSize);
 			return 1;
+		case 10:
+			j9str_printf(PORTLIB, keyBuffer, keyBufferSize, "Critical Target Utilization");
+			if (0.0 == _criticalTargetUtilization) {
+				j9str_printf(PORTLIB, valueBuffer, valueBufferSize, "disabled");
+			} else {
+				j9str_printf(PORTLIB, valueBuffer, valueBufferSize, "%4.1f%% (thread priority >= %d)", _criticalTargetUtilization * 1.0e2, _extensions->criticalThreadPriority);
+			}
+			return 1;
+		case 11:
+			j9str_printf(PORTLIB, keyBuffer, keyBufferSize, "Adaptive Beat");
+			if (_extensions->adaptiveBeat) {
+				j9str_printf(PORTLIB, valueBuffer, valueBufferSize, "%4.2f - %4.2f ms", _minimumBeatNanos / 1.0e6, _maximumBeatNanos / 1.0e6);
+			} else {
+				j9str_printf(PORTLIB, valueBuffer, valueBufferSize, "disabled");
+			}
+			return 1;
 	}
 	return 0;
 }
@@ -200,9 +217,19 @@ MM_Scheduler::initialize(MM_EnvironmentBase *env)
 
 	/* Show GC parameters here before we enter real execution */
 	window = _extensions->timeWindowMicro / 1e6;
-	beat = _extensions->beatMicro / 1e6;
-	beatNanos = (U_64) (_extensions->beatMicro * 1e3);
+	_maximumBeatNanos = (U_64) (_extensions->beatMicro * 1e3);
+	_minimumBeatNanos = _maximumBeatNanos;
+	if (_extensions->adaptiveBeat) {
+		_minimumBeatNanos = (0 != _extensions->adaptiveBeatMinimumMicro) ? (U_64) (_extensions->adaptiveBeatMinimumMicro * 1e3) : (_maximumBeatNanos / 4);
+		if (_minimumBeatNanos > _maximumBeatNanos) {
+			_minimumBeatNanos = _maximumBeatNanos;
+		}
+	}
+	/* Adaptive beat starts with the shortest quantum and lengthens it once allocation pressure is measured */
+	beatNanos = _minimumBeatNanos;
+	beat = beatNanos / 1e9;
 	_staticTargetUtilization = _extensions->targetUtilizationPercentage / 1e2;
+	_criticalTargetUtilization = _extensions->criticalTargetUtilizationPercentage / 1e2;
 	_utilTracker = MM_UtilizationTracker::newInstance(env, window, beatNanos, _staticTargetUtilization);
 	if (NULL == _utilTracker) {
 		goto error_no_memory;
@@ -216,6 +243,8 @@ MM_Scheduler::initialize(MM_EnvironmentBase *env)
 	}
 	memset(_threadResumedTable, false, _threadCountMaximum * sizeof(bool));
 
+	memset((void *)_maxQuantumOvershootNanos, 0, sizeof(_maxQuantumOvershootNanos));
+
 	if (omrthread_monitor_init_with_name(&_masterThreadMonitor, 0, "MasterThread")) {
 		return false;
 	}	
@@ -258,6 +287,7 @@ MM_Scheduler::startGC(MM_EnvironmentBase *env)
 	}
 
 	if (METRONOME_GC_OFF == MM_AtomicOperations::lockCompareExchangeU32(&_gcOn, METRONOME_GC_OFF, METRONOME_GC_ON)) {
+		_cycleStartTimeInNanos = MM_EnvironmentRealtime::getEnvironment(env)->getTimer()->getTimeInNanos();
 		if (_gc->isPreviousCycleBelowTrigger()) {
 			_gc->setPreviousCycleBelowTrigger(false);
 			TRIGGER_J9HOOK_MM_PRIVATE_METRONOME_TRIGGER_START(_extensions->privateHookInterface,
@@ -273,6 +303,10 @@ MM_Scheduler::startGC(MM_EnvironmentBase *env)
 void
 MM_Scheduler::stopGC(MM_EnvironmentBase *env)
 {
+	U_64 currentTime = MM_EnvironmentRealtime::getEnvironment(env)->getTimer()->getTimeInNanos();
+	if ((0 != _cycleStartTimeInNanos) && (currentTime > _cycleStartTimeInNanos)) {
+		_lastCycleDurationInNanos = currentTime - _cycleStartTimeInNanos;
+	}
 	_gcOn = METRONOME_GC_OFF;
 }
 
@@ -457,6 +491,12 @@ void
 MM_Scheduler::startGCTime(MM_EnvironmentRealtime *env, bool isDoubleBeat)
 {
 	if (env->isMasterThread()) {
+		if (!isDoubleBeat) {
+			/* A mutator slice has just ended; retune the target and quantum before charging it */
+			U_64 currentTime = env->getTimer()->getTimeInNanos();
+			updateTargetUtilization(env, currentTime);
+			updateBeat(env, currentTime);
+		}
 		setStartTimeOfCurrentGCSlice(_utilTracker->addTimeSlice(env, env->getTimer(), false));
 	}
 }
@@ -465,10 +505,120 @@ void
 MM_Scheduler::stopGCTime(MM_EnvironmentRealtime *env)
 {
 	if (env->isMasterThread()) {
+		_freeMemoryAtMutatorStart = _extensions->heap->getApproximateActiveFreeMemorySize();
 		setStartTimeOfCurrentMutatorSlice(_utilTracker->addTimeSlice(env, env->getTimer(), false));
 	}
 }
 
+bool
+MM_Scheduler::isCriticalThread(MM_EnvironmentRealtime *env)
+{
+	J9VMThread *vmThread = (J9VMThread *)env->getLanguageVMThread();
+	j9object_t threadObject = vmThread->threadObject;
+	return (NULL != threadObject) && ((UDATA)J9VMJAVALANGTHREAD_PRIORITY(vmThread, threadObject) >= _extensions->criticalThreadPriority);
+}
+
+void
+MM_Scheduler::updateTargetUtilization(MM_EnvironmentRealtime *env, U_64 currentTime)
+{
+	double targetUtilization = _staticTargetUtilization;
+
+	/* A static target of 0 means each cycle runs to completion (see initializeForVirtualSTW) */
+	if ((_criticalTargetUtilization > _staticTargetUtilization) && (0.0 != _staticTargetUtilization)) {
+		U_64 lastCriticalActivity = _lastCriticalActivityInNanos;
+		if (0 != lastCriticalActivity) {
+			/* Critical threads record their activity without synchronization, so the sample may be slightly ahead of currentTime */
+			if ((lastCriticalActivity >= currentTime) || ((currentTime - lastCriticalActivity) <= (U_64) (window * 1e9))) {
+				targetUtilization = _criticalTargetUtilization;
+			}
+		}
+	}
+	_utilTracker->setTargetUtilization(targetUtilization);
+}
+
+void
+MM_Scheduler::updateBeat(MM_EnvironmentRealtime *env, U_64 currentTime)
+{
+	UDATA freeMemory = _extensions->heap->getApproximateActiveFreeMemorySize();
+	U_64 mutatorStartTime = getStartTimeOfCurrentMutatorSlice();
+
+	if ((0 != mutatorStartTime) && (currentTime > mutatorStartTime)) {
+		/* Sweeping only returns memory during GC increments, so any drop in free memory across a mutator slice was allocated */
+		double allocatedBytes = (_freeMemoryAtMutatorStart > freeMemory) ? (double)(_freeMemoryAtMutatorStart - freeMemory) : 0.0;
+		double sliceRate = allocatedBytes / ((currentTime - mutatorStartTime) / 1e9);
+		/* Smooth the rate so that one allocation burst does not swing the quantum */
+		_allocationRate = (0.0 == _allocationRate) ? sliceRate : ((0.75 * _allocationRate) + (0.25 * sliceRate));
+	}
+
+	if (_extensions->adaptiveBeat && (0 != _lastCycleDurationInNanos)) {
+		/* Pressure is the fraction of the remaining free memory the mutators will consume in the time a cycle takes.
+		 * Short quanta are used while the GC has slack; as pressure approaches 1 the quantum grows towards the
+		 * configured beat so that fewer increments (and fewer mutator stops) are needed to finish the cycle.
+		 */
+		double pressure = 1.0;
+		if ((0 != freeMemory) && (0.0 != _allocationRate)) {
+			pressure = ((_lastCycleDurationInNanos / 1e9) * _allocationRate) / (double)freeMemory;
+		} else if (0.0 == _allocationRate) {
+			pressure = 0.0;
+		}
+		if (pressure > 1.0) {
+			pressure = 1.0;
+		}
+		setBeatNanos(_minimumBeatNanos + (U_64) (pressure * (double)(_maximumBeatNanos - _minimumBeatNanos)));
+	}
+}
+
+void
+MM_Scheduler::setBeatNanos(U_64 newBeatNanos)
+{
+	beatNanos = newBeatNanos;
+	beat = newBeatNanos / 1e9;
+	_utilTracker->setMaxGCSlice(newBeatNanos);
+}
+
+void
+MM_Scheduler::recordQuantumOvershoot(MM_EnvironmentRealtime *env)
+{
+	I_64 nanosLeft = _utilTracker->getNanosLeft(env, getStartTimeOfCurrentGCSlice());
+	if (nanosLeft < 0) {
+		U_64 overshoot = (U_64)-nanosLeft;
+		UDATA cause = env->getGCActivity();
+		if (GC_ACTIVITY_OTHER == cause) {
+			if (_gc->isCollectorRootMarking()) {
+				cause = GC_ACTIVITY_ROOTS;
+			} else if (_gc->isCollectorTracing()) {
+				cause = GC_ACTIVITY_TRACE;
+			} else if (_gc->isCollectorUnloadingClassLoaders()) {
+				cause = GC_ACTIVITY_UNLOADING;
+			} else if (_gc->isCollectorSweeping()) {
+				cause = GC_ACTIVITY_SWEEP;
+			}
+		}
+		U_64 oldValue = _maxQuantumOvershootNanos[cause];
+		while (overshoot > oldValue) {
+			oldValue = MM_AtomicOperations::lockCompareExchangeU64(&_maxQuantumOvershootNanos[cause], oldValue, overshoot);
+		}
+	}
+}
+
+void
+MM_Scheduler::reportQuantumOvershoot(MM_EnvironmentRealtime *env)
+{
+	PORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	TRIGGER_J9HOOK_MM_METRONOME_QUANTUM_OVERSHOOT(_extensions->hookInterface, (J9VMThread *)env->getLanguageVMThread(), j9time_hires_clock(),
+		J9HOOK_MM_METRONOME_QUANTUM_OVERSHOOT,
+		_maxQuantumOvershootNanos[GC_ACTIVITY_ROOTS],
+		_maxQuantumOvershootNanos[GC_ACTIVITY_STACKS],
+		_maxQuantumOvershootNanos[GC_ACTIVITY_TRACE],
+		_maxQuantumOvershootNanos[GC_ACTIVITY_OVERFLOW],
+		_maxQuantumOvershootNanos[GC_ACTIVITY_UNLOADING],
+		_maxQuantumOvershootNanos[GC_ACTIVITY_SWEEP],
+		_maxQuantumOvershootNanos[GC_ACTIVITY_OTHER]);
+
+	memset((void *)_maxQuantumOvershootNanos, 0, sizeof(_maxQuantumOvershootNanos));
+}
+
 bool
 MM_Scheduler::shouldGCDoubleBeat(MM_EnvironmentRealtime *env)
 {
@@ -579,6 +729,7 @@ MM_Scheduler::reportStopGCIncrement(MM_EnvironmentRealtime *env, bool isCycleEnd
 			_completeCurrentGCSynchronously = false;
 			_completeCurrentGCSynchronouslyReason = UNKOWN_REASON;
 		}
+		reportQuantumOvershoot(env);
 	}
 
 	TRIGGER_J9HOOK_MM_PRIVATE_METRONOME_INCREMENT_END(_extensions->privateHookInterface, env->getOmrVMThread(), j9time_hires_clock(), J9HOOK_MM_PRIVATE_METRONOME_INCREMENT_END,
@@ -724,6 +875,7 @@ void MM_Scheduler::yieldFromGC(MM_EnvironmentRealtime *env, bool distanceChecked
 {
 	assert(!_gc->isCollectorConcurrentTracing());
 	assert(!_gc->isCollectorConcurrentSweeping());
+	recordQuantumOvershoot(env);
 	if (env->isMasterThread()) {
 		if (_yieldCollaborator) {
 			/* wait for slaves to yield/sync */
@@ -756,6 +908,9 @@ void MM_Scheduler::yieldFromGC(MM_EnvironmentRealtime *env, bool distanceChecked
 		_yieldCollaborator->yield(env);
 		env->reportScanningResumed();
 	}
+
+	/* Time spent yielded must not be mistaken for tracing time when pacing yield checks */
+	env->resetTraceYieldCheck();
 }
 
 void
@@ -1067,12 +1222,16 @@ MM_Scheduler::shutDownMasterThread()
 /**
  * Check to see if it is time to do the next GC increment.  If beatNanos time
  * has elapsed since the end of the last GC increment then start the next
- * increment now.
+ * increment now.  Threads of the critical group also record that they are
+ * active, which raises the utilization target for the next window.
  */
 void
 MM_Scheduler::startGCIfTimeExpired(MM_EnvironmentBase *envModron)
 {
 	MM_EnvironmentRealtime *env = MM_EnvironmentRealtime::getEnvironment(envModron);
+	if ((0.0 != _criticalTargetUtilization) && isCriticalThread(env)) {
+		_lastCriticalActivityInNanos = env->getTimer()->getTimeInNanos();
+	}
 	if (isInitialized() && isGCOn() && env->getTimer()->hasTimeElapsed(getStartTimeOfCurrentMutatorSlice(), beatNanos)) {
 		continueGC(env, TIME_TRIGGER, 0, (J9VMThread *)env->getLanguageVMThread(), true);
 	}
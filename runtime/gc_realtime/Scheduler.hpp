@@ -71,6 +71,15 @@ private:
 	U_64 _mutatorStartTimeInNanos; /**< Time in nanoseconds when the mutator slice started.  This is updated at increment end and when a GC quantum is skipped due to shouldMutatorDoubleBeat */
 	U_64 _incrementStartTimeInNanos; /**< Time in nanoseconds when the last gc increment started */
 	MM_GCCode _gcCode; /**< The gc code that will be used for the next GC cycle.  If this is modified during a collect it will be unused.  This variable is reset at the end of every cycle to the default collection type */
+	double _criticalTargetUtilization; /**< Utilization enforced while critical threads are active (0.0 if there is no critical group) */
+	volatile U_64 _lastCriticalActivityInNanos; /**< Time in nanoseconds when a thread of the critical group last checked for an expired beat */
+	U_64 _maximumBeatNanos; /**< The configured quantum; adaptive beat sizing never exceeds it */
+	U_64 _minimumBeatNanos; /**< The shortest quantum adaptive beat sizing may select */
+	UDATA _freeMemoryAtMutatorStart; /**< Approximate free heap when the current mutator slice started */
+	double _allocationRate; /**< Smoothed bytes allocated per second of mutator time, measured across mutator slices */
+	U_64 _cycleStartTimeInNanos; /**< Time in nanoseconds when the current GC cycle was triggered */
+	U_64 _lastCycleDurationInNanos; /**< Wall time of the last completed GC cycle (0 until a cycle completes) */
+	volatile U_64 _maxQuantumOvershootNanos[GC_ACTIVITY_COUNT]; /**< Largest overshoot of a quantum seen in the current cycle, indexed by GC_ACTIVITY_* cause */
 protected:
 public:
 	bool _isInitialized; /**< Set to true when all threads have been started */
@@ -167,6 +176,43 @@ protected:
 	bool internalShouldGCYield(MM_EnvironmentRealtime *env, U_64 timeSlack);
 
 	/** @} */
+
+	/**
+	 * @return true if the thread belongs to the critical utilization group
+	 */
+	bool isCriticalThread(MM_EnvironmentRealtime *env);
+
+	/**
+	 * Select the utilization target for the next increment: the critical target while a critical
+	 * thread has been active within the last time window, the static target otherwise.
+	 * Called by the master thread at increment start.
+	 */
+	void updateTargetUtilization(MM_EnvironmentRealtime *env, U_64 currentTime);
+
+	/**
+	 * Fold the heap consumed during the mutator slice which just ended into the allocation rate and,
+	 * if adaptive beat is enabled, resize the quantum to the resulting allocation pressure.
+	 * Called by the master thread at increment start.
+	 */
+	void updateBeat(MM_EnvironmentRealtime *env, U_64 currentTime);
+
+	/**
+	 * Change the quantum used for GC increments and mutator slices.
+	 */
+	void setBeatNanos(U_64 newBeatNanos);
+
+	/**
+	 * Charge the time by which the calling GC thread has run past the end of the current quantum
+	 * to whatever it was doing (or to the current phase if that is not recorded).
+	 * Called by every GC thread as it yields.
+	 */
+	void recordQuantumOvershoot(MM_EnvironmentRealtime *env);
+
+	/**
+	 * Report the per cause maximum quantum overshoot of the cycle which just ended, and reset it.
+	 * Called by the master thread at cycle end.
+	 */
+	void reportQuantumOvershoot(MM_EnvironmentRealtime *env);
 	
 public:
 	void pushYieldCollaborator(MM_YieldCollaborator *yieldCollaborator) {
@@ -251,6 +297,14 @@ public:
 		_mutatorStartTimeInNanos(J9CONST64(0)),
 		_incrementStartTimeInNanos(J9CONST64(0)),
 		_gcCode(J9MMCONSTANT_IMPLICIT_GC_DEFAULT),
+		_criticalTargetUtilization(0.0),
+		_lastCriticalActivityInNanos(J9CONST64(0)),
+		_maximumBeatNanos(J9CONST64(0)),
+		_minimumBeatNanos(J9CONST64(0)),
+		_freeMemoryAtMutatorStart(0),
+		_allocationRate(0.0),
+		_cycleStartTimeInNanos(J9CONST64(0)),
+		_lastCycleDurationInNanos(J9CONST64(0)),
 		_isInitialized(false),
 		_yieldCollaborator(NULL),
 		_shouldGCYield(false),
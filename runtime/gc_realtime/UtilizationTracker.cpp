@@ -24,6 +24,7 @@
 #include "j9cfg.h"
 #include "j9protos.h"
 #include "j9consts.h"
+#include "mmhook.h"
 #include "modronopt.h"
 #include "ModronAssertions.h"
 
@@ -102,6 +103,29 @@ MM_UtilizationTracker::getTargetUtilization()
 	return _targetUtilization;
 }
 
+/**
+ * Changes the utilization target.  The new target takes effect with the next call to addTimeSlice.
+ * 
+ * @note Synchronization must be provided externally when calling this method.
+ */
+void
+MM_UtilizationTracker::setTargetUtilization(double targetUtil)
+{
+	_targetUtilization = targetUtil;
+}
+
+/**
+ * Changes the longest time the GC may run at once (the quantum).  The new limit takes effect
+ * with the next call to addTimeSlice.
+ * 
+ * @note Synchronization must be provided externally when calling this method.
+ */
+void
+MM_UtilizationTracker::setMaxGCSlice(U_64 maxGCSlice)
+{
+	_maxGCSlice = maxGCSlice;
+}
+
 /**
  * Compacts the timeSlice array to two entries (1 for mutator, 1 for GC) since the
  * array will overflow on the next call to addTimeSlice if we do not.
@@ -186,6 +210,12 @@ MM_UtilizationTracker::addTimeSlice(MM_EnvironmentRealtime *env, MM_Timer *timer
 	U_64 excessNanos = (U_64) (1e9 * ((_currentUtilization - _targetUtilization) * _timeWindow));
 	_nanosLeftInCurrentSlice = (excessNanos < _maxGCSlice) ? excessNanos : _maxGCSlice;
 
+	/* Report the slice so that the utilization timeline can be reconstructed offline */
+	PORT_ACCESS_FROM_ENVIRONMENT(env);
+	TRIGGER_J9HOOK_MM_METRONOME_UTILIZATION_SLICE(MM_GCExtensions::getExtensions(env)->hookInterface, (J9VMThread *)env->getLanguageVMThread(), j9time_hires_clock(),
+	                                              J9HOOK_MM_METRONOME_UTILIZATION_SLICE, (U_64)(elapsed * 1e9), isMutator ? 1 : 0,
+	                                              (UDATA)(_currentUtilization * 1e4), (UDATA)(_targetUtilization * 1e4), _maxGCSlice);
+
 	return currentTime;
 }
 
@@ -88,6 +88,9 @@ public:
 	void tearDown(MM_EnvironmentBase *env);
 	
 	double getTargetUtilization();
+	void setTargetUtilization(double targetUtil);
+	U_64 getMaxGCSlice() { return _maxGCSlice; }
+	void setMaxGCSlice(U_64 maxGCSlice);
 	U_64 addTimeSlice(MM_EnvironmentRealtime *env, MM_Timer *timer, bool isMutator);
 	double getCurrentUtil();
 	I_64 getNanosLeft(MM_EnvironmentRealtime *env, U_64 sliceStartTimeInNanos);
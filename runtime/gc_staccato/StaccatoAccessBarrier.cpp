@@ -215,6 +215,40 @@ MM_StaccatoAccessBarrier::preObjectStore(J9VMThread *vmThread, J9Object **destAd
 	return preObjectStoreInternal(vmThread, destAddress, value, isVolatile);
 }
 
+/**
+ * @copydoc MM_ObjectAccessBarrier::preObjectStoreRange()
+ *
+ * Bulk form of the Yuasa half of the double barrier: every value about to be overwritten in the
+ * range is logged to the snapshot remembered set in a single pass.
+ */
+bool
+MM_StaccatoAccessBarrier::preObjectStoreRange(J9VMThread *vmThread, J9Object *destObject, fj9object_t *destAddress, UDATA slotCount)
+{
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(vmThread->omrVMThread);
+
+	if (isBarrierActive(env)) {
+		rememberObjectRange(env, destAddress, slotCount);
+	}
+
+	return true;
+}
+
+/**
+ * @copydoc MM_ObjectAccessBarrier::postObjectStoreRange()
+ *
+ * Bulk form of the other half of the double barrier: if this thread has not been scanned yet, the
+ * values just stored are remembered.
+ */
+void
+MM_StaccatoAccessBarrier::postObjectStoreRange(J9VMThread *vmThread, J9Object *destObject, fj9object_t *destAddress, UDATA slotCount)
+{
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(vmThread->omrVMThread);
+
+	if (isBarrierActive(env) && isDoubleBarrierActiveOnThread(vmThread)) {
+		rememberObjectRange(env, destAddress, slotCount);
+	}
+}
+
 /**
  * Enables the double barrier on the provided thread.
  */
@@ -323,7 +357,7 @@ MM_StaccatoAccessBarrier::backwardReferenceArrayCopyIndex(J9VMThread *vmThread,
 		if (isBarrierActive(env)) {
 
 			if (!markAndScanContiguousArray(env, destObject)) {
-				return ARRAY_COPY_NOT_DONE;
+				return doCopyContiguousWithRangeBarriers(vmThread, srcObject, destObject, srcIndex, destIndex, lengthInSlots);
 			}
 		}
 
@@ -349,11 +383,12 @@ MM_StaccatoAccessBarrier::forwardReferenceArrayCopyIndex(J9VMThread *vmThread, J
 		if (isBarrierActive(env) ) {
 			
 			if ((destObject != srcObject) && isDoubleBarrierActiveOnThread(vmThread)) {
-				return ARRAY_COPY_NOT_DONE;
+				return doCopyContiguousWithRangeBarriers(vmThread, srcObject, destObject, srcIndex, destIndex, lengthInSlots);
 			} else {
 				if (markAndScanContiguousArray(env, destObject)) {
 					return doCopyContiguousForward(vmThread, srcObject, destObject, srcIndex, destIndex, lengthInSlots);
 				}
+				return doCopyContiguousWithRangeBarriers(vmThread, srcObject, destObject, srcIndex, destIndex, lengthInSlots);
 			}
 			
 		} else {
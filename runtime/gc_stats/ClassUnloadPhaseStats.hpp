@@ -0,0 +1,75 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Stats
+ */
+
+#if !defined(CLASSUNLOADPHASESTATS_HPP_)
+#define CLASSUNLOADPHASESTATS_HPP_
+
+#include "j9cfg.h"
+#include "j9comp.h"
+#include "modronbase.h"
+
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+
+/**
+ * Breakdown of the setup phase of a class unloading pass, reported alongside MM_ClassUnloadStats.
+ * All times are in microseconds.
+ * @ingroup GC_Stats
+ */
+class MM_ClassUnloadPhaseStats
+{
+	/*
+	 * Data members
+	 */
+public:
+	UDATA _threadCount; /**< Number of GC threads which took part in the parallel phases */
+	UDATA _segmentsScanned; /**< Number of RAM class segments scanned for dying classes */
+	U_64 _identifyTime; /**< Time spent marking dying classes (parallel) */
+	U_64 _unlinkTime; /**< Time spent removing dying classes from the subclass hierarchy (parallel) */
+	U_64 _hookTime; /**< Time spent building the dying class list and reporting the unloads (single threaded) */
+
+	/*
+	 * Function members
+	 */
+public:
+	MMINLINE void
+	clear()
+	{
+		_threadCount = 0;
+		_segmentsScanned = 0;
+		_identifyTime = 0;
+		_unlinkTime = 0;
+		_hookTime = 0;
+	}
+
+	MM_ClassUnloadPhaseStats()
+	{
+		clear();
+	}
+};
+
+#endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
+#endif /* CLASSUNLOADPHASESTATS_HPP_ */
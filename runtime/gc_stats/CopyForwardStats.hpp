@@ -64,6 +64,16 @@ public:
 	UDATA _stringConstantsCleared;  /**< The number of string constants that have been cleared during marking */
 	UDATA _stringConstantsCandidates; /**< The number of string constants that have been visited in string table during marking */
 
+	UDATA _splitArrayUnitsScanned; /**< The number of split pointer array work units scanned */
+	UDATA _splitArraySlotsScanned; /**< The number of pointer array slots scanned from split work units */
+	UDATA _splitArraySlotsPrefetched; /**< The number of pointer array slot targets prefetched ahead of being copied */
+	U_64 _splitArrayScanTime; /**< Time (hires ticks) spent scanning split pointer array work units */
+	UDATA _mixedObjectSlotsPrefetched; /**< The number of mixed object slot targets prefetched ahead of being copied */
+
+	UDATA _pretenuredObjects; /**< The number of Eden objects copied directly into the pretenure age */
+	UDATA _pretenuredBytes; /**< The number of bytes of Eden objects copied directly into the pretenure age */
+	UDATA _pretenureCopyBytesSaved; /**< Estimate of the bytes which pretenuring will save from being copied through the remaining nursery ages */
+
 private:
 	
 	/* 
@@ -87,6 +97,16 @@ public:
 
 		_stringConstantsCleared = 0;
 		_stringConstantsCandidates = 0;
+
+		_splitArrayUnitsScanned = 0;
+		_splitArraySlotsScanned = 0;
+		_splitArraySlotsPrefetched = 0;
+		_splitArrayScanTime = 0;
+		_mixedObjectSlotsPrefetched = 0;
+
+		_pretenuredObjects = 0;
+		_pretenuredBytes = 0;
+		_pretenureCopyBytesSaved = 0;
 	}
 	
 	/**
@@ -106,6 +126,16 @@ public:
 
 		_stringConstantsCleared += stats->_stringConstantsCleared;
 		_stringConstantsCandidates += stats->_stringConstantsCandidates;
+
+		_splitArrayUnitsScanned += stats->_splitArrayUnitsScanned;
+		_splitArraySlotsScanned += stats->_splitArraySlotsScanned;
+		_splitArraySlotsPrefetched += stats->_splitArraySlotsPrefetched;
+		_splitArrayScanTime += stats->_splitArrayScanTime;
+		_mixedObjectSlotsPrefetched += stats->_mixedObjectSlotsPrefetched;
+
+		_pretenuredObjects += stats->_pretenuredObjects;
+		_pretenuredBytes += stats->_pretenuredBytes;
+		_pretenureCopyBytesSaved += stats->_pretenureCopyBytesSaved;
 	}
 
 	MM_CopyForwardStats() :
@@ -119,6 +149,14 @@ public:
 		,_phantomReferenceStats()
 		,_stringConstantsCleared(0)
 		,_stringConstantsCandidates(0)
+		,_splitArrayUnitsScanned(0)
+		,_splitArraySlotsScanned(0)
+		,_splitArraySlotsPrefetched(0)
+		,_splitArrayScanTime(0)
+		,_mixedObjectSlotsPrefetched(0)
+		,_pretenuredObjects(0)
+		,_pretenuredBytes(0)
+		,_pretenureCopyBytesSaved(0)
 	{}
 };
 
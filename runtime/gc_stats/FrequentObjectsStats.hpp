@@ -87,6 +87,16 @@ public:
 		spaceSavingUpdate(_spaceSaving, J9OBJECT_CLAZZ((J9VMThread *)env->getLanguageVMThread(), object), 1);
 	}
 
+	/*
+	 * Update stats with a class directly, for callers which sample classes rather than objects
+	 * @param clazz the class to record
+	 * @param count the number of instances to record
+	 */
+	void update(J9Class *clazz, UDATA count)
+	{
+		spaceSavingUpdate(_spaceSaving, clazz, count);
+	}
+
 	/* Creates a data structure which keeps track of the k most frequent class allocations (estimated probability of 90% of
 	 * reporting this accurately (and in the correct order).  The larger k is, the more memory is required
 	 * @param portLibrary the port library
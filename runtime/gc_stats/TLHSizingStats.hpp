@@ -0,0 +1,98 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Stats
+ */
+
+#if !defined(TLHSIZINGSTATS_HPP_)
+#define TLHSIZINGSTATS_HPP_
+
+#include "j9cfg.h"
+#include "j9comp.h"
+#include "modronbase.h"
+
+#if defined(J9VM_GC_VLHGC)
+
+/**
+ * Per-thread TLH refresh history used to size the thread's TLHs from its own allocation rate.
+ * @ingroup GC_Stats
+ */
+class MM_TLHSizingStats
+{
+	/*
+	 * Data members
+	 */
+public:
+	UDATA _refreshSize; /**< The TLH size this thread requests on refresh (0 until the thread has been sized at a collection) */
+	double _allocationFraction; /**< Weighted fraction of all TLH bytes between collections which were refreshed by this thread */
+
+	UDATA _refreshCount; /**< TLH refreshes since the last collection */
+	UDATA _refreshBytes; /**< TLH bytes requested since the last collection */
+	UDATA _wastedBytes; /**< Bytes left unused in this thread's TLH at the last collection */
+
+	UDATA _refreshCountTotal; /**< TLH refreshes over the life of the thread */
+	UDATA _wastedBytesTotal; /**< Bytes left unused in this thread's TLHs at collections over the life of the thread */
+
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * Record a successful TLH refresh.
+	 * @param bytes[in] the size of the TLH the thread was given
+	 */
+	MMINLINE void
+	recordRefresh(UDATA bytes)
+	{
+		_refreshCount += 1;
+		_refreshBytes += bytes;
+		_refreshCountTotal += 1;
+	}
+
+	/**
+	 * Record the unused remainder of the thread's TLH at a collection and start a new sizing interval.
+	 * @param bytes[in] the number of bytes left unused in the TLH
+	 */
+	MMINLINE void
+	recordWaste(UDATA bytes)
+	{
+		_wastedBytes = bytes;
+		_wastedBytesTotal += bytes;
+		_refreshCount = 0;
+		_refreshBytes = 0;
+	}
+
+	MM_TLHSizingStats()
+		: _refreshSize(0)
+		, _allocationFraction(0.0)
+		, _refreshCount(0)
+		, _refreshBytes(0)
+		, _wastedBytes(0)
+		, _refreshCountTotal(0)
+		, _wastedBytesTotal(0)
+	{}
+};
+
+#endif /* J9VM_GC_VLHGC */
+#endif /* TLHSIZINGSTATS_HPP_ */
@@ -26,13 +26,26 @@
  * @ingroup GC_Structs
  */
 
+#include <string.h>
+
 #include "j9.h"
 #include "j9cfg.h"
 #include "j9consts.h"
 #include "j9protos.h"
+#include "ModronAssertions.h"
 
 #include "VMThreadStackSlotIterator.hpp"
 
+/**
+ * State of the frame-only walk which finds the unit boundaries of a stack being split.
+ */
+typedef struct StackSplitData {
+	J9StackWalkState *splitStates; /**< Receives a copy of the walk state at each unit boundary */
+	UDATA maxSplits; /**< The number of walk states splitStates can hold */
+	UDATA framesPerUnit; /**< The number of frames between two unit boundaries */
+	UDATA splitCount; /**< The number of walk states recorded so far */
+} StackSplitData;
+
 extern "C" {
 	
 /**
@@ -60,6 +73,38 @@ vmThreadStackFrameIterator(J9VMThread * currentThread, J9StackWalkState * walkSt
 	return J9_STACKWALK_KEEP_ITERATING;
 }
 
+static UDATA
+vmThreadStackIncrementalFrameIterator(J9VMThread * currentThread, J9StackWalkState * walkState)
+{
+	J9MODRON_SUSPENDSTACKWALK *shouldSuspend = (J9MODRON_SUSPENDSTACKWALK *)walkState->userData4;
+
+	if (NULL != currentThread->javaVM->collectJitPrivateThreadData) {
+		currentThread->javaVM->collectJitPrivateThreadData(currentThread, walkState);
+	}
+	/* The object slots of this frame have already been reported, so this is a clean point to stop */
+	if ((*shouldSuspend)(currentThread, walkState->userData3)) {
+		return J9_STACKWALK_STOP_ITERATING;
+	}
+	return J9_STACKWALK_KEEP_ITERATING;
+}
+
+static UDATA
+vmThreadStackSplitFrameIterator(J9VMThread * currentThread, J9StackWalkState * walkState)
+{
+	StackSplitData *data = (StackSplitData *)walkState->userData1;
+
+	/* Units are scanned in parallel and out of order, so the JIT samples are only collected here */
+	if (NULL != currentThread->javaVM->collectJitPrivateThreadData) {
+		currentThread->javaVM->collectJitPrivateThreadData(currentThread, walkState);
+	}
+	/* Frames beyond the last boundary that fits all belong to the last unit */
+	if ((0 == (walkState->framesWalked % data->framesPerUnit)) && (data->splitCount < data->maxSplits)) {
+		memcpy(&data->splitStates[data->splitCount], walkState, sizeof(J9StackWalkState));
+		data->splitCount += 1;
+	}
+	return J9_STACKWALK_KEEP_ITERATING;
+}
+
 } /* extern "C" */
 
 /**
@@ -114,3 +159,170 @@ GC_VMThreadStackSlotIterator::scanSlots(
 	vmThread->javaVM->walkStackFrames(vmThread, &stackWalkState);
 }
 
+
+/**
+ * Walk the slots of the walk thread which contain object references, offering to suspend the walk
+ * after each frame so that a deep stack can be scanned across several GC quanta.
+ * The first call (<code>resume</code> false) starts the walk in <code>walkState</code>; when it returns false
+ * the walk was suspended and must be continued by calling again with the same <code>walkState</code> and
+ * <code>resume</code> true.  The stack of <code>walkThread</code> must not change until the walk has completed
+ * (the caller is responsible for keeping the thread halted in between).
+ *
+ * @param vmThread the thread doing the walk
+ * @param walkThread the thread whose stack is to be walked
+ * @param walkState caller owned walk state, preserved between calls
+ * @param resume false to start a new walk, true to continue a suspended one
+ * @param userData will be passed as an argument to the callback functions
+ * @param oSlotIterator the callback function to be called with each slot
+ * @param shouldSuspend called after each frame, returns true to suspend the walk
+ * @param includeStackFrameClassReferences specifies whether the running methods classes should be included
+ * @return true if the walk has completed, false if it was suspended
+ */
+bool
+GC_VMThreadStackSlotIterator::scanSlotsIncrementally(
+			J9VMThread *vmThread,
+			J9VMThread *walkThread,
+			J9StackWalkState *walkState,
+			bool resume,
+			void *userData,
+			J9MODRON_OSLOTITERATOR *oSlotIterator,
+			J9MODRON_SUSPENDSTACKWALK *shouldSuspend,
+			bool includeStackFrameClassReferences
+		)
+{
+	J9JavaVM *vm = vmThread->javaVM;
+	/* The walker only adds MAINTAIN_REGISTER_MAP when a walk starts and restores the caller's flags on
+	 * exit, so it has to be requested explicitly for resumed walks to keep the JIT register map valid.
+	 */
+	UDATA flags = J9_STACKWALK_ITERATE_O_SLOTS | J9_STACKWALK_DO_NOT_SNIFF_AND_WHACK | J9_STACKWALK_ITERATE_FRAMES
+			| J9_STACKWALK_SKIP_INLINES | J9_STACKWALK_MAINTAIN_REGISTER_MAP;
+
+	if (includeStackFrameClassReferences) {
+		flags |= J9_STACKWALK_ITERATE_METHOD_CLASS_SLOTS;
+	}
+
+	if (resume) {
+		Assert_MM_true(walkThread == walkState->walkThread);
+		flags |= J9_STACKWALK_RESUME;
+	} else {
+		walkState->objectSlotWalkFunction = vmThreadStackDoOSlotIterator;
+		walkState->frameWalkFunction = vmThreadStackIncrementalFrameIterator;
+		walkState->userData1 = (void *)oSlotIterator;
+		walkState->userData2 = (void *)vm;
+		walkState->userData4 = (void *)shouldSuspend;
+		walkState->walkThread = walkThread;
+	}
+	walkState->userData3 = userData;
+	walkState->flags = flags;
+
+	vm->walkStackFrames(vmThread, walkState);
+
+	/* A walk which gives up early (e.g. stacks out of sync) never reaches the end of stack but cannot be resumed either */
+	return (J9SF_FRAME_TYPE_END_OF_STACK == walkState->pc)
+		|| J9_ARE_ALL_BITS_SET(walkThread->privateFlags, J9_PRIVATE_FLAGS_STACKS_OUT_OF_SYNC);
+}
+
+/**
+ * Find the boundaries at which the stack of a thread can be split into frame-range units that are
+ * scanned independently (see scanSlotsInRange()).  The stack is walked without reporting any slots,
+ * keeping the JIT register map up to date, and a copy of the walk state is recorded after every
+ * <code>framesPerUnit</code> frames.  Each copy is a point from which the walk can be resumed.
+ * The stack of <code>walkThread</code> must not change until all of its units have been scanned.
+ *
+ * @param vmThread the thread doing the walk
+ * @param walkThread the thread whose stack is to be split
+ * @param splitStates receives the walk states at the unit boundaries
+ * @param maxSplits the number of walk states splitStates can hold
+ * @param framesPerUnit the number of frames in each unit
+ * @return the number of units the stack was split into (one more than the number of walk states recorded),
+ * or 0 if the stack could not be walked to its end and must be scanned in one go
+ */
+UDATA
+GC_VMThreadStackSlotIterator::splitStack(
+			J9VMThread *vmThread,
+			J9VMThread *walkThread,
+			J9StackWalkState *splitStates,
+			UDATA maxSplits,
+			UDATA framesPerUnit
+		)
+{
+	J9StackWalkState stackWalkState;
+	StackSplitData splitData;
+
+	Assert_MM_true(0 != framesPerUnit);
+
+	splitData.splitStates = splitStates;
+	splitData.maxSplits = maxSplits;
+	splitData.framesPerUnit = framesPerUnit;
+	splitData.splitCount = 0;
+
+	stackWalkState.frameWalkFunction = vmThreadStackSplitFrameIterator;
+	stackWalkState.userData1 = (void *)&splitData;
+	stackWalkState.flags = J9_STACKWALK_ITERATE_FRAMES | J9_STACKWALK_SKIP_INLINES | J9_STACKWALK_DO_NOT_SNIFF_AND_WHACK | J9_STACKWALK_MAINTAIN_REGISTER_MAP;
+	stackWalkState.walkThread = walkThread;
+
+	UDATA rc = vmThread->javaVM->walkStackFrames(vmThread, &stackWalkState);
+
+	if ((J9_STACKWALK_RC_NONE != rc)
+		|| (J9SF_FRAME_TYPE_END_OF_STACK != stackWalkState.pc)
+		|| J9_ARE_ANY_BITS_SET(walkThread->privateFlags, J9_PRIVATE_FLAGS_STACKS_OUT_OF_SYNC)
+	) {
+		return 0;
+	}
+	return splitData.splitCount + 1;
+}
+
+/**
+ * Walk the slots of one frame-range unit of a stack split by splitStack().  The walk starts at the top
+ * of the stack (<code>startState</code> NULL) or resumes from a copy of one of the recorded walk states,
+ * and stops once <code>endFrame</code> frames of the stack have been walked (0 walks to the end of the stack).
+ * Stack maps are resolved only for the frames of the unit, so several units of one stack can be walked
+ * in parallel by different threads.  JIT sample collection is left to splitStack().
+ *
+ * @param vmThread the thread doing the walk
+ * @param walkThread the thread whose stack is to be walked
+ * @param startState the walk state recorded at the start of the unit, or NULL for the first unit
+ * @param endFrame the frame count at the end of the unit (the framesWalked of the next unit's start state), or 0 for the last unit
+ * @param userData will be passed as an argument to the callback function
+ * @param oSlotIterator the callback function to be called with each slot
+ * @param includeStackFrameClassReferences specifies whether the running methods classes should be included
+ */
+void
+GC_VMThreadStackSlotIterator::scanSlotsInRange(
+			J9VMThread *vmThread,
+			J9VMThread *walkThread,
+			J9StackWalkState *startState,
+			UDATA endFrame,
+			void *userData,
+			J9MODRON_OSLOTITERATOR *oSlotIterator,
+			bool includeStackFrameClassReferences
+		)
+{
+	J9StackWalkState stackWalkState;
+	J9JavaVM *vm = vmThread->javaVM;
+	UDATA flags = J9_STACKWALK_ITERATE_O_SLOTS | J9_STACKWALK_DO_NOT_SNIFF_AND_WHACK | J9_STACKWALK_SKIP_INLINES | J9_STACKWALK_MAINTAIN_REGISTER_MAP;
+
+	if (NULL != startState) {
+		Assert_MM_true(walkThread == startState->walkThread);
+		memcpy(&stackWalkState, startState, sizeof(J9StackWalkState));
+		stackWalkState.currentThread = vmThread;
+		flags |= J9_STACKWALK_RESUME;
+	} else {
+		stackWalkState.walkThread = walkThread;
+	}
+	if (0 != endFrame) {
+		flags |= J9_STACKWALK_COUNT_SPECIFIED;
+		stackWalkState.maxFrames = endFrame;
+	}
+	if (includeStackFrameClassReferences) {
+		flags |= J9_STACKWALK_ITERATE_METHOD_CLASS_SLOTS;
+	}
+
+	stackWalkState.objectSlotWalkFunction = vmThreadStackDoOSlotIterator;
+	stackWalkState.userData1 = (void *)oSlotIterator;
+	stackWalkState.userData2 = (void *)vm;
+	stackWalkState.userData3 = userData;
+	stackWalkState.flags = flags;
+
+	vm->walkStackFrames(vmThread, &stackWalkState);
+}
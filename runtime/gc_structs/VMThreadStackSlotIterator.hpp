@@ -37,6 +37,11 @@
  */
 typedef void J9MODRON_OSLOTITERATOR(J9JavaVM *javaVM, J9Object **objectIndirect, void *localData, J9StackWalkState *walkState, const void *stackLocation);
 
+/**
+ * Signature for the callback function asked, after each frame, whether an incremental walk should be suspended
+ */
+typedef bool J9MODRON_SUSPENDSTACKWALK(J9VMThread *vmThread, void *localData);
+
 /**
  * Iterate over all slots on the stack of a given thread which contain object references.
  * @ingroup GC_Structs
@@ -51,6 +56,32 @@ public:
 			J9MODRON_OSLOTITERATOR *oSlotIterator,
 			bool includeStackFrameClassReferences,
 			bool trackVisibleFrameDepth);
+
+	static bool scanSlotsIncrementally(
+			J9VMThread *vmThread,
+			J9VMThread *walkThread,
+			J9StackWalkState *walkState,
+			bool resume,
+			void *userData,
+			J9MODRON_OSLOTITERATOR *oSlotIterator,
+			J9MODRON_SUSPENDSTACKWALK *shouldSuspend,
+			bool includeStackFrameClassReferences);
+
+	static UDATA splitStack(
+			J9VMThread *vmThread,
+			J9VMThread *walkThread,
+			J9StackWalkState *splitStates,
+			UDATA maxSplits,
+			UDATA framesPerUnit);
+
+	static void scanSlotsInRange(
+			J9VMThread *vmThread,
+			J9VMThread *walkThread,
+			J9StackWalkState *startState,
+			UDATA endFrame,
+			void *userData,
+			J9MODRON_OSLOTITERATOR *oSlotIterator,
+			bool includeStackFrameClassReferences);
 };
 
 #endif /* VMTHREADSTACKSLOTITERATOR_HPP_ */
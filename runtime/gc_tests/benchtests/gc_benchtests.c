@@ -0,0 +1,1383 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * GC microbenchmark and stress harness, loaded as a -Xrun library:
+ *
+ *   java -Xgcpolicy:gencon -Xrunbenchtests:graph=tree,size=256m,collect=both -version
+ *
+ * Once the VM is initialized the main thread builds a synthetic object graph in the heap, then repeatedly mutates it,
+ * allocates garbage and forces collections.  The collector phases are timed from the GC hooks and a summary of each
+ * phase seen (count, total, mean, percentiles and live bytes processed per second) is written as one JSON object per
+ * line, so that results can be compared across builds and policies (run_benchtests.sh runs every policy).
+ *
+ * The workload option adds work of its own to each iteration, timed by the harness:
+ *   collect     nothing more: mutate the graph and force the collections (the default)
+ *   cards       rather than mutating the graph at random, dirty the cards of dirty percent of the cards holding graph
+ *               nodes before each collection, so that runs at a low and a high percentage compare card cleaning of a
+ *               sparse and a dense card table (-Xtgc:cardcleaning reports the balanced card cleaning time itself)
+ *   reads       read every reference slot of the graph through the VM read barrier after allocating the garbage, so
+ *               that runs with and without -Xgc:concurrentScavenge compare the read cost and the pause times
+ *   arraycopy   copy an Object[] of length elements referring into the graph with the reference arraycopy helper,
+ *               and clone it, each iteration
+ *   startup     report the time from start (milliseconds since the epoch, taken by the launcher) to the first object
+ *               allocated by the harness, then stop; run_benchtests.sh startup repeats it for several -Xmx values
+ *   intern      threads attached threads each intern the same names distinct Strings (from a different starting point)
+ *               each iteration, timed from their start to the last one finishing; the collections in between clear the
+ *               names from the String table again.  run_benchtests.sh intern repeats it for 1 to 64 threads
+ *   allocate    allocate objects small arrays of garbage through the out-of-line allocation path, which takes the
+ *               allocation samples; run_benchtests.sh allocate runs it with and without -Xgc:allocationProfile, so
+ *               that the difference in the allocation rate is the cost of the profile
+ *   dedup       keep copies separately allocated copies of each of names distinct Strings alive through the collections,
+ *               then report the live size once the deduplication thread has had time to share their value arrays;
+ *               run_benchtests.sh dedup runs it with and without -XXgc:enableStringDeduplication
+ *   heapdump    write a heap dump with the dump options dumpopts each iteration, timing how long the application is
+ *               stopped; each dump replaces the last, in benchtests.<pid>.phd in the current directory.
+ *               run_benchtests.sh heapdump compares the serial, parallel and forked PHD writers
+ *
+ * Options (comma separated):
+ *   workload=collect|cards|reads|arraycopy|startup|intern|allocate|dedup|heapdump
+ *                               work timed each iteration (default collect)
+ *   graph=tree|list|wide|cross  shape of the graph (default tree):  a tree of fanout references per node, a linked list,
+ *                               pointer arrays of width slots referring to small leaves, or a chain of nodes with fanout
+ *                               random references between them, allocated spacing bytes apart so that they cross regions
+ *   size=<bytes>                approximate live size of the graph (k, m and g suffixes, default 64m)
+ *   fanout=<n>                  references per tree or cross node (default 4)
+ *   width=<n>                   slots per pointer array of the wide graph (default 16384)
+ *   spacing=<bytes>             garbage allocated between the nodes of the cross graph (default 4k)
+ *   collect=global|local|both   kind of collection forced (default both)
+ *   iterations=<n>              measured collections of each kind (default 20)
+ *   warmup=<n>                  unmeasured collections of each kind run first (default 3)
+ *   mutate=<n>                  reference stores into the graph before each collection, dirtying cards and remembered sets (default 10000)
+ *   churn=<bytes>               garbage allocated before each collection (default 0)
+ *   seed=<n>                    random seed (default 1)
+ *   dirty=<percent>             percentage of the graph's cards dirtied by the cards workload (default 1)
+ *   length=<n>                  elements of the arrays copied by the arraycopy workload (default 1m, that is 1048576)
+ *   start=<millis>              launch time of the startup workload, in milliseconds since the epoch
+ *   threads=<n>                 threads doing the work of the intern workload (default 1)
+ *   names=<n>                   distinct Strings interned by each thread of the intern workload, or kept alive by the
+ *                               dedup workload (default 64k)
+ *   copies=<n>                  copies of each String kept alive by the dedup workload (default 4)
+ *   dumpopts=<options>          opts= of the heap dumps of the heapdump workload, such as PHD+PARALLEL (default PHD)
+ *   objects=<n>                 arrays allocated each iteration by the allocate workload (default 1m, that is 1048576)
+ *   variant=<name>              label reported with the results, to tell apart runs with different JVM options
+ *   output=<file>               append the results to file rather than writing them to the terminal
+ */
+
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "j9port.h"
+#include "j9.h"
+#include "omr.h"
+#include "j9protos.h"
+#include "j9comp.h"
+#include "j9consts.h"
+#include "j9dump.h"
+#include "gc_benchtests.h"
+#include "mmhook.h"
+#include "mmomrhook.h"
+#include "mmprivatehook.h"
+
+#define GCBENCH_MAXIMUM_SAMPLES 4096
+#define GCBENCH_MUTATION_TARGETS 1024
+#define GCBENCH_CHURN_ARRAY_SIZE (64 * 1024)
+#define GCBENCH_FILE_NAME_LENGTH 1024
+#define GCBENCH_LINE_LENGTH 1024
+#define GCBENCH_NAME_LENGTH 64
+#define GCBENCH_MAXIMUM_THREADS 256
+#define GCBENCH_STRING_LENGTH 128
+/* time given to the String deduplication thread to process the candidates of the last collection */
+#define GCBENCH_DEDUP_SETTLE_MILLIS 1000
+
+typedef enum GCBenchGraph {
+	GCBENCH_GRAPH_TREE = 0,
+	GCBENCH_GRAPH_LIST,
+	GCBENCH_GRAPH_WIDE,
+	GCBENCH_GRAPH_CROSS
+} GCBenchGraph;
+
+typedef enum GCBenchWorkload {
+	GCBENCH_WORKLOAD_COLLECT = 0,
+	GCBENCH_WORKLOAD_CARDS,
+	GCBENCH_WORKLOAD_READS,
+	GCBENCH_WORKLOAD_ARRAYCOPY,
+	GCBENCH_WORKLOAD_STARTUP,
+	GCBENCH_WORKLOAD_INTERN,
+	GCBENCH_WORKLOAD_ALLOCATE,
+	GCBENCH_WORKLOAD_DEDUP,
+	GCBENCH_WORKLOAD_HEAPDUMP
+} GCBenchWorkload;
+
+typedef enum GCBenchHooks {
+	GCBENCH_HOOKS_OMR = 0,
+	GCBENCH_HOOKS_PRIVATE
+} GCBenchHooks;
+
+typedef struct GCBenchPhase {
+	const char *name;
+	GCBenchHooks startHooks; /* interface of startEvent */
+	UDATA startEvent;
+	GCBenchHooks endHooks; /* interface of endEvent */
+	UDATA endEvent;
+} GCBenchPhase;
+
+typedef struct GCBenchSamples {
+	U_64 startTime; /* hires clock at the start of the phase, 0 if the phase is not in progress */
+	UDATA count;
+	U_64 samples[GCBENCH_MAXIMUM_SAMPLES]; /* phase durations, in microseconds */
+} GCBenchSamples;
+
+typedef struct GCBenchOptions {
+	GCBenchWorkload workload;
+	GCBenchGraph graph;
+	UDATA size;
+	UDATA fanout;
+	UDATA width;
+	UDATA spacing;
+	BOOLEAN collectGlobal;
+	BOOLEAN collectLocal;
+	UDATA iterations;
+	UDATA warmup;
+	UDATA mutate;
+	UDATA churn;
+	UDATA seed;
+	UDATA dirty;
+	UDATA length;
+	UDATA threads;
+	UDATA names;
+	UDATA objects;
+	UDATA copies;
+	I_64 start;
+	char variant[GCBENCH_NAME_LENGTH];
+	char dumpOptions[GCBENCH_NAME_LENGTH];
+	char output[GCBENCH_FILE_NAME_LENGTH];
+} GCBenchOptions;
+
+static const char *graphNames[] = { "tree", "list", "wide", "cross" };
+static const char *workloadNames[] = { "collect", "cards", "reads", "arraycopy", "startup", "intern", "allocate", "dedup", "heapdump" };
+
+/* the phases timed, by the hooks bracketing them (a policy reports the phases it has) */
+static const GCBenchPhase phases[] = {
+	{ "increment", GCBENCH_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_GC_INCREMENT_START, GCBENCH_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_GC_INCREMENT_END },
+	{ "cycle", GCBENCH_HOOKS_OMR, J9HOOK_MM_OMR_GC_CYCLE_START, GCBENCH_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_GC_POST_CYCLE_END },
+	{ "global-gc", GCBENCH_HOOKS_OMR, J9HOOK_MM_OMR_GLOBAL_GC_START, GCBENCH_HOOKS_OMR, J9HOOK_MM_OMR_GLOBAL_GC_END },
+	{ "local-gc", GCBENCH_HOOKS_OMR, J9HOOK_MM_OMR_LOCAL_GC_START, GCBENCH_HOOKS_OMR, J9HOOK_MM_OMR_LOCAL_GC_END },
+	{ "mark", GCBENCH_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_MARK_START, GCBENCH_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_MARK_END },
+	{ "sweep", GCBENCH_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_SWEEP_START, GCBENCH_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_SWEEP_END },
+	{ "compact", GCBENCH_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_COMPACT_START, GCBENCH_HOOKS_OMR, J9HOOK_MM_OMR_COMPACT_END },
+	{ "card-cleaning", GCBENCH_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_CONCURRENT_COLLECTION_CARD_CLEANING_START, GCBENCH_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_CONCURRENT_COLLECTION_CARD_CLEANING_END },
+	{ "remembered-set-scan", GCBENCH_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_CONCURRENT_REMEMBERED_SET_SCAN_START, GCBENCH_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_CONCURRENT_REMEMBERED_SET_SCAN_END },
+	{ "copy-forward", GCBENCH_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_COPY_FORWARD_START, GCBENCH_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_COPY_FORWARD_END },
+	{ "pgc-mark", GCBENCH_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_PGC_MARK_START, GCBENCH_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_PGC_MARK_END },
+	{ "gmp-mark", GCBENCH_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_GMP_MARK_START, GCBENCH_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_GMP_MARK_END },
+	{ "global-mark", GCBENCH_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_VLHGC_GLOBAL_GC_MARK_START, GCBENCH_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_VLHGC_GLOBAL_GC_MARK_END },
+	{ "reclaim-sweep", GCBENCH_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_RECLAIM_SWEEP_START, GCBENCH_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_RECLAIM_SWEEP_END },
+	{ "reclaim-compact", GCBENCH_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_RECLAIM_COMPACT_START, GCBENCH_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_RECLAIM_COMPACT_END },
+	{ "concurrent", GCBENCH_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_CONCURRENT_PHASE_START, GCBENCH_HOOKS_PRIVATE, J9HOOK_MM_PRIVATE_CONCURRENT_PHASE_END },
+};
+#define GCBENCH_PHASE_COUNT (sizeof(phases) / sizeof(phases[0]))
+
+static GCBenchSamples phaseSamples[GCBENCH_PHASE_COUNT];
+/* collections timed by the harness itself, around the call forcing them */
+static GCBenchSamples requestSamples;
+/* work timed by the harness for the reads and arraycopy workloads */
+static GCBenchSamples readSamples;
+static GCBenchSamples copySamples;
+static GCBenchSamples cloneSamples;
+/* rounds of work of the worker threads (the intern workload) */
+static GCBenchSamples workerSamples;
+/* rounds of allocation of the allocate workload */
+static GCBenchSamples allocateSamples;
+/* heap dumps of the heapdump workload */
+static GCBenchSamples dumpSamples;
+
+static J9JavaVM *benchVM;
+static GCBenchOptions benchOptions;
+static BOOLEAN recording;
+static IDATA outputFD = -1;
+static U_64 randomState;
+static UDATA nodeLength;
+static UDATA liveBytes;
+static jobject graphRootRef;
+static jobject mutationTargetsRef;
+/* every node of the graph, in allocation order, kept for the cards and reads workloads */
+static jobject nodesRef;
+static jobject copySourceRef;
+static jobject copyDestinationRef;
+/* the Strings of the dedup workload */
+static jobject stringsRef;
+static UDATA cardSize;
+static UDATA cardStores;
+static UDATA slotsRead;
+static UDATA bytesAllocated;
+/* keeps the loads of readGraph() */
+static volatile UDATA readChecksum;
+/* the worker threads wait on workerMutex for workerRound to change, then do a round of work */
+static omrthread_monitor_t workerMutex;
+static UDATA workerRound;
+static UDATA workersAlive;
+static UDATA workersBusy;
+static BOOLEAN workersFailed;
+static BOOLEAN workersExit;
+
+static BOOLEAN parseOptions(J9JavaVM *vm, const char *options);
+static BOOLEAN parseNumber(const char *value, UDATA *result);
+static BOOLEAN parseName(const char *value, UDATA length, const char **names, UDATA nameCount, UDATA *result);
+static void vmInitializedHandler(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
+static void phaseStartHandler(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
+static void phaseEndHandler(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
+static BOOLEAN registerPhaseHooks(J9JavaVM *vm);
+static void unregisterPhaseHooks(J9JavaVM *vm);
+static J9HookInterface **getHooks(J9JavaVM *vm, GCBenchHooks hooks);
+static void runBenchmark(J9VMThread *currentThread);
+static BOOLEAN buildGraph(J9VMThread *currentThread);
+static void mutateGraph(J9VMThread *currentThread);
+static void dirtyCards(J9VMThread *currentThread);
+static void readGraph(J9VMThread *currentThread);
+static BOOLEAN buildCopyArrays(J9VMThread *currentThread);
+static BOOLEAN copyArrays(J9VMThread *currentThread);
+static void reportStartup(J9VMThread *currentThread);
+static BOOLEAN internNames(J9VMThread *currentThread, UDATA index);
+static BOOLEAN allocateObjects(J9VMThread *currentThread);
+static BOOLEAN buildStrings(J9VMThread *currentThread);
+static UDATA settledLiveBytes(J9VMThread *currentThread);
+static BOOLEAN dumpHeap(J9VMThread *currentThread);
+static BOOLEAN startWorkers(J9VMThread *currentThread);
+static BOOLEAN runWorkers(J9VMThread *currentThread);
+static void stopWorkers(J9VMThread *currentThread);
+static int J9THREAD_PROC workerMain(void *entryArg);
+static BOOLEAN churn(J9VMThread *currentThread);
+static j9object_t allocateArray(J9VMThread *currentThread, J9Class *clazz, UDATA length);
+static jobject newGlobalRef(J9VMThread *currentThread, j9object_t object);
+static void deleteGlobalRef(J9VMThread *currentThread, jobject *ref);
+static UDATA nextRandom(UDATA bound);
+static void recordSample(GCBenchSamples *samples, U_64 micros);
+static void resetPhases(void);
+static void reportPhase(const char *kind, const char *name, GCBenchSamples *samples, UDATA bytes, const char *detail);
+static void emit(const char *format, ...);
+static int compareSamples(const void *left, const void *right);
+
+jint JNICALL
+JVM_OnLoad( JavaVM *jvm, char* options, void *reserved )
+{
+	J9JavaVM *javaVM = (J9JavaVM*)jvm;
+	J9HookInterface **vmHooks = javaVM->internalVMFunctions->getVMHookInterface(javaVM);
+	PORT_ACCESS_FROM_JAVAVM(javaVM);
+
+	benchVM = javaVM;
+	if (!parseOptions(javaVM, options)) {
+		return JNI_ERR;
+	}
+
+	if (0 != (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_INITIALIZED, vmInitializedHandler, OMR_GET_CALLSITE(), NULL)) {
+		j9tty_printf(PORTLIB, "benchtests: unable to register for hook\n");
+		return JNI_ERR;
+	}
+
+	return JNI_OK;
+}
+
+static BOOLEAN
+parseNumber(const char *value, UDATA *result)
+{
+	char *end = NULL;
+	U_64 number = (U_64)strtoull(value, &end, 10);
+
+	if (end == value) {
+		return FALSE;
+	}
+	switch (*end) {
+	case 'k':
+	case 'K':
+		number <<= 10;
+		end += 1;
+		break;
+	case 'm':
+	case 'M':
+		number <<= 20;
+		end += 1;
+		break;
+	case 'g':
+	case 'G':
+		number <<= 30;
+		end += 1;
+		break;
+	default:
+		break;
+	}
+	if (('\0' != *end) && (',' != *end)) {
+		return FALSE;
+	}
+	*result = (UDATA)number;
+	return TRUE;
+}
+
+static BOOLEAN
+parseName(const char *value, UDATA length, const char **names, UDATA nameCount, UDATA *result)
+{
+	UDATA i = 0;
+
+	for (i = 0; i < nameCount; i++) {
+		if ((strlen(names[i]) == length) && (0 == strncmp(value, names[i], length))) {
+			*result = i;
+			return TRUE;
+		}
+	}
+	return FALSE;
+}
+
+static BOOLEAN
+parseOptions(J9JavaVM *vm, const char *options)
+{
+	const char *cursor = options;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	memset(&benchOptions, 0, sizeof(benchOptions));
+	benchOptions.workload = GCBENCH_WORKLOAD_COLLECT;
+	benchOptions.graph = GCBENCH_GRAPH_TREE;
+	benchOptions.size = 64 * 1024 * 1024;
+	benchOptions.fanout = 4;
+	benchOptions.width = 16384;
+	benchOptions.spacing = 4096;
+	benchOptions.collectGlobal = TRUE;
+	benchOptions.collectLocal = TRUE;
+	benchOptions.iterations = 20;
+	benchOptions.warmup = 3;
+	benchOptions.mutate = 10000;
+	benchOptions.churn = 0;
+	benchOptions.seed = 1;
+	benchOptions.dirty = 1;
+	benchOptions.length = 1024 * 1024;
+	benchOptions.threads = 1;
+	benchOptions.names = 64 * 1024;
+	benchOptions.objects = 1024 * 1024;
+	benchOptions.copies = 4;
+	strcpy(benchOptions.dumpOptions, "PHD");
+
+	while ((NULL != cursor) && ('\0' != *cursor)) {
+		const char *next = strchr(cursor, ',');
+		UDATA length = (NULL == next) ? strlen(cursor) : (UDATA)(next - cursor);
+		BOOLEAN valid = TRUE;
+
+		if (0 == strncmp(cursor, "workload=", 9)) {
+			UDATA workload = 0;
+			valid = parseName(cursor + 9, length - 9, workloadNames, sizeof(workloadNames) / sizeof(workloadNames[0]), &workload);
+			benchOptions.workload = (GCBenchWorkload)workload;
+		} else if (0 == strncmp(cursor, "graph=", 6)) {
+			UDATA graph = 0;
+			valid = parseName(cursor + 6, length - 6, graphNames, sizeof(graphNames) / sizeof(graphNames[0]), &graph);
+			benchOptions.graph = (GCBenchGraph)graph;
+		} else if (0 == strncmp(cursor, "collect=", 8)) {
+			if ((14 == length) && (0 == strncmp(cursor + 8, "global", 6))) {
+				benchOptions.collectGlobal = TRUE;
+				benchOptions.collectLocal = FALSE;
+			} else if ((13 == length) && (0 == strncmp(cursor + 8, "local", 5))) {
+				benchOptions.collectGlobal = FALSE;
+				benchOptions.collectLocal = TRUE;
+			} else if ((12 == length) && (0 == strncmp(cursor + 8, "both", 4))) {
+				benchOptions.collectGlobal = TRUE;
+				benchOptions.collectLocal = TRUE;
+			} else {
+				valid = FALSE;
+			}
+		} else if (0 == strncmp(cursor, "variant=", 8)) {
+			if ((8 == length) || ((length - 8) >= sizeof(benchOptions.variant))) {
+				valid = FALSE;
+			} else {
+				memcpy(benchOptions.variant, cursor + 8, length - 8);
+				benchOptions.variant[length - 8] = '\0';
+			}
+		} else if (0 == strncmp(cursor, "dumpopts=", 9)) {
+			if ((9 == length) || ((length - 9) >= sizeof(benchOptions.dumpOptions))) {
+				valid = FALSE;
+			} else {
+				memcpy(benchOptions.dumpOptions, cursor + 9, length - 9);
+				benchOptions.dumpOptions[length - 9] = '\0';
+			}
+		} else if (0 == strncmp(cursor, "output=", 7)) {
+			if ((7 == length) || ((length - 7) >= sizeof(benchOptions.output))) {
+				valid = FALSE;
+			} else {
+				memcpy(benchOptions.output, cursor + 7, length - 7);
+				benchOptions.output[length - 7] = '\0';
+			}
+		} else if (0 == strncmp(cursor, "size=", 5)) {
+			valid = parseNumber(cursor + 5, &benchOptions.size) && (0 != benchOptions.size);
+		} else if (0 == strncmp(cursor, "fanout=", 7)) {
+			valid = parseNumber(cursor + 7, &benchOptions.fanout) && (0 != benchOptions.fanout) && (benchOptions.fanout <= 1024);
+		} else if (0 == strncmp(cursor, "width=", 6)) {
+			valid = parseNumber(cursor + 6, &benchOptions.width) && (0 != benchOptions.width) && (benchOptions.width <= (1024 * 1024));
+		} else if (0 == strncmp(cursor, "spacing=", 8)) {
+			valid = parseNumber(cursor + 8, &benchOptions.spacing);
+		} else if (0 == strncmp(cursor, "iterations=", 11)) {
+			valid = parseNumber(cursor + 11, &benchOptions.iterations) && (0 != benchOptions.iterations);
+		} else if (0 == strncmp(cursor, "warmup=", 7)) {
+			valid = parseNumber(cursor + 7, &benchOptions.warmup);
+		} else if (0 == strncmp(cursor, "mutate=", 7)) {
+			valid = parseNumber(cursor + 7, &benchOptions.mutate);
+		} else if (0 == strncmp(cursor, "churn=", 6)) {
+			valid = parseNumber(cursor + 6, &benchOptions.churn);
+		} else if (0 == strncmp(cursor, "seed=", 5)) {
+			valid = parseNumber(cursor + 5, &benchOptions.seed);
+		} else if (0 == strncmp(cursor, "dirty=", 6)) {
+			valid = parseNumber(cursor + 6, &benchOptions.dirty) && (benchOptions.dirty <= 100);
+		} else if (0 == strncmp(cursor, "length=", 7)) {
+			valid = parseNumber(cursor + 7, &benchOptions.length) && (0 != benchOptions.length) && (benchOptions.length <= (UDATA)I_32_MAX);
+		} else if (0 == strncmp(cursor, "threads=", 8)) {
+			valid = parseNumber(cursor + 8, &benchOptions.threads) && (0 != benchOptions.threads) && (benchOptions.threads <= GCBENCH_MAXIMUM_THREADS);
+		} else if (0 == strncmp(cursor, "names=", 6)) {
+			valid = parseNumber(cursor + 6, &benchOptions.names) && (0 != benchOptions.names);
+		} else if (0 == strncmp(cursor, "copies=", 7)) {
+			valid = parseNumber(cursor + 7, &benchOptions.copies) && (0 != benchOptions.copies);
+		} else if (0 == strncmp(cursor, "objects=", 8)) {
+			valid = parseNumber(cursor + 8, &benchOptions.objects) && (0 != benchOptions.objects);
+		} else if (0 == strncmp(cursor, "start=", 6)) {
+			/* milliseconds since the epoch do not fit a 32 bit UDATA */
+			char *end = NULL;
+			benchOptions.start = (I_64)strtoll(cursor + 6, &end, 10);
+			valid = (end != (cursor + 6)) && (('\0' == *end) || (',' == *end)) && (0 < benchOptions.start);
+		} else {
+			valid = FALSE;
+		}
+
+		if (!valid) {
+			j9tty_printf(PORTLIB, "benchtests: invalid option %.*s\n", (int)length, cursor);
+			return FALSE;
+		}
+		cursor = (NULL == next) ? NULL : (next + 1);
+	}
+
+	if ((GCBENCH_WORKLOAD_STARTUP == benchOptions.workload) && (0 == benchOptions.start)) {
+		j9tty_printf(PORTLIB, "benchtests: the startup workload needs start=<millis>\n");
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+static J9HookInterface **
+getHooks(J9JavaVM *vm, GCBenchHooks hooks)
+{
+	if (GCBENCH_HOOKS_OMR == hooks) {
+		return vm->memoryManagerFunctions->j9gc_get_omr_hook_interface(vm->omrVM);
+	}
+	return vm->memoryManagerFunctions->j9gc_get_private_hook_interface(vm);
+}
+
+static BOOLEAN
+registerPhaseHooks(J9JavaVM *vm)
+{
+	UDATA i = 0;
+
+	for (i = 0; i < GCBENCH_PHASE_COUNT; i++) {
+		J9HookInterface **startHooks = getHooks(vm, phases[i].startHooks);
+		J9HookInterface **endHooks = getHooks(vm, phases[i].endHooks);
+		if ((0 != (*startHooks)->J9HookRegisterWithCallSite(startHooks, phases[i].startEvent, phaseStartHandler, OMR_GET_CALLSITE(), &phaseSamples[i]))
+			|| (0 != (*endHooks)->J9HookRegisterWithCallSite(endHooks, phases[i].endEvent, phaseEndHandler, OMR_GET_CALLSITE(), &phaseSamples[i]))
+		) {
+			return FALSE;
+		}
+	}
+	return TRUE;
+}
+
+static void
+unregisterPhaseHooks(J9JavaVM *vm)
+{
+	UDATA i = 0;
+
+	for (i = 0; i < GCBENCH_PHASE_COUNT; i++) {
+		J9HookInterface **startHooks = getHooks(vm, phases[i].startHooks);
+		J9HookInterface **endHooks = getHooks(vm, phases[i].endHooks);
+		(*startHooks)->J9HookUnregister(startHooks, phases[i].startEvent, phaseStartHandler, &phaseSamples[i]);
+		(*endHooks)->J9HookUnregister(endHooks, phases[i].endEvent, phaseEndHandler, &phaseSamples[i]);
+	}
+}
+
+static void
+phaseStartHandler(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	GCBenchSamples *samples = (GCBenchSamples *)userData;
+	PORT_ACCESS_FROM_JAVAVM(benchVM);
+
+	samples->startTime = j9time_hires_clock();
+}
+
+static void
+phaseEndHandler(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	GCBenchSamples *samples = (GCBenchSamples *)userData;
+	PORT_ACCESS_FROM_JAVAVM(benchVM);
+
+	/* an end without a start is the end of a phase which began before the hooks were registered */
+	if (0 != samples->startTime) {
+		recordSample(samples, j9time_hires_delta(samples->startTime, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS));
+		samples->startTime = 0;
+	}
+}
+
+static void
+recordSample(GCBenchSamples *samples, U_64 micros)
+{
+	if (recording && (samples->count < GCBENCH_MAXIMUM_SAMPLES)) {
+		samples->samples[samples->count] = micros;
+		samples->count += 1;
+	}
+}
+
+static void
+resetPhases(void)
+{
+	UDATA i = 0;
+
+	for (i = 0; i < GCBENCH_PHASE_COUNT; i++) {
+		phaseSamples[i].count = 0;
+	}
+	requestSamples.count = 0;
+	readSamples.count = 0;
+	copySamples.count = 0;
+	cloneSamples.count = 0;
+	workerSamples.count = 0;
+	allocateSamples.count = 0;
+	dumpSamples.count = 0;
+	cardStores = 0;
+	slotsRead = 0;
+	bytesAllocated = 0;
+}
+
+static UDATA
+nextRandom(UDATA bound)
+{
+	/* xorshift64 */
+	randomState ^= randomState << 13;
+	randomState ^= randomState >> 7;
+	randomState ^= randomState << 17;
+	return (UDATA)(randomState % bound);
+}
+
+static j9object_t
+allocateArray(J9VMThread *currentThread, J9Class *clazz, UDATA length)
+{
+	return currentThread->javaVM->memoryManagerFunctions->J9AllocateIndexableObject(currentThread, clazz, (U_32)length, J9_GC_ALLOCATE_OBJECT_NON_INSTRUMENTABLE);
+}
+
+static jobject
+newGlobalRef(J9VMThread *currentThread, j9object_t object)
+{
+	if (NULL == object) {
+		return NULL;
+	}
+	return currentThread->javaVM->internalVMFunctions->j9jni_createGlobalRef((JNIEnv *)currentThread, object, JNI_FALSE);
+}
+
+static void
+deleteGlobalRef(J9VMThread *currentThread, jobject *ref)
+{
+	if (NULL != *ref) {
+		currentThread->javaVM->internalVMFunctions->j9jni_deleteGlobalRef((JNIEnv *)currentThread, *ref, JNI_FALSE);
+		*ref = NULL;
+	}
+}
+
+/*
+ * Allocate every node into a holder array (so that the nodes survive the collections the allocations may cause), link
+ * them into the requested shape, then drop the holder so that only the shape keeps them alive (the cards and reads
+ * workloads keep the holder, to visit every node).  References to objects are reloaded from their global references
+ * after every allocation since a collection may have moved them.
+ */
+static BOOLEAN
+buildGraph(J9VMThread *currentThread)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	J9InternalVMFunctions *vmFuncs = vm->internalVMFunctions;
+	J9Class *arrayClass = J9VMJAVALANGOBJECT_OR_NULL(vm)->arrayClass;
+	jobject holderRef = NULL;
+	jobject rootRef = NULL;
+	UDATA nodeBytes = 0;
+	UDATA nodeCount = 0;
+	UDATA i = 0;
+	BOOLEAN result = FALSE;
+	j9object_t node = NULL;
+
+	switch (benchOptions.graph) {
+	case GCBENCH_GRAPH_LIST:
+		/* next, and a spare slot for mutation */
+		nodeLength = 2;
+		break;
+	case GCBENCH_GRAPH_WIDE:
+		/* a leaf slot for mutation */
+		nodeLength = 1;
+		break;
+	default:
+		/* fanout references, and a spare slot for mutation */
+		nodeLength = benchOptions.fanout + 1;
+		break;
+	}
+
+	node = allocateArray(currentThread, arrayClass, nodeLength);
+	if (NULL == node) {
+		return FALSE;
+	}
+	nodeBytes = vm->memoryManagerFunctions->j9gc_get_object_size_in_bytes(vm, node);
+	nodeCount = OMR_MAX(benchOptions.size / nodeBytes, 2);
+	nodeCount = OMR_MIN(nodeCount, (UDATA)I_32_MAX);
+
+	holderRef = newGlobalRef(currentThread, allocateArray(currentThread, arrayClass, nodeCount));
+	if (NULL == holderRef) {
+		return FALSE;
+	}
+	for (i = 0; i < nodeCount; i++) {
+		node = allocateArray(currentThread, arrayClass, nodeLength);
+		if (NULL == node) {
+			goto done;
+		}
+		J9JAVAARRAYOFOBJECT_STORE(currentThread, J9_JNI_UNWRAP_REFERENCE(holderRef), i, node);
+		if ((GCBENCH_GRAPH_CROSS == benchOptions.graph) && (0 != benchOptions.spacing)) {
+			/* garbage between the nodes so that the references between them cross cards and regions */
+			if (NULL == allocateArray(currentThread, vm->byteArrayClass, benchOptions.spacing)) {
+				goto done;
+			}
+		}
+	}
+
+	if (GCBENCH_GRAPH_WIDE == benchOptions.graph) {
+		UDATA arrayCount = (nodeCount + benchOptions.width - 1) / benchOptions.width;
+		rootRef = newGlobalRef(currentThread, allocateArray(currentThread, arrayClass, arrayCount));
+		if (NULL == rootRef) {
+			goto done;
+		}
+		for (i = 0; i < arrayCount; i++) {
+			UDATA first = i * benchOptions.width;
+			UDATA slotCount = OMR_MIN(benchOptions.width, nodeCount - first);
+			j9object_t holder = NULL;
+			j9object_t array = allocateArray(currentThread, arrayClass, slotCount);
+			UDATA slot = 0;
+			if (NULL == array) {
+				goto done;
+			}
+			J9JAVAARRAYOFOBJECT_STORE(currentThread, J9_JNI_UNWRAP_REFERENCE(rootRef), i, array);
+			holder = J9_JNI_UNWRAP_REFERENCE(holderRef);
+			for (slot = 0; slot < slotCount; slot++) {
+				J9JAVAARRAYOFOBJECT_STORE(currentThread, array, slot, J9JAVAARRAYOFOBJECT_LOAD(currentThread, holder, first + slot));
+			}
+		}
+	} else {
+		/* no allocation while linking, so the holder can't move */
+		j9object_t holder = J9_JNI_UNWRAP_REFERENCE(holderRef);
+		for (i = 0; i < nodeCount; i++) {
+			j9object_t current = J9JAVAARRAYOFOBJECT_LOAD(currentThread, holder, i);
+			UDATA slot = 0;
+			switch (benchOptions.graph) {
+			case GCBENCH_GRAPH_TREE:
+				for (slot = 0; slot < benchOptions.fanout; slot++) {
+					UDATA child = (i * benchOptions.fanout) + slot + 1;
+					if (child < nodeCount) {
+						J9JAVAARRAYOFOBJECT_STORE(currentThread, current, slot, J9JAVAARRAYOFOBJECT_LOAD(currentThread, holder, child));
+					}
+				}
+				break;
+			case GCBENCH_GRAPH_LIST:
+				if ((i + 1) < nodeCount) {
+					J9JAVAARRAYOFOBJECT_STORE(currentThread, current, 0, J9JAVAARRAYOFOBJECT_LOAD(currentThread, holder, i + 1));
+				}
+				break;
+			case GCBENCH_GRAPH_CROSS:
+				/* the chain keeps every node reachable, the other references go anywhere */
+				if ((i + 1) < nodeCount) {
+					J9JAVAARRAYOFOBJECT_STORE(currentThread, current, 0, J9JAVAARRAYOFOBJECT_LOAD(currentThread, holder, i + 1));
+				}
+				for (slot = 1; slot < benchOptions.fanout; slot++) {
+					J9JAVAARRAYOFOBJECT_STORE(currentThread, current, slot, J9JAVAARRAYOFOBJECT_LOAD(currentThread, holder, nextRandom(nodeCount)));
+				}
+				break;
+			default:
+				break;
+			}
+		}
+		rootRef = newGlobalRef(currentThread, J9JAVAARRAYOFOBJECT_LOAD(currentThread, holder, 0));
+	}
+
+	/* a sample of the nodes, which mutateGraph() links to each other */
+	mutationTargetsRef = newGlobalRef(currentThread, allocateArray(currentThread, arrayClass, GCBENCH_MUTATION_TARGETS));
+	if (NULL != mutationTargetsRef) {
+		j9object_t holder = J9_JNI_UNWRAP_REFERENCE(holderRef);
+		j9object_t targets = J9_JNI_UNWRAP_REFERENCE(mutationTargetsRef);
+		for (i = 0; i < GCBENCH_MUTATION_TARGETS; i++) {
+			J9JAVAARRAYOFOBJECT_STORE(currentThread, targets, i, J9JAVAARRAYOFOBJECT_LOAD(currentThread, holder, nextRandom(nodeCount)));
+		}
+		graphRootRef = rootRef;
+		rootRef = NULL;
+		if ((GCBENCH_WORKLOAD_CARDS == benchOptions.workload) || (GCBENCH_WORKLOAD_READS == benchOptions.workload)) {
+			nodesRef = holderRef;
+			holderRef = NULL;
+		}
+		result = TRUE;
+	}
+
+done:
+	if (NULL != rootRef) {
+		vmFuncs->j9jni_deleteGlobalRef((JNIEnv *)currentThread, rootRef, JNI_FALSE);
+	}
+	if (NULL != holderRef) {
+		vmFuncs->j9jni_deleteGlobalRef((JNIEnv *)currentThread, holderRef, JNI_FALSE);
+	}
+	return result;
+}
+
+static void
+mutateGraph(J9VMThread *currentThread)
+{
+	j9object_t targets = J9_JNI_UNWRAP_REFERENCE(mutationTargetsRef);
+	UDATA i = 0;
+
+	/* the spare slot of a node only ever refers to another node of the graph, so the live set does not change */
+	for (i = 0; i < benchOptions.mutate; i++) {
+		j9object_t source = J9JAVAARRAYOFOBJECT_LOAD(currentThread, targets, nextRandom(GCBENCH_MUTATION_TARGETS));
+		j9object_t target = J9JAVAARRAYOFOBJECT_LOAD(currentThread, targets, nextRandom(GCBENCH_MUTATION_TARGETS));
+		J9JAVAARRAYOFOBJECT_STORE(currentThread, source, nodeLength - 1, target);
+	}
+}
+
+/*
+ * Store into every node lying in a card selected by its index, so that the dirty percentage of the cards holding the
+ * graph are dirtied whatever order copying collections have left the nodes in.
+ */
+static void
+dirtyCards(J9VMThread *currentThread)
+{
+	j9object_t nodes = J9_JNI_UNWRAP_REFERENCE(nodesRef);
+	UDATA nodeCount = J9INDEXABLEOBJECT_SIZE(currentThread, nodes);
+	UDATA i = 0;
+
+	for (i = 0; i < nodeCount; i++) {
+		j9object_t node = J9JAVAARRAYOFOBJECT_LOAD(currentThread, nodes, i);
+		if ((((UDATA)node / cardSize) % 100) < benchOptions.dirty) {
+			/* a node referring to itself from its spare slot leaves the live set unchanged */
+			J9JAVAARRAYOFOBJECT_STORE(currentThread, node, nodeLength - 1, node);
+			if (recording) {
+				cardStores += 1;
+			}
+		}
+	}
+}
+
+/*
+ * Read every reference slot of every node through the read barrier of the VM (the evacuate range check while
+ * concurrent scavenge is enabled).
+ */
+static void
+readGraph(J9VMThread *currentThread)
+{
+	j9object_t nodes = J9_JNI_UNWRAP_REFERENCE(nodesRef);
+	UDATA nodeCount = J9INDEXABLEOBJECT_SIZE(currentThread, nodes);
+	UDATA checksum = 0;
+	UDATA i = 0;
+	U_64 start = 0;
+	PORT_ACCESS_FROM_JAVAVM(benchVM);
+
+	start = j9time_hires_clock();
+	for (i = 0; i < nodeCount; i++) {
+		j9object_t node = J9JAVAARRAYOFOBJECT_LOAD(currentThread, nodes, i);
+		UDATA slot = 0;
+		for (slot = 0; slot < nodeLength; slot++) {
+			checksum ^= (UDATA)J9JAVAARRAYOFOBJECT_LOAD(currentThread, node, slot);
+		}
+	}
+	recordSample(&readSamples, j9time_hires_delta(start, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS));
+	readChecksum = checksum;
+	slotsRead = nodeCount * (nodeLength + 1);
+}
+
+static BOOLEAN
+buildCopyArrays(J9VMThread *currentThread)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	J9Class *arrayClass = J9VMJAVALANGOBJECT_OR_NULL(vm)->arrayClass;
+	j9object_t source = NULL;
+	j9object_t targets = NULL;
+	UDATA i = 0;
+
+	copySourceRef = newGlobalRef(currentThread, allocateArray(currentThread, arrayClass, benchOptions.length));
+	if (NULL == copySourceRef) {
+		return FALSE;
+	}
+	copyDestinationRef = newGlobalRef(currentThread, allocateArray(currentThread, arrayClass, benchOptions.length));
+	if (NULL == copyDestinationRef) {
+		return FALSE;
+	}
+
+	/* no allocation while filling, so the source can't move */
+	source = J9_JNI_UNWRAP_REFERENCE(copySourceRef);
+	targets = J9_JNI_UNWRAP_REFERENCE(mutationTargetsRef);
+	for (i = 0; i < benchOptions.length; i++) {
+		J9JAVAARRAYOFOBJECT_STORE(currentThread, source, i, J9JAVAARRAYOFOBJECT_LOAD(currentThread, targets, i % GCBENCH_MUTATION_TARGETS));
+	}
+	return TRUE;
+}
+
+/*
+ * Copy the source array over the destination with the reference arraycopy helper System.arraycopy uses, then clone
+ * it the way Object.clone does, timing each (but not the allocation of the clone).
+ */
+static BOOLEAN
+copyArrays(J9VMThread *currentThread)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	J9MemoryManagerFunctions *mmFuncs = vm->memoryManagerFunctions;
+	j9object_t clone = NULL;
+	U_64 start = 0;
+	I_32 result = 0;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	start = j9time_hires_clock();
+	result = mmFuncs->referenceArrayCopyIndex(currentThread, (J9IndexableObject *)J9_JNI_UNWRAP_REFERENCE(copySourceRef),
+			(J9IndexableObject *)J9_JNI_UNWRAP_REFERENCE(copyDestinationRef), 0, 0, (I_32)benchOptions.length);
+	recordSample(&copySamples, j9time_hires_delta(start, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS));
+	if (-1 != result) {
+		return FALSE;
+	}
+
+	clone = allocateArray(currentThread, J9VMJAVALANGOBJECT_OR_NULL(vm)->arrayClass, benchOptions.length);
+	if (NULL == clone) {
+		return FALSE;
+	}
+	start = j9time_hires_clock();
+	mmFuncs->j9gc_objaccess_cloneIndexableObject(currentThread, (J9IndexableObject *)J9_JNI_UNWRAP_REFERENCE(copySourceRef), (J9IndexableObject *)clone);
+	recordSample(&cloneSamples, j9time_hires_delta(start, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS));
+	return TRUE;
+}
+
+/*
+ * Intern the names of the intern workload, starting at a point which depends on the thread so that the threads add
+ * different names to the table at first, then find each other's.
+ */
+static BOOLEAN
+internNames(J9VMThread *currentThread, UDATA index)
+{
+	J9MemoryManagerFunctions *mmFuncs = currentThread->javaVM->memoryManagerFunctions;
+	UDATA first = (index * benchOptions.names) / benchOptions.threads;
+	char name[GCBENCH_NAME_LENGTH];
+	UDATA i = 0;
+	PORT_ACCESS_FROM_JAVAVM(benchVM);
+
+	for (i = 0; i < benchOptions.names; i++) {
+		UDATA length = j9str_printf(PORTLIB, name, sizeof(name), "benchtests.intern.%zu", (first + i) % benchOptions.names);
+		if (NULL == mmFuncs->j9gc_createJavaLangString(currentThread, (U_8 *)name, length, J9_STR_INTERN)) {
+			return FALSE;
+		}
+	}
+	return TRUE;
+}
+
+/*
+ * Allocate the garbage arrays of the allocate workload.  These are allocated out of line, like every allocation of the
+ * harness, so each one counts towards the next allocation sample.
+ */
+static BOOLEAN
+allocateObjects(J9VMThread *currentThread)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	J9Class *arrayClass = J9VMJAVALANGOBJECT_OR_NULL(vm)->arrayClass;
+	j9object_t object = NULL;
+	U_64 start = 0;
+	UDATA i = 0;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	start = j9time_hires_clock();
+	for (i = 0; i < benchOptions.objects; i++) {
+		object = allocateArray(currentThread, arrayClass, 2);
+		if (NULL == object) {
+			return FALSE;
+		}
+	}
+	recordSample(&allocateSamples, j9time_hires_delta(start, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS));
+	bytesAllocated = benchOptions.objects * vm->memoryManagerFunctions->j9gc_get_object_size_in_bytes(vm, object);
+	return TRUE;
+}
+
+/*
+ * Allocate copies separate Strings (each with its own value array) for each of the names of the dedup workload, and
+ * keep them alive from an array.
+ */
+static BOOLEAN
+buildStrings(J9VMThread *currentThread)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	J9MemoryManagerFunctions *mmFuncs = vm->memoryManagerFunctions;
+	UDATA count = benchOptions.names * benchOptions.copies;
+	char name[GCBENCH_STRING_LENGTH];
+	UDATA i = 0;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	if (count > (UDATA)I_32_MAX) {
+		return FALSE;
+	}
+	stringsRef = newGlobalRef(currentThread, allocateArray(currentThread, J9VMJAVALANGOBJECT_OR_NULL(vm)->arrayClass, count));
+	if (NULL == stringsRef) {
+		return FALSE;
+	}
+	for (i = 0; i < count; i++) {
+		/* long enough that the value arrays dominate the size of the Strings */
+		UDATA length = j9str_printf(PORTLIB, name, sizeof(name), "benchtests.dedup.%096zu", i % benchOptions.names);
+		j9object_t string = mmFuncs->j9gc_createJavaLangString(currentThread, (U_8 *)name, length, 0);
+		if (NULL == string) {
+			return FALSE;
+		}
+		J9JAVAARRAYOFOBJECT_STORE(currentThread, J9_JNI_UNWRAP_REFERENCE(stringsRef), i, string);
+	}
+	return TRUE;
+}
+
+/*
+ * Give the String deduplication thread time to process the candidates of the last collection, then collect the value
+ * arrays it released and return the live size.
+ */
+static UDATA
+settledLiveBytes(J9VMThread *currentThread)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	J9MemoryManagerFunctions *mmFuncs = vm->memoryManagerFunctions;
+
+	vm->internalVMFunctions->internalReleaseVMAccess(currentThread);
+	omrthread_sleep(GCBENCH_DEDUP_SETTLE_MILLIS);
+	vm->internalVMFunctions->internalAcquireVMAccess(currentThread);
+	mmFuncs->j9gc_modron_global_collect(currentThread);
+	return mmFuncs->j9gc_heap_total_memory(vm) - mmFuncs->j9gc_heap_free_memory(vm);
+}
+
+/*
+ * Write a heap dump through the dump agents, timing the request:  that is how long the application is stopped, which
+ * for a forked dump ends once the snapshot has been taken rather than when the file is complete.
+ */
+static BOOLEAN
+dumpHeap(J9VMThread *currentThread)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	char optionString[GCBENCH_LINE_LENGTH / 4];
+	omr_error_t rc = OMR_ERROR_NONE;
+	U_64 start = 0;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	j9str_printf(PORTLIB, optionString, sizeof(optionString), "heap:opts=%s,file=benchtests.%%pid.phd", benchOptions.dumpOptions);
+	start = j9time_hires_clock();
+	rc = vm->j9rasDumpFunctions->triggerOneOffDump(vm, optionString, "benchtests", NULL, 0);
+	recordSample(&dumpSamples, j9time_hires_delta(start, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS));
+	return (OMR_ERROR_NONE == rc);
+}
+
+static int J9THREAD_PROC
+workerMain(void *entryArg)
+{
+	UDATA index = (UDATA)entryArg;
+	J9JavaVM *vm = benchVM;
+	J9InternalVMFunctions *vmFuncs = vm->internalVMFunctions;
+	J9VMThread *currentThread = NULL;
+	UDATA round = 0;
+
+	if (JNI_OK == vmFuncs->internalAttachCurrentThread(vm, &currentThread, NULL, J9_PRIVATE_FLAGS_DAEMON_THREAD | J9_PRIVATE_FLAGS_ATTACHED_THREAD, omrthread_self())) {
+		omrthread_monitor_enter(workerMutex);
+		for (;;) {
+			BOOLEAN done = FALSE;
+
+			while ((round == workerRound) && !workersExit) {
+				omrthread_monitor_wait(workerMutex);
+			}
+			if (workersExit) {
+				break;
+			}
+			round = workerRound;
+			omrthread_monitor_exit(workerMutex);
+
+			/* only hold VM access for the work, so that the collections between rounds do not wait for the workers */
+			vmFuncs->internalAcquireVMAccess(currentThread);
+			done = internNames(currentThread, index);
+			vmFuncs->internalReleaseVMAccess(currentThread);
+
+			omrthread_monitor_enter(workerMutex);
+			if (!done) {
+				workersFailed = TRUE;
+			}
+			workersBusy -= 1;
+			omrthread_monitor_notify_all(workerMutex);
+		}
+		omrthread_monitor_exit(workerMutex);
+		vmFuncs->DetachCurrentThread((JavaVM *)vm);
+	}
+
+	omrthread_monitor_enter(workerMutex);
+	workersAlive -= 1;
+	omrthread_monitor_notify_all(workerMutex);
+	omrthread_monitor_exit(workerMutex);
+	return 0;
+}
+
+static BOOLEAN
+startWorkers(J9VMThread *currentThread)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	UDATA i = 0;
+
+	if (0 != omrthread_monitor_init_with_name(&workerMutex, 0, "benchtests workers")) {
+		return FALSE;
+	}
+	omrthread_monitor_enter(workerMutex);
+	for (i = 0; i < benchOptions.threads; i++) {
+		if (0 != vm->internalVMFunctions->createThreadWithCategory(NULL, vm->defaultOSStackSize, J9THREAD_PRIORITY_NORMAL, FALSE, workerMain, (void *)i, J9THREAD_CATEGORY_APPLICATION_THREAD)) {
+			break;
+		}
+		workersAlive += 1;
+	}
+	omrthread_monitor_exit(workerMutex);
+	return (i == benchOptions.threads);
+}
+
+/*
+ * Have every worker do a round of work, timing it from the start of the round to the last worker finishing.
+ */
+static BOOLEAN
+runWorkers(J9VMThread *currentThread)
+{
+	J9InternalVMFunctions *vmFuncs = currentThread->javaVM->internalVMFunctions;
+	BOOLEAN result = FALSE;
+	U_64 start = 0;
+	PORT_ACCESS_FROM_JAVAVM(benchVM);
+
+	vmFuncs->internalReleaseVMAccess(currentThread);
+	omrthread_monitor_enter(workerMutex);
+	start = j9time_hires_clock();
+	workersBusy = workersAlive;
+	workerRound += 1;
+	omrthread_monitor_notify_all(workerMutex);
+	while (0 != workersBusy) {
+		omrthread_monitor_wait(workerMutex);
+	}
+	recordSample(&workerSamples, j9time_hires_delta(start, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS));
+	result = !workersFailed && (workersAlive == benchOptions.threads);
+	omrthread_monitor_exit(workerMutex);
+	vmFuncs->internalAcquireVMAccess(currentThread);
+	return result;
+}
+
+static void
+stopWorkers(J9VMThread *currentThread)
+{
+	J9InternalVMFunctions *vmFuncs = currentThread->javaVM->internalVMFunctions;
+
+	if (NULL == workerMutex) {
+		return;
+	}
+	vmFuncs->internalReleaseVMAccess(currentThread);
+	omrthread_monitor_enter(workerMutex);
+	workersExit = TRUE;
+	omrthread_monitor_notify_all(workerMutex);
+	while (0 != workersAlive) {
+		omrthread_monitor_wait(workerMutex);
+	}
+	omrthread_monitor_exit(workerMutex);
+	vmFuncs->internalAcquireVMAccess(currentThread);
+	omrthread_monitor_destroy(workerMutex);
+	workerMutex = NULL;
+}
+
+static BOOLEAN
+churn(J9VMThread *currentThread)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	UDATA allocated = 0;
+
+	while (allocated < benchOptions.churn) {
+		if (NULL == allocateArray(currentThread, vm->byteArrayClass, GCBENCH_CHURN_ARRAY_SIZE)) {
+			return FALSE;
+		}
+		allocated += GCBENCH_CHURN_ARRAY_SIZE;
+	}
+	return TRUE;
+}
+
+static void
+emit(const char *format, ...)
+{
+	char line[GCBENCH_LINE_LENGTH];
+	va_list args;
+	PORT_ACCESS_FROM_JAVAVM(benchVM);
+
+	va_start(args, format);
+	j9str_vprintf(line, sizeof(line), format, args);
+	va_end(args);
+	if (-1 != outputFD) {
+		j9file_write_text(outputFD, line, strlen(line));
+	} else {
+		j9tty_printf(PORTLIB, "%s", line);
+	}
+}
+
+static int
+compareSamples(const void *left, const void *right)
+{
+	U_64 leftSample = *(const U_64 *)left;
+	U_64 rightSample = *(const U_64 *)right;
+	return (leftSample < rightSample) ? -1 : ((leftSample > rightSample) ? 1 : 0);
+}
+
+/*
+ * Write the summary of samples as one JSON object.  bytes is the size of the data each sample processed (the live set
+ * for a collection), detail any further fields of the workload, each preceded by a comma.
+ */
+static void
+reportPhase(const char *kind, const char *name, GCBenchSamples *samples, UDATA bytes, const char *detail)
+{
+	U_64 total = 0;
+	U_64 mean = 0;
+	U_64 p50 = 0;
+	U_64 p90 = 0;
+	U_64 p99 = 0;
+	UDATA i = 0;
+
+	if (0 == samples->count) {
+		return;
+	}
+	qsort(samples->samples, samples->count, sizeof(U_64), compareSamples);
+	for (i = 0; i < samples->count; i++) {
+		total += samples->samples[i];
+	}
+	mean = total / samples->count;
+	p50 = samples->samples[((samples->count - 1) * 50) / 100];
+	p90 = samples->samples[((samples->count - 1) * 90) / 100];
+	p99 = samples->samples[((samples->count - 1) * 99) / 100];
+
+	emit("{\"benchmark\":\"benchtests\",\"workload\":\"%s\",\"variant\":\"%s\",\"policy\":\"%s\",\"graph\":\"%s\",\"liveBytes\":%zu,\"collect\":\"%s\",\"phase\":\"%s\",\"count\":%zu,"
+		"\"totalMs\":%llu.%03llu,\"minMs\":%llu.%03llu,\"meanMs\":%llu.%03llu,\"p50Ms\":%llu.%03llu,\"p90Ms\":%llu.%03llu,\"p99Ms\":%llu.%03llu,\"maxMs\":%llu.%03llu,"
+		"\"MBPerSecond\":%llu%s}\n",
+		workloadNames[benchOptions.workload], benchOptions.variant, benchVM->memoryManagerFunctions->j9gc_get_gcmodestring(benchVM), graphNames[benchOptions.graph], liveBytes, kind, name, samples->count,
+		total / 1000, total % 1000, samples->samples[0] / 1000, samples->samples[0] % 1000, mean / 1000, mean % 1000,
+		p50 / 1000, p50 % 1000, p90 / 1000, p90 % 1000, p99 / 1000, p99 % 1000,
+		samples->samples[samples->count - 1] / 1000, samples->samples[samples->count - 1] % 1000,
+		/* bytes per microsecond is (decimal) megabytes per second */
+		(0 == mean) ? (U_64)0 : ((U_64)bytes / mean), detail);
+}
+
+/*
+ * Time to the first allocation from the launch, for comparing the heap initialization cost of different -Xmx.
+ */
+static void
+reportStartup(J9VMThread *currentThread)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	J9MemoryManagerFunctions *mmFuncs = vm->memoryManagerFunctions;
+	I_64 elapsed = 0;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	if (NULL == allocateArray(currentThread, J9VMJAVALANGOBJECT_OR_NULL(vm)->arrayClass, 1)) {
+		j9tty_printf(PORTLIB, "benchtests: unable to allocate\n");
+		return;
+	}
+	elapsed = j9time_current_time_millis() - benchOptions.start;
+
+	emit("{\"benchmark\":\"benchtests\",\"workload\":\"startup\",\"policy\":\"%s\",\"maximumHeapBytes\":%zu,\"firstAllocationMs\":%lld}\n",
+		mmFuncs->j9gc_get_gcmodestring(vm), mmFuncs->j9gc_get_maximum_heap_size(vm), elapsed);
+}
+
+static void
+runBenchmark(J9VMThread *currentThread)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	J9MemoryManagerFunctions *mmFuncs = vm->memoryManagerFunctions;
+	UDATA kind = 0;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	randomState = (U_64)benchOptions.seed * 0x9E3779B97F4A7C15ULL;
+	if (0 == randomState) {
+		randomState = 1;
+	}
+
+	if (!buildGraph(currentThread)) {
+		j9tty_printf(PORTLIB, "benchtests: unable to build the %s graph of %zu bytes\n", graphNames[benchOptions.graph], benchOptions.size);
+		return;
+	}
+	if (GCBENCH_WORKLOAD_CARDS == benchOptions.workload) {
+		cardSize = mmFuncs->j9gc_concurrent_getCardSize(vm);
+		if (0 == cardSize) {
+			j9tty_printf(PORTLIB, "benchtests: -Xgcpolicy:%s has no card table\n", mmFuncs->j9gc_get_gcmodestring(vm));
+			return;
+		}
+	} else if (GCBENCH_WORKLOAD_ARRAYCOPY == benchOptions.workload) {
+		if (!buildCopyArrays(currentThread)) {
+			j9tty_printf(PORTLIB, "benchtests: unable to allocate the arrays of %zu elements to copy\n", benchOptions.length);
+			return;
+		}
+	} else if (GCBENCH_WORKLOAD_DEDUP == benchOptions.workload) {
+		if (!buildStrings(currentThread)) {
+			j9tty_printf(PORTLIB, "benchtests: unable to allocate %zu copies of %zu Strings\n", benchOptions.copies, benchOptions.names);
+			return;
+		}
+	} else if (GCBENCH_WORKLOAD_INTERN == benchOptions.workload) {
+		if (!startWorkers(currentThread)) {
+			j9tty_printf(PORTLIB, "benchtests: unable to start %zu threads\n", benchOptions.threads);
+			stopWorkers(currentThread);
+			return;
+		}
+	}
+	mmFuncs->j9gc_modron_global_collect(currentThread);
+	liveBytes = mmFuncs->j9gc_heap_total_memory(vm) - mmFuncs->j9gc_heap_free_memory(vm);
+
+	if (!registerPhaseHooks(vm)) {
+		j9tty_printf(PORTLIB, "benchtests: unable to register for hook\n");
+		unregisterPhaseHooks(vm);
+		return;
+	}
+
+	for (kind = 0; kind < 2; kind++) {
+		BOOLEAN global = (0 == kind);
+		const char *kindName = global ? "global" : "local";
+		char detail[GCBENCH_LINE_LENGTH / 4];
+		UDATA i = 0;
+
+		if (global ? !benchOptions.collectGlobal : !benchOptions.collectLocal) {
+			continue;
+		}
+		resetPhases();
+		for (i = 0; i < (benchOptions.warmup + benchOptions.iterations); i++) {
+			U_64 start = 0;
+
+			recording = (i >= benchOptions.warmup);
+			if (GCBENCH_WORKLOAD_CARDS == benchOptions.workload) {
+				dirtyCards(currentThread);
+			} else {
+				mutateGraph(currentThread);
+			}
+			if (!churn(currentThread)) {
+				j9tty_printf(PORTLIB, "benchtests: out of memory allocating %zu bytes of garbage\n", benchOptions.churn);
+				break;
+			}
+			/* after the garbage, so that the reads may overlap a concurrent scavenge it started */
+			if (GCBENCH_WORKLOAD_READS == benchOptions.workload) {
+				readGraph(currentThread);
+			} else if (GCBENCH_WORKLOAD_ARRAYCOPY == benchOptions.workload) {
+				if (!copyArrays(currentThread)) {
+					j9tty_printf(PORTLIB, "benchtests: unable to copy the arrays of %zu elements\n", benchOptions.length);
+					break;
+				}
+			} else if (GCBENCH_WORKLOAD_INTERN == benchOptions.workload) {
+				if (!runWorkers(currentThread)) {
+					j9tty_printf(PORTLIB, "benchtests: unable to intern %zu Strings on %zu threads\n", benchOptions.names, benchOptions.threads);
+					break;
+				}
+			} else if (GCBENCH_WORKLOAD_ALLOCATE == benchOptions.workload) {
+				if (!allocateObjects(currentThread)) {
+					j9tty_printf(PORTLIB, "benchtests: out of memory allocating %zu arrays\n", benchOptions.objects);
+					break;
+				}
+			} else if (GCBENCH_WORKLOAD_HEAPDUMP == benchOptions.workload) {
+				if (!dumpHeap(currentThread)) {
+					j9tty_printf(PORTLIB, "benchtests: unable to write a heap dump with opts=%s\n", benchOptions.dumpOptions);
+					break;
+				}
+			}
+			start = j9time_hires_clock();
+			if (global) {
+				mmFuncs->j9gc_modron_global_collect(currentThread);
+			} else {
+				mmFuncs->j9gc_modron_local_collect(currentThread);
+			}
+			recordSample(&requestSamples, j9time_hires_delta(start, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS));
+		}
+		recording = FALSE;
+
+		detail[0] = '\0';
+		if (GCBENCH_WORKLOAD_CARDS == benchOptions.workload) {
+			j9str_printf(PORTLIB, detail, sizeof(detail), ",\"dirtyPercent\":%zu,\"cardSize\":%zu,\"cardStoresPerCollection\":%zu",
+				benchOptions.dirty, cardSize, (0 == requestSamples.count) ? 0 : (cardStores / requestSamples.count));
+		} else if (GCBENCH_WORKLOAD_DEDUP == benchOptions.workload) {
+			/* liveBytes is the size before the collections which queued the Strings for deduplication */
+			j9str_printf(PORTLIB, detail, sizeof(detail), ",\"names\":%zu,\"copies\":%zu,\"settledLiveBytes\":%zu",
+				benchOptions.names, benchOptions.copies, settledLiveBytes(currentThread));
+		}
+		reportPhase(kindName, "request", &requestSamples, liveBytes, detail);
+		for (i = 0; i < GCBENCH_PHASE_COUNT; i++) {
+			reportPhase(kindName, phases[i].name, &phaseSamples[i], liveBytes, detail);
+		}
+		if (GCBENCH_WORKLOAD_READS == benchOptions.workload) {
+			j9str_printf(PORTLIB, detail, sizeof(detail), ",\"slots\":%zu", slotsRead);
+			reportPhase(kindName, "reads", &readSamples, slotsRead * sizeof(fj9object_t), detail);
+		} else if (GCBENCH_WORKLOAD_ARRAYCOPY == benchOptions.workload) {
+			j9str_printf(PORTLIB, detail, sizeof(detail), ",\"elements\":%zu", benchOptions.length);
+			reportPhase(kindName, "arraycopy", &copySamples, benchOptions.length * sizeof(fj9object_t), detail);
+			reportPhase(kindName, "clone", &cloneSamples, benchOptions.length * sizeof(fj9object_t), detail);
+		} else if (GCBENCH_WORKLOAD_INTERN == benchOptions.workload) {
+			/* the mean round in microseconds gives the interns per second */
+			U_64 interns = (U_64)benchOptions.threads * benchOptions.names;
+			j9str_printf(PORTLIB, detail, sizeof(detail), ",\"threads\":%zu,\"names\":%zu,\"internsPerRound\":%llu",
+				benchOptions.threads, benchOptions.names, interns);
+			reportPhase(kindName, "intern", &workerSamples, 0, detail);
+		} else if (GCBENCH_WORKLOAD_HEAPDUMP == benchOptions.workload) {
+			j9str_printf(PORTLIB, detail, sizeof(detail), ",\"dumpOptions\":\"%s\"", benchOptions.dumpOptions);
+			reportPhase(kindName, "heapdump", &dumpSamples, liveBytes, detail);
+		} else if (GCBENCH_WORKLOAD_ALLOCATE == benchOptions.workload) {
+			j9str_printf(PORTLIB, detail, sizeof(detail), ",\"objects\":%zu,\"bytesAllocated\":%zu", benchOptions.objects, bytesAllocated);
+			reportPhase(kindName, "allocate", &allocateSamples, bytesAllocated, detail);
+		}
+	}
+
+	unregisterPhaseHooks(vm);
+	stopWorkers(currentThread);
+}
+
+static void
+vmInitializedHandler(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	J9VMInitEvent *event = (J9VMInitEvent *)eventData;
+	J9VMThread *currentThread = event->vmThread;
+	J9JavaVM *vm = currentThread->javaVM;
+	J9InternalVMFunctions *vmFuncs = vm->internalVMFunctions;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	(*hook)->J9HookUnregister(hook, J9HOOK_VM_INITIALIZED, vmInitializedHandler, NULL);
+
+	if ('\0' != benchOptions.output[0]) {
+		outputFD = j9file_open(benchOptions.output, EsOpenWrite | EsOpenCreate | EsOpenAppend, 0666);
+		if (-1 == outputFD) {
+			j9tty_printf(PORTLIB, "benchtests: unable to open %s\n", benchOptions.output);
+			return;
+		}
+	}
+
+	vmFuncs->internalAcquireVMAccess(currentThread);
+	if (GCBENCH_WORKLOAD_STARTUP == benchOptions.workload) {
+		reportStartup(currentThread);
+	} else {
+		runBenchmark(currentThread);
+	}
+	deleteGlobalRef(currentThread, &graphRootRef);
+	deleteGlobalRef(currentThread, &mutationTargetsRef);
+	deleteGlobalRef(currentThread, &nodesRef);
+	deleteGlobalRef(currentThread, &copySourceRef);
+	deleteGlobalRef(currentThread, &copyDestinationRef);
+	deleteGlobalRef(currentThread, &stringsRef);
+	vmFuncs->internalReleaseVMAccess(currentThread);
+
+	if (-1 != outputFD) {
+		j9file_close(outputFD);
+		outputFD = -1;
+	}
+}
@@ -0,0 +1,284 @@
+#!/bin/sh
+################################################################################
+# Copyright (c) 2026, 2026 IBM Corp. and others
+#
+# This program and the accompanying materials are made available under
+# the terms of the Eclipse Public License 2.0 which accompanies this
+# distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+# or the Apache License, Version 2.0 which accompanies this distribution and
+# is available at https://www.apache.org/licenses/LICENSE-2.0.
+#
+# This Source Code may also be made available under the following
+# Secondary Licenses when the conditions for such availability set
+# forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+# General Public License, version 2 with the GNU Classpath
+# Exception [1] and GNU General Public License, version 2 with the
+# OpenJDK Assembly Exception [2].
+#
+# [1] https://www.gnu.org/software/classpath/license.html
+# [2] http://openjdk.java.net/legal/assembly-exception.html
+#
+# SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+################################################################################
+
+# Run the benchtests GC harness under each GC policy, appending one JSON object per phase to a results file.
+#
+#   run_benchtests.sh <java> <results file> [benchtests options] [-- extra JVM options]
+#
+# e.g. run_benchtests.sh jdk/bin/java results.json graph=cross,size=512m,churn=64m -- -Xmx2g -Xgcthreads8
+#
+# With startup as the first argument the startup workload is run under each policy for each of a list of maximum
+# heap sizes instead, reporting the time to the first allocation:
+#
+#   run_benchtests.sh startup <java> <results file> [-Xmx values] [-- extra JVM options]
+#
+# e.g. run_benchtests.sh startup jdk/bin/java startup.json 1g 32g 512g -- -Xgcthreads8
+#
+# With a threaded workload (intern) as the first argument that workload is run under each policy for each of a list of
+# thread counts instead (1 to 64 by default):
+#
+#   run_benchtests.sh intern <java> <results file> [thread counts] [-- [benchtests options] [-- extra JVM options]]
+#
+# e.g. run_benchtests.sh intern jdk/bin/java intern.json 1 8 64 -- names=256k -- -Xmx1g
+#
+# With allocate as the first argument the allocate workload is run under each policy without and then with
+# -Xgc:allocationProfile, reported as the variants baseline and allocationProfile, so that the difference in the
+# allocation rate is the overhead of the allocation profile:
+#
+#   run_benchtests.sh allocate <java> <results file> [benchtests options] [-- extra JVM options]
+#
+# e.g. run_benchtests.sh allocate jdk/bin/java allocate.json objects=4m -- -Xmx1g
+#
+# With dedup as the first argument the dedup workload is run under the policies which support String deduplication
+# without and then with -XXgc:enableStringDeduplication, reported as the variants baseline and stringDeduplication,
+# comparing the pause times and the live size once the Strings have been deduplicated:
+#
+#   run_benchtests.sh dedup <java> <results file> [benchtests options] [-- extra JVM options]
+#
+# e.g. run_benchtests.sh dedup jdk/bin/java dedup.json names=256k,copies=8 -- -Xmx2g
+#
+# With heapdump as the first argument the heapdump workload is run under each policy for each of a list of heap dump
+# options (PHD, PHD+PARALLEL and PHD+FORK by default), reported as the variant, comparing how long each stops the
+# application:
+#
+#   run_benchtests.sh heapdump <java> <results file> [dump options] [-- [benchtests options] [-- extra JVM options]]
+#
+# e.g. run_benchtests.sh heapdump jdk/bin/java heapdump.json PHD PHD+PARALLEL+GZIP -- size=4g,iterations=5 -- -Xmx8g
+
+POLICIES="gencon optthruput optavgpause balanced metronome"
+
+if [ "$1" = "intern" ]; then
+	WORKLOAD=$1
+	shift
+	if [ $# -lt 2 ]; then
+		echo "usage: $0 $WORKLOAD <java> <results file> [thread counts] [-- [benchtests options] [-- extra JVM options]]" >&2
+		exit 1
+	fi
+	JAVA=$1
+	RESULTS=$2
+	shift 2
+	COUNTS=
+	while [ $# -gt 0 ] && [ "$1" != "--" ]; do
+		COUNTS="$COUNTS $1"
+		shift
+	done
+	if [ "$1" = "--" ]; then
+		shift
+	fi
+	OPTIONS=
+	if [ $# -gt 0 ] && [ "$1" != "--" ]; then
+		OPTIONS="$1,"
+		shift
+	fi
+	if [ "$1" = "--" ]; then
+		shift
+	fi
+	if [ -z "$COUNTS" ]; then
+		COUNTS="1 2 4 8 16 32 64"
+	fi
+
+	STATUS=0
+	for POLICY in $POLICIES; do
+		for COUNT in $COUNTS; do
+			echo "benchtests: -Xgcpolicy:$POLICY $WORKLOAD threads=$COUNT"
+			if ! "$JAVA" -Xgcpolicy:$POLICY "$@" "-Xrunbenchtests:workload=$WORKLOAD,threads=$COUNT,${OPTIONS}output=$RESULTS" -version; then
+				echo "benchtests: -Xgcpolicy:$POLICY $WORKLOAD threads=$COUNT failed" >&2
+				STATUS=1
+			fi
+		done
+	done
+	exit $STATUS
+fi
+
+if [ "$1" = "allocate" ]; then
+	shift
+	if [ $# -lt 2 ]; then
+		echo "usage: $0 allocate <java> <results file> [benchtests options] [-- extra JVM options]" >&2
+		exit 1
+	fi
+	JAVA=$1
+	RESULTS=$2
+	shift 2
+	OPTIONS=
+	if [ $# -gt 0 ] && [ "$1" != "--" ]; then
+		OPTIONS="$1,"
+		shift
+	fi
+	if [ "$1" = "--" ]; then
+		shift
+	fi
+
+	STATUS=0
+	for POLICY in $POLICIES; do
+		echo "benchtests: -Xgcpolicy:$POLICY allocate"
+		if ! "$JAVA" -Xgcpolicy:$POLICY "$@" "-Xrunbenchtests:workload=allocate,variant=baseline,${OPTIONS}output=$RESULTS" -version; then
+			echo "benchtests: -Xgcpolicy:$POLICY allocate failed" >&2
+			STATUS=1
+		fi
+		echo "benchtests: -Xgcpolicy:$POLICY -Xgc:allocationProfile allocate"
+		if ! "$JAVA" -Xgcpolicy:$POLICY -Xgc:allocationProfile "$@" "-Xrunbenchtests:workload=allocate,variant=allocationProfile,${OPTIONS}output=$RESULTS" -version; then
+			echo "benchtests: -Xgcpolicy:$POLICY -Xgc:allocationProfile allocate failed" >&2
+			STATUS=1
+		fi
+	done
+	exit $STATUS
+fi
+
+if [ "$1" = "heapdump" ]; then
+	shift
+	if [ $# -lt 2 ]; then
+		echo "usage: $0 heapdump <java> <results file> [dump options] [-- [benchtests options] [-- extra JVM options]]" >&2
+		exit 1
+	fi
+	JAVA=$1
+	RESULTS=$2
+	shift 2
+	DUMPOPTS=
+	while [ $# -gt 0 ] && [ "$1" != "--" ]; do
+		DUMPOPTS="$DUMPOPTS $1"
+		shift
+	done
+	if [ "$1" = "--" ]; then
+		shift
+	fi
+	OPTIONS=
+	if [ $# -gt 0 ] && [ "$1" != "--" ]; then
+		OPTIONS="$1,"
+		shift
+	fi
+	if [ "$1" = "--" ]; then
+		shift
+	fi
+	if [ -z "$DUMPOPTS" ]; then
+		DUMPOPTS="PHD PHD+PARALLEL PHD+FORK"
+	fi
+
+	STATUS=0
+	for POLICY in $POLICIES; do
+		for DUMPOPT in $DUMPOPTS; do
+			echo "benchtests: -Xgcpolicy:$POLICY heapdump dumpopts=$DUMPOPT"
+			if ! "$JAVA" -Xgcpolicy:$POLICY "$@" "-Xrunbenchtests:workload=heapdump,dumpopts=$DUMPOPT,variant=$DUMPOPT,${OPTIONS}output=$RESULTS" -version; then
+				echo "benchtests: -Xgcpolicy:$POLICY heapdump dumpopts=$DUMPOPT failed" >&2
+				STATUS=1
+			fi
+		done
+	done
+	exit $STATUS
+fi
+
+if [ "$1" = "dedup" ]; then
+	shift
+	if [ $# -lt 2 ]; then
+		echo "usage: $0 dedup <java> <results file> [benchtests options] [-- extra JVM options]" >&2
+		exit 1
+	fi
+	JAVA=$1
+	RESULTS=$2
+	shift 2
+	OPTIONS=
+	if [ $# -gt 0 ] && [ "$1" != "--" ]; then
+		OPTIONS="$1,"
+		shift
+	fi
+	if [ "$1" = "--" ]; then
+		shift
+	fi
+
+	STATUS=0
+	for POLICY in gencon balanced; do
+		echo "benchtests: -Xgcpolicy:$POLICY dedup"
+		if ! "$JAVA" -Xgcpolicy:$POLICY "$@" "-Xrunbenchtests:workload=dedup,variant=baseline,${OPTIONS}output=$RESULTS" -version; then
+			echo "benchtests: -Xgcpolicy:$POLICY dedup failed" >&2
+			STATUS=1
+		fi
+		echo "benchtests: -Xgcpolicy:$POLICY -XXgc:enableStringDeduplication dedup"
+		if ! "$JAVA" -Xgcpolicy:$POLICY -XXgc:enableStringDeduplication "$@" "-Xrunbenchtests:workload=dedup,variant=stringDeduplication,${OPTIONS}output=$RESULTS" -version; then
+			echo "benchtests: -Xgcpolicy:$POLICY -XXgc:enableStringDeduplication dedup failed" >&2
+			STATUS=1
+		fi
+	done
+	exit $STATUS
+fi
+
+if [ "$1" = "startup" ]; then
+	shift
+	if [ $# -lt 2 ]; then
+		echo "usage: $0 startup <java> <results file> [-Xmx values] [-- extra JVM options]" >&2
+		exit 1
+	fi
+	JAVA=$1
+	RESULTS=$2
+	shift 2
+	SIZES=
+	while [ $# -gt 0 ] && [ "$1" != "--" ]; do
+		SIZES="$SIZES $1"
+		shift
+	done
+	if [ "$1" = "--" ]; then
+		shift
+	fi
+	if [ -z "$SIZES" ]; then
+		SIZES="1g 8g 64g 512g"
+	fi
+
+	STATUS=0
+	for POLICY in $POLICIES; do
+		for SIZE in $SIZES; do
+			echo "benchtests: -Xgcpolicy:$POLICY -Xmx$SIZE"
+			# milliseconds since the epoch, as j9time_current_time_millis() counts them
+			START=$(date +%s%3N)
+			if ! "$JAVA" -Xgcpolicy:$POLICY -Xmx$SIZE "$@" "-Xrunbenchtests:workload=startup,start=$START,output=$RESULTS" -version; then
+				echo "benchtests: -Xgcpolicy:$POLICY -Xmx$SIZE failed" >&2
+				STATUS=1
+			fi
+		done
+	done
+	exit $STATUS
+fi
+
+if [ $# -lt 2 ]; then
+	echo "usage: $0 <java> <results file> [benchtests options] [-- extra JVM options]" >&2
+	exit 1
+fi
+
+JAVA=$1
+RESULTS=$2
+shift 2
+OPTIONS=
+if [ $# -gt 0 ] && [ "$1" != "--" ]; then
+	OPTIONS="$1,"
+	shift
+fi
+if [ "$1" = "--" ]; then
+	shift
+fi
+
+STATUS=0
+for POLICY in $POLICIES; do
+	echo "benchtests: -Xgcpolicy:$POLICY"
+	if ! "$JAVA" -Xgcpolicy:$POLICY "$@" "-Xrunbenchtests:${OPTIONS}output=$RESULTS" -version; then
+		echo "benchtests: -Xgcpolicy:$POLICY failed" >&2
+		STATUS=1
+	fi
+done
+exit $STATUS
@@ -51,6 +51,9 @@
 #include "TgcFreelist.hpp"
 #include "TgcExcessivegc.hpp"
 #include "TgcHeap.hpp"
+#if defined(J9VM_GC_REALTIME)
+#include "TgcUtilization.hpp"
+#endif /* J9VM_GC_REALTIME */
 #if defined(J9VM_GC_MODRON_STANDARD)
 #include "TgcFreeListSummary.hpp"
 #include "TgcLargeAllocation.hpp"
@@ -272,6 +275,11 @@ tgcParseArgs(J9JavaVM *javaVM, char *optArg)
 			continue;
 		}
 
+		if (try_scan(&scan_start, "utilization")) {
+			tgcExtensions->_utilizationRequested = true;
+			continue;
+		}
+
 		/* Couldn't find a match for arguments */
 		scan_failed(PORTLIB, "GC", error_scan);
 		return false;
@@ -428,6 +436,15 @@ tgcInitializeRequestedOptions(J9JavaVM *javaVM)
 #endif /* J9VM_GC_VLHGC */
 	}
 
+	/* Metronome only options */
+	if (extensions->isMetronomeGC()) {
+#if defined(J9VM_GC_REALTIME)
+		if (tgcExtensions->_utilizationRequested) {
+			result = result && tgcUtilizationInitialize(javaVM);
+		}
+#endif /* J9VM_GC_REALTIME */
+	}
+
 
 #endif /* defined(J9VM_GC_MODRON_STANDARD) || defined(J9VM_GC_VLHGC)  || defined(J9VM_GC_SEGREGATED_HEAP) */
 
@@ -27,6 +27,9 @@
 #include "mmhook.h"
 
 #include "EnvironmentBase.hpp"
+#if defined(J9VM_GC_VLHGC)
+#include "EnvironmentVLHGC.hpp"
+#endif /* J9VM_GC_VLHGC */
 #include "GCExtensions.hpp"
 #include "VMThreadListIterator.hpp"
 #include "TLHAllocationInterface.hpp"
@@ -60,6 +63,40 @@ tgcAllocationPrintStats(OMR_VMThread* omrVMThread)
 	tgcExtensions->printf("Normal Allocated Bytes:        %12zu\n", allocStats->_allocationBytes);
 }
 
+#if defined(J9VM_GC_VLHGC)
+static void
+tgcAllocationPrintThreadTLHStats(OMR_VMThread* omrVMThread)
+{
+	J9VMThread *currentThread = (J9VMThread *)omrVMThread->_language_vmthread;
+	MM_GCExtensions *ext = MM_GCExtensions::getExtensions(omrVMThread);
+	MM_TgcExtensions *tgcExtensions = MM_TgcExtensions::getExtensions(ext);
+
+	tgcExtensions->printf("---------- Thread TLH Statistics ----------\n");
+	tgcExtensions->printf("              thread   refreshes  refreshes(total)       waste  waste(total) refreshSize\n");
+	GC_VMThreadListIterator threadIterator(currentThread);
+	J9VMThread *walkThread = NULL;
+	while (NULL != (walkThread = threadIterator.nextVMThread())) {
+		MM_TLHSizingStats *sizingStats = &MM_EnvironmentVLHGC::getEnvironment(walkThread)->_tlhSizingStats;
+		if (0 != sizingStats->_refreshCountTotal) {
+			tgcExtensions->printf("%20p %11zu %17zu %11zu %13zu %11zu\n",
+				walkThread,
+				sizingStats->_refreshCount,
+				sizingStats->_refreshCountTotal,
+				sizingStats->_wastedBytes,
+				sizingStats->_wastedBytesTotal,
+				sizingStats->_refreshSize);
+		}
+	}
+}
+
+static void
+tgcHookAllocationIncrementPrintStats(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	MM_TarokIncrementStartEvent* event = (MM_TarokIncrementStartEvent*)eventData;
+	tgcAllocationPrintThreadTLHStats(event->currentThread);
+}
+#endif /* J9VM_GC_VLHGC */
+
 static void
 tgcHookAllocationGlobalPrintStats(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
 {
@@ -83,6 +120,13 @@ tgcAllocationInitialize(J9JavaVM *javaVM)
 	J9HookInterface** omrHooks = J9_HOOK_INTERFACE(extensions->omrHookInterface);
 	(*omrHooks)->J9HookRegisterWithCallSite(omrHooks, J9HOOK_MM_OMR_GLOBAL_GC_START, tgcHookAllocationGlobalPrintStats, OMR_GET_CALLSITE(), NULL);
 	(*omrHooks)->J9HookRegisterWithCallSite(omrHooks, J9HOOK_MM_OMR_LOCAL_GC_START, tgcHookAllocationLocalPrintStats, OMR_GET_CALLSITE(), NULL);
+#if defined(J9VM_GC_VLHGC)
+	if (extensions->isVLHGC()) {
+		/* balanced collections are reported as increments, each one beginning while the mutator TLH history is intact */
+		J9HookInterface** privateHooks = J9_HOOK_INTERFACE(extensions->privateHookInterface);
+		(*privateHooks)->J9HookRegisterWithCallSite(privateHooks, J9HOOK_MM_PRIVATE_TAROK_INCREMENT_START, tgcHookAllocationIncrementPrintStats, OMR_GET_CALLSITE(), NULL);
+	}
+#endif /* J9VM_GC_VLHGC */
 
 	return result;
 }
@@ -63,6 +63,24 @@ tgcHookCopyForwardEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, v
 			);
 		}
 	}
+
+	/* report the cache-miss sensitive phases: split pointer array scanning and prefetch effectiveness */
+	PORT_ACCESS_FROM_VMC(vmThread);
+	tgcExtensions->printf("CFPF:     units     slots  arrPrefetch  mixPrefetch   time(us)\n");
+	threadIterator.reset();
+	while ((walkThread = threadIterator.nextVMThread()) != NULL) {
+		MM_EnvironmentVLHGC *env = MM_EnvironmentVLHGC::getEnvironment(walkThread);
+		if ((walkThread == vmThread) || (env->getThreadType() == GC_SLAVE_THREAD)) {
+			tgcExtensions->printf("%4zu:   %7zu   %7zu      %7zu      %7zu    %7llu\n",
+				env->getSlaveID(),
+				env->_copyForwardStats._splitArrayUnitsScanned,
+				env->_copyForwardStats._splitArraySlotsScanned,
+				env->_copyForwardStats._splitArraySlotsPrefetched,
+				env->_copyForwardStats._mixedObjectSlotsPrefetched,
+				j9time_hires_delta(0, env->_copyForwardStats._splitArrayScanTime, J9PORT_TIME_DELTA_IN_MICROSECONDS)
+			);
+		}
+	}
 }
 
 /****************************************
@@ -126,6 +126,7 @@ public:
 	bool _copyForwardRequested; /**< true if "copyForward" option is parsed */
 	bool _interRegionReferencesRequested; /**< true if "interRegionReferences" option is parsed */
 	bool _sizeClassesRequested; /**< true if "sizeClasses" option is parsed */
+	bool _utilizationRequested; /**< true if "utilization" option is parsed */
 
 	TgcBacktraceExtensions _backtrace;
 	TgcDumpExtensions _dump;
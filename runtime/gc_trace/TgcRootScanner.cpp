@@ -30,7 +30,11 @@
 #include "TgcExtensions.hpp"
 #include "VMThreadListIterator.hpp"
 
+/* The number of most expensive thread stacks listed for each collection */
+#define TGC_ROOT_SCANNER_TOP_STACKS 10
+
 static void printRootScannerStats(OMR_VMThread *omrVMThread);
+static void printThreadStackStats(J9VMThread *currentThread);
 static void tgcHookGCEnd(J9HookInterface** hook, UDATA eventNumber, void* eventData, void* userData);
 
 /**
@@ -144,6 +148,8 @@ printRootScannerStats(OMR_VMThread *omrVMThread)
 			}
 		}
 
+		printThreadStackStats(currentThread);
+
 		/* Print totals for each root scanner entity */
 		tgcExtensions->printf("\t<total");
 		for (UDATA entityIndex = 1; entityIndex < RootScannerEntity_Count; entityIndex++) {
@@ -162,6 +168,76 @@ printRootScannerStats(OMR_VMThread *omrVMThread)
 	}
 }
 
+/**
+ * Print the cost of scanning thread stacks (charged to the thread owning the stack rather than to the
+ * GC thread scanning it), listing the most expensive stacks, and clear the per-thread stack statistics.
+ */
+static void
+printThreadStackStats(J9VMThread *currentThread)
+{
+	PORT_ACCESS_FROM_JAVAVM(currentThread->javaVM);
+	MM_TgcExtensions *tgcExtensions = MM_TgcExtensions::getExtensions(currentThread);
+	J9VMThread *topThreads[TGC_ROOT_SCANNER_TOP_STACKS];
+	U_64 topTimes[TGC_ROOT_SCANNER_TOP_STACKS];
+	UDATA topUnits[TGC_ROOT_SCANNER_TOP_STACKS];
+	UDATA topCount = 0;
+	UDATA scannedCount = 0;
+	UDATA skippedCount = 0;
+	UDATA splitCount = 0;
+	UDATA unitCount = 0;
+	J9VMThread *thread = NULL;
+
+	GC_VMThreadListIterator threadIterator(currentThread);
+	while (NULL != (thread = threadIterator.nextVMThread())) {
+		GC_Environment *gcEnv = MM_EnvironmentBase::getEnvironment(thread->omrVMThread)->getGCEnvironment();
+		U_64 scanTime = gcEnv->_stackScanTime;
+
+		if ((0 != scanTime) || (0 != gcEnv->_stackScanUnits)) {
+			scannedCount += 1;
+			unitCount += gcEnv->_stackScanUnits;
+
+			/* Insertion into the list of most expensive stacks, kept in descending order of scan time */
+			UDATA slot = topCount;
+			while ((0 < slot) && (topTimes[slot - 1] < scanTime)) {
+				if (slot < TGC_ROOT_SCANNER_TOP_STACKS) {
+					topThreads[slot] = topThreads[slot - 1];
+					topTimes[slot] = topTimes[slot - 1];
+					topUnits[slot] = topUnits[slot - 1];
+				}
+				slot -= 1;
+			}
+			if (slot < TGC_ROOT_SCANNER_TOP_STACKS) {
+				topThreads[slot] = thread;
+				topTimes[slot] = scanTime;
+				topUnits[slot] = gcEnv->_stackScanUnits;
+				if (topCount < TGC_ROOT_SCANNER_TOP_STACKS) {
+					topCount += 1;
+				}
+			}
+		}
+		skippedCount += gcEnv->_stackScanSkips;
+		splitCount += gcEnv->_stackScanSplits;
+
+		gcEnv->_stackScanTime = 0;
+		gcEnv->_stackScanUnits = 0;
+		gcEnv->_stackScanSkips = 0;
+		gcEnv->_stackScanSplits = 0;
+	}
+
+	if ((0 != scannedCount) || (0 != skippedCount)) {
+		tgcExtensions->printf("\t<stacks scanned=\"%zu\" skipped=\"%zu\" split=\"%zu\" units=\"%zu\">\n", scannedCount, skippedCount, splitCount, unitCount);
+		for (UDATA i = 0; i < topCount; i++) {
+			U_64 scanTime = j9time_hires_delta(0, topTimes[i], J9PORT_TIME_DELTA_IN_MICROSECONDS);
+			tgcExtensions->printf("\t\t<stack thread=\"%p\" time=\"%llu.%03.3llu\" units=\"%zu\"/>\n",
+					topThreads[i],
+					scanTime / 1000,
+					scanTime % 1000,
+					topUnits[i]);
+		}
+		tgcExtensions->printf("\t</stacks>\n");
+	}
+}
+
 static void
 tgcHookGCEnd(J9HookInterface** hook, UDATA eventNumber, void* eventData, void* userData)
 {
@@ -0,0 +1,93 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "j9.h"
+#include "j9cfg.h"
+#include "j9port.h"
+#include "modronopt.h"
+#include "mmhook.h"
+
+#include "TgcUtilization.hpp"
+
+#if defined(J9VM_GC_REALTIME)
+
+#include "GCExtensions.hpp"
+#include "TgcExtensions.hpp"
+
+/**
+ * Report a single time slice charged by the Metronome utilization tracker.
+ */
+static void
+tgcHookUtilizationSlice(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	MM_MetronomeUtilizationSliceEvent* event = (MM_MetronomeUtilizationSliceEvent*)eventData;
+	J9VMThread* vmThread = event->currentThread;
+	MM_TgcExtensions *tgcExtensions = MM_TgcExtensions::getExtensions(vmThread);
+	PORT_ACCESS_FROM_VMC(vmThread);
+
+	U_64 timeMicros = j9time_hires_delta(0, event->timestamp, J9PORT_TIME_DELTA_IN_MICROSECONDS);
+	U_64 durationMicros = event->sliceDuration / 1000;
+	U_64 beatMicros = event->beatNanos / 1000;
+
+	tgcExtensions->printf("Utilization: time(us)=\"%llu\", slice=\"%s\", duration(us)=\"%llu\", utilization=\"%zu.%02zu%%\", target=\"%zu.%02zu%%\", beat(us)=\"%llu\"\n",
+		timeMicros,
+		(0 != event->isMutator) ? "mutator" : "gc",
+		durationMicros,
+		event->currentUtilization / 100, event->currentUtilization % 100,
+		event->targetUtilization / 100, event->targetUtilization % 100,
+		beatMicros);
+}
+
+/**
+ * Report, per cause, the largest amount by which a GC quantum was overrun during the cycle which just ended.
+ */
+static void
+tgcHookQuantumOvershoot(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	MM_MetronomeQuantumOvershootEvent* event = (MM_MetronomeQuantumOvershootEvent*)eventData;
+	J9VMThread* vmThread = event->currentThread;
+	MM_TgcExtensions *tgcExtensions = MM_TgcExtensions::getExtensions(vmThread);
+
+	tgcExtensions->printf("Quantum overshoot(us): roots=\"%llu\", stacks=\"%llu\", trace=\"%llu\", overflow=\"%llu\", unloading=\"%llu\", sweep=\"%llu\", other=\"%llu\"\n",
+		event->rootOvershoot / 1000,
+		event->stackOvershoot / 1000,
+		event->traceOvershoot / 1000,
+		event->overflowOvershoot / 1000,
+		event->unloadingOvershoot / 1000,
+		event->sweepOvershoot / 1000,
+		event->otherOvershoot / 1000);
+}
+
+bool
+tgcUtilizationInitialize(J9JavaVM *javaVM)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(javaVM);
+	bool result = true;
+
+	J9HookInterface** mmHooks = J9_HOOK_INTERFACE(extensions->hookInterface);
+	(*mmHooks)->J9HookRegisterWithCallSite(mmHooks, J9HOOK_MM_METRONOME_UTILIZATION_SLICE, tgcHookUtilizationSlice, OMR_GET_CALLSITE(), NULL);
+	(*mmHooks)->J9HookRegisterWithCallSite(mmHooks, J9HOOK_MM_METRONOME_QUANTUM_OVERSHOOT, tgcHookQuantumOvershoot, OMR_GET_CALLSITE(), NULL);
+
+	return result;
+}
+
+#endif /* J9VM_GC_REALTIME */
@@ -110,6 +110,9 @@ MM_VerboseHandlerOutputRealtime::enableVerbose()
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_OUT_OF_MEMORY, verboseHandlerOutOFMemory, OMR_GET_CALLSITE(), (void *)this);
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_UTILIZATION_TRACKER_OVERFLOW, verboseHandlerUtilTrackerOverflow, OMR_GET_CALLSITE(), (void *)this);
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_NON_MONOTONIC_TIME, verboseHandlerNonMonotonicTime, OMR_GET_CALLSITE(), (void *)this);
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+	(*_mmHooks)->J9HookRegisterWithCallSite(_mmHooks, J9HOOK_MM_IDLE_PAGE_RELEASE, verboseHandlerIdlePageRelease, OMR_GET_CALLSITE(), (void *)this);
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
 }
 
 void
@@ -146,6 +149,9 @@ MM_VerboseHandlerOutputRealtime::disableVerbose()
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_OUT_OF_MEMORY, verboseHandlerOutOFMemory, NULL);
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_UTILIZATION_TRACKER_OVERFLOW, verboseHandlerUtilTrackerOverflow, NULL);
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_NON_MONOTONIC_TIME, verboseHandlerNonMonotonicTime, NULL);
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+	(*_mmHooks)->J9HookUnregister(_mmHooks, J9HOOK_MM_IDLE_PAGE_RELEASE, verboseHandlerIdlePageRelease, NULL);
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
 }
 
 bool
@@ -634,3 +640,16 @@ MM_VerboseHandlerOutputRealtime::handleEvent(MM_NonMonotonicTimeEvent* eventData
 	writer->flush(env);
 	exitAtomicReportingBlock();
 }
+
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+void
+MM_VerboseHandlerOutputRealtime::handleEvent(MM_IdlePageReleaseEvent* eventData)
+{
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(eventData->currentThread->omrVMThread);
+
+	enterAtomicReportingBlock();
+	MM_VerboseHandlerJava::outputIdlePageRelease(_manager, env, eventData);
+	_manager->getWriterChain()->flush(env);
+	exitAtomicReportingBlock();
+}
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
@@ -274,6 +274,9 @@ public:
 	void handleEvent(MM_OutOfMemoryEvent* eventData);
 	void handleEvent(MM_UtilizationTrackerOverflowEvent* eventData);
 	void handleEvent(MM_NonMonotonicTimeEvent* eventData);
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+	void handleEvent(MM_IdlePageReleaseEvent* eventData);
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
 
 	void writeHeartbeatData(MM_EnvironmentBase* env, U_64 timestamp);
 	void writeHeartbeatDataAndResetHeartbeatStats(MM_EnvironmentBase* env, U_64 timestamp);
@@ -161,3 +161,12 @@ void verboseHandlerNonMonotonicTime(J9HookInterface** hook, UDATA eventNum, void
 	MM_VerboseHandlerOutputRealtime* handler = (MM_VerboseHandlerOutputRealtime*)userData;
 	handler->handleEvent(event);
 }
+
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+void verboseHandlerIdlePageRelease(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	MM_IdlePageReleaseEvent* event = (MM_IdlePageReleaseEvent*) eventData;
+	MM_VerboseHandlerOutputRealtime* handler = (MM_VerboseHandlerOutputRealtime*)userData;
+	handler->handleEvent(event);
+}
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
@@ -61,4 +61,8 @@ void verboseHandlerUtilTrackerOverflow(J9HookInterface** hook, UDATA eventNum, v
 
 void verboseHandlerNonMonotonicTime(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+void verboseHandlerIdlePageRelease(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
+
 #endif /* VERBOSEHANDLERREALTIME_HPP_ */
@@ -26,6 +26,7 @@
 #include "mmhook.h"
 #include "gcutils.h"
 
+#include "ClassLoaderManager.hpp"
 #include "CollectionStatisticsStandard.hpp"
 #include "ConcurrentGCStats.hpp"
 #include "CycleState.hpp"
@@ -41,6 +42,12 @@
 static void verboseHandlerClassUnloadingEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 #endif /* defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
 static void verboseHandlerSlowExclusive(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData);
+#if defined(J9VM_GC_CONCURRENT_SWEEP)
+static void verboseHandlerConcurrentSweepSummary(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData);
+#endif /* defined(J9VM_GC_CONCURRENT_SWEEP) */
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+static void verboseHandlerIdlePageRelease(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData);
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
 
 MM_VerboseHandlerOutput *
 MM_VerboseHandlerOutputStandardJava::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager)
@@ -79,6 +86,7 @@ void
 MM_VerboseHandlerOutputStandardJava::outputMemoryInfoInnerStanzaInternal(MM_EnvironmentBase *env, UDATA indent, MM_CollectionStatistics *statsBase)
 {
 	MM_VerboseHandlerJava::outputFinalizableInfo(_manager, env, indent);
+	MM_VerboseHandlerJava::outputStringDeduplicationInfo(_manager, env, indent);
 }
 
 void
@@ -90,6 +98,12 @@ MM_VerboseHandlerOutputStandardJava::enableVerbose()
 	(*_mmHooks)->J9HookRegisterWithCallSite(_mmHooks, J9HOOK_MM_CLASS_UNLOADING_END, verboseHandlerClassUnloadingEnd, OMR_GET_CALLSITE(), (void *)this);
 #endif /* defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
 	(*_vmHooks)->J9HookRegisterWithCallSite(_vmHooks, J9HOOK_VM_SLOW_EXCLUSIVE, verboseHandlerSlowExclusive, OMR_GET_CALLSITE(), (void *)this);
+#if defined(J9VM_GC_CONCURRENT_SWEEP)
+	(*_mmHooks)->J9HookRegisterWithCallSite(_mmHooks, J9HOOK_MM_CONCURRENT_SWEEP_SUMMARY, verboseHandlerConcurrentSweepSummary, OMR_GET_CALLSITE(), (void *)this);
+#endif /* defined(J9VM_GC_CONCURRENT_SWEEP) */
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+	(*_mmHooks)->J9HookRegisterWithCallSite(_mmHooks, J9HOOK_MM_IDLE_PAGE_RELEASE, verboseHandlerIdlePageRelease, OMR_GET_CALLSITE(), (void *)this);
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
 
 }
 
@@ -102,6 +116,12 @@ MM_VerboseHandlerOutputStandardJava::disableVerbose()
 	(*_mmHooks)->J9HookUnregister(_mmHooks, J9HOOK_MM_CLASS_UNLOADING_END, verboseHandlerClassUnloadingEnd, NULL);
 #endif /* defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
 	(*_vmHooks)->J9HookUnregister(_vmHooks, J9HOOK_VM_SLOW_EXCLUSIVE, verboseHandlerSlowExclusive, NULL);
+#if defined(J9VM_GC_CONCURRENT_SWEEP)
+	(*_mmHooks)->J9HookUnregister(_mmHooks, J9HOOK_MM_CONCURRENT_SWEEP_SUMMARY, verboseHandlerConcurrentSweepSummary, NULL);
+#endif /* defined(J9VM_GC_CONCURRENT_SWEEP) */
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+	(*_mmHooks)->J9HookUnregister(_mmHooks, J9HOOK_MM_IDLE_PAGE_RELEASE, verboseHandlerIdlePageRelease, NULL);
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
 
 }
 
@@ -188,6 +208,38 @@ MM_VerboseHandlerOutputStandardJava::handleSlowExclusive(J9HookInterface **hook,
 
 }
 
+#if defined(J9VM_GC_CONCURRENT_SWEEP)
+void
+MM_VerboseHandlerOutputStandardJava::handleConcurrentSweepSummary(J9HookInterface **hook, UDATA eventNum, void *eventData)
+{
+	MM_ConcurrentSweepSummaryEvent *event = (MM_ConcurrentSweepSummaryEvent *)eventData;
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->currentThread->omrVMThread);
+	MM_VerboseWriterChain *writer = getManager()->getWriterChain();
+
+	enterAtomicReportingBlock();
+	writer->formatAndOutput(env, 0, "<concurrent-sweep lazyrequests=\"%zu\" lazysatisfied=\"%zu\" lazybytes=\"%zu\" lazytimems=\"%llu.%03.3llu\" concurrentrequests=\"%zu\" concurrentbytes=\"%zu\" concurrenttimems=\"%llu.%03.3llu\" pausebytes=\"%zu\" pausetimems=\"%llu.%03.3llu\" />",
+		event->lazyRequests, event->lazySatisfied, event->lazyBytes, event->lazyTime / 1000, event->lazyTime % 1000,
+		event->concurrentRequests, event->concurrentBytes, event->concurrentTime / 1000, event->concurrentTime % 1000,
+		event->pauseBytes, event->pauseTime / 1000, event->pauseTime % 1000);
+	writer->flush(env);
+	exitAtomicReportingBlock();
+}
+#endif /* defined(J9VM_GC_CONCURRENT_SWEEP) */
+
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+void
+MM_VerboseHandlerOutputStandardJava::handleIdlePageRelease(J9HookInterface **hook, UDATA eventNum, void *eventData)
+{
+	MM_IdlePageReleaseEvent *event = (MM_IdlePageReleaseEvent *)eventData;
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->currentThread->omrVMThread);
+
+	enterAtomicReportingBlock();
+	MM_VerboseHandlerJava::outputIdlePageRelease(_manager, env, event);
+	_manager->getWriterChain()->flush(env);
+	exitAtomicReportingBlock();
+}
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
+
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 void
 MM_VerboseHandlerOutputStandardJava::handleClassUnloadEnd(J9HookInterface** hook, UDATA eventNum, void* eventData)
@@ -220,6 +272,15 @@ MM_VerboseHandlerOutputStandardJava::handleClassUnloadEnd(J9HookInterface** hook
 			scanTime / 1000, scanTime % 1000,
 			postTime / 1000, postTime % 1000);
 
+	MM_ClassUnloadPhaseStats *phaseStats = extensions->classLoaderManager->getUnloadPhaseStats();
+	writer->formatAndOutput(
+			env, 1,
+			"<classunload-phases threads=\"%zu\" segments=\"%zu\" identifyms=\"%llu.%03.3llu\" unlinkms=\"%llu.%03.3llu\" hooksms=\"%llu.%03.3llu\" />",
+			phaseStats->_threadCount, phaseStats->_segmentsScanned,
+			phaseStats->_identifyTime / 1000, phaseStats->_identifyTime % 1000,
+			phaseStats->_unlinkTime / 1000, phaseStats->_unlinkTime % 1000,
+			phaseStats->_hookTime / 1000, phaseStats->_hookTime % 1000);
+
 	handleGCOPOuterStanzaEnd(env);
 	writer->flush(env);
 	exitAtomicReportingBlock();
@@ -326,3 +387,19 @@ verboseHandlerSlowExclusive(J9HookInterface **hook, UDATA eventNum, void *eventD
 {
 	((MM_VerboseHandlerOutputStandardJava *)userData)->handleSlowExclusive(hook, eventNum, eventData);
 }
+
+#if defined(J9VM_GC_CONCURRENT_SWEEP)
+void
+verboseHandlerConcurrentSweepSummary(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData)
+{
+	((MM_VerboseHandlerOutputStandardJava *)userData)->handleConcurrentSweepSummary(hook, eventNum, eventData);
+}
+#endif /* defined(J9VM_GC_CONCURRENT_SWEEP) */
+
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+void
+verboseHandlerIdlePageRelease(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData)
+{
+	((MM_VerboseHandlerOutputStandardJava *)userData)->handleIdlePageRelease(hook, eventNum, eventData);
+}
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
@@ -116,6 +116,26 @@ public:
 	 * @param eventData hook specific event data.
 	 */
 	void handleSlowExclusive(J9HookInterface **hook, UDATA eventNum, void *eventData);
+
+#if defined(J9VM_GC_CONCURRENT_SWEEP)
+	/**
+	 * Write verbose stanza for a concurrent sweep summary event.
+	 * @param hook Hook interface used by the JVM.
+	 * @param eventNum The hook event number.
+	 * @param eventData hook specific event data.
+	 */
+	void handleConcurrentSweepSummary(J9HookInterface **hook, UDATA eventNum, void *eventData);
+#endif /* defined(J9VM_GC_CONCURRENT_SWEEP) */
+
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+	/**
+	 * Write verbose stanza for an idle page release event.
+	 * @param hook Hook interface used by the JVM.
+	 * @param eventNum The hook event number.
+	 * @param eventData hook specific event data.
+	 */
+	void handleIdlePageRelease(J9HookInterface **hook, UDATA eventNum, void *eventData);
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
 };
 
 #endif /* VERBOSEHANDLEROUTPUTSTANDARDJAVA_HPP_ */
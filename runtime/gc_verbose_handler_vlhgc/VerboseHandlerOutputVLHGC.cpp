@@ -22,6 +22,7 @@
 
 #include "VerboseHandlerOutputVLHGC.hpp"
 
+#include "ClassLoaderManager.hpp"
 #include "CollectionStatisticsVLHGC.hpp"
 #include "ConcurrentPhaseStatsBase.hpp"
 #include "CopyForwardStats.hpp"
@@ -66,6 +67,9 @@ static void verboseHandlerReclaimCompactEnd(J9HookInterface** hook, UDATA eventN
 static void verboseHandlerExcessiveGCRaised(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 static void verboseHandlerAcquiredExclusiveToSatisfyAllocation(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 static void verboseHandlerClassUnloadingEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+static void verboseHandlerIdlePageRelease(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
 
 MM_VerboseHandlerOutput *
 MM_VerboseHandlerOutputVLHGC::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager)
@@ -163,6 +167,10 @@ MM_VerboseHandlerOutputVLHGC::enableVerbose()
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 	(*_mmHooks)->J9HookRegisterWithCallSite(_mmHooks, J9HOOK_MM_CLASS_UNLOADING_END, verboseHandlerClassUnloadingEnd, OMR_GET_CALLSITE(), (void *)this);
 #endif /* defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
+
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+	(*_mmHooks)->J9HookRegisterWithCallSite(_mmHooks, J9HOOK_MM_IDLE_PAGE_RELEASE, verboseHandlerIdlePageRelease, OMR_GET_CALLSITE(), (void *)this);
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
 }
 
 void
@@ -222,6 +230,10 @@ MM_VerboseHandlerOutputVLHGC::disableVerbose()
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 	(*_mmHooks)->J9HookUnregister(_mmHooks, J9HOOK_MM_CLASS_UNLOADING_END, verboseHandlerClassUnloadingEnd, NULL);
 #endif /* defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
+
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+	(*_mmHooks)->J9HookUnregister(_mmHooks, J9HOOK_MM_IDLE_PAGE_RELEASE, verboseHandlerIdlePageRelease, NULL);
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
 }
 
 bool
@@ -350,6 +362,7 @@ MM_VerboseHandlerOutputVLHGC::outputMemoryInfoInnerStanza(MM_EnvironmentBase *en
 	}
 
 	MM_VerboseHandlerJava::outputFinalizableInfo(_manager, env, indent);
+	MM_VerboseHandlerJava::outputStringDeduplicationInfo(_manager, env, indent);
 
 	UDATA rememberedSetFreePercent = (UDATA)((100 * (U_64)stats->_rememberedSetBytesFree) / ((U_64)stats->_rememberedSetBytesTotal));
 
@@ -400,6 +413,10 @@ MM_VerboseHandlerOutputVLHGC::handleCopyForwardEnd(J9HookInterface** hook, UDATA
 				copyForwardStats->_copyObjectsNonEden, copyForwardStats->_copyBytesNonEden, copyForwardStats->_copyDiscardBytesNonEden);
 	writer->formatAndOutput(env, 1, "<memory-cardclean objects=\"%zu\" bytes=\"%zu\" />",
 				copyForwardStats->_objectsCardClean, copyForwardStats->_bytesCardClean);
+	if (0 != copyForwardStats->_pretenuredObjects) {
+		writer->formatAndOutput(env, 1, "<memory-pretenured objects=\"%zu\" bytes=\"%zu\" copybytessaved=\"%zu\" />",
+					copyForwardStats->_pretenuredObjects, copyForwardStats->_pretenuredBytes, copyForwardStats->_pretenureCopyBytesSaved);
+	}
 	if(copyForwardStats->_aborted || (0 != copyForwardStats->_nonEvacuateRegionCount)) {
 		writer->formatAndOutput(env, 1, "<memory-traced type=\"eden\" objects=\"%zu\" bytes=\"%zu\" />",
 					copyForwardStats->_scanObjectsEden, copyForwardStats->_scanBytesEden);
@@ -675,6 +692,20 @@ MM_VerboseHandlerOutputVLHGC::handleReclaimCompactEnd(J9HookInterface** hook, UD
 	exitAtomicReportingBlock();
 }
 
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+void
+MM_VerboseHandlerOutputVLHGC::handleIdlePageRelease(J9HookInterface** hook, UDATA eventNum, void* eventData)
+{
+	MM_IdlePageReleaseEvent* event = (MM_IdlePageReleaseEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread->omrVMThread);
+
+	enterAtomicReportingBlock();
+	MM_VerboseHandlerJava::outputIdlePageRelease(_manager, env, event);
+	_manager->getWriterChain()->flush(env);
+	exitAtomicReportingBlock();
+}
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
+
 void
 MM_VerboseHandlerOutputVLHGC::handleClassUnloadEnd(J9HookInterface** hook, UDATA eventNum, void* eventData)
 {
@@ -719,6 +750,17 @@ MM_VerboseHandlerOutputVLHGC::handleClassUnloadEnd(J9HookInterface** hook, UDATA
 			scanTime / 1000, scanTime % 1000,
 			postTime / 1000, postTime % 1000);
 
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+	MM_ClassUnloadPhaseStats *phaseStats = MM_GCExtensions::getExtensions(env)->classLoaderManager->getUnloadPhaseStats();
+	writer->formatAndOutput(
+			env, 1,
+			"<classunload-phases threads=\"%zu\" segments=\"%zu\" identifyms=\"%llu.%03.3llu\" unlinkms=\"%llu.%03.3llu\" hooksms=\"%llu.%03.3llu\" />",
+			phaseStats->_threadCount, phaseStats->_segmentsScanned,
+			phaseStats->_identifyTime / 1000, phaseStats->_identifyTime % 1000,
+			phaseStats->_unlinkTime / 1000, phaseStats->_unlinkTime % 1000,
+			phaseStats->_hookTime / 1000, phaseStats->_hookTime % 1000);
+#endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
+
 	if (!partialTimeSuccess) {
 		writer->formatAndOutput(env, 1, "<warning details=\"clock error detected, previous timing may be inaccurate\" />");
 	}
@@ -945,3 +987,10 @@ void verboseHandlerClassUnloadingEnd(J9HookInterface** hook, UDATA eventNum, voi
 }
 #endif /* defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
 
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+static void
+verboseHandlerIdlePageRelease(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerOutputVLHGC *)userData)->handleIdlePageRelease(hook, eventNum, eventData);
+}
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
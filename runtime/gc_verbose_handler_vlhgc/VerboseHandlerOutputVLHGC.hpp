@@ -252,6 +252,16 @@ public:
 	 */
 	void handleClassUnloadEnd(J9HookInterface** hook, UDATA eventNum, void* eventData);
 
+#if defined(J9VM_GC_IDLE_HEAP_MANAGER)
+	/**
+	 * Write verbose stanza for an idle page release event.
+	 * @param hook Hook interface used by the JVM.
+	 * @param eventNum The hook event number.
+	 * @param eventData hook specific event data.
+	 */
+	void handleIdlePageRelease(J9HookInterface** hook, UDATA eventNum, void* eventData);
+#endif /* defined(J9VM_GC_IDLE_HEAP_MANAGER) */
+
 	virtual void enableVerbose();
 	virtual void disableVerbose();
 
@@ -33,6 +33,7 @@
 #include "VerboseWriterChain.hpp"
 #include "GCExtensions.hpp"
 #include "FinalizeListManager.hpp"
+#include "StringDeduplicator.hpp"
 
 void
 MM_VerboseHandlerJava::outputFinalizableInfo(MM_VerboseManager *manager, MM_EnvironmentBase *env, UDATA indent)
@@ -50,6 +51,28 @@ MM_VerboseHandlerJava::outputFinalizableInfo(MM_VerboseManager *manager, MM_Envi
 	}
 }
 
+void
+MM_VerboseHandlerJava::outputStringDeduplicationInfo(MM_VerboseManager *manager, MM_EnvironmentBase *env, UDATA indent)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env);
+	MM_StringDeduplicator *deduplicator = extensions->stringDeduplicator;
+
+	if (NULL != deduplicator) {
+		/* totals since startup; the deduplication thread updates them in the background */
+		manager->getWriterChain()->formatAndOutput(env, indent, "<string-deduplication candidates=\"%zu\" dropped=\"%zu\" deduplicated=\"%zu\" bytesreclaimed=\"%zu\" tableentries=\"%zu\" tableoverhead=\"%zu\" />",
+			deduplicator->_candidatesQueued, deduplicator->_candidatesDropped + deduplicator->_candidatesDiscarded, deduplicator->_stringsDeduplicated,
+			deduplicator->_bytesDeduplicated, deduplicator->getTableEntryCount(), deduplicator->getTableOverheadBytes());
+	}
+}
+
+void
+MM_VerboseHandlerJava::outputIdlePageRelease(MM_VerboseManager *manager, MM_EnvironmentBase *env, MM_IdlePageReleaseEvent *event)
+{
+	manager->getWriterChain()->formatAndOutput(env, 0, "<idle-page-release bytesreleased=\"%zu\" ranges=\"%zu\" batches=\"%zu\" rssbefore=\"%llu\" rssafter=\"%llu\" durationms=\"%llu.%03.3llu\" interrupted=\"%s\" />",
+		event->bytesReleased, event->rangesReleased, event->batches, event->rssBefore, event->rssAfter,
+		event->duration / 1000, event->duration % 1000, (0 != event->interrupted) ? "true" : "false");
+}
+
 bool
 MM_VerboseHandlerJava::getThreadName(char *buf, UDATA bufLen, OMR_VMThread *omrThread)
 {
@@ -42,6 +42,22 @@ public:
 	 */
 	static void outputFinalizableInfo(MM_VerboseManager *manager, MM_EnvironmentBase *env, UDATA indent);
 
+	/**
+	 * Output String deduplication totals (nothing if deduplication is not enabled).
+	 * @param manager
+	 * @param env GC thread used for output.
+	 * @param indent base level of indentation for the summary.
+	 */
+	static void outputStringDeduplicationInfo(MM_VerboseManager *manager, MM_EnvironmentBase *env, UDATA indent);
+
+	/**
+	 * Output the result of releasing free heap pages on idle, with the process RSS before and after.
+	 * @param manager
+	 * @param env thread used for output.
+	 * @param event the release event.
+	 */
+	static void outputIdlePageRelease(MM_VerboseManager *manager, MM_EnvironmentBase *env, MM_IdlePageReleaseEvent *event);
+
 	/**
 	 * Output the name of the thread into the buffer.
 	 * @return Whether the thread name was truncated.
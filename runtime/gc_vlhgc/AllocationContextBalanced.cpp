@@ -37,6 +37,8 @@
 #include "EnvironmentVLHGC.hpp"
 #include "HeapRegionDescriptorVLHGC.hpp"
 #include "HeapRegionManager.hpp"
+#include "LanguageThreadLocalHeap.hpp"
+#include "Math.hpp"
 #include "MemoryPoolBumpPointer.hpp"
 #include "MemorySubSpaceTarok.hpp"
 #include "ObjectAllocationInterface.hpp"
@@ -187,6 +189,16 @@ MM_AllocationContextBalanced::allocateTLH(MM_EnvironmentBase *env, MM_AllocateDe
 	if (shouldCollectOnFailure && (NULL == result)) {
 		result = _subspace->replenishAllocationContextFailed(env, _subspace, this, objectAllocationInterface, allocateDescription, MM_MemorySubSpace::ALLOCATION_TYPE_TLH);
 	}
+	if (NULL != result) {
+		MM_TLHSizingStats *sizingStats = &MM_EnvironmentVLHGC::getEnvironment(env)->_tlhSizingStats;
+		MM_LanguageThreadLocalHeap languageTLH;
+		/* the pool may hand out less than was asked for (the remainder of a region), so record what the thread got */
+		sizingStats->recordRefresh(languageTLH.getRefreshedBytes(env, result));
+		if (0 != sizingStats->_refreshSize) {
+			/* the thread has been sized at a collection so override the global growth policy for its next refresh */
+			languageTLH.setRefreshSize(env, sizingStats->_refreshSize);
+		}
+	}
 	return result;
 }
 void *
@@ -816,6 +828,94 @@ MM_AllocationContextBalanced::acquireFreeRegionFromContext(MM_EnvironmentBase *e
 	
 }
 
+#if defined(J9VM_GC_ARRAYLETS)
+MM_HeapRegionDescriptorVLHGC *
+MM_AllocationContextBalanced::acquireAdjacentFreeRegionForArrayletLeaf(MM_EnvironmentBase *env, MM_AllocateDescription *allocateDescription)
+{
+	J9IndexableObject *spine = allocateDescription->getSpine();
+	MM_HeapRegionDescriptorVLHGC *spineRegion = (MM_HeapRegionDescriptorVLHGC *)_heapRegionManager->tableDescriptorForAddress(spine);
+	if (this != spineRegion->_allocateData._owningContext) {
+		/* the spine has been moved to the common context since its allocation started, so its leaves are not being allocated by us */
+		return NULL;
+	}
+
+	UDATA regionCount = _heapRegionManager->getTableRegionCount();
+	UDATA targetIndex = _nextArrayletLeafIndex;
+	if (spine == _arrayletLeafSpine) {
+		if (targetIndex >= regionCount) {
+			/* the previous leaf is the last region in the heap */
+			return NULL;
+		}
+	} else {
+		if (targetIndex >= regionCount) {
+			targetIndex = 0;
+		}
+		/* first leaf:  use the next-fit cursor if a run of free regions on our node which can hold all of the leaves starts there */
+		UDATA regionSize = _heapRegionManager->getRegionSize();
+		UDATA leafBytes = allocateDescription->getBytesRequested() - allocateDescription->getContiguousBytes();
+		UDATA leafCount = MM_Math::roundToCeiling(regionSize, leafBytes) / regionSize;
+		UDATA runLength = 0;
+		while ((runLength < leafCount) && ((targetIndex + runLength) < regionCount)) {
+			MM_HeapRegionDescriptorVLHGC *region = (MM_HeapRegionDescriptorVLHGC *)_heapRegionManager->mapRegionTableIndexToDescriptor(targetIndex + runLength);
+			/* unsynchronized read:  a region found to be taken when it is acquired below just ends the run early */
+			MM_HeapRegionDescriptor::RegionType type = region->getRegionType();
+			if (!region->isCommitted()
+				|| ((MM_HeapRegionDescriptor::FREE != type) && (MM_HeapRegionDescriptor::BUMP_ALLOCATED_IDLE != type))
+				|| (getNumaNode() != region->getNumaNode())
+			) {
+				break;
+			}
+			runLength += 1;
+		}
+		if (runLength < leafCount) {
+			/* no room here:  move the cursor past the region which ended the run, so the next arraylet looks further on */
+			_nextArrayletLeafIndex = targetIndex + runLength + 1;
+			return NULL;
+		}
+	}
+
+	return acquireFreeRegionFromNode(env, (MM_HeapRegionDescriptorVLHGC *)_heapRegionManager->mapRegionTableIndexToDescriptor(targetIndex));
+}
+
+MM_HeapRegionDescriptorVLHGC *
+MM_AllocationContextBalanced::acquireFreeRegionFromNode(MM_EnvironmentBase *env, MM_HeapRegionDescriptorVLHGC *region)
+{
+	MM_HeapRegionDescriptorVLHGC *result = NULL;
+	if (getNumaNode() == region->getNumaNode()) {
+		result = acquireFreeRegionFromContext(env, region);
+		MM_AllocationContextBalanced *targetContext = getNextSibling();
+		while ((NULL == result) && (targetContext != this)) {
+			result = targetContext->acquireFreeRegionFromContext(env, region);
+			targetContext = targetContext->getNextSibling();
+		}
+	}
+	return result;
+}
+
+MM_HeapRegionDescriptorVLHGC *
+MM_AllocationContextBalanced::acquireFreeRegionFromContext(MM_EnvironmentBase *env, MM_HeapRegionDescriptorVLHGC *region)
+{
+	MM_HeapRegionDescriptorVLHGC *result = NULL;
+	_freeListLock.acquire();
+	/* a FREE region is in the _freeRegions list and an idle one in the _idleMPBPRegions list of some context on the node:  the list records which */
+	MM_RegionListTarok *list = NULL;
+	if (MM_HeapRegionDescriptor::FREE == region->getRegionType()) {
+		list = &_freeRegions;
+	} else if (MM_HeapRegionDescriptor::BUMP_ALLOCATED_IDLE == region->getRegionType()) {
+		list = &_idleMPBPRegions;
+	}
+	if ((NULL != list) && list->containsRegion(region)) {
+		list->removeRegion(region);
+		if (&_idleMPBPRegions == list) {
+			region->_allocateData.taskAsFreePool(env);
+		}
+		result = region;
+	}
+	_freeListLock.release();
+	return result;
+}
+#endif /* defined(J9VM_GC_ARRAYLETS) */
+
 void
 MM_AllocationContextBalanced::lockCommon()
 {
@@ -941,12 +1041,21 @@ MM_AllocationContextBalanced::lockedReplenishAndAllocate(MM_EnvironmentBase *env
 #if defined(J9VM_GC_ARRAYLETS)
 	if (MM_MemorySubSpace::ALLOCATION_TYPE_LEAF == allocationType) {
 		if (_subspace->consumeFromTaxationThreshold(env, regionSize)) {
-			/* acquire a free region */
-			MM_HeapRegionDescriptorVLHGC *leafRegion = acquireFreeRegionFromHeap(env);
+			/* acquire a free region, adjacent to the other leaves of the array if possible */
+			MM_HeapRegionDescriptorVLHGC *leafRegion = NULL;
+			if (extensions->tarokEnableContiguousArrayletLeaves) {
+				leafRegion = acquireAdjacentFreeRegionForArrayletLeaf(env, allocateDescription);
+			}
+			if (NULL == leafRegion) {
+				leafRegion = acquireFreeRegionFromHeap(env);
+			}
 			if (NULL != leafRegion) {
 				result = lockedAllocateArrayletLeaf(env, allocateDescription, leafRegion);
 				leafRegion->_allocateData._owningContext = this;
 				Assert_MM_true(leafRegion->getLowAddress() == result);
+				/* the next leaf of this spine, or the first of the next arraylet, is looked for right after this one */
+				_arrayletLeafSpine = allocateDescription->getSpine();
+				_nextArrayletLeafIndex = _heapRegionManager->mapDescriptorToRegionTableIndex(leafRegion) + 1;
 				Trc_MM_AllocationContextBalanced_lockedReplenishAndAllocate_acquiredFreeRegion(env->getLanguageVMThread(), regionSize);
 			}
 		}
@@ -70,6 +70,10 @@ private:
 	MM_HeapRegionManager *_heapRegionManager; /**< A cached pointer to the HeapRegionManager */
 	UDATA *_freeProcessorNodes;	/**< The array listing all the NUMA node numbers which account for the nodes with processors but no memory plus an empty slot for each context to use (element 0 is used by this context) - this is used when setting affinity */
 	UDATA _freeProcessorNodeCount;	/**< The length, in elements, of the _freeProcessorNodes array (always at least 1 after startup) */
+#if defined(J9VM_GC_ARRAYLETS)
+	J9IndexableObject *_arrayletLeafSpine; /**< The spine whose leaf was most recently allocated by the receiver (protected by _contextLock) */
+	UDATA _nextArrayletLeafIndex; /**< Region table index following the most recently allocated leaf: the next leaf of _arrayletLeafSpine, or where to look for the leaves of the next arraylet (protected by _contextLock) */
+#endif /* defined(J9VM_GC_ARRAYLETS) */
 
 /* Methods */
 public:
@@ -295,6 +299,10 @@ protected:
 		, _heapRegionManager(NULL)
 		, _freeProcessorNodes(NULL)
 		, _freeProcessorNodeCount(0)
+#if defined(J9VM_GC_ARRAYLETS)
+		, _arrayletLeafSpine(NULL)
+		, _nextArrayletLeafIndex(0)
+#endif /* defined(J9VM_GC_ARRAYLETS) */
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -381,6 +389,40 @@ private:
 	 */
 	MM_HeapRegionDescriptorVLHGC *acquireFreeRegionFromContext(MM_EnvironmentBase *env);
 
+#if defined(J9VM_GC_ARRAYLETS)
+	/**
+	 * Tries to acquire the free region for the next leaf of the arraylet being allocated which keeps its leaves adjacent in the heap, so
+	 * that its data can be addressed contiguously from the first leaf:  the region following the previous leaf of the spine or, for the
+	 * first leaf, the region following the last leaf the receiver allocated, if a run of free regions large enough for all of the leaves
+	 * starts there.  The search is next-fit, so it costs O(1) per leaf rather than a walk of the leaves or of the region table.
+	 * @note The caller must own the receiver's _contextLock
+	 *
+	 * @param env[in] The thread allocating the leaf
+	 * @param allocateDescription[in] The arraylet allocation in progress
+	 * @return The region (removed from its free list as by acquireFreeRegionFromNode) or NULL if the adjacent region is not available
+	 */
+	MM_HeapRegionDescriptorVLHGC *acquireAdjacentFreeRegionForArrayletLeaf(MM_EnvironmentBase *env, MM_AllocateDescription *allocateDescription);
+
+	/**
+	 * Tries to acquire the given region from the free or idle region list of the receiver or of one of its siblings.
+	 * @note The caller must own the receiver's _contextLock
+	 *
+	 * @param env[in] The thread attempting the allocation
+	 * @param region[in] The region to acquire
+	 * @return The region, converted to FREE if it was idle, or NULL if it is not free on the receiver's node
+	 */
+	MM_HeapRegionDescriptorVLHGC *acquireFreeRegionFromNode(MM_EnvironmentBase *env, MM_HeapRegionDescriptorVLHGC *region);
+
+	/**
+	 * Tries to acquire the given region from the free or idle region list of the receiver.
+	 *
+	 * @param env[in] The thread attempting the allocation
+	 * @param region[in] The region to acquire
+	 * @return The region, converted to FREE if it was idle, or NULL if the receiver does not manage it as a free or idle region
+	 */
+	MM_HeapRegionDescriptorVLHGC *acquireFreeRegionFromContext(MM_EnvironmentBase *env, MM_HeapRegionDescriptorVLHGC *region);
+#endif /* defined(J9VM_GC_ARRAYLETS) */
+
 	/**
 	 * Perform a TLH allocation.  Note that the receiver can assume that either the context is locked or the calling thread has exclusive.
 	 *
@@ -38,6 +38,7 @@
 #include "GCExtensions.hpp"
 #include "Heap.hpp"
 #include "HeapRegionDescriptor.hpp"
+#include "IncrementalCardTable.hpp"
 
 #define BITS_PER_BYTE	8
 #define COMPRESSED_CARDS_PER_WORD	(sizeof(UDATA) * BITS_PER_BYTE)
@@ -186,6 +187,15 @@ MM_CompressedCardTable::rebuildCompressedCardTableForPartialCollect(MM_Environme
 
 #if (1 == COMPRESSED_CARD_TABLE_DIV)
 
+		if ((1 == mask) && ((cardLast - card) >= (IDATA)COMPRESSED_CARDS_PER_WORD)) {
+			/* at a word boundary: a full word of clean cards compresses to a clean word without looking at each card */
+			if (MM_IncrementalCardTable::areAllCardsClean(card, card + COMPRESSED_CARDS_PER_WORD)) {
+				*compressedCard++ = AllCompressedCardsInWordClean;
+				card += COMPRESSED_CARDS_PER_WORD;
+				continue;
+			}
+		}
+
 		Card state = *card++;
 		if (isDirtyCardForPartialCollect(state)) {
 			/* invert bit */
@@ -126,6 +126,17 @@ public:
 			_breadthFirstCopyForwardScheme->setReservedNonEvacuatedRegions(regionCount);
 		}
 	}
+
+	/**
+	 * Discard any class survival profile used for pretenuring (called when classes are unloaded).
+	 * @param env[in] Master GC thread.
+	 */
+	void resetPretenureProfile(MM_EnvironmentVLHGC *env)
+	{
+		if (NULL != _breadthFirstCopyForwardScheme) {
+			_breadthFirstCopyForwardScheme->resetPretenureProfile(env);
+		}
+	}
 };
 
 
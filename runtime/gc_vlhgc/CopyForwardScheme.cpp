@@ -73,6 +73,7 @@
 #include "HeapRegionDescriptorVLHGC.hpp"
 #include "HeapRegionIteratorVLHGC.hpp"
 #include "HeapRegionManager.hpp"
+#include "IncrementalCardTable.hpp"
 #include "InterRegionRememberedSet.hpp"
 #include "MarkMap.hpp"
 #include "MemorySpace.hpp"
@@ -84,6 +85,7 @@
 #include "ObjectModel.hpp"
 #include "PacketSlotIterator.hpp"
 #include "ParallelTask.hpp"
+#include "PretenureProfile.hpp"
 #include "ReferenceObjectBuffer.hpp"
 #include "ReferenceObjectList.hpp"
 #include "ReferenceStats.hpp"
@@ -91,7 +93,9 @@
 #include "RootScanner.hpp"
 #include "ScavengerForwardedHeader.hpp"
 #include "SlotObject.hpp"
+#include "SlotPrefetchRing.hpp"
 #include "StackSlotValidator.hpp"
+#include "StringDeduplicator.hpp"
 #include "SublistFragment.hpp"
 #include "SublistIterator.hpp"
 #include "SublistPool.hpp"
@@ -333,6 +337,11 @@ MM_CopyForwardScheme::MM_CopyForwardScheme(MM_EnvironmentVLHGC *env, MM_HeapRegi
 	, _failedToExpand(false)
 	, _shouldScanFinalizableObjects(false)
 	, _objectAlignmentInBytes(env->getObjectAlignmentInBytes())
+	, _pretenureProfile(NULL)
+	, _pretenureAge(0)
+	, _stackWatermarkEpoch(0)
+	, _validStackWatermarkEpoch(0)
+	, _stackWatermarkCompactCount(0)
 {
 	_typeId = __FUNCTION__;
 }
@@ -469,6 +478,13 @@ MM_CopyForwardScheme::initialize(MM_EnvironmentVLHGC *env)
 	if (NULL == _compactGroupBlock) {
 		return false;
 	}
+
+	if (_extensions->tarokEnablePretenuring) {
+		_pretenureProfile = MM_PretenureProfile::newInstance(env);
+		if (NULL == _pretenureProfile) {
+			return false;
+		}
+	}
 	
 	return true;
 }
@@ -506,6 +522,19 @@ MM_CopyForwardScheme::tearDown(MM_EnvironmentVLHGC *env)
 		env->getForge()->free(_compactGroupBlock);
 		_compactGroupBlock = NULL;
 	}
+
+	if (NULL != _pretenureProfile) {
+		_pretenureProfile->kill(env);
+		_pretenureProfile = NULL;
+	}
+}
+
+void
+MM_CopyForwardScheme::resetPretenureProfile(MM_EnvironmentVLHGC *env)
+{
+	if (NULL != _pretenureProfile) {
+		_pretenureProfile->reset(env);
+	}
 }
 
 MM_AllocationContextTarok *
@@ -1289,7 +1318,7 @@ MM_CopyForwardScheme::getDesiredCopyCacheSize(MM_EnvironmentVLHGC *env, UDATA co
 }
 
 MM_CopyScanCacheVLHGC *
-MM_CopyForwardScheme::reserveMemoryForCopy(MM_EnvironmentVLHGC *env, J9Object *objectToEvacuate, MM_AllocationContextTarok *reservingContext, UDATA objectReserveSizeInBytes)
+MM_CopyForwardScheme::reserveMemoryForCopy(MM_EnvironmentVLHGC *env, J9Object *objectToEvacuate, MM_AllocationContextTarok *reservingContext, UDATA objectReserveSizeInBytes, bool pretenure)
 {
 	void *addrBase = NULL;
 	void *addrTop = NULL;
@@ -1297,8 +1326,13 @@ MM_CopyForwardScheme::reserveMemoryForCopy(MM_EnvironmentVLHGC *env, J9Object *o
 
 	Assert_MM_objectAligned(env, objectReserveSizeInBytes);
 
-	MM_HeapRegionDescriptorVLHGC *region = (MM_HeapRegionDescriptorVLHGC *)_regionManager->tableDescriptorForAddress(objectToEvacuate);
-	UDATA compactGroup = MM_CompactGroupManager::getCompactGroupNumberInContext(env, region, reservingContext);
+	UDATA compactGroup = 0;
+	if (pretenure) {
+		compactGroup = MM_CompactGroupManager::getCompactGroupNumberForAge(env, _pretenureAge, reservingContext);
+	} else {
+		MM_HeapRegionDescriptorVLHGC *region = (MM_HeapRegionDescriptorVLHGC *)_regionManager->tableDescriptorForAddress(objectToEvacuate);
+		compactGroup = MM_CompactGroupManager::getCompactGroupNumberInContext(env, region, reservingContext);
+	}
 	MM_CopyForwardCompactGroup *copyForwardCompactGroup = &env->_copyForwardCompactGroups[compactGroup];
 	
 	Assert_MM_true(compactGroup < _compactGroupMaxCount);
@@ -1459,7 +1493,12 @@ MM_CopyForwardScheme::copyAndForward(MM_EnvironmentVLHGC *env, MM_AllocationCont
 MMINLINE bool
 MM_CopyForwardScheme::copyAndForward(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *reservingContext, J9Object *objectPtr, GC_SlotObject *slotObject, bool leafType)
 {
-	J9Object *value = slotObject->readReferenceFromSlot();
+	return copyAndForward(env, reservingContext, objectPtr, slotObject, slotObject->readReferenceFromSlot(), leafType);
+}
+
+MMINLINE bool
+MM_CopyForwardScheme::copyAndForward(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *reservingContext, J9Object *objectPtr, GC_SlotObject *slotObject, J9Object *value, bool leafType)
+{
 	J9Object *preservedValue = value;
 
 	bool success = copyAndForward(env, reservingContext, &value, leafType);
@@ -1498,9 +1537,8 @@ MM_CopyForwardScheme::copyAndForward(MM_EnvironmentVLHGC *env, MM_AllocationCont
 }
 
 MMINLINE bool
-MM_CopyForwardScheme::copyAndForwardPointerArray(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *reservingContext, J9IndexableObject *arrayPtr, UDATA startIndex, GC_SlotObject *slotObject)
+MM_CopyForwardScheme::copyAndForwardPointerArray(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *reservingContext, J9IndexableObject *arrayPtr, UDATA startIndex, GC_SlotObject *slotObject, J9Object *value)
 {
-	J9Object *value = slotObject->readReferenceFromSlot();
 	J9Object *preservedValue = value;
 
 	bool success = copyAndForward(env, reservingContext, &value);
@@ -1616,6 +1654,13 @@ MM_CopyForwardScheme::masterSetupForCopyForward(MM_EnvironmentVLHGC *env)
 	
 	/* Record whether finalizable processing is required in this copy-forward collection */
 	_shouldScanFinalizableObjects = _extensions->finalizeListManager->isFinalizableObjectProcessingRequired();
+
+	/* A compaction may have moved objects out of the regions recorded with a stamped stack */
+	if (_stackWatermarkCompactCount != _extensions->tarokCompactCount) {
+		_validStackWatermarkEpoch = 0;
+		_stackWatermarkCompactCount = _extensions->tarokCompactCount;
+	}
+	_stackWatermarkEpoch += 1;
 }
 
 /**
@@ -1776,11 +1821,18 @@ MM_CopyForwardScheme::copyForwardCollectionSet(MM_EnvironmentVLHGC *env)
 	/* Perform any master-specific setup */
 	masterSetupForCopyForward(env);
 
+	/* pretenured objects skip the remaining nursery ages (tarokNurseryMaxAge is only final once the collector has started) */
+	_pretenureAge = OMR_MIN(_extensions->tarokNurseryMaxAge._valueSpecified + 1, _extensions->tarokRegionMaxAge);
+
 	/* And perform the copy forward */
 	MM_CopyForwardSchemeTask copyForwardTask(env, _dispatcher, this, env->_cycleState);
 	_dispatcher->run(env, &copyForwardTask);
 
 	masterCleanupForCopyForward(env);
+
+	if (NULL != _pretenureProfile) {
+		_pretenureProfile->updatePretenureDecisions(env);
+	}
 	
 	/* Record the completion time of the copy forward cycle */
 	static_cast<MM_CycleStateVLHGC*>(env->_cycleState)->_vlhgcIncrementStats._copyForwardStats._endTime = j9time_hires_clock();
@@ -1805,6 +1857,9 @@ MM_CopyForwardScheme::copyForwardCollectionSet(MM_EnvironmentVLHGC *env)
 		_workQueueWaitCountPtr = &_scanCacheWaitCount;
 	}
 
+	/* Stamps from an aborted or hybrid copy-forward can not be trusted (objects left in place are compacted later) */
+	_validStackWatermarkEpoch = (copyForwardCompletedSuccessfully(env) && (0 == _regionCountCannotBeEvacuated)) ? _stackWatermarkEpoch : 0;
+
 	/* Do any final work to regions in order to release them back to the master collector implementation */
 	postProcessRegions(env);
 
@@ -2089,7 +2144,15 @@ MM_CopyForwardScheme::copy(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *
 
 		reservingContext = getPreferredAllocationContext(reservingContext, object);
 
-		copyCache = reserveMemoryForCopy(env, object, reservingContext, objectReserveSizeInBytes);
+		MM_HeapRegionDescriptorVLHGC * sourceRegion = (MM_HeapRegionDescriptorVLHGC *)_regionManager->tableDescriptorForAddress(object);
+		J9Class *clazz = NULL;
+		bool pretenure = false;
+		if (NULL != _pretenureProfile) {
+			clazz = forwardedHeader->getPreservedClass();
+			pretenure = sourceRegion->isEden() && _pretenureProfile->shouldPretenure(object, clazz);
+		}
+
+		copyCache = reserveMemoryForCopy(env, object, reservingContext, objectReserveSizeInBytes, pretenure);
 
 		/* Check if memory was reserved successfully */
 		if(NULL == copyCache) {
@@ -2180,7 +2243,6 @@ MM_CopyForwardScheme::copy(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *
 					/* account for this as free memory */
 					env->_copyForwardCompactGroups[destinationCompactGroup]._freeMemoryMeasured += hotFieldPadSize;
 				}
-				MM_HeapRegionDescriptorVLHGC * sourceRegion = (MM_HeapRegionDescriptorVLHGC *)_regionManager->tableDescriptorForAddress(object);
 				UDATA sourceCompactGroup = MM_CompactGroupManager::getCompactGroupNumber(env, sourceRegion);
 				if (sourceRegion->isEden()) {
 					env->_copyForwardCompactGroups[sourceCompactGroup]._edenStats._liveObjects += 1;
@@ -2193,10 +2255,45 @@ MM_CopyForwardScheme::copy(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *
 					env->_copyForwardCompactGroups[destinationCompactGroup]._nonEdenStats._copiedObjects += 1;
 					env->_copyForwardCompactGroups[destinationCompactGroup]._nonEdenStats._copiedBytes += objectCopySizeInBytes;
 				}
-				copyCache->_allocationAgeSizeProduct += ((double)objectReserveSizeInBytes * (double)sourceRegion->getAllocationAge());
+				U_64 allocationAge = sourceRegion->getAllocationAge();
+				U_64 lowerAgeBound = sourceRegion->getLowerAgeBound();
+				U_64 upperAgeBound = sourceRegion->getUpperAgeBound();
+				if (pretenure) {
+					if (_extensions->tarokAllocationAgeEnabled) {
+						/* the object is treated as though it had already aged through the nursery, so it takes the youngest allocation age of its destination group */
+						UDATA destinationAge = MM_CompactGroupManager::getRegionAgeFromGroup(env, destinationCompactGroup);
+						Assert_MM_true(destinationAge > 0);
+						UDATA youngerCompactGroup = MM_CompactGroupManager::getCompactGroupNumberForAge(env, destinationAge - 1, reservingContext);
+						allocationAge = _extensions->compactGroupPersistentStats[youngerCompactGroup]._maxAllocationAge;
+						lowerAgeBound = allocationAge;
+						upperAgeBound = allocationAge;
+					}
+					env->_copyForwardStats._pretenuredObjects += 1;
+					env->_copyForwardStats._pretenuredBytes += objectCopySizeInBytes;
+					/* without pretenuring the object would have been copied once more for each nursery age it skipped */
+					env->_copyForwardStats._pretenureCopyBytesSaved += objectCopySizeInBytes * (_pretenureAge - 1);
+				}
+				copyCache->_allocationAgeSizeProduct += ((double)objectReserveSizeInBytes * (double)allocationAge);
 				copyCache->_objectSize += objectReserveSizeInBytes;
-				copyCache->_lowerAgeBound = OMR_MIN(copyCache->_lowerAgeBound, sourceRegion->getLowerAgeBound());
-				copyCache->_upperAgeBound = OMR_MAX(copyCache->_upperAgeBound, sourceRegion->getUpperAgeBound());
+				copyCache->_lowerAgeBound = OMR_MIN(copyCache->_lowerAgeBound, lowerAgeBound);
+				copyCache->_upperAgeBound = OMR_MAX(copyCache->_upperAgeBound, upperAgeBound);
+
+				if (NULL != _pretenureProfile) {
+					if (sourceRegion->isEden()) {
+						_pretenureProfile->recordCopy(env, object, clazz, objectCopySizeInBytes, true);
+					} else if (sourceRegion->getLogicalAge() == _extensions->tarokNurseryMaxAge._valueSpecified) {
+						_pretenureProfile->recordCopy(env, object, clazz, objectCopySizeInBytes, false);
+					}
+				}
+
+				if ((NULL != _extensions->stringDeduplicator)
+					&& (J9GC_J9OBJECT_CLAZZ(destinationObjectPtr) == J9VMJAVALANGSTRING_OR_NULL(_javaVM))
+					&& (sourceRegion->getLogicalAge() < _extensions->stringDeduplicationAgeThreshold)
+					&& (MM_CompactGroupManager::getRegionAgeFromGroup(env, destinationCompactGroup) >= _extensions->stringDeduplicationAgeThreshold)
+				) {
+					/* the String is crossing the age threshold with this copy */
+					_extensions->stringDeduplicator->addCandidate(destinationObjectPtr);
+				}
 
 #if defined(J9VM_GC_LEAF_BITS)
 				if (_extensions->tarokEnableLeafFirstCopying) {
@@ -2432,17 +2529,23 @@ MM_CopyForwardScheme::iterateAndCopyforwardSlotReference(MM_EnvironmentVLHGC *en
 	}
 	descriptionIndex = J9_OBJECT_DESCRIPTION_SIZE - 1;
 
+	/* slots are copied scanPrefetchDistance reference slots behind the scan so that the target headers have been prefetched by the time they are copied */
+	MM_SlotPrefetchRing prefetchRing(_javaVM->omrVM, _extensions->scanPrefetchDistance);
 	while(success && (scanPtr < endScanPtr)) {
 		/* Determine if the slot should be processed */
 		if (descriptionBits & 1) {
-			GC_SlotObject slotObject(_javaVM->omrVM, scanPtr);
-
-		/* Copy/Forward the slot reference and perform any inter-region remember work that is required */
 #if defined(J9VM_GC_LEAF_BITS)
-			success = copyAndForward(env, reservingContext, objectPtr, &slotObject, 1 == (leafBits & 1));
+			prefetchRing.push((fj9object_t *)scanPtr, 1 == (leafBits & 1));
 #else /* J9VM_GC_LEAF_BITS */
-			success = copyAndForward(env, reservingContext, objectPtr, &slotObject);
+			prefetchRing.push((fj9object_t *)scanPtr);
 #endif /* J9VM_GC_LEAF_BITS */
+
+			if (prefetchRing.isFull()) {
+				MM_SlotPrefetchRing::PendingSlot pending = prefetchRing.pop();
+				GC_SlotObject slotObject(_javaVM->omrVM, pending.slotAddress);
+				/* Copy/Forward the slot reference and perform any inter-region remember work that is required */
+				success = copyAndForward(env, reservingContext, objectPtr, &slotObject, pending.target, pending.leaf);
+			}
 		}
 		descriptionBits >>= 1;
 #if defined(J9VM_GC_LEAF_BITS)
@@ -2457,6 +2560,12 @@ MM_CopyForwardScheme::iterateAndCopyforwardSlotReference(MM_EnvironmentVLHGC *en
 		}
 		scanPtr += 1;
 	}
+	while (success && !prefetchRing.isEmpty()) {
+		MM_SlotPrefetchRing::PendingSlot pending = prefetchRing.pop();
+		GC_SlotObject slotObject(_javaVM->omrVM, pending.slotAddress);
+		success = copyAndForward(env, reservingContext, objectPtr, &slotObject, pending.target, pending.leaf);
+	}
+	env->_copyForwardStats._mixedObjectSlotsPrefetched += prefetchRing.getPrefetchCount();
 	return success;
 }
 
@@ -2612,20 +2721,43 @@ MM_CopyForwardScheme::scanPointerArrayObjectSlotsSplit(MM_EnvironmentVLHGC *env,
 	UDATA slotsToScan = createNextSplitArrayWorkUnit(env, arrayPtr, startIndex, currentSplitUnitOnly);
 
 	if (slotsToScan > 0) {
+		PORT_ACCESS_FROM_ENVIRONMENT(env);
+		U_64 startTime = j9time_hires_clock();
+		UDATA slotsScanned = 0;
+
 		/* TODO: this iterator scans the array backwards - change it to forward, and optimize it since we can guarantee the range will be contiguous */
 		GC_PointerArrayIterator pointerArrayIterator(_javaVM, (J9Object *)arrayPtr);
 		pointerArrayIterator.setIndex(startIndex + slotsToScan);
 
+		/* slots are copied scanPrefetchDistance slots behind the iterator so that the target headers have been prefetched by the time they are copied */
+		MM_SlotPrefetchRing prefetchRing(_javaVM->omrVM, _extensions->scanPrefetchDistance);
 		for (UDATA scanCount = 0; success && (scanCount < slotsToScan); scanCount++) {
 			GC_SlotObject *slotObject = pointerArrayIterator.nextSlot();
 			if (NULL == slotObject) {
 				/* this can happen if the array is only partially allocated */
 				break;
 			}
+			prefetchRing.push(slotObject->readAddressFromSlot());
 
-			/* Copy/Forward the slot reference and perform any inter-region remember work that is required */
-			success = copyAndForwardPointerArray(env, reservingContext, arrayPtr, startIndex, slotObject);
+			if (prefetchRing.isFull()) {
+				MM_SlotPrefetchRing::PendingSlot pending = prefetchRing.pop();
+				GC_SlotObject pendingSlotObject(_javaVM->omrVM, pending.slotAddress);
+				/* Copy/Forward the slot reference and perform any inter-region remember work that is required */
+				success = copyAndForwardPointerArray(env, reservingContext, arrayPtr, startIndex, &pendingSlotObject, pending.target);
+				slotsScanned += 1;
+			}
 		}
+		while (success && !prefetchRing.isEmpty()) {
+			MM_SlotPrefetchRing::PendingSlot pending = prefetchRing.pop();
+			GC_SlotObject pendingSlotObject(_javaVM->omrVM, pending.slotAddress);
+			success = copyAndForwardPointerArray(env, reservingContext, arrayPtr, startIndex, &pendingSlotObject, pending.target);
+			slotsScanned += 1;
+		}
+
+		env->_copyForwardStats._splitArrayUnitsScanned += 1;
+		env->_copyForwardStats._splitArraySlotsScanned += slotsScanned;
+		env->_copyForwardStats._splitArraySlotsPrefetched += prefetchRing.getPrefetchCount();
+		env->_copyForwardStats._splitArrayScanTime += (j9time_hires_clock() - startTime);
 	}
 
 	return slotsToScan;
@@ -3588,7 +3720,7 @@ MM_CopyForwardScheme::cleanCardTableForPartialCollect(MM_EnvironmentVLHGC *env,
 	U_64 cleanStartTime = j9time_hires_clock();
 
 	bool gmpIsRunning = (NULL != env->_cycleState->_externalCycleState);
-	MM_CardTable* cardTable = _extensions->cardTable;
+	MM_IncrementalCardTable *cardTable = (MM_IncrementalCardTable *)_extensions->cardTable;
 	GC_HeapRegionIteratorVLHGC regionIterator(_regionManager);
 	MM_HeapRegionDescriptorVLHGC *region = NULL;
 	while(NULL != (region = regionIterator.nextRegion())) {
@@ -3597,7 +3729,7 @@ MM_CopyForwardScheme::cleanCardTableForPartialCollect(MM_EnvironmentVLHGC *env,
 			if(J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
 				if (!region->_markData._shouldMark) {
 					/* this region isn't part of the collection set, so it may have dirty or remembered cards in it. */
-					cardTable->cleanCardsInRegion(env, cardCleaner, region);
+					cardTable->cleanNonCleanCardsInRegion(env, cardCleaner, region);
 				} else {
 					/* this region is part of the collection set, so just change its dirty cards to clean (or GMP_MUST_SCAN) */
 					void *low = region->getLowAddress();
@@ -3605,6 +3737,7 @@ MM_CopyForwardScheme::cleanCardTableForPartialCollect(MM_EnvironmentVLHGC *env,
 					Card *card = cardTable->heapAddrToCardAddr(env, low);
 					Card *toCard = cardTable->heapAddrToCardAddr(env, high);
 
+					card = MM_IncrementalCardTable::findFirstNonCleanCard(card, toCard);
 					while (card < toCard) {
 						Card fromState = *card;
 						switch(fromState) {
@@ -3637,7 +3770,7 @@ MM_CopyForwardScheme::cleanCardTableForPartialCollect(MM_EnvironmentVLHGC *env,
 						default:
 							Assert_MM_unreachable();
 						}
-						card += 1;
+						card = MM_IncrementalCardTable::findFirstNonCleanCard(card + 1, toCard);
 					}
 				}
 			}
@@ -3791,8 +3924,83 @@ class MM_CopyForwardSchemeRootScanner : public MM_RootScanner
 {
 private:
 	MM_CopyForwardScheme *_copyForwardScheme;  /**< Local reference back to the copy forward scheme driving the collection */
+	UDATA _stackRegionCount; /**< The number of distinct heap regions the stack being scanned refers to (may exceed the capacity of _stackRegions) */
+	MM_HeapRegionDescriptor *_stackRegions[GC_Environment::STACK_WATERMARK_MAX_REGIONS]; /**< The heap regions the stack being scanned refers to */
 
 private:
+	/**
+	 * Record the region holding an object referred to by the stack being scanned.
+	 * @param objectPtr[in] the (already copied) object
+	 */
+	void
+	recordStackRegion(J9Object *objectPtr)
+	{
+		if (_stackRegionCount <= GC_Environment::STACK_WATERMARK_MAX_REGIONS) {
+			MM_HeapRegionDescriptor *region = _copyForwardScheme->_regionManager->tableDescriptorForAddress(objectPtr);
+			for (UDATA i = 0; i < _stackRegionCount; i++) {
+				if (region == _stackRegions[i]) {
+					return;
+				}
+			}
+			if (_stackRegionCount < GC_Environment::STACK_WATERMARK_MAX_REGIONS) {
+				_stackRegions[_stackRegionCount] = region;
+			}
+			_stackRegionCount += 1;
+		}
+	}
+
+	/**
+	 * Determine whether the stack of a thread can be skipped: it has not run since an earlier copy-forward
+	 * stamped it, and none of the regions it referred to then is in the current collection set.
+	 * @param walkThread[in] the thread whose stack is about to be scanned
+	 * @return true if the stack scan can be skipped
+	 */
+	bool
+	isThreadStackUnchanged(J9VMThread *walkThread)
+	{
+		if (!isThreadStackWatermarked(walkThread, _copyForwardScheme->_validStackWatermarkEpoch)) {
+			return false;
+		}
+		GC_Environment *gcEnv = MM_EnvironmentBase::getEnvironment(walkThread->omrVMThread)->getGCEnvironment();
+		for (UDATA i = 0; i < gcEnv->_stackWatermarkRegionCount; i++) {
+			if (((MM_HeapRegionDescriptorVLHGC *)gcEnv->_stackWatermarkRegions[i])->_markData._shouldMark) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/**
+	 * Scan a thread, skipping its stack if isThreadStackUnchanged(), and stamping the stack for the next
+	 * copy-forward if it refers to few enough regions.
+	 * @see MM_RootScanner::scanOneThread()
+	 */
+	virtual bool
+	scanOneThread(MM_EnvironmentBase *env, J9VMThread* walkThread, void* localData)
+	{
+		scanThreadSlots(walkThread);
+
+		if (isThreadStackUnchanged(walkThread)) {
+			reportThreadStackSkipped(walkThread);
+			/* the recorded regions still hold: nothing they contain has moved */
+			setThreadStackWatermark(walkThread, _copyForwardScheme->_stackWatermarkEpoch);
+		} else {
+			_stackRegionCount = 0;
+			/* The slots of a split stack are seen by several scanners, so it is never stamped */
+			if (scanThreadStack(env, walkThread, localData) && (_stackRegionCount <= GC_Environment::STACK_WATERMARK_MAX_REGIONS)) {
+				GC_Environment *gcEnv = MM_EnvironmentBase::getEnvironment(walkThread->omrVMThread)->getGCEnvironment();
+				for (UDATA i = 0; i < _stackRegionCount; i++) {
+					gcEnv->_stackWatermarkRegions[i] = _stackRegions[i];
+				}
+				gcEnv->_stackWatermarkRegionCount = _stackRegionCount;
+				setThreadStackWatermark(walkThread, _copyForwardScheme->_stackWatermarkEpoch);
+			} else {
+				setThreadStackWatermark(walkThread, 0);
+			}
+		}
+		return false;
+	}
+
 	virtual void doSlot(J9Object **slotPtr) {
 		if (NULL != *slotPtr) {
 			/* we don't have the context of this slot so just relocate the object into the same node where we found it */
@@ -3809,6 +4017,7 @@ private:
 			J9VMThread *thread = ((J9StackWalkState *)walkState)->currentThread;
 			MM_AllocationContextTarok *reservingContext = (MM_AllocationContextTarok *)MM_EnvironmentVLHGC::getEnvironment(thread)->getAllocationContext();
 			_copyForwardScheme->copyAndForward(MM_EnvironmentVLHGC::getEnvironment(_env), reservingContext, slotPtr);
+			recordStackRegion(*slotPtr);
 		} else if (NULL != *slotPtr) {
 			/* stack object - just validate */
 			Assert_MM_validStackSlot(MM_StackSlotValidator(MM_StackSlotValidator::NOT_ON_HEAP, *slotPtr, stackLocation, walkState).validate(_env));
@@ -3863,7 +4072,8 @@ private:
 public:
 	MM_CopyForwardSchemeRootScanner(MM_EnvironmentVLHGC *env, MM_CopyForwardScheme *copyForwardScheme) :
 		MM_RootScanner(env),
-		_copyForwardScheme(copyForwardScheme)
+		_copyForwardScheme(copyForwardScheme),
+		_stackRegionCount(0)
 	{
 		_typeId = __FUNCTION__;
 	};
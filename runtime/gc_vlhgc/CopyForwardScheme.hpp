@@ -53,6 +53,7 @@ class MM_HeapRegionDescriptorVLHGC;
 class MM_InterRegionRememberedSet;
 class MM_MarkMap;
 class MM_MemoryPoolBumpPointer;
+class MM_PretenureProfile;
 class MM_ReferenceStats;
 
 /* Forward declaration of classes defined within the cpp */
@@ -159,6 +160,12 @@ private:
 	bool _shouldScanFinalizableObjects; /**< Set to true at the beginning of a collection if there are any pending finalizable objects */
 	const UDATA _objectAlignmentInBytes;	/**< Run-time objects alignment in bytes */
 
+	MM_PretenureProfile *_pretenureProfile; /**< Class survival profile used to pretenure Eden objects (NULL if pretenuring is disabled) */
+	UDATA _pretenureAge; /**< The region age into which pretenured Eden objects are copied (the first age beyond the nursery) */
+	UDATA _stackWatermarkEpoch; /**< Incremented at the start of each copy-forward and stamped on the stacks it finds referring to few enough regions */
+	UDATA _validStackWatermarkEpoch; /**< Epoch of the previous copy-forward while stacks stamped by it can be skipped, 0 otherwise */
+	UDATA _stackWatermarkCompactCount; /**< tarokCompactCount at the previous copy-forward (a compaction in between invalidates every stamp) */
+
 protected:
 public:
 private:
@@ -558,9 +565,10 @@ private:
 	 * @param objectToEvacuate Object being copied.
 	 * @param reservingContext[in] The context to which we would prefer to copy any objects discovered in this method
 	 * @param objectReserveSizeInBytes Amount of bytes to be reserved (can be greater than the original object size) for copying.
+	 * @param pretenure True if the object should be copied into the pretenure age rather than the age of the region containing it.
 	 * @return a CopyScanCache which contains the reserved memory or NULL if the reserve was not successful.
 	 */
-	MMINLINE MM_CopyScanCacheVLHGC *reserveMemoryForCopy(MM_EnvironmentVLHGC *env, J9Object *objectToEvacuate, MM_AllocationContextTarok *reservingContext, UDATA objectReserveSizeInBytes);
+	MMINLINE MM_CopyScanCacheVLHGC *reserveMemoryForCopy(MM_EnvironmentVLHGC *env, J9Object *objectToEvacuate, MM_AllocationContextTarok *reservingContext, UDATA objectReserveSizeInBytes, bool pretenure);
 
 	void flushCaches(MM_CopyScanCacheVLHGC *cache);
 	
@@ -817,6 +825,12 @@ private:
 	 */
 	MMINLINE bool copyAndForward(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *reservingContext, J9Object *objectPtr, GC_SlotObject *slotObject, bool leafType = false);
 
+	/**
+	 * As copyAndForward(env, reservingContext, objectPtr, slotObject, leafType), for a slot whose reference has already been read.
+	 * @param value[in] the reference read from the slot (the slot must not have changed since)
+	 */
+	MMINLINE bool copyAndForward(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *reservingContext, J9Object *objectPtr, GC_SlotObject *slotObject, J9Object *value, bool leafType);
+
 	/**
 	 * Update the given slot to point at the new location of the object, after copying the object if it was not already.
 	 * Attempt to copy (either flip or tenure) the object and install a forwarding pointer at the new location. The object
@@ -826,9 +840,10 @@ private:
 	 * @param objectPtr[in] Array object being scanned.
 	 * @param startIndex[in] First index of the sub (split)array being scanned.
 	 * @param slotObject the slot to be copied or updated
+	 * @param value[in] the reference read from the slot
 	 * @return true if copy succeeded (or no copying was involved)
 	 */
-	MMINLINE bool copyAndForwardPointerArray(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *reservingContext, J9IndexableObject *arrayPtr, UDATA startIndex, GC_SlotObject *slotObject);
+	MMINLINE bool copyAndForwardPointerArray(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *reservingContext, J9IndexableObject *arrayPtr, UDATA startIndex, GC_SlotObject *slotObject, J9Object *value);
 
 
 	/**
@@ -1092,6 +1107,12 @@ public:
 		_regionCountReservedNonEvacuated = regionCount;
 	}
 
+	/**
+	 * Discard the pretenure profile.  Must be called when classes are unloaded since the profile is keyed by class.
+	 * @param env[in] Main thread.
+	 */
+	void resetPretenureProfile(MM_EnvironmentVLHGC *env);
+
 	friend class MM_CopyForwardGMPCardCleaner;
 	friend class MM_CopyForwardNoGMPCardCleaner;
 	friend class MM_CopyForwardSchemeTask;
@@ -103,8 +103,7 @@ MM_EnvironmentVLHGC::initializeGCThread()
 	UDATA threadPoolSize = extensions->getHeap()->getHeapRegionManager()->getTableRegionCount();
 	/* Make this thread aware of its RSCL buckets for all regions */
 	_rememberedSetCardBucketPool = &extensions->rememberedSetCardBucketPool[getSlaveID() * threadPoolSize];
-    /* Associate buckets with approprate RSCL (each RSCL maintains a list of its own buckets) */
-	extensions->interRegionRememberedSet->threadLocalInitialize(this);
+	/* buckets are associated with their RSCL when the owning region is first committed (see MM_InterRegionRememberedSet::initializeRegionBuckets) */
 }
 
 void
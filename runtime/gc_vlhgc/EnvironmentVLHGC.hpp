@@ -42,6 +42,7 @@
 #include "EnvironmentBase.hpp"
 #include "OwnableSynchronizerObjectBufferVLHGC.hpp"
 #include "ReferenceObjectBufferVLHGC.hpp"
+#include "TLHSizingStats.hpp"
 #include "UnfinalizedObjectBufferVLHGC.hpp"
 #include "WorkStack.hpp"
 
@@ -84,6 +85,8 @@ public:
 #endif /* J9VM_GC_MODRON_COMPACTION */
 	MM_InterRegionRememberedSetStats _irrsStats;
 
+	MM_TLHSizingStats _tlhSizingStats; /**< TLH refresh and waste history of this (mutator) thread, used for adaptive TLH sizing */
+
 protected:
 private:
 /* Functionality Section */
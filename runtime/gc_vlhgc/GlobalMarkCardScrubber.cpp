@@ -37,6 +37,7 @@
 #include "HeapMapWordIterator.hpp"
 #include "HeapRegionDescriptorVLHGC.hpp"
 #include "HeapRegionIterator.hpp"
+#include "IncrementalCardTable.hpp"
 #include "InterRegionRememberedSet.hpp"
 #include "MarkMap.hpp"
 #include "MixedObjectIterator.hpp"
@@ -301,7 +302,7 @@ MM_ParallelScrubCardTableTask::run(MM_EnvironmentBase *envBase)
 				if (env->_currentTask->shouldYieldFromTask(env)) {
 					/* J9MODRON_HANDLE_NEXT_WORK_UNIT may be out of sync once we break. It must not be called again. */
 				} else {
-					extensions->cardTable->cleanCardsInRegion(env, &scrubber, region);
+					((MM_IncrementalCardTable *)extensions->cardTable)->cleanNonCleanCardsInRegion(env, &scrubber, region);
 				}
 			}
 		}
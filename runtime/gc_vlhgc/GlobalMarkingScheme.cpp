@@ -62,6 +62,7 @@
 #include "HeapRegionDescriptorVLHGC.hpp"
 #include "HeapRegionIteratorVLHGC.hpp"
 #include "IncrementalGenerationalGC.hpp"
+#include "IncrementalCardTable.hpp"
 #include "InterRegionRememberedSet.hpp"
 #include "MarkMap.hpp"
 #include "MarkMapManager.hpp"
@@ -77,6 +78,7 @@
 #include "RegionBasedOverflowVLHGC.hpp"
 #include "RootScanner.hpp"
 #include "SegmentIterator.hpp"
+#include "SlotPrefetchRing.hpp"
 #include "StackSlotValidator.hpp"
 #include "SublistIterator.hpp"
 #include "SublistPool.hpp"
@@ -673,6 +675,14 @@ MM_GlobalMarkingScheme::scanReferenceMixedObject(MM_EnvironmentVLHGC *env, J9Obj
 	}
 }
 
+MMINLINE void
+MM_GlobalMarkingScheme::markPointerArraySlot(MM_EnvironmentVLHGC *env, J9IndexableObject *objectPtr, J9Object *value)
+{
+	markObject(env, value);
+
+	rememberReferenceIfRequired(env, (J9Object *)objectPtr, value);
+}
+
 UDATA
 MM_GlobalMarkingScheme::scanPointerArrayObjectSplit(MM_EnvironmentVLHGC *env, J9IndexableObject *objectPtr, UDATA startIndex, ScanReason reason)
 {
@@ -699,17 +709,22 @@ MM_GlobalMarkingScheme::scanPointerArrayObjectSplit(MM_EnvironmentVLHGC *env, J9
 		/* TODO: this iterator scans the array backwards - change it to forward, and optimize it since we can guarantee the range will be contiguous */
 		GC_PointerArrayIterator pointerArrayIterator(_javaVM, (J9Object *)objectPtr);
 		pointerArrayIterator.setIndex(startIndex + slotsToScan);
+		/* slots are marked scanPrefetchDistance slots behind the iterator so that the target headers have been prefetched by the time they are marked */
+		MM_SlotPrefetchRing prefetchRing(_javaVM->omrVM, _extensions->scanPrefetchDistance);
 		for (UDATA scanCount = 0; scanCount < slotsToScan; scanCount++) {
 			GC_SlotObject *slotObject = pointerArrayIterator.nextSlot();
 			if (NULL == slotObject) {
 				/* this can happen if the array is only partially allocated */
 				break;
 			}
-			J9Object * value = slotObject->readReferenceFromSlot();
-	
-			markObject(env, value);
-			
-			rememberReferenceIfRequired(env, (J9Object *)objectPtr, value);
+			prefetchRing.push(slotObject->readAddressFromSlot());
+
+			if (prefetchRing.isFull()) {
+				markPointerArraySlot(env, objectPtr, prefetchRing.pop().target);
+			}
+		}
+		while (!prefetchRing.isEmpty()) {
+			markPointerArraySlot(env, objectPtr, prefetchRing.pop().target);
 		}
 	}
 
@@ -1272,7 +1287,7 @@ MM_GlobalMarkingScheme::cleanCardTableForGlobalCollect(MM_EnvironmentVLHGC *env,
 	while(NULL != (region = regionIterator.nextRegion())) {
 		if (region->containsObjects()) {
 			if(J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
-				_extensions->cardTable->cleanCardsInRegion(env, cardCleaner, region);
+				((MM_IncrementalCardTable *)_extensions->cardTable)->cleanNonCleanCardsInRegion(env, cardCleaner, region);
 			}
 		}
 	}
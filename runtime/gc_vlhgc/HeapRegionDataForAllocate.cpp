@@ -41,6 +41,7 @@ MM_HeapRegionDataForAllocate::MM_HeapRegionDataForAllocate(MM_EnvironmentVLHGC *
 	: MM_BaseNonVirtual()
 	, _nextInList(NULL)
 	, _previousInList(NULL)
+	, _containingList(NULL)
 	, _owningContext(NULL)
 	, _originalOwningContext(NULL)
 	, _region(NULL)
@@ -36,6 +36,7 @@ class MM_EnvironmentVLHGC;
 class MM_MemoryPoolBumpPointer;
 class MM_HeapRegionDescriptorVLHGC;
 class MM_AllocationContextTarok;
+class MM_RegionListTarok;
 
 /**
  * The descriptor type used to manage object allocation within regions
@@ -45,6 +46,7 @@ class MM_HeapRegionDataForAllocate : public MM_BaseNonVirtual
 public:
 	MM_HeapRegionDescriptorVLHGC *_nextInList; /**< Used by MM_RegionListTarok to track which descriptors are in the list (next pointer in linked list) */
 	MM_HeapRegionDescriptorVLHGC *_previousInList; /**< Used by MM_RegionListTarok to track which descriptors are in the list (previous pointer in linked list) */
+	MM_RegionListTarok *_containingList; /**< The MM_RegionListTarok currently holding this descriptor.  NULL if it is in no list */
 	MM_AllocationContextTarok *_owningContext;	/**< A pointer to the allocation context which currently owns (that is, the only one which can allocate from it) this region.  NULL if unowned */
 	MM_AllocationContextTarok *_originalOwningContext;	/**< A pointer to the allocation context from which this region was stolen.  NULL if not stolen (either unowned or owned by a context on its native node) */
 protected:
@@ -149,7 +149,9 @@ MM_HeapRegionDescriptorVLHGC::destructor(MM_EnvironmentBase *env, MM_HeapRegionM
 bool
 MM_HeapRegionDescriptorVLHGC::allocateSupportingResources(MM_EnvironmentBase *env)
 {
-	return MM_GCExtensions::getExtensions(env)->interRegionRememberedSet->allocateRegionBuffers((MM_EnvironmentVLHGC *)env, this);
+	MM_InterRegionRememberedSet *interRegionRememberedSet = MM_GCExtensions::getExtensions(env)->interRegionRememberedSet;
+	interRegionRememberedSet->initializeRegionBuckets((MM_EnvironmentVLHGC *)env, this);
+	return interRegionRememberedSet->allocateRegionBuffers((MM_EnvironmentVLHGC *)env, this);
 }
 
 UDATA
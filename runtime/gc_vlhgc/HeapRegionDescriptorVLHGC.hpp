@@ -273,7 +273,7 @@ public:
 
 	/**
 	 * Allocate supporting resources (large enough to justify not to preallocate them for all regions at the startup) when region is being committed.
-	 * For VLHGC region, the resource is RSCL Buffer pool
+	 * For VLHGC region, the resources are the RSCL Buffer pool and the GC threads' RSCL buckets
 	 * @param env[in] of a GC thread
 	 * @return true if allocation is successful
 	 */
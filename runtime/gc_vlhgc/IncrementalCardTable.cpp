@@ -30,9 +30,11 @@
 #include "j9cfg.h"
 
 #include "IncrementalCardTable.hpp"
+#include "CardCleaner.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensions.hpp"
 #include "Heap.hpp"
+#include "HeapRegionDescriptor.hpp"
 
 MM_IncrementalCardTable *
 MM_IncrementalCardTable::newInstance(MM_EnvironmentBase *env, MM_Heap *heap)
@@ -79,3 +81,29 @@ MM_IncrementalCardTable::tearDown(MM_EnvironmentBase *env)
 	*/
 	MM_CardTable::tearDown(env);
 }
+
+void
+MM_IncrementalCardTable::cleanNonCleanCardsInRegion(MM_EnvironmentBase *env, MM_CardCleaner *cardCleaner, MM_HeapRegionDescriptor *region)
+{
+	cleanNonCleanCardsInRange(env, cardCleaner, region->getLowAddress(), region->getHighAddress());
+}
+
+void
+MM_IncrementalCardTable::cleanNonCleanCardsInRange(MM_EnvironmentBase *env, MM_CardCleaner *cardCleaner, void *lowAddress, void *highAddress)
+{
+	UDATA oldVMState = env->pushVMstate(cardCleaner->getVMStateID());
+	Card *firstCard = heapAddrToCardAddr(env, lowAddress);
+	Card *toCard = heapAddrToCardAddr(env, highAddress);
+	Card *card = findFirstNonCleanCard(firstCard, toCard);
+	UDATA cardsCleaned = 0;
+
+	while (card < toCard) {
+		U_8 *address = (U_8 *)lowAddress + ((UDATA)(card - firstCard) * CARD_SIZE);
+		cardCleaner->clean(env, address, address + CARD_SIZE, card);
+		cardsCleaned += 1;
+		card = findFirstNonCleanCard(card + 1, toCard);
+	}
+
+	env->_cardCleaningStats._cardsCleaned += cardsCleaned;
+	env->popVMstate(oldVMState);
+}
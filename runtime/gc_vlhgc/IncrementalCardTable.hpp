@@ -34,9 +34,20 @@
 #include "j9.h"
 #include "j9cfg.h"
 
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif /* defined(__AVX2__) || defined(__SSE2__) */
+
 #include "CardTable.hpp"
 
+class MM_CardCleaner;
 class MM_EnvironmentBase;
+class MM_HeapRegionDescriptor;
+
+/**
+ * A UDATA where every byte is CARD_CLEAN, used to skip a word of clean cards with a single compare.
+ */
+#define ALL_CARDS_CLEAN_IN_WORD (((UDATA)CARD_CLEAN) * (UDATA_MAX / (UDATA)0xFF))
 
 /**
  * @todo Provide class documentation
@@ -53,6 +64,85 @@ private:
 
 public:
 	static MM_IncrementalCardTable *newInstance(MM_EnvironmentBase *env, MM_Heap *heap);
+
+	/**
+	 * Find the first card in the range [card, toCard) which is not CARD_CLEAN.
+	 * Runs of clean cards are skipped a vector (32 or 16 cards, where the compiler targets AVX2 or SSE2) or a word at a time.
+	 * @param card[in] the first card to examine
+	 * @param toCard[in] the card immediately after the range
+	 * @return the first non-clean card, or toCard if every card in the range is clean
+	 */
+	static MMINLINE Card *
+	findFirstNonCleanCard(Card *card, Card *toCard)
+	{
+		/* step up to word alignment one card at a time */
+		while ((card < toCard) && (0 != ((UDATA)card & (sizeof(UDATA) - 1)))) {
+			if (CARD_CLEAN != *card) {
+				return card;
+			}
+			card += 1;
+		}
+
+#if defined(__AVX2__)
+		const __m256i cleanCards = _mm256_set1_epi8((char)CARD_CLEAN);
+		while (((UDATA)toCard - (UDATA)card) >= sizeof(__m256i)) {
+			__m256i cards = _mm256_loadu_si256((const __m256i *)card);
+			U_32 nonCleanMask = ~(U_32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(cards, cleanCards));
+			if (0 != nonCleanMask) {
+				return card + __builtin_ctz(nonCleanMask);
+			}
+			card += sizeof(__m256i);
+		}
+#elif defined(__SSE2__)
+		const __m128i cleanCards = _mm_set1_epi8((char)CARD_CLEAN);
+		while (((UDATA)toCard - (UDATA)card) >= sizeof(__m128i)) {
+			__m128i cards = _mm_loadu_si128((const __m128i *)card);
+			U_32 nonCleanMask = 0xFFFF & ~(U_32)_mm_movemask_epi8(_mm_cmpeq_epi8(cards, cleanCards));
+			if (0 != nonCleanMask) {
+				return card + __builtin_ctz(nonCleanMask);
+			}
+			card += sizeof(__m128i);
+		}
+#endif /* defined(__AVX2__) */
+
+		/* skip whole words of clean cards */
+		while ((((UDATA)toCard - (UDATA)card) >= sizeof(UDATA)) && (ALL_CARDS_CLEAN_IN_WORD == *(UDATA *)card)) {
+			card += sizeof(UDATA);
+		}
+
+		/* locate the non-clean card within the word (or handle the tail of the range) */
+		while ((card < toCard) && (CARD_CLEAN == *card)) {
+			card += 1;
+		}
+		return card;
+	}
+
+	/**
+	 * @return true if every card in the range [card, toCard) is CARD_CLEAN
+	 */
+	static MMINLINE bool
+	areAllCardsClean(Card *card, Card *toCard)
+	{
+		return toCard == findFirstNonCleanCard(card, toCard);
+	}
+
+	/**
+	 * Pass every card in the given region which is not CARD_CLEAN to the card cleaner.
+	 * Equivalent to MM_CardTable::cleanCardsInRegion() but clean cards are skipped in bulk rather than examined individually.
+	 * @param env[in] the current thread
+	 * @param cardCleaner[in] the cleaner to apply to each non-clean card
+	 * @param region[in] the region whose cards should be cleaned
+	 */
+	void cleanNonCleanCardsInRegion(MM_EnvironmentBase *env, MM_CardCleaner *cardCleaner, MM_HeapRegionDescriptor *region);
+
+	/**
+	 * Pass every card in the given heap range which is not CARD_CLEAN to the card cleaner.
+	 * @param env[in] the current thread
+	 * @param cardCleaner[in] the cleaner to apply to each non-clean card
+	 * @param lowAddress[in] the card aligned base of the range
+	 * @param highAddress[in] the card aligned top of the range
+	 */
+	void cleanNonCleanCardsInRange(MM_EnvironmentBase *env, MM_CardCleaner *cardCleaner, void *lowAddress, void *highAddress);
 protected:
 	bool initialize(MM_EnvironmentBase *env, MM_Heap *heap);
 	virtual void tearDown(MM_EnvironmentBase *env);
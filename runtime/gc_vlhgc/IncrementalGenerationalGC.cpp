@@ -62,6 +62,7 @@
 #include "HeapStats.hpp"
 #include "IncrementalGenerationalGC.hpp"
 #include "InterRegionRememberedSet.hpp"
+#include "LanguageThreadLocalHeap.hpp"
 #include "MarkMap.hpp"
 #include "MarkMapManager.hpp"
 #include "MarkMapSegmentChunkIterator.hpp"
@@ -72,10 +73,14 @@
 #include "ParallelTask.hpp"
 #include "ReferenceChainWalker.hpp"
 #include "VLHGCAccessBarrier.hpp"
+#include "VMThreadListIterator.hpp"
 #include "WorkPacketsIterator.hpp"
 #include "WorkPacketsVLHGC.hpp"
 #include "WorkStack.hpp"
 
+/* weight given to the most recent interval when updating a thread's share of TLH allocation */
+#define TLH_SIZING_ALLOCATION_FRACTION_WEIGHT 0.35
+
 /**
  * Initialization
  */
@@ -927,6 +932,9 @@ MM_IncrementalGenerationalGC::runPartialGarbageCollect(MM_EnvironmentVLHGC *env,
 	 * Collection preparation work including cache flushing and stats reporting.
 	 */
 
+	/* Size each thread's TLH from its allocation since the last PGC while its TLH is still intact */
+	updateThreadLocalHeapSizing(env);
+
 	/* Flush non-allocation caches for update purposes (verbose) and safety (member deletion) */
 	GC_OMRVMInterface::flushNonAllocationCaches(env);
 	/* Flush allocation caches */
@@ -961,6 +969,39 @@ MM_IncrementalGenerationalGC::runPartialGarbageCollect(MM_EnvironmentVLHGC *env,
 	postCollect(env, env->_cycleState->_activeSubSpace);
 }
 
+void
+MM_IncrementalGenerationalGC::updateThreadLocalHeapSizing(MM_EnvironmentVLHGC *env)
+{
+	MM_LanguageThreadLocalHeap languageTLH;
+	GC_VMThreadListIterator threadIterator(_javaVM);
+	J9VMThread *walkThread = NULL;
+
+	UDATA totalRefreshBytes = 0;
+	while (NULL != (walkThread = threadIterator.nextVMThread())) {
+		MM_EnvironmentVLHGC *walkEnv = MM_EnvironmentVLHGC::getEnvironment(walkThread);
+		totalRefreshBytes += walkEnv->_tlhSizingStats._refreshBytes;
+	}
+
+	bool resize = _extensions->tarokEnableAdaptiveTLHSizing && (0 != totalRefreshBytes);
+	UDATA edenSize = getCurrentEdenSizeInBytes(env);
+
+	threadIterator.reset();
+	while (NULL != (walkThread = threadIterator.nextVMThread())) {
+		MM_EnvironmentVLHGC *walkEnv = MM_EnvironmentVLHGC::getEnvironment(walkThread);
+		MM_TLHSizingStats *sizingStats = &walkEnv->_tlhSizingStats;
+		if (resize) {
+			double intervalFraction = (double)sizingStats->_refreshBytes / (double)totalRefreshBytes;
+			sizingStats->_allocationFraction = (sizingStats->_allocationFraction * (1.0 - TLH_SIZING_ALLOCATION_FRACTION_WEIGHT)) + (intervalFraction * TLH_SIZING_ALLOCATION_FRACTION_WEIGHT);
+			/* aim for the thread to consume its expected share of the next Eden in tarokTLHTargetRefreshes refreshes */
+			UDATA refreshSize = (UDATA)(((double)edenSize * sizingStats->_allocationFraction) / (double)_extensions->tarokTLHTargetRefreshes);
+			refreshSize = OMR_MAX(refreshSize, _extensions->tlhMinimumSize);
+			refreshSize = OMR_MIN(refreshSize, _extensions->tlhMaximumSize);
+			sizingStats->_refreshSize = MM_Math::roundToFloor(sizeof(UDATA), refreshSize);
+		}
+		sizingStats->recordWaste(languageTLH.getUnusedBytes(walkEnv));
+	}
+}
+
 void
 MM_IncrementalGenerationalGC::runGlobalMarkPhaseIncrement(MM_EnvironmentVLHGC *env)
 {
@@ -2548,6 +2589,9 @@ MM_IncrementalGenerationalGC::unloadDeadClassLoaders(MM_EnvironmentVLHGC *env)
 		classUnloadStats->_endPostTime = j9time_hires_clock();
 
 		_extensions->classLoaderManager->exitClassUnloadMutex(env);
+
+		/* the pretenure profile is keyed by class so it can't survive classes being unloaded */
+		_copyForwardDelegate.resetPretenureProfile(env);
 	}
 	/* If there was dynamic class unloading checks during the run, record the new number of class loaders last seen during a DCU pass */
 	_extensions->classLoaderManager->setLastUnloadNumOfClassLoaders();
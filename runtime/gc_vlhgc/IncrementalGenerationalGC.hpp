@@ -435,6 +435,13 @@ private:
 	 */
 	void runPartialGarbageCollect(MM_EnvironmentVLHGC *env, MM_AllocateDescription *allocDescription);
 
+	/**
+	 * Record each mutator thread's TLH waste and, if adaptive TLH sizing is enabled, derive the refresh size each thread will
+	 * request until the next PGC from its share of the TLH bytes refreshed since the last one.
+	 * Must be called before the TLHs are flushed for collection.
+	 */
+	void updateThreadLocalHeapSizing(MM_EnvironmentVLHGC *env);
+
 	/**
 	 * Perform an increment of a global mark phase (GMP).  The main (internal) entry point to running GMP increment.
 	 */
@@ -24,6 +24,7 @@
  * @ingroup gc_vlhgc
  */
 
+#include "omrthread.h"
 #include "ModronAssertions.h"
 
 #include "InterRegionRememberedSet.hpp"
@@ -100,11 +101,27 @@ MM_InterRegionRememberedSet::exportStats(MM_EnvironmentVLHGC* env, MM_Collection
 
 
 void
-MM_InterRegionRememberedSet::threadLocalInitialize(MM_EnvironmentVLHGC* env)
+MM_InterRegionRememberedSet::initializeRegionBuckets(MM_EnvironmentVLHGC* env, MM_HeapRegionDescriptorVLHGC *region)
 {
-	for (UDATA index = 0; index < _heapRegionManager->getTableRegionCount(); index++) {
-		MM_HeapRegionDescriptorVLHGC *region = (MM_HeapRegionDescriptorVLHGC *)_heapRegionManager->physicalTableDescriptorForIndex(index);
-		region->getRememberedSetCardList()->initialize(env, index);
+	MM_RememberedSetCardList *rscl = region->getRememberedSetCardList();
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env);
+	/* regions committed before the bucket pool exists are picked up by initializeRememberedSetCardBucketPool() */
+	if (NULL != extensions->rememberedSetCardBucketPool) {
+		/* the pool publication and a concurrent commit of the region can both get here:  the one which claims the list links the buckets */
+		if (rscl->claimBucketsInitialization()) {
+			UDATA regionCount = _heapRegionManager->getTableRegionCount();
+			UDATA index = _heapRegionManager->mapDescriptorToRegionTableIndex(region);
+			/* each GC thread owns a slice of the pool with one bucket per region (see MM_EnvironmentVLHGC::initializeGCThread) */
+			for (UDATA slaveID = 0; slaveID < extensions->gcThreadCount; slaveID++) {
+				rscl->initialize(env, index, &extensions->rememberedSetCardBucketPool[slaveID * regionCount]);
+			}
+			rscl->publishBucketsInitialized();
+		} else {
+			/* the region may be used as soon as we return, so wait for the claiming thread to finish linking */
+			while (!rscl->areBucketsInitialized()) {
+				omrthread_yield();
+			}
+		}
 	}
 }
 
@@ -529,10 +529,12 @@ public:
 
 
 	/**
-	 * Initialize Thread local resources for RS CardLists for all threads
-	 * @param env master GC thread
+	 * Link the RSCL buckets of every GC thread into the RSCL of the given region.  Done when the region is first committed
+	 * (rather than for every region in the table at startup) so that the bucket pool of a large, mostly uncommitted heap is not touched.
+	 * @param env[in] the thread committing the region
+	 * @param region[in] the region being committed
 	 */
-	void threadLocalInitialize(MM_EnvironmentVLHGC* env);
+	void initializeRegionBuckets(MM_EnvironmentVLHGC* env, MM_HeapRegionDescriptorVLHGC *region);
 
 	/**
 	 * Teardown InterRegionRememberedSet
@@ -547,6 +549,13 @@ public:
 	{
 		env->initializeGCThread();
 		_rememberedSetCardBucketPool = env->_rememberedSetCardBucketPool;
+		/* only the regions committed so far need their buckets, the rest are initialized as they are committed */
+		for (UDATA index = 0; index < _heapRegionManager->getTableRegionCount(); index++) {
+			MM_HeapRegionDescriptorVLHGC *region = physicalTableDescriptorForIndex(index);
+			if (region->isCommitted()) {
+				initializeRegionBuckets(env, region);
+			}
+		}
 	}
 	
 	/**
@@ -57,6 +57,7 @@
 #include "HeapRegionDescriptorVLHGC.hpp"
 #include "HeapRegionIteratorVLHGC.hpp"
 #include "HeapRegionManagerTarok.hpp"
+#include "IncrementalCardTable.hpp"
 #include "InterRegionRememberedSet.hpp"
 #include "MarkMap.hpp"
 #include "PartialMarkingScheme.hpp"
@@ -74,6 +75,7 @@
 #include "RegionBasedOverflowVLHGC.hpp"
 #include "RootScanner.hpp"
 #include "SegmentIterator.hpp"
+#include "SlotPrefetchRing.hpp"
 #include "StackSlotValidator.hpp"
 #include "SublistIterator.hpp"
 #include "SublistPool.hpp"
@@ -663,6 +665,14 @@ MM_PartialMarkingScheme::scanReferenceMixedObject(MM_EnvironmentVLHGC *env, J9Ob
 	}
 }
 
+MMINLINE void
+MM_PartialMarkingScheme::markPointerArraySlot(MM_EnvironmentVLHGC *env, J9IndexableObject *objectPtr, J9Object *value)
+{
+	markObject(env, value);
+
+	rememberReferenceIfRequired(env, (J9Object *)objectPtr, value);
+}
+
 UDATA
 MM_PartialMarkingScheme::scanPointerArrayObjectSplit(MM_EnvironmentVLHGC *env, J9IndexableObject *objectPtr, UDATA startIndex, ScanReason reason)
 {
@@ -689,17 +699,22 @@ MM_PartialMarkingScheme::scanPointerArrayObjectSplit(MM_EnvironmentVLHGC *env, J
 		/* TODO: this iterator scans the array backwards - change it to forward, and optimize it since we can guarantee the range will be contiguous */
 		GC_PointerArrayIterator pointerArrayIterator(_javaVM, (J9Object *)objectPtr);
 		pointerArrayIterator.setIndex(startIndex + slotsToScan);
+		/* slots are marked scanPrefetchDistance slots behind the iterator so that the target headers have been prefetched by the time they are marked */
+		MM_SlotPrefetchRing prefetchRing(_javaVM->omrVM, _extensions->scanPrefetchDistance);
 		for (UDATA scanCount = 0; scanCount < slotsToScan; scanCount++) {
 			GC_SlotObject *slotObject = pointerArrayIterator.nextSlot();
 			if (NULL == slotObject) {
 				/* this can happen if the array is only partially allocated */
 				break;
 			}
-			J9Object * value = slotObject->readReferenceFromSlot();
-	
-			markObject(env, value);
-			
-			rememberReferenceIfRequired(env, (J9Object *)objectPtr, value);
+			prefetchRing.push(slotObject->readAddressFromSlot());
+
+			if (prefetchRing.isFull()) {
+				markPointerArraySlot(env, objectPtr, prefetchRing.pop().target);
+			}
+		}
+		while (!prefetchRing.isEmpty()) {
+			markPointerArraySlot(env, objectPtr, prefetchRing.pop().target);
 		}
 	}
 
@@ -1312,7 +1327,7 @@ MM_PartialMarkingScheme::cleanCardTableForPartialCollect(MM_EnvironmentVLHGC *en
 	U_64 cleanStartTime = j9time_hires_clock();
 
 	bool gmpIsRunning = (NULL != env->_cycleState->_externalCycleState);
-	MM_CardTable* cardTable = _extensions->cardTable;
+	MM_IncrementalCardTable *cardTable = (MM_IncrementalCardTable *)_extensions->cardTable;
 	GC_HeapRegionIteratorVLHGC regionIterator(_heapRegionManager);
 	MM_HeapRegionDescriptorVLHGC *region = NULL;
 	while(NULL != (region = regionIterator.nextRegion())) {
@@ -1320,7 +1335,7 @@ MM_PartialMarkingScheme::cleanCardTableForPartialCollect(MM_EnvironmentVLHGC *en
 			if(J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
 				if (!region->_markData._shouldMark) {
 					/* this region isn't part of the collection set, so it may have dirty or remembered cards in it. */
-					cardTable->cleanCardsInRegion(env, cardCleaner, region);
+					cardTable->cleanNonCleanCardsInRegion(env, cardCleaner, region);
 				} else {
 					/* this region is part of the collection set, so just change its dirty cards to clean (or GMP_MUST_SCAN) */
 					void *low = region->getLowAddress();
@@ -1328,6 +1343,7 @@ MM_PartialMarkingScheme::cleanCardTableForPartialCollect(MM_EnvironmentVLHGC *en
 					Card *card = cardTable->heapAddrToCardAddr(env, low);
 					Card *toCard = cardTable->heapAddrToCardAddr(env, high);
 					
+					card = MM_IncrementalCardTable::findFirstNonCleanCard(card, toCard);
 					while (card < toCard) {
 						Card fromState = *card;
 						switch(fromState) {
@@ -1351,7 +1367,7 @@ MM_PartialMarkingScheme::cleanCardTableForPartialCollect(MM_EnvironmentVLHGC *en
 						default:
 							Assert_MM_unreachable();
 						}
-						card += 1;
+						card = MM_IncrementalCardTable::findFirstNonCleanCard(card + 1, toCard);
 					}
 				}	
 			}
@@ -295,6 +295,14 @@ private:
 	 */
 	void scanReferenceMixedObject(MM_EnvironmentVLHGC *env, J9Object *objectPtr, ScanReason reason);
 	
+	/**
+	 * Mark the target of a single pointer array slot and remember the reference if required.
+	 * @param env[in] the current thread
+	 * @param objectPtr[in] the object array containing the slot
+	 * @param value[in] the reference read from the slot
+	 */
+	MMINLINE void markPointerArraySlot(MM_EnvironmentVLHGC *env, J9IndexableObject *objectPtr, J9Object *value);
+
 	/**
 	 * Scan the specified portion of the specified object array.
 	 * If the function does not scan to the end of the array, the remaining portion of the
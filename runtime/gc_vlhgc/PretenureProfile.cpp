@@ -0,0 +1,157 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include <string.h>
+
+#include "PretenureProfile.hpp"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentVLHGC.hpp"
+#include "GCExtensions.hpp"
+
+/**
+ * Minimum sampled bytes a class must have contributed from Eden (scaled by the sample rate) before it can be pretenured,
+ * so that a handful of long-lived singletons do not cause a class to be pretenured.
+ */
+#define PRETENURE_MINIMUM_EDEN_BYTES (64 * 1024)
+
+/**
+ * Weight given to the survival rate observed in the most recent copy-forward when updating the decayed survival rate.
+ */
+#define PRETENURE_SURVIVAL_RATE_WEIGHT 0.25
+
+/**
+ * How far below the survival threshold the survival rate of a pretenured class must fall before it stops being pretenured,
+ * so that a class whose survival rate hovers around the threshold is not switched on and off every copy-forward.
+ */
+#define PRETENURE_CLEAR_MARGIN 0.10
+
+MM_PretenureProfile *
+MM_PretenureProfile::newInstance(MM_EnvironmentVLHGC *env)
+{
+	MM_PretenureProfile *profile = (MM_PretenureProfile *)env->getForge()->allocate(sizeof(MM_PretenureProfile), MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
+	if (NULL != profile) {
+		new(profile) MM_PretenureProfile(env);
+		if (!profile->initialize(env)) {
+			profile->kill(env);
+			profile = NULL;
+		}
+	}
+	return profile;
+}
+
+void
+MM_PretenureProfile::kill(MM_EnvironmentVLHGC *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_PretenureProfile::initialize(MM_EnvironmentVLHGC *env)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env);
+
+	_entries = (Entry *)env->getForge()->allocate(sizeof(Entry) * ENTRY_COUNT, MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
+	if (NULL == _entries) {
+		return false;
+	}
+	_sampleMask = extensions->tarokPretenureSampleRate - 1;
+	_minimumSampledBytes = PRETENURE_MINIMUM_EDEN_BYTES / extensions->tarokPretenureSampleRate;
+	_survivalThreshold = (double)extensions->tarokPretenureSurvivalThreshold / 100.0;
+	_clearThreshold = OMR_MAX(0.0, _survivalThreshold - PRETENURE_CLEAR_MARGIN);
+	reset(env);
+
+	return true;
+}
+
+void
+MM_PretenureProfile::tearDown(MM_EnvironmentVLHGC *env)
+{
+	if (NULL != _entries) {
+		env->getForge()->free(_entries);
+		_entries = NULL;
+	}
+}
+
+void
+MM_PretenureProfile::reset(MM_EnvironmentVLHGC *env)
+{
+	memset((void *)_entries, 0, sizeof(Entry) * ENTRY_COUNT);
+	_pretenuredClassCount = 0;
+}
+
+void
+MM_PretenureProfile::recordSample(MM_EnvironmentVLHGC *env, J9Class *clazz, UDATA bytes, bool fromEden)
+{
+	UDATA index = hashClass(clazz);
+	for (UDATA probe = 0; probe < PROBE_LIMIT; probe++) {
+		Entry *entry = &_entries[(index + probe) & (ENTRY_COUNT - 1)];
+		J9Class *entryClass = entry->_clazz;
+		if (NULL == entryClass) {
+			/* claim the empty entry (if another thread beat us to it, see if it claimed it for the same class) */
+			entryClass = (J9Class *)MM_AtomicOperations::lockCompareExchange((volatile UDATA *)&entry->_clazz, (UDATA)NULL, (UDATA)clazz);
+			if (NULL == entryClass) {
+				entryClass = clazz;
+			}
+		}
+		if (clazz == entryClass) {
+			if (fromEden) {
+				MM_AtomicOperations::add(&entry->_edenBytes, bytes);
+			} else {
+				MM_AtomicOperations::add(&entry->_agedBytes, bytes);
+			}
+			break;
+		}
+	}
+	/* if the probe limit was reached the sample is dropped: the table is full around this class's hash */
+}
+
+void
+MM_PretenureProfile::updatePretenureDecisions(MM_EnvironmentVLHGC *env)
+{
+	UDATA pretenuredClassCount = 0;
+	for (UDATA index = 0; index < ENTRY_COUNT; index++) {
+		Entry *entry = &_entries[index];
+		if (NULL != entry->_clazz) {
+			UDATA edenBytes = entry->_edenBytes;
+			if (0 != edenBytes) {
+				/* the bytes of this class leaving the nursery relative to the bytes of it leaving Eden approximates the fraction which survive the nursery */
+				double survivalRate = OMR_MIN(1.0, (double)entry->_agedBytes / (double)edenBytes);
+				entry->_survivalRate = (entry->_survivalRate * (1.0 - PRETENURE_SURVIVAL_RATE_WEIGHT)) + (survivalRate * PRETENURE_SURVIVAL_RATE_WEIGHT);
+			}
+			if (entry->_pretenure) {
+				entry->_pretenure = (entry->_survivalRate >= _clearThreshold);
+			} else {
+				entry->_pretenure = (edenBytes >= _minimumSampledBytes) && (entry->_survivalRate >= _survivalThreshold);
+			}
+			if (entry->_pretenure) {
+				pretenuredClassCount += 1;
+			}
+			/* decay the samples so that the profile follows phase changes in the application */
+			entry->_edenBytes = edenBytes / 2;
+			entry->_agedBytes = entry->_agedBytes / 2;
+		}
+	}
+	_pretenuredClassCount = pretenuredClassCount;
+}
@@ -0,0 +1,198 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Tarok
+ */
+
+#if !defined(PRETENUREPROFILE_HPP_)
+#define PRETENUREPROFILE_HPP_
+
+#include "j9.h"
+#include "j9cfg.h"
+
+#include "BaseNonVirtual.hpp"
+
+class MM_EnvironmentVLHGC;
+
+/**
+ * Survival profile used by copy-forward to pretenure objects which consistently survive the nursery.
+ *
+ * Copied objects are sampled (by address, so no per-thread state is required) and their bytes are attributed to their class,
+ * split between bytes copied out of Eden and bytes copied out of regions at the oldest nursery age (that is, bytes leaving the
+ * nursery).  At the end of each copy-forward the ratio of the two (decayed over time) is used to decide which classes should be copied out of Eden directly into the first
+ * non-nursery age, rather than being copied through every nursery age on the way there.  The sampled objects of a pretenured class still age through the
+ * nursery, so that its survival rate stays current and the class stops being pretenured once the rate falls clearly below the threshold.
+ *
+ * The class of the object is used as the key of the profile since the allocation site of an object is not recorded in the heap.
+ * @ingroup GC_Modron_Tarok
+ */
+class MM_PretenureProfile : public MM_BaseNonVirtual
+{
+	/* Data Members */
+public:
+protected:
+private:
+	/**
+	 * A single profiled class.  _clazz is claimed with an atomic compare and swap, the counters are updated atomically.
+	 */
+	struct Entry {
+		J9Class * volatile _clazz; /**< The class this entry profiles (NULL if the entry is unused) */
+		volatile UDATA _edenBytes; /**< Sampled bytes of this class copied out of Eden */
+		volatile UDATA _agedBytes; /**< Sampled bytes of this class copied out of regions at the oldest nursery age */
+		double _survivalRate; /**< Decayed ratio of _agedBytes to _edenBytes */
+		bool _pretenure; /**< True if objects of this class should be copied out of Eden directly into the pretenure age */
+	};
+
+	enum {
+		ENTRY_COUNT = 4096, /**< The number of entries in the profile (must be a power of two) */
+		PROBE_LIMIT = 8, /**< The number of entries examined before giving up on a lookup or insert */
+	};
+
+	Entry *_entries; /**< Open addressed table of profiled classes */
+	UDATA _sampleMask; /**< Objects whose (aligned) address has none of these bits set are sampled */
+	UDATA _minimumSampledBytes; /**< Sampled Eden bytes required before a class is considered for pretenuring */
+	double _survivalThreshold; /**< Survival rate above which a class is pretenured */
+	double _clearThreshold; /**< Survival rate below which a pretenured class stops being pretenured */
+	UDATA _pretenuredClassCount; /**< Number of classes currently flagged for pretenuring */
+
+	/* Methods */
+public:
+	static MM_PretenureProfile *newInstance(MM_EnvironmentVLHGC *env);
+	void kill(MM_EnvironmentVLHGC *env);
+
+	/**
+	 * Record the copy of an object, if it is selected by sampling.
+	 * @param env[in] the current GC thread
+	 * @param object[in] the (original) address of the copied object, used for sampling
+	 * @param clazz[in] the class of the object
+	 * @param bytes[in] the size of the object
+	 * @param fromEden[in] true if the object was copied out of an Eden region, false if it was copied out of the oldest nursery age
+	 */
+	MMINLINE void
+	recordCopy(MM_EnvironmentVLHGC *env, J9Object *object, J9Class *clazz, UDATA bytes, bool fromEden)
+	{
+		if (isSampled(object)) {
+			UDATA sampledBytes = bytes;
+			if (!fromEden && isPretenured(clazz)) {
+				/* only the objects of a pretenured class sampled out of Eden still age through the nursery, so sampling them again
+				 * as they leave it is a sample of a sample: scale it back to the rate of the Eden samples
+				 */
+				sampledBytes *= (_sampleMask + 1);
+			}
+			recordSample(env, clazz, sampledBytes, fromEden);
+		}
+	}
+
+	/**
+	 * @param object[in] the (original) address of an object being copied out of Eden
+	 * @param clazz[in] the class of the object
+	 * @return true if the object should be copied directly into the pretenure age
+	 */
+	MMINLINE bool
+	shouldPretenure(J9Object *object, J9Class *clazz)
+	{
+		/* sampled objects age through the nursery as usual, measuring the survival rate of the class */
+		return !isSampled(object) && isPretenured(clazz);
+	}
+
+	/**
+	 * Recalculate survival rates and pretenuring decisions from the samples recorded since the last update, and decay the samples.
+	 * Called single-threaded at the end of each copy-forward.
+	 * @param env[in] the master GC thread
+	 */
+	void updatePretenureDecisions(MM_EnvironmentVLHGC *env);
+
+	/**
+	 * Forget all profiled classes.  Must be called when classes are unloaded since the profile is keyed by J9Class.
+	 * @param env[in] the current GC thread
+	 */
+	void reset(MM_EnvironmentVLHGC *env);
+
+	/**
+	 * @return the number of classes currently being pretenured
+	 */
+	MMINLINE UDATA getPretenuredClassCount() { return _pretenuredClassCount; }
+
+protected:
+	bool initialize(MM_EnvironmentVLHGC *env);
+	void tearDown(MM_EnvironmentVLHGC *env);
+
+private:
+	MMINLINE UDATA
+	hashClass(J9Class *clazz)
+	{
+		UDATA hash = (UDATA)clazz >> 3;
+		return (hash ^ (hash >> 11)) & (ENTRY_COUNT - 1);
+	}
+
+	MMINLINE Entry *
+	findEntry(J9Class *clazz)
+	{
+		UDATA index = hashClass(clazz);
+		for (UDATA probe = 0; probe < PROBE_LIMIT; probe++) {
+			Entry *entry = &_entries[(index + probe) & (ENTRY_COUNT - 1)];
+			J9Class *entryClass = entry->_clazz;
+			if (clazz == entryClass) {
+				return entry;
+			}
+			if (NULL == entryClass) {
+				break;
+			}
+		}
+		return NULL;
+	}
+
+	MMINLINE bool
+	isSampled(J9Object *object)
+	{
+		return 0 == (((UDATA)object >> 3) & _sampleMask);
+	}
+
+	MMINLINE bool
+	isPretenured(J9Class *clazz)
+	{
+		bool result = false;
+		if (0 != _pretenuredClassCount) {
+			Entry *entry = findEntry(clazz);
+			result = (NULL != entry) && entry->_pretenure;
+		}
+		return result;
+	}
+
+	void recordSample(MM_EnvironmentVLHGC *env, J9Class *clazz, UDATA bytes, bool fromEden);
+
+	MM_PretenureProfile(MM_EnvironmentVLHGC *env)
+		: MM_BaseNonVirtual()
+		, _entries(NULL)
+		, _sampleMask(0)
+		, _minimumSampledBytes(0)
+		, _survivalThreshold(0.0)
+		, _clearThreshold(0.0)
+		, _pretenuredClassCount(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* PRETENUREPROFILE_HPP_ */
@@ -842,6 +842,7 @@ MM_ReclaimDelegate::masterThreadCompact(MM_EnvironmentVLHGC *env, MM_AllocateDes
 	reportCompactStart(env);
 
 	extensions->interRegionRememberedSet->setupForPartialCollect(env);
+	extensions->tarokCompactCount += 1;
 
 	MM_ParallelWriteOnceCompactTask compactTask(env, _dispatcher, _writeOnceCompactor, env->_cycleState, nextMarkMap);
 	_dispatcher->run(env, &compactTask);
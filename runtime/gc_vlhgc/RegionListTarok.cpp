@@ -33,11 +33,13 @@ MM_RegionListTarok::insertRegion(MM_HeapRegionDescriptorVLHGC *region)
 {
 	Assert_MM_true(NULL == region->_allocateData._nextInList);
 	Assert_MM_true(NULL == region->_allocateData._previousInList);
+	Assert_MM_true(NULL == region->_allocateData._containingList);
 	if (NULL != _regions) {
 		region->_allocateData._nextInList = _regions;
 		_regions->_allocateData._previousInList = region;
 	}
 	_regions = region;
+	region->_allocateData._containingList = this;
 	_listSize += 1;
 }
 
@@ -46,6 +48,7 @@ MM_RegionListTarok::removeRegion(MM_HeapRegionDescriptorVLHGC *region)
 {
 	/* the list must contain something */
 	Assert_MM_true(_listSize > 0);
+	Assert_MM_true(this == region->_allocateData._containingList);
 	MM_HeapRegionDescriptorVLHGC *next = region->_allocateData._nextInList;
 	MM_HeapRegionDescriptorVLHGC *previous = region->_allocateData._previousInList;
 	
@@ -60,5 +63,6 @@ MM_RegionListTarok::removeRegion(MM_HeapRegionDescriptorVLHGC *region)
 	}
 	region->_allocateData._nextInList = NULL;
 	region->_allocateData._previousInList = NULL;
+	region->_allocateData._containingList = NULL;
 	_listSize -= 1;
 }
@@ -93,6 +93,12 @@ public:
 	 * @return The number of regions in the list
 	 */
 	MMINLINE UDATA listSize() { return _listSize; }
+
+	/**
+	 * @param region[in] a region
+	 * @return true if the region is held in the receiver (the caller must hold whatever lock protects the receiver)
+	 */
+	MMINLINE bool containsRegion(MM_HeapRegionDescriptorVLHGC *region) { return this == region->_allocateData._containingList; }
 	
 	MM_RegionListTarok()
 		: MM_BaseNonVirtual()
@@ -26,10 +26,10 @@
 #include "InterRegionRememberedSet.hpp"
 
 bool
-MM_RememberedSetCardList::initialize(MM_EnvironmentVLHGC *env, UDATA index)
+MM_RememberedSetCardList::initialize(MM_EnvironmentVLHGC *env, UDATA index, MM_RememberedSetCardBucket *bucketPool)
 {
 	_index = index;
-	MM_RememberedSetCardBucket *bucket = &(env->_rememberedSetCardBucketPool[_index]);
+	MM_RememberedSetCardBucket *bucket = &(bucketPool[_index]);
 	new(bucket) MM_RememberedSetCardBucket();
 	bucket->initialize(env, this, _bucketListHead);
 	_bucketListHead = bucket;
@@ -28,6 +28,7 @@
 #include "modron.h"
 #include "ModronAssertions.h"
 
+#include "AtomicOperations.hpp"
 #include "BaseVirtual.hpp"
 #include "EnvironmentVLHGC.hpp"
 #include "GCExtensions.hpp"
@@ -41,6 +42,14 @@ class MM_RememberedSetCardList : public MM_BaseVirtual
 	friend class MM_RememberedSetCardBucket;
 
 public:
+	/**
+	 * States of the linking of the GC threads' buckets into the list (see MM_InterRegionRememberedSet::initializeRegionBuckets)
+	 */
+	enum BucketsState {
+		BUCKETS_UNINITIALIZED = 0, /**< no thread has claimed the linking */
+		BUCKETS_INITIALIZING, /**< a thread has claimed the linking and is doing it */
+		BUCKETS_INITIALIZED /**< the buckets of all GC threads are linked into the list */
+	};
 protected:
 private:
 	MM_RememberedSetCardBucket *_bucketListHead;			/**< head of the linked list of buckets */
@@ -50,6 +59,7 @@ private:
 	bool _stable;											/**< if true, list is overflowed due to region being stable */
 	volatile UDATA _bufferCount;										/**< count of buffers in all buckets' lists */
 	MM_RememberedSetCardList * volatile _nonEmptyOverflowedNext; 		/**< overflowed RSCL found during a GC cycle are linked into a single liked list - this is next pointer */
+	volatile UDATA _bucketsState;							/**< a BucketsState:  which thread links the buckets is decided by an atomic claim of this state */
 private:
 	/**
 	 * Remove an entry. This just NULLs the entry. Compaction/shifting is to be done later, explicitly.
@@ -172,9 +182,37 @@ public:
 	void clear(MM_EnvironmentVLHGC *env);
 
 	/**
-	 * Initialize the list
+	 * Link one GC thread's bucket for this list into the list
+	 * @param env[in] the current thread
+	 * @param index[in] the table index of the region which owns the list
+	 * @param bucketPool[in] the bucket pool of the GC thread whose bucket is being linked
+	 */
+	bool initialize(MM_EnvironmentVLHGC *env, UDATA index, MM_RememberedSetCardBucket *bucketPool);
+
+	/**
+	 * @return true if the buckets of the GC threads have been linked into the list
+	 */
+	bool areBucketsInitialized() {
+		return BUCKETS_INITIALIZED == _bucketsState;
+	}
+
+	/**
+	 * Atomically claim the linking of the GC threads' buckets into the list.  Exactly one caller succeeds; it must link the
+	 * buckets and then call publishBucketsInitialized().
+	 * @return true if the calling thread claimed the linking, false if another thread has already claimed it
 	 */
-	bool initialize(MM_EnvironmentVLHGC *env, UDATA index);
+	bool claimBucketsInitialization() {
+		return BUCKETS_UNINITIALIZED == MM_AtomicOperations::lockCompareExchange(&_bucketsState, BUCKETS_UNINITIALIZED, BUCKETS_INITIALIZING);
+	}
+
+	/**
+	 * Called by the thread which claimed the linking once all buckets are linked, to make them visible to other threads
+	 */
+	void publishBucketsInitialized() {
+		Assert_MM_true(BUCKETS_INITIALIZING == _bucketsState);
+		MM_AtomicOperations::storeSync();
+		_bucketsState = BUCKETS_INITIALIZED;
+	}
 
 	/**
 	 * Teardown the list
@@ -191,6 +229,7 @@ public:
 	  , _stable(false)
 	  , _bufferCount(0)
 	  , _nonEmptyOverflowedNext(NULL)
+	  , _bucketsState(BUCKETS_UNINITIALIZED)
 	{
 		_typeId = __FUNCTION__;
 	}
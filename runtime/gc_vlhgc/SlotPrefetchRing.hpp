@@ -0,0 +1,147 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Tarok
+ */
+
+#if !defined(SLOTPREFETCHRING_HPP_)
+#define SLOTPREFETCHRING_HPP_
+
+#include "j9.h"
+#include "j9cfg.h"
+#include "modron.h"
+
+#include "SlotObject.hpp"
+
+#if defined(_MSC_VER) && (defined(J9HAMMER) || defined(J9X86))
+#include <xmmintrin.h>
+#define J9GC_PREFETCH_OBJECT(address) _mm_prefetch((const char *)(address), _MM_HINT_T0)
+#elif defined(__GNUC__) || defined(__clang__)
+#define J9GC_PREFETCH_OBJECT(address) __builtin_prefetch((const void *)(address), 1, 3)
+#else
+#define J9GC_PREFETCH_OBJECT(address)
+#endif
+
+/**
+ * A small FIFO of slots used to hide the latency of touching the targets of a run of reference slots
+ * (a split unit of a large pointer array, or the slots of a mixed object).  The reference in each slot
+ * pushed into the ring is read once, and the header of the object it refers to is prefetched; the slot
+ * and its reference are only handed back for processing once _distance newer slots have been pushed
+ * behind it, giving the prefetch time to complete.
+ *
+ * The reference is carried with the slot so that it is not decoded a second time when the slot is
+ * processed.  The collector must not update the slots while they are in the ring; a store by a mutator
+ * during concurrent marking is no different from one made just after the slot was scanned (the card
+ * table records it either way).
+ * @ingroup GC_Modron_Tarok
+ */
+class MM_SlotPrefetchRing
+{
+public:
+	enum {
+		MAXIMUM_DISTANCE = 32, /**< The largest supported number of slots in flight */
+		RING_SIZE = 64 /**< Capacity of the ring, a power of two above MAXIMUM_DISTANCE so that indices wrap with a mask */
+	};
+
+	/**
+	 * A slot waiting in the ring.
+	 */
+	struct PendingSlot {
+		fj9object_t *slotAddress; /**< The address of the slot */
+		J9Object *target; /**< The reference read from the slot when it was pushed */
+		bool leaf; /**< The leaf bit of the slot (false for pointer array slots) */
+	};
+
+private:
+	OMR_VM *_omrVM; /**< Used to decode compressed slots */
+	UDATA _distance; /**< The number of slots kept in flight ahead of the slot being processed (0 disables prefetching) */
+	UDATA _head; /**< Index of the oldest pending slot */
+	UDATA _count; /**< The number of pending slots */
+	UDATA _prefetchCount; /**< The number of non-NULL targets prefetched through this ring */
+	PendingSlot _slots[RING_SIZE]; /**< Circular buffer of pending slots */
+
+public:
+	/**
+	 * @return true if the ring has reached its prefetch distance and the oldest slot should be processed
+	 */
+	MMINLINE bool isFull() const { return _count > _distance; }
+
+	/**
+	 * @return true if there are no pending slots
+	 */
+	MMINLINE bool isEmpty() const { return 0 == _count; }
+
+	/**
+	 * @return the number of object headers prefetched so far
+	 */
+	MMINLINE UDATA getPrefetchCount() const { return _prefetchCount; }
+
+	/**
+	 * Add a slot to the tail of the ring, reading its reference and prefetching the header of the object it refers to.
+	 * @param slotAddress[in] the address of the slot (the caller must have made room with pop() if isFull())
+	 * @param leaf[in] the leaf bit of the slot, handed back with it
+	 */
+	MMINLINE void
+	push(fj9object_t *slotAddress, bool leaf = false)
+	{
+		GC_SlotObject slotObject(_omrVM, slotAddress);
+		J9Object *target = slotObject.readReferenceFromSlot();
+		if ((0 != _distance) && (NULL != target)) {
+			J9GC_PREFETCH_OBJECT(target);
+			_prefetchCount += 1;
+		}
+		PendingSlot *pending = &_slots[(_head + _count) & (RING_SIZE - 1)];
+		pending->slotAddress = slotAddress;
+		pending->target = target;
+		pending->leaf = leaf;
+		_count += 1;
+	}
+
+	/**
+	 * Remove and return the oldest pending slot.
+	 * @return the slot, with the reference read from it when it was pushed
+	 */
+	MMINLINE PendingSlot
+	pop()
+	{
+		PendingSlot pending = _slots[_head];
+		_head = (_head + 1) & (RING_SIZE - 1);
+		_count -= 1;
+		return pending;
+	}
+
+	/**
+	 * @param omrVM[in] the VM, used to decode compressed references
+	 * @param distance[in] the number of slots to prefetch ahead (clamped to MAXIMUM_DISTANCE)
+	 */
+	MM_SlotPrefetchRing(OMR_VM *omrVM, UDATA distance)
+		: _omrVM(omrVM)
+		, _distance((distance > MAXIMUM_DISTANCE) ? (UDATA)MAXIMUM_DISTANCE : distance)
+		, _head(0)
+		, _count(0)
+		, _prefetchCount(0)
+	{}
+};
+
+#endif /* SLOTPREFETCHRING_HPP_ */
@@ -119,6 +119,38 @@ MM_VLHGCAccessBarrier::preBatchObjectStore(J9VMThread *vmThread, J9Class *destCl
 	return true;
 }
 
+/**
+ * @copydoc MM_ObjectAccessBarrier::preObjectStoreRange()
+ *
+ * Balanced has no pre-store barrier, so bulk stores are always supported.
+ */
+bool
+MM_VLHGCAccessBarrier::preObjectStoreRange(J9VMThread *vmThread, J9Object *destObject, fj9object_t *destAddress, UDATA slotCount)
+{
+	return true;
+}
+
+/**
+ * @copydoc MM_ObjectAccessBarrier::postObjectStoreRange()
+ *
+ * Dirties the destination's card once for the whole range.  Card cleaning rescans every object whose
+ * header lies in a dirty card in its entirety, so the header card covers all slots of the range even
+ * when they span several cards.  As with the single-slot barrier, nothing is dirtied if only NULLs
+ * were stored.
+ */
+void
+MM_VLHGCAccessBarrier::postObjectStoreRange(J9VMThread *vmThread, J9Object *destObject, fj9object_t *destAddress, UDATA slotCount)
+{
+	fj9object_t *endAddress = destAddress + slotCount;
+	for (fj9object_t *slot = destAddress; slot < endAddress; slot++) {
+		if (0 != *slot) {
+			MM_EnvironmentVLHGC *env = MM_EnvironmentVLHGC::getEnvironment(vmThread);
+			_extensions->cardTable->dirtyCard(env, destObject);
+			break;
+		}
+	}
+}
+
 /**
  * Generational write barrier call when a single object is stored into another.
  * The remembered set system consists of a physical list of objects in the OLD area that
@@ -250,6 +282,22 @@ MM_VLHGCAccessBarrier::postStoreClassToClassLoader(J9VMThread *vmThread, J9Class
 	}
 }
 
+void *
+MM_VLHGCAccessBarrier::getCriticalDataPointer(J9IndexableObject *arrayObject)
+{
+	void *data = NULL;
+#if defined(J9VM_GC_ARRAYLETS)
+	if (!_extensions->indexableObjectModel.isInlineContiguousArraylet(arrayObject)) {
+		/* leaves are never moved, so adjacent leaves can be used in place for as long as the array is alive */
+		data = _extensions->indexableObjectModel.getDataPointerForContiguousLeaves(arrayObject);
+	} else
+#endif /* defined(J9VM_GC_ARRAYLETS) */
+	{
+		data = (void *)_extensions->indexableObjectModel.getDataPointerForContiguous(arrayObject);
+	}
+	return data;
+}
+
 void*
 MM_VLHGCAccessBarrier::jniGetPrimitiveArrayCritical(J9VMThread* vmThread, jarray array, jboolean *isCopy)
 {
@@ -264,12 +312,8 @@ MM_VLHGCAccessBarrier::jniGetPrimitiveArrayCritical(J9VMThread* vmThread, jarray
 	if (alwaysCopyInCritical) {
 		shouldCopy = true;
 	} else {
-#if defined(J9VM_GC_ARRAYLETS)
 		/* an array having discontiguous extents is another reason to force the critical section to be a copy */
-		if (!_extensions->indexableObjectModel.isInlineContiguousArraylet(arrayObject)) {
-			shouldCopy = true;
-		}
-#endif
+		shouldCopy = (NULL == getCriticalDataPointer(arrayObject));
 	}
 
 	if (shouldCopy) {
@@ -291,7 +335,7 @@ MM_VLHGCAccessBarrier::jniGetPrimitiveArrayCritical(J9VMThread* vmThread, jarray
 		MM_JNICriticalRegion::enterCriticalRegion(vmThread, true);
 		Assert_MM_true(vmThread->publicFlags & J9_PUBLIC_FLAGS_VM_ACCESS);
 		arrayObject = (J9IndexableObject*)J9_JNI_UNWRAP_REFERENCE(array);
-		data = (void *)_extensions->indexableObjectModel.getDataPointerForContiguous(arrayObject);
+		data = getCriticalDataPointer(arrayObject);
 		if(NULL != isCopy) {
 			*isCopy = JNI_FALSE;
 		}
@@ -318,12 +362,8 @@ MM_VLHGCAccessBarrier::jniReleasePrimitiveArrayCritical(J9VMThread* vmThread, ja
 	if (alwaysCopyInCritical) {
 		shouldCopy = true;
 	} else {
-#if defined(J9VM_GC_ARRAYLETS)
 		/* an array having discontiguous extents is another reason to force the critical section to be a copy */
-		if (!_extensions->indexableObjectModel.isInlineContiguousArraylet(arrayObject)) {
-			shouldCopy = true;
-		}
-#endif
+		shouldCopy = (NULL == getCriticalDataPointer(arrayObject));
 	}
 	if(shouldCopy) {
 		if(JNI_ABORT != mode) {
@@ -348,7 +388,7 @@ MM_VLHGCAccessBarrier::jniReleasePrimitiveArrayCritical(J9VMThread* vmThread, ja
 		 * Objects can not be moved if critical section is active
 		 * This trace point will be generated if object has been moved or passed value of elems is corrupted
 		 */
-		void *data = (void *)_extensions->indexableObjectModel.getDataPointerForContiguous(arrayObject);
+		void *data = getCriticalDataPointer(arrayObject);
 		if(elems != data) {
 			Trc_MM_JNIReleasePrimitiveArrayCritical_invalid(vmThread, arrayObject, elems, data);
 		}
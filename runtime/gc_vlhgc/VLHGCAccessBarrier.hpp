@@ -46,6 +46,11 @@ class MM_VLHGCAccessBarrier : public MM_ObjectAccessBarrier
 private:
 	void postObjectStoreImpl(J9VMThread *vmThread, J9Object *dstObject, J9Object *srcObject);
 	void preBatchObjectStoreImpl(J9VMThread *vmThread, J9Object *dstObject);
+	/**
+	 * @return the address at which a JNI critical section can access the data of arrayObject in place, or NULL if the data is
+	 * split across arraylet leaves which are not adjacent in the heap (in which case the critical section works on a copy)
+	 */
+	void *getCriticalDataPointer(J9IndexableObject *arrayObject);
 
 protected:
 	virtual bool initialize(MM_EnvironmentBase *env);
@@ -65,6 +70,8 @@ public:
 	virtual void postObjectStore(J9VMThread *vmThread, J9Class *destClass, J9Object **destAddress, J9Object *value, bool isVolatile=false);
 	virtual bool preBatchObjectStore(J9VMThread *vmThread, J9Object *destObject, bool isVolatile=false);
 	virtual bool preBatchObjectStore(J9VMThread *vmThread, J9Class *destClass, bool isVolatile=false);
+	virtual bool preObjectStoreRange(J9VMThread *vmThread, J9Object *destObject, fj9object_t *destAddress, UDATA slotCount);
+	virtual void postObjectStoreRange(J9VMThread *vmThread, J9Object *destObject, fj9object_t *destAddress, UDATA slotCount);
 	virtual void recentlyAllocatedObject(J9VMThread *vmThread, J9Object *object); 
 	virtual void postStoreClassToClassLoader(J9VMThread *vmThread, J9ClassLoader* destClassLoader, J9Class* srcClass);
 
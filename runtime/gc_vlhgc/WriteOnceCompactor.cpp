@@ -60,6 +60,7 @@
 #include "HeapRegionDescriptorVLHGC.hpp"
 #include "HeapRegionIteratorVLHGC.hpp"
 #include "HeapStats.hpp"
+#include "IncrementalCardTable.hpp"
 #include "InterRegionRememberedSet.hpp"
 #include "MarkMap.hpp"
 #include "ModronTypes.hpp"
@@ -938,7 +939,7 @@ MM_WriteOnceCompactor::moveObjects(MM_EnvironmentVLHGC *env)
 		} else {
 			/* there is some fixup work to do while we wait for move work to become available.  Clean cards for this subarea */
 			MM_WriteOnceFixupCardCleaner cardCleaner(this, env->_cycleState, _regionManager);
-			cardTable->cleanCardsInRegion(env, &cardCleaner, region);
+			((MM_IncrementalCardTable *)cardTable)->cleanNonCleanCardsInRegion(env, &cardCleaner, region);
 		}
 	}
 }
@@ -0,0 +1,584 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * gcevtdump: decode the binary GC event stream written with -Xgc:verboseBinaryFile=<file> (see VerboseBinaryFormat.h)
+ * into verbose GC XML or into JSON (one object per line).
+ */
+
+#include <string.h>
+
+#include "j9.h"
+#include "j9port.h"
+#include "VerboseBinaryFormat.h"
+
+#if defined(J9ZOS390)
+#include "atoe.h"
+#endif
+
+/* Return values. */
+#define RET_SUCCESS                 0
+#define RET_COMMANDLINE_INCORRECT  -1
+#define RET_ALLOCATE_FAILED        -2
+#define RET_FILE_OPEN_FAILED       -3
+#define RET_FILE_READ_FAILED       -4
+#define RET_BAD_FORMAT             -5
+
+#define GCEVTDUMP_MAXIMUM_STRINGS 256
+#define GCEVTDUMP_MAXIMUM_OPEN_CYCLES 8
+#define GCEVTDUMP_TIMESTAMP_LENGTH 32
+
+typedef enum GCEventOutputFormat {
+	GCEVTDUMP_FORMAT_XML = 0,
+	GCEVTDUMP_FORMAT_JSON
+} GCEventOutputFormat;
+
+typedef struct GCEventDecoder {
+	J9PortLibrary *portLibrary;
+	GCEventOutputFormat format;
+	const J9GCEventStreamHeader *header;
+	const U_8 *ring;
+	const char *strings[GCEVTDUMP_MAXIMUM_STRINGS]; /* interned strings (index 0 is the empty string) */
+	U_16 stringLengths[GCEVTDUMP_MAXIMUM_STRINGS];
+	UDATA stringCount;
+	UDATA nextStanzaId; /* XML stanza identifiers, assigned as the VM does when it writes verbose GC */
+	U_64 cycleIds[GCEVTDUMP_MAXIMUM_OPEN_CYCLES]; /* binary identifiers of the cycles in progress */
+	UDATA cycleStanzaIds[GCEVTDUMP_MAXIMUM_OPEN_CYCLES]; /* XML identifier of the cycle-start of each cycle in cycleIds */
+	U_64 lastCycleStart[GCEVTDUMP_MAXIMUM_STRINGS]; /* timestamp of the last cycle start of each cycle type (by string id) */
+	U_64 incrementStart; /* timestamp of the last increment start */
+	UDATA recordCount; /* records decoded */
+} GCEventDecoder;
+
+static void printUsage(J9PortLibrary *portLibrary);
+static IDATA readFile(J9PortLibrary *portLibrary, const char *fileName, U_8 **bufferPtr, I_64 *lengthPtr);
+static IDATA validateHeader(GCEventDecoder *decoder, U_8 *buffer, I_64 length);
+static IDATA decodeRecords(GCEventDecoder *decoder);
+static void decodeRecord(GCEventDecoder *decoder, const J9GCEventRecordHeader *record, const U_64 *fields, UDATA fieldCount);
+static void formatTimestamp(GCEventDecoder *decoder, U_64 timestamp, char *buffer, UDATA bufferLength);
+static U_64 ticksToMicros(GCEventDecoder *decoder, U_64 ticks);
+static void printJSONString(GCEventDecoder *decoder, const char *string, UDATA length);
+static UDATA getCycleStanzaId(GCEventDecoder *decoder, U_64 cycleId);
+static UDATA percent(U_64 part, U_64 total);
+static const char *getReasonName(U_64 reason);
+static const char *getSpaceName(U_64 space);
+static void printSpaceMemory(GCEventDecoder *decoder, const char *space, U_64 freeBytes, U_64 totalBytes);
+
+UDATA signalProtectedMain(struct J9PortLibrary *portLibrary, void *arg);
+
+static void
+printUsage(J9PortLibrary *portLibrary)
+{
+	PORT_ACCESS_FROM_PORT(portLibrary);
+
+	j9tty_printf(PORTLIB, "Usage: gcevtdump [-xml | -json] <file>\n\n");
+	j9tty_printf(PORTLIB, "Decode a GC event stream written with -Xgc:verboseBinaryFile=<file>.\n");
+	j9tty_printf(PORTLIB, "  -xml   write the events as verbose GC XML (the default)\n");
+	j9tty_printf(PORTLIB, "  -json  write the events as JSON, one object per line\n");
+}
+
+static IDATA
+readFile(J9PortLibrary *portLibrary, const char *fileName, U_8 **bufferPtr, I_64 *lengthPtr)
+{
+	PORT_ACCESS_FROM_PORT(portLibrary);
+	I_64 length = j9file_length(fileName);
+	U_8 *buffer = NULL;
+	IDATA fd = -1;
+	I_64 bytesRead = 0;
+
+	if (length < 0) {
+		j9tty_err_printf(PORTLIB, "Could not open %s\n", fileName);
+		return RET_FILE_OPEN_FAILED;
+	}
+	buffer = j9mem_allocate_memory((UDATA)length + 1, OMRMEM_CATEGORY_VM);
+	if (NULL == buffer) {
+		j9tty_err_printf(PORTLIB, "Could not allocate %lld bytes to read %s\n", length, fileName);
+		return RET_ALLOCATE_FAILED;
+	}
+	fd = j9file_open(fileName, EsOpenRead, 0);
+	if (-1 == fd) {
+		j9tty_err_printf(PORTLIB, "Could not open %s\n", fileName);
+		j9mem_free_memory(buffer);
+		return RET_FILE_OPEN_FAILED;
+	}
+	while (bytesRead < length) {
+		IDATA count = j9file_read(fd, buffer + bytesRead, (IDATA)(length - bytesRead));
+		if (count <= 0) {
+			break;
+		}
+		bytesRead += count;
+	}
+	j9file_close(fd);
+	if (bytesRead != length) {
+		j9tty_err_printf(PORTLIB, "Could not read %s\n", fileName);
+		j9mem_free_memory(buffer);
+		return RET_FILE_READ_FAILED;
+	}
+
+	*bufferPtr = buffer;
+	*lengthPtr = length;
+	return RET_SUCCESS;
+}
+
+static IDATA
+validateHeader(GCEventDecoder *decoder, U_8 *buffer, I_64 length)
+{
+	PORT_ACCESS_FROM_PORT(decoder->portLibrary);
+	J9GCEventStreamHeader *header = (J9GCEventStreamHeader *)buffer;
+	const U_8 *stringTable = NULL;
+	UDATA offset = 0;
+
+	if ((length < (I_64)sizeof(J9GCEventStreamHeader)) || (0 != strncmp(header->eyecatcher, J9GCEVT_EYECATCHER, sizeof(header->eyecatcher)))) {
+		j9tty_err_printf(PORTLIB, "Not a GC event stream file\n");
+		return RET_BAD_FORMAT;
+	}
+	if (J9GCEVT_BYTE_ORDER_MARK != header->byteOrderMark) {
+		j9tty_err_printf(PORTLIB, "The GC event stream was written on a platform of the other byte order\n");
+		return RET_BAD_FORMAT;
+	}
+	if (header->version > J9GCEVT_VERSION) {
+		/* newer writers only append fields and record types, which are reported as unknown */
+		j9tty_err_printf(PORTLIB, "Warning: GC event stream version %u is newer than this decoder (version %u)\n", header->version, J9GCEVT_VERSION);
+	}
+	if ((0 == header->ringSize)
+		|| ((I_64)(header->headerSize + header->stringTableSize + header->ringSize) > length)
+		|| (header->stringTableUsed > header->stringTableSize)
+		|| (header->readCursor > header->writeCursor)
+		|| ((header->writeCursor - header->readCursor) > header->ringSize)
+	) {
+		j9tty_err_printf(PORTLIB, "The GC event stream header is corrupt\n");
+		return RET_BAD_FORMAT;
+	}
+
+	decoder->header = header;
+	stringTable = buffer + header->headerSize;
+	decoder->ring = stringTable + header->stringTableSize;
+
+	decoder->strings[0] = "";
+	decoder->stringLengths[0] = 0;
+	decoder->stringCount = 1;
+	while (((offset + sizeof(U_16)) <= header->stringTableUsed) && (decoder->stringCount < GCEVTDUMP_MAXIMUM_STRINGS)) {
+		U_16 entryLength = 0;
+		memcpy(&entryLength, stringTable + offset, sizeof(U_16));
+		if ((offset + sizeof(U_16) + entryLength) > header->stringTableUsed) {
+			break;
+		}
+		decoder->strings[decoder->stringCount] = (const char *)(stringTable + offset + sizeof(U_16));
+		decoder->stringLengths[decoder->stringCount] = entryLength;
+		decoder->stringCount += 1;
+		offset += sizeof(U_16) + ((entryLength + 1) & ~(UDATA)1);
+	}
+
+	return RET_SUCCESS;
+}
+
+static U_64
+ticksToMicros(GCEventDecoder *decoder, U_64 ticks)
+{
+	U_64 frequency = decoder->header->hiresFrequency;
+
+	if (0 == frequency) {
+		return 0;
+	}
+	return ((ticks / frequency) * 1000000) + (((ticks % frequency) * 1000000) / frequency);
+}
+
+static void
+formatTimestamp(GCEventDecoder *decoder, U_64 timestamp, char *buffer, UDATA bufferLength)
+{
+	PORT_ACCESS_FROM_PORT(decoder->portLibrary);
+	const J9GCEventStreamHeader *header = decoder->header;
+	I_64 millis = (I_64)header->startTimeMillis;
+	UDATA length = 0;
+
+	if (timestamp >= header->startHiresClock) {
+		millis += (I_64)(ticksToMicros(decoder, timestamp - header->startHiresClock) / 1000);
+	} else {
+		millis -= (I_64)(ticksToMicros(decoder, header->startHiresClock - timestamp) / 1000);
+	}
+	length = j9str_ftime(buffer, bufferLength, "%Y-%m-%dT%H:%M:%S", millis);
+	j9str_printf(PORTLIB, buffer + length, bufferLength - length, ".%03d", (int)(millis % 1000));
+}
+
+static void
+printJSONString(GCEventDecoder *decoder, const char *string, UDATA length)
+{
+	PORT_ACCESS_FROM_PORT(decoder->portLibrary);
+	UDATA i = 0;
+
+	j9tty_printf(PORTLIB, "\"");
+	for (i = 0; i < length; i++) {
+		char c = string[i];
+		if (('"' == c) || ('\\' == c)) {
+			j9tty_printf(PORTLIB, "\\%c", c);
+		} else if ((U_8)c < 0x20) {
+			j9tty_printf(PORTLIB, "\\u%04x", (U_32)(U_8)c);
+		} else {
+			j9tty_printf(PORTLIB, "%c", c);
+		}
+	}
+	j9tty_printf(PORTLIB, "\"");
+}
+
+static UDATA
+getCycleStanzaId(GCEventDecoder *decoder, U_64 cycleId)
+{
+	UDATA i = 0;
+
+	for (i = 0; i < GCEVTDUMP_MAXIMUM_OPEN_CYCLES; i++) {
+		if (cycleId == decoder->cycleIds[i]) {
+			return decoder->cycleStanzaIds[i];
+		}
+	}
+	/* the cycle started before the oldest record still in the ring */
+	return 0;
+}
+
+static UDATA
+percent(U_64 part, U_64 total)
+{
+	return (0 == total) ? 0 : (UDATA)((part * 100) / total);
+}
+
+static const char *
+getReasonName(U_64 reason)
+{
+	switch (reason) {
+	case J9GCEVT_REASON_EXPLICIT:
+		return "explicit";
+	case J9GCEVT_REASON_AGGRESSIVE:
+		return "aggressive";
+	case J9GCEVT_REASON_OUT_OF_MEMORY:
+		return "out of memory";
+	default:
+		return "implicit";
+	}
+}
+
+static const char *
+getSpaceName(U_64 space)
+{
+	switch (space) {
+	case J9GCEVT_SPACE_NURSERY:
+		return "nursery";
+	case J9GCEVT_SPACE_TENURE:
+		return "tenure";
+	default:
+		return "unknown";
+	}
+}
+
+static void
+printSpaceMemory(GCEventDecoder *decoder, const char *space, U_64 freeBytes, U_64 totalBytes)
+{
+	PORT_ACCESS_FROM_PORT(decoder->portLibrary);
+
+	/* a space the heap does not have (or a record from a writer which did not report it) */
+	if (0 == totalBytes) {
+		return;
+	}
+	if (GCEVTDUMP_FORMAT_JSON == decoder->format) {
+		j9tty_printf(PORTLIB, ",\"%sFreeBytes\":%llu,\"%sTotalBytes\":%llu", space, freeBytes, space, totalBytes);
+	} else {
+		j9tty_printf(PORTLIB, "    <mem type=\"%s\" free=\"%llu\" total=\"%llu\" percent=\"%zu\" />\n",
+			space, freeBytes, totalBytes, percent(freeBytes, totalBytes));
+	}
+}
+
+static void
+decodeRecord(GCEventDecoder *decoder, const J9GCEventRecordHeader *record, const U_64 *fields, UDATA fieldCount)
+{
+	PORT_ACCESS_FROM_PORT(decoder->portLibrary);
+	char timestamp[GCEVTDUMP_TIMESTAMP_LENGTH];
+	U_64 values[J9GCEVT_MAXIMUM_FIELD_COUNT];
+	UDATA stringId = (record->stringId < decoder->stringCount) ? record->stringId : 0;
+	const char *name = decoder->strings[stringId];
+	int nameLength = (int)decoder->stringLengths[stringId];
+	BOOLEAN json = (GCEVTDUMP_FORMAT_JSON == decoder->format);
+
+	/* fields missing from an older (shorter) record read as 0, fields added by a newer writer are ignored */
+	memset(values, 0, sizeof(values));
+	memcpy(values, fields, OMR_MIN(fieldCount, (UDATA)J9GCEVT_MAXIMUM_FIELD_COUNT) * sizeof(U_64));
+	formatTimestamp(decoder, record->timestamp, timestamp, sizeof(timestamp));
+
+	switch (record->type) {
+	case J9GCEVT_RECORD_CYCLE_START:
+	{
+		U_64 intervalMicros = 0;
+		UDATA stanzaId = 0;
+		UDATA slot = (UDATA)(values[J9GCEVT_FIELD_CYCLE_ID] % GCEVTDUMP_MAXIMUM_OPEN_CYCLES);
+
+		if (0 != decoder->lastCycleStart[stringId]) {
+			intervalMicros = ticksToMicros(decoder, record->timestamp - decoder->lastCycleStart[stringId]);
+		}
+		decoder->lastCycleStart[stringId] = record->timestamp;
+		decoder->cycleIds[slot] = values[J9GCEVT_FIELD_CYCLE_ID];
+		if (json) {
+			j9tty_printf(PORTLIB, "{\"event\":\"cycle-start\",\"timestamp\":\"%s\",\"type\":", timestamp);
+			printJSONString(decoder, name, nameLength);
+			j9tty_printf(PORTLIB, ",\"cycleId\":%llu,\"reason\":\"%s\",\"intervalMs\":%llu.%03llu,\"freeBytes\":%llu,\"totalBytes\":%llu}\n",
+				values[J9GCEVT_FIELD_CYCLE_ID], getReasonName(values[J9GCEVT_FIELD_CYCLE_REASON]), intervalMicros / 1000, intervalMicros % 1000,
+				values[J9GCEVT_FIELD_CYCLE_FREE_BYTES], values[J9GCEVT_FIELD_CYCLE_TOTAL_BYTES]);
+		} else {
+			if (J9GCEVT_REASON_EXPLICIT == values[J9GCEVT_FIELD_CYCLE_REASON]) {
+				j9tty_printf(PORTLIB, "<sys-start id=\"%zu\" reason=\"explicit\" timestamp=\"%s\" />\n", decoder->nextStanzaId++, timestamp);
+			}
+			stanzaId = decoder->nextStanzaId++;
+			decoder->cycleStanzaIds[slot] = stanzaId;
+			j9tty_printf(PORTLIB, "<cycle-start id=\"%zu\" type=\"%.*s\" contextid=\"0\" timestamp=\"%s\" intervalms=\"%llu.%03llu\" />\n",
+				stanzaId, nameLength, name, timestamp, intervalMicros / 1000, intervalMicros % 1000);
+		}
+		break;
+	}
+	case J9GCEVT_RECORD_CYCLE_END:
+		if (json) {
+			j9tty_printf(PORTLIB, "{\"event\":\"cycle-end\",\"timestamp\":\"%s\",\"type\":", timestamp);
+			printJSONString(decoder, name, nameLength);
+			j9tty_printf(PORTLIB, ",\"cycleId\":%llu,\"freeBytes\":%llu,\"totalBytes\":%llu}\n",
+				values[J9GCEVT_FIELD_CYCLE_ID], values[J9GCEVT_FIELD_CYCLE_FREE_BYTES], values[J9GCEVT_FIELD_CYCLE_TOTAL_BYTES]);
+		} else {
+			j9tty_printf(PORTLIB, "<cycle-end id=\"%zu\" type=\"%.*s\" contextid=\"%zu\" timestamp=\"%s\" />\n",
+				decoder->nextStanzaId++, nameLength, name, getCycleStanzaId(decoder, values[J9GCEVT_FIELD_CYCLE_ID]), timestamp);
+		}
+		break;
+	case J9GCEVT_RECORD_INCREMENT_START:
+	case J9GCEVT_RECORD_INCREMENT_END:
+	{
+		BOOLEAN start = (J9GCEVT_RECORD_INCREMENT_START == record->type);
+		U_64 durationMicros = 0;
+		U_64 freeBytes = values[J9GCEVT_FIELD_INCREMENT_FREE_BYTES];
+		U_64 totalBytes = values[J9GCEVT_FIELD_INCREMENT_TOTAL_BYTES];
+
+		if (start) {
+			decoder->incrementStart = record->timestamp;
+		} else if ((0 != decoder->incrementStart) && (record->timestamp >= decoder->incrementStart)) {
+			durationMicros = ticksToMicros(decoder, record->timestamp - decoder->incrementStart);
+		}
+		if (json) {
+			j9tty_printf(PORTLIB, "{\"event\":\"%s\",\"timestamp\":\"%s\",\"type\":", start ? "gc-start" : "gc-end", timestamp);
+			printJSONString(decoder, name, nameLength);
+			j9tty_printf(PORTLIB, ",\"cycleId\":%llu,\"incrementId\":%llu,", values[J9GCEVT_FIELD_INCREMENT_CYCLE_ID], values[J9GCEVT_FIELD_INCREMENT_ID]);
+			if (!start) {
+				j9tty_printf(PORTLIB, "\"durationMs\":%llu.%03llu,", durationMicros / 1000, durationMicros % 1000);
+			}
+			j9tty_printf(PORTLIB, "\"freeBytes\":%llu,\"totalBytes\":%llu", freeBytes, totalBytes);
+			printSpaceMemory(decoder, "nursery", values[J9GCEVT_FIELD_INCREMENT_NURSERY_FREE_BYTES], values[J9GCEVT_FIELD_INCREMENT_NURSERY_TOTAL_BYTES]);
+			printSpaceMemory(decoder, "tenure", values[J9GCEVT_FIELD_INCREMENT_TENURE_FREE_BYTES], values[J9GCEVT_FIELD_INCREMENT_TENURE_TOTAL_BYTES]);
+			j9tty_printf(PORTLIB, "}\n");
+		} else {
+			UDATA contextId = getCycleStanzaId(decoder, values[J9GCEVT_FIELD_INCREMENT_CYCLE_ID]);
+			if (start) {
+				j9tty_printf(PORTLIB, "<gc-start id=\"%zu\" type=\"%.*s\" contextid=\"%zu\" timestamp=\"%s\">\n",
+					decoder->nextStanzaId++, nameLength, name, contextId, timestamp);
+			} else {
+				j9tty_printf(PORTLIB, "<gc-end id=\"%zu\" type=\"%.*s\" contextid=\"%zu\" durationms=\"%llu.%03llu\" timestamp=\"%s\">\n",
+					decoder->nextStanzaId++, nameLength, name, contextId, durationMicros / 1000, durationMicros % 1000, timestamp);
+			}
+			j9tty_printf(PORTLIB, "  <mem-info id=\"%zu\" free=\"%llu\" total=\"%llu\" percent=\"%zu\">\n",
+				decoder->nextStanzaId++, freeBytes, totalBytes, percent(freeBytes, totalBytes));
+			printSpaceMemory(decoder, "nursery", values[J9GCEVT_FIELD_INCREMENT_NURSERY_FREE_BYTES], values[J9GCEVT_FIELD_INCREMENT_NURSERY_TOTAL_BYTES]);
+			printSpaceMemory(decoder, "tenure", values[J9GCEVT_FIELD_INCREMENT_TENURE_FREE_BYTES], values[J9GCEVT_FIELD_INCREMENT_TENURE_TOTAL_BYTES]);
+			j9tty_printf(PORTLIB, "  </mem-info>\n");
+			j9tty_printf(PORTLIB, "</%s>\n", start ? "gc-start" : "gc-end");
+		}
+		break;
+	}
+	case J9GCEVT_RECORD_CLASS_UNLOADING_END:
+	{
+		U_64 durationMicros = values[J9GCEVT_FIELD_CLASS_UNLOADING_DURATION];
+		if (json) {
+			j9tty_printf(PORTLIB, "{\"event\":\"classunload\",\"timestamp\":\"%s\",\"durationMs\":%llu.%03llu,\"classLoadersUnloaded\":%llu,\"classesUnloaded\":%llu}\n",
+				timestamp, durationMicros / 1000, durationMicros % 1000,
+				values[J9GCEVT_FIELD_CLASS_UNLOADING_LOADERS], values[J9GCEVT_FIELD_CLASS_UNLOADING_CLASSES]);
+		} else {
+			j9tty_printf(PORTLIB, "<gc-op id=\"%zu\" type=\"classunload\" timems=\"%llu.%03llu\" contextid=\"0\" timestamp=\"%s\">\n",
+				decoder->nextStanzaId++, durationMicros / 1000, durationMicros % 1000, timestamp);
+			j9tty_printf(PORTLIB, "  <classunload-info classloadersunloaded=\"%llu\" classesunloaded=\"%llu\" />\n",
+				values[J9GCEVT_FIELD_CLASS_UNLOADING_LOADERS], values[J9GCEVT_FIELD_CLASS_UNLOADING_CLASSES]);
+			j9tty_printf(PORTLIB, "</gc-op>\n");
+		}
+		break;
+	}
+	case J9GCEVT_RECORD_IDLE_PAGE_RELEASE:
+	{
+		U_64 durationMicros = values[J9GCEVT_FIELD_IDLE_RELEASE_DURATION];
+		const char *interrupted = (0 != values[J9GCEVT_FIELD_IDLE_RELEASE_INTERRUPTED]) ? "true" : "false";
+		if (json) {
+			j9tty_printf(PORTLIB, "{\"event\":\"idle-page-release\",\"timestamp\":\"%s\",\"bytesReleased\":%llu,\"ranges\":%llu,\"batches\":%llu,\"rssBefore\":%llu,\"rssAfter\":%llu,\"durationMs\":%llu.%03llu,\"interrupted\":%s}\n",
+				timestamp, values[J9GCEVT_FIELD_IDLE_RELEASE_BYTES], values[J9GCEVT_FIELD_IDLE_RELEASE_RANGES], values[J9GCEVT_FIELD_IDLE_RELEASE_BATCHES],
+				values[J9GCEVT_FIELD_IDLE_RELEASE_RSS_BEFORE], values[J9GCEVT_FIELD_IDLE_RELEASE_RSS_AFTER],
+				durationMicros / 1000, durationMicros % 1000, interrupted);
+		} else {
+			j9tty_printf(PORTLIB, "<idle-page-release bytesreleased=\"%llu\" ranges=\"%llu\" batches=\"%llu\" rssbefore=\"%llu\" rssafter=\"%llu\" durationms=\"%llu.%03llu\" interrupted=\"%s\" timestamp=\"%s\" />\n",
+				values[J9GCEVT_FIELD_IDLE_RELEASE_BYTES], values[J9GCEVT_FIELD_IDLE_RELEASE_RANGES], values[J9GCEVT_FIELD_IDLE_RELEASE_BATCHES],
+				values[J9GCEVT_FIELD_IDLE_RELEASE_RSS_BEFORE], values[J9GCEVT_FIELD_IDLE_RELEASE_RSS_AFTER],
+				durationMicros / 1000, durationMicros % 1000, interrupted, timestamp);
+		}
+		break;
+	}
+	case J9GCEVT_RECORD_PHASE_END:
+	{
+		U_64 durationMicros = values[J9GCEVT_FIELD_PHASE_DURATION];
+		if (json) {
+			j9tty_printf(PORTLIB, "{\"event\":\"gc-op\",\"timestamp\":\"%s\",\"type\":", timestamp);
+			printJSONString(decoder, name, nameLength);
+			j9tty_printf(PORTLIB, ",\"cycleId\":%llu,\"durationMs\":%llu.%03llu}\n",
+				values[J9GCEVT_FIELD_PHASE_CYCLE_ID], durationMicros / 1000, durationMicros % 1000);
+		} else {
+			j9tty_printf(PORTLIB, "<gc-op id=\"%zu\" type=\"%.*s\" timems=\"%llu.%03llu\" contextid=\"%zu\" timestamp=\"%s\" />\n",
+				decoder->nextStanzaId++, nameLength, name, durationMicros / 1000, durationMicros % 1000,
+				getCycleStanzaId(decoder, values[J9GCEVT_FIELD_PHASE_CYCLE_ID]), timestamp);
+		}
+		break;
+	}
+	case J9GCEVT_RECORD_ALLOCATION_FAILURE:
+	{
+		const char *space = getSpaceName(values[J9GCEVT_FIELD_ALLOCATION_FAILURE_SPACE]);
+		if (json) {
+			j9tty_printf(PORTLIB, "{\"event\":\"af-start\",\"timestamp\":\"%s\",\"type\":\"%s\",\"bytesRequested\":%llu}\n",
+				timestamp, space, values[J9GCEVT_FIELD_ALLOCATION_FAILURE_BYTES]);
+		} else {
+			j9tty_printf(PORTLIB, "<af-start id=\"%zu\" type=\"%s\" totalBytesRequested=\"%llu\" timestamp=\"%s\" />\n",
+				decoder->nextStanzaId++, space, values[J9GCEVT_FIELD_ALLOCATION_FAILURE_BYTES], timestamp);
+		}
+		break;
+	}
+	case J9GCEVT_RECORD_EXCLUSIVE_ACCESS:
+	{
+		U_64 durationMicros = values[J9GCEVT_FIELD_EXCLUSIVE_ACCESS_DURATION];
+		U_64 idleMicros = values[J9GCEVT_FIELD_EXCLUSIVE_ACCESS_MEAN_IDLE];
+		if (json) {
+			j9tty_printf(PORTLIB, "{\"event\":\"exclusive-start\",\"timestamp\":\"%s\",\"durationMs\":%llu.%03llu,\"meanIdleMs\":%llu.%03llu,\"threads\":%llu}\n",
+				timestamp, durationMicros / 1000, durationMicros % 1000, idleMicros / 1000, idleMicros % 1000,
+				values[J9GCEVT_FIELD_EXCLUSIVE_ACCESS_THREADS]);
+		} else {
+			j9tty_printf(PORTLIB, "<exclusive-start id=\"%zu\" timestamp=\"%s\">\n", decoder->nextStanzaId++, timestamp);
+			j9tty_printf(PORTLIB, "  <response-info timems=\"%llu.%03llu\" idlems=\"%llu.%03llu\" threads=\"%llu\" />\n",
+				durationMicros / 1000, durationMicros % 1000, idleMicros / 1000, idleMicros % 1000,
+				values[J9GCEVT_FIELD_EXCLUSIVE_ACCESS_THREADS]);
+			j9tty_printf(PORTLIB, "</exclusive-start>\n");
+		}
+		break;
+	}
+	default:
+		/* a record type added by a newer writer */
+		if (json) {
+			j9tty_printf(PORTLIB, "{\"event\":\"unknown\",\"recordType\":%u,\"timestamp\":\"%s\",\"fieldCount\":%zu}\n", (U_32)record->type, timestamp, fieldCount);
+		} else {
+			j9tty_printf(PORTLIB, "<!-- unknown record type %u at %s -->\n", (U_32)record->type, timestamp);
+		}
+		break;
+	}
+
+	decoder->recordCount += 1;
+}
+
+static IDATA
+decodeRecords(GCEventDecoder *decoder)
+{
+	PORT_ACCESS_FROM_PORT(decoder->portLibrary);
+	const J9GCEventStreamHeader *header = decoder->header;
+	U_64 ringSize = header->ringSize;
+	U_64 cursor = header->readCursor;
+
+	while (cursor < header->writeCursor) {
+		U_64 position = cursor % ringSize;
+		const J9GCEventRecordHeader *record = (const J9GCEventRecordHeader *)(decoder->ring + position);
+		UDATA size = 0;
+
+		if ((ringSize - position) < J9GCEVT_RECORD_ALIGNMENT) {
+			break;
+		}
+		size = record->size;
+		if ((size < J9GCEVT_RECORD_ALIGNMENT) || (0 != (size % J9GCEVT_RECORD_ALIGNMENT)) || (size > (ringSize - position))
+			|| ((J9GCEVT_RECORD_PAD != record->type) && (size < sizeof(J9GCEventRecordHeader)))
+		) {
+			j9tty_err_printf(PORTLIB, "Corrupt record at cursor %llu: decoding stopped\n", cursor);
+			return RET_BAD_FORMAT;
+		}
+		if (J9GCEVT_RECORD_PAD != record->type) {
+			decodeRecord(decoder, record, (const U_64 *)(record + 1), (size - sizeof(J9GCEventRecordHeader)) / sizeof(U_64));
+		}
+		cursor += size;
+	}
+
+	return RET_SUCCESS;
+}
+
+UDATA
+signalProtectedMain(struct J9PortLibrary *portLibrary, void *arg)
+{
+	struct j9cmdlineOptions *startupOptions = (struct j9cmdlineOptions *)arg;
+	int argc = startupOptions->argc;
+	char **argv = startupOptions->argv;
+	GCEventDecoder decoder;
+	const char *fileName = NULL;
+	U_8 *buffer = NULL;
+	I_64 length = 0;
+	IDATA result = RET_SUCCESS;
+	int i = 0;
+	PORT_ACCESS_FROM_PORT(startupOptions->portLibrary);
+
+	memset(&decoder, 0, sizeof(decoder));
+	decoder.portLibrary = PORTLIB;
+	decoder.format = GCEVTDUMP_FORMAT_XML;
+	decoder.nextStanzaId = 1;
+
+	for (i = 1; i < argc; i++) {
+		if (0 == strcmp(argv[i], "-xml")) {
+			decoder.format = GCEVTDUMP_FORMAT_XML;
+		} else if (0 == strcmp(argv[i], "-json")) {
+			decoder.format = GCEVTDUMP_FORMAT_JSON;
+		} else if (('-' != argv[i][0]) && (NULL == fileName)) {
+			fileName = argv[i];
+		} else {
+			printUsage(PORTLIB);
+			return (UDATA)RET_COMMANDLINE_INCORRECT;
+		}
+	}
+	if (NULL == fileName) {
+		printUsage(PORTLIB);
+		return (UDATA)RET_COMMANDLINE_INCORRECT;
+	}
+
+	result = readFile(PORTLIB, fileName, &buffer, &length);
+	if (RET_SUCCESS != result) {
+		return (UDATA)result;
+	}
+
+	result = validateHeader(&decoder, buffer, length);
+	if (RET_SUCCESS == result) {
+		if (GCEVTDUMP_FORMAT_XML == decoder.format) {
+			char timestamp[GCEVTDUMP_TIMESTAMP_LENGTH];
+			formatTimestamp(&decoder, decoder.header->startHiresClock, timestamp, sizeof(timestamp));
+			j9tty_printf(PORTLIB, "<?xml version=\"1.0\" ?>\n\n");
+			j9tty_printf(PORTLIB, "<verbosegc xmlns=\"http://www.ibm.com/j9/verbosegc\" version=\"gcevtdump %u\">\n\n", decoder.header->version);
+			j9tty_printf(PORTLIB, "<!-- GC event stream started %s, %llu records written -->\n", timestamp, decoder.header->recordCount);
+		}
+		result = decodeRecords(&decoder);
+		if (GCEVTDUMP_FORMAT_XML == decoder.format) {
+			j9tty_printf(PORTLIB, "\n</verbosegc>\n");
+		}
+	}
+
+	j9mem_free_memory(buffer);
+	return (UDATA)result;
+}
@@ -100,6 +100,18 @@
 #define COM_IBM_REGISTER_TRACEPOINT_SUBSCRIBER "com.ibm.RegisterTracePointSubscriber"
 #define COM_IBM_DEREGISTER_TRACEPOINT_SUBSCRIBER "com.ibm.DeregisterTracePointSubscriber"
 
+#define COM_IBM_ENABLE_PARALLEL_HEAP_ITERATION "com.ibm.EnableParallelHeapIteration"
+
+/*
+ * Constants for the enable parameter of COM_IBM_ENABLE_PARALLEL_HEAP_ITERATION.
+ * With COM_IBM_PARALLEL_HEAP_ITERATION_SERIAL_CALLBACKS the callbacks are issued one at a time (under a lock).
+ * With COM_IBM_PARALLEL_HEAP_ITERATION_CONCURRENT_CALLBACKS they are issued by several GC threads at once,
+ * and must therefore be thread safe.
+ */
+#define COM_IBM_PARALLEL_HEAP_ITERATION_DISABLED 0
+#define COM_IBM_PARALLEL_HEAP_ITERATION_SERIAL_CALLBACKS 1
+#define COM_IBM_PARALLEL_HEAP_ITERATION_CONCURRENT_CALLBACKS 2
+
 #define COM_IBM_SHARED_CACHE_MODLEVEL_JAVA5 1
 #define COM_IBM_SHARED_CACHE_MODLEVEL_JAVA6 2
 #define COM_IBM_SHARED_CACHE_MODLEVEL_JAVA7 3
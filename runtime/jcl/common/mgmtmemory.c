@@ -520,6 +520,48 @@ Java_com_ibm_java_lang_management_internal_MemoryMXBeanImpl_getCurrentGCThreadsI
 	return result;
 }
 
+jlong JNICALL
+Java_com_ibm_java_lang_management_internal_MemoryMXBeanImpl_getFinalizerQueueMaxDepthImpl(JNIEnv *env, jobject beanInstance)
+{
+	UDATA maxJobCount = 0;
+#if defined(J9VM_GC_FINALIZATION)
+	J9JavaVM *javaVM = ((J9VMThread *) env)->javaVM;
+	U_64 lastDrainMillis = 0;
+	U_64 maxDrainMillis = 0;
+
+	javaVM->memoryManagerFunctions->j9gc_get_finalizer_queue_statistics(javaVM, &maxJobCount, &lastDrainMillis, &maxDrainMillis);
+#endif /* J9VM_GC_FINALIZATION */
+	return (jlong)maxJobCount;
+}
+
+jlong JNICALL
+Java_com_ibm_java_lang_management_internal_MemoryMXBeanImpl_getFinalizerQueueLatencyImpl(JNIEnv *env, jobject beanInstance)
+{
+	U_64 lastDrainMillis = 0;
+#if defined(J9VM_GC_FINALIZATION)
+	J9JavaVM *javaVM = ((J9VMThread *) env)->javaVM;
+	UDATA maxJobCount = 0;
+	U_64 maxDrainMillis = 0;
+
+	javaVM->memoryManagerFunctions->j9gc_get_finalizer_queue_statistics(javaVM, &maxJobCount, &lastDrainMillis, &maxDrainMillis);
+#endif /* J9VM_GC_FINALIZATION */
+	return (jlong)lastDrainMillis;
+}
+
+jlong JNICALL
+Java_com_ibm_java_lang_management_internal_MemoryMXBeanImpl_getFinalizerQueueMaxLatencyImpl(JNIEnv *env, jobject beanInstance)
+{
+	U_64 maxDrainMillis = 0;
+#if defined(J9VM_GC_FINALIZATION)
+	J9JavaVM *javaVM = ((J9VMThread *) env)->javaVM;
+	UDATA maxJobCount = 0;
+	U_64 lastDrainMillis = 0;
+
+	javaVM->memoryManagerFunctions->j9gc_get_finalizer_queue_statistics(javaVM, &maxJobCount, &lastDrainMillis, &maxDrainMillis);
+#endif /* J9VM_GC_FINALIZATION */
+	return (jlong)maxDrainMillis;
+}
+
 /* Implementation of the main loop of a thread that processes and dispatches memory usage notifications to Java handlers. */
 void JNICALL
 Java_com_ibm_lang_management_internal_MemoryNotificationThread_processNotificationLoop(JNIEnv *env, jobject threadInstance)
@@ -716,6 +716,17 @@ Java_com_ibm_java_lang_management_internal_ThreadMXBeanImpl_dumpAllThreadsImpl(J
 			vmThread = vmThread->linkNext;
 		} while (vmThread != vm->mainThread);
 
+		for (i = 0; i < numThreads; ++i) {
+			/* can't do this the first time through because the thread might be
+			 * walking its own stack
+			 */
+			exc = saveObjectRefs(env, &allinfo[i]);
+			if (exc > 0) {
+				freeThreadInfos(currentThread, allinfo, numThreads);
+				goto dumpAll_failWithExclusive;
+			}
+		}
+
 		if (JNI_TRUE == getLockedSynchronizers) {
 			exc = getSynchronizers(currentThread, allinfo, numThreads);
 			if (exc > 0) {
@@ -725,18 +736,6 @@ Java_com_ibm_java_lang_management_internal_ThreadMXBeanImpl_dumpAllThreadsImpl(J
 		} /* if (getLockedSynchronizers == JNI_TRUE) */
 	} /* if (allinfolen > 0) */
 
-
-	for (i = 0; i < numThreads; ++i) {
-		/* can't do this the first time through because the thread might be
-		 * walking its own stack
-		 */
-		exc = saveObjectRefs(env, &allinfo[i]);
-		if (exc > 0) {
-			freeThreadInfos(currentThread, allinfo, numThreads);
-			goto dumpAll_failWithExclusive;
-		}
-	}
-
 	vmfns->releaseExclusiveVMAccess(currentThread);
 
 	for (i = 0; i < numThreads; ++i) {
@@ -849,6 +848,19 @@ getArrayOfThreadInfo(JNIEnv *env,
 			}
 		}
 
+		for (i = 0; i < (UDATA)numThreads; ++i) {
+			/* can't do this the first time through because the thread might be
+			 * walking its own stack
+			 */
+			if (allinfo[i].thread) {
+				exc = saveObjectRefs(env, &allinfo[i]);
+				if (exc > 0) {
+					freeThreadInfos(currentThread, allinfo, numThreads);
+					goto getArray_failWithExclusive;
+				}
+			}
+		}
+
 		if (JNI_TRUE == getLockedSynchronizers) {
 			exc = getSynchronizers(currentThread, allinfo, numThreads);
 			if (exc > 0) {
@@ -858,19 +870,6 @@ getArrayOfThreadInfo(JNIEnv *env,
 		} /* if (getLockedSynchronizers == JNI_TRUE) */
 	} /* if (numThreads > 0) */
 
-	for (i = 0; i < (UDATA)numThreads; ++i) {
-		/* can't do this the first time through because the thread might be
-		 * walking its own stack
-		 */
-		if (allinfo[i].thread) {
-			exc = saveObjectRefs(env, &allinfo[i]);
-			if (exc > 0) {
-				freeThreadInfos(currentThread, allinfo, numThreads);
-				goto getArray_failWithExclusive;
-			}
-		}
-	}
-
 	vmfns->releaseExclusiveVMAccess(currentThread);
 
 	for (i = 0; (jint)i < numThreads; ++i) {
@@ -1465,6 +1464,8 @@ getStackFramePCs(J9VMThread *currentThread, J9VMThread *targetThread, ThreadInfo
 
 /**
  * Scan the heap and build locked synchronizer lists for all examined threads.
+ * The scan may run a garbage collection (see j9mm_iterate_all_ownable_synchronizer_objects), so the
+ * object references in allinfo must already have been saved as local refs.
  * @pre exclusive VM access
  * @param[in] currentThread
  * @param[in] allinfo Threads being examined. Locked synchronizers are also stored into this array.
@@ -1543,7 +1544,7 @@ getSynchronizersHeapIterator(J9VMThread *vmThread, J9MM_IterateObjectDescriptor
 			if ((data->allinfo[i].thread != NULL) && (J9OBJECT_FROM_JOBJECT(data->allinfo[i].thread) == owner)) {
 				sinfo = j9mem_allocate_memory(sizeof(SynchronizerInfo), J9MEM_CATEGORY_VM_JCL);
 				if (sinfo) {
-					sinfo->obj.unsafe = object;
+					sinfo->obj.safe = vm->internalVMFunctions->j9jni_createLocalRef((JNIEnv *)vmThread, object);
 					sinfo->next = data->allinfo[i].lockedSynchronizers.list;
 					data->allinfo[i].lockedSynchronizers.list = sinfo;
 					data->allinfo[i].lockedSynchronizers.len++;
@@ -2023,7 +2024,6 @@ saveObjectRefs(JNIEnv *env, ThreadInfo *info)
 {
 	J9JavaVM * vm = ((J9VMThread *)env)->javaVM;
 	J9InternalVMFunctions *vmfns = vm->internalVMFunctions;
-	SynchronizerInfo *sinfo;
 	UDATA i;
 	IDATA exc = 0;
 
@@ -2047,16 +2047,6 @@ saveObjectRefs(JNIEnv *env, ThreadInfo *info)
 		info->lockedMonitors.arr_unsafe = NULL;
 	}
 
-	if (0 == exc) {
-		if (info->lockedSynchronizers.len > 0) {
-			sinfo = info->lockedSynchronizers.list;
-			while (sinfo) {
-				sinfo->obj.safe = vmfns->j9jni_createLocalRef(env, sinfo->obj.unsafe);
-				sinfo = sinfo->next;
-			}
-		}
-	}
-	
 	return exc;
 }
 
@@ -114,6 +114,8 @@ static jvmtiError JNICALL jvmtiGetJ9method(jvmtiEnv *env, jmethodID mid, void **
 static jvmtiError JNICALL jvmtiRegisterTracePointSubscriber(jvmtiEnv *env, char *description, jvmtiTraceSubscriber subscriber, jvmtiTraceAlarm alarm, void *userData, void **subscriptionID, ...);
 static jvmtiError JNICALL jvmtiDeregisterTracePointSubscriber(jvmtiEnv *env, void *subscriptionID, ...);
 
+static jvmtiError JNICALL jvmtiEnableParallelHeapIteration(jvmtiEnv *env, jint enable, ...);
+
 /*
  * Struct to encapsulate the details of a verbose GC subscriber
  */
@@ -346,6 +348,11 @@ static const jvmtiParamInfo jvmtiDeregisterTracepointSubscriber_params[] = {
 	{ "subscriptionID", JVMTI_KIND_IN_PTR, JVMTI_TYPE_CVOID, JNI_FALSE }
 };
 
+/* (jvmtiEnv *env, jint enable) */
+static const jvmtiParamInfo jvmtiEnableParallelHeapIteration_params[] = {
+	{ "enable", JVMTI_KIND_IN, JVMTI_TYPE_JINT, JNI_FALSE }
+};
+
 /*
  * Error lists for extended functions
  */
@@ -358,6 +365,11 @@ static const jvmtiError notAvailable_errors[] = {
 	JVMTI_ERROR_NOT_AVAILABLE
 };
 
+static const jvmtiError jvmtiRemoveAllTags_errors[] = {
+	JVMTI_ERROR_NOT_AVAILABLE,
+	JVMTI_ERROR_OUT_OF_MEMORY
+};
+
 static const jvmtiError ras_errors[] = {
 	JVMTI_ERROR_NULL_POINTER,
 	JVMTI_ERROR_OUT_OF_MEMORY,
@@ -612,7 +624,7 @@ static const J9JVMTIExtensionFunctionInfo J9JVMTIExtensionFunctionInfoTable[] =
 		COM_IBM_REMOVE_ALL_TAGS,
 		J9NLS_JVMTI_COM_IBM_REMOVE_ALL_TAGS,
 		0, NULL,
-		SIZE_AND_TABLE(notAvailable_errors)
+		SIZE_AND_TABLE(jvmtiRemoveAllTags_errors)
 	},
 	{
 		(jvmtiExtensionFunction) jvmtiRegisterTraceSubscriber,
@@ -726,6 +738,13 @@ static const J9JVMTIExtensionFunctionInfo J9JVMTIExtensionFunctionInfoTable[] =
 		SIZE_AND_TABLE(jvmtiDeregisterTracepointSubscriber_params),
 		SIZE_AND_TABLE(jvmtiDeregisterTracePointSubscriber_errors)
 	},
+	{
+		(jvmtiExtensionFunction) jvmtiEnableParallelHeapIteration,
+		COM_IBM_ENABLE_PARALLEL_HEAP_ITERATION,
+		J9NLS_JVMTI_COM_IBM_ENABLE_PARALLEL_HEAP_ITERATION_DESCRIPTION,
+		SIZE_AND_TABLE(jvmtiEnableParallelHeapIteration_params),
+		EMPTY_SIZE_AND_TABLE
+	},
 };
 
 #define NUM_EXTENSION_FUNCTIONS (sizeof(J9JVMTIExtensionFunctionInfoTable) / sizeof(J9JVMTIExtensionFunctionInfoTable[0]))
@@ -2034,24 +2053,31 @@ jvmtiRemoveAllTags(jvmtiEnv* jvmti_env, ...)
 {
 	J9JVMTIEnv * j9env = (J9JVMTIEnv *) jvmti_env;
 	jvmtiError rc = JVMTI_ERROR_NOT_AVAILABLE;
+	UDATA i;
 
-	J9HashTableHashFn hashFn = j9env->objectTagTable->hashFn;
-	J9HashTableEqualFn hashEqualFn = j9env->objectTagTable->hashEqualFn;
+	Trc_JVMTI_jvmtiRemoveAllTags_Entry(jvmti_env);
 
+	for (i = 0; i < j9env->objectTagShardCount; i++) {
+		J9JVMTIObjectTagShard * shard = &j9env->objectTagShards[i];
+		J9HashTable * emptyTable;
 
-	Trc_JVMTI_jvmtiRemoveAllTags_Entry(jvmti_env);
+		/* Ensure exclusive access to this shard of the tag table */
+		omrthread_monitor_enter(shard->mutex);
 
-	/* Ensure exclusive access to tag table */
-	omrthread_monitor_enter(j9env->mutex);
+		emptyTable = hashTableNew(OMRPORT_FROM_J9PORT(j9env->vm->portLibrary), J9_GET_CALLSITE(), 0, sizeof(J9JVMTIObjectTag), sizeof(jlong), 0,  J9MEM_CATEGORY_JVMTI, shard->table->hashFn, shard->table->hashEqualFn, NULL, NULL);
+		if (NULL == emptyTable) {
+			rc = JVMTI_ERROR_OUT_OF_MEMORY;
+		} else {
+			hashTableFree(shard->table);
+			shard->table = emptyTable;
+			if (JVMTI_ERROR_NOT_AVAILABLE == rc) {
+				rc = JVMTI_ERROR_NONE;
+			}
+		}
 
-	if (j9env->objectTagTable != NULL) {
-		hashTableFree(j9env->objectTagTable);
-		j9env->objectTagTable = hashTableNew(OMRPORT_FROM_J9PORT(j9env->vm->portLibrary), J9_GET_CALLSITE(), 0, sizeof(J9JVMTIObjectTag), sizeof(jlong), 0,  J9MEM_CATEGORY_JVMTI, hashFn, hashEqualFn, NULL, NULL);
-		rc = JVMTI_ERROR_NONE;
+		omrthread_monitor_exit(shard->mutex);
 	}
 
-	omrthread_monitor_exit(j9env->mutex);
-
 	TRACE_JVMTI_RETURN(jvmtiRemoveAllTags);
 }
 
@@ -3462,3 +3488,42 @@ jvmtiDeregisterTracePointSubscriber(jvmtiEnv* env, void *subscriberID, ...)
 	done:
 	TRACE_JVMTI_RETURN(jvmtiDeregisterTracePointSubscriber);
 }
+
+/*
+ * Selects how IterateThroughHeap walks the heap for this environment.  Once enabled, the objects are
+ * visited by the GC threads in parallel, region by region, and the heap_filter and klass filters are
+ * applied on those threads.  The callbacks are then issued on the GC threads (rather than on the thread
+ * which called IterateThroughHeap), and the objects are no longer reported in address order.  The callbacks
+ * must therefore not rely on thread local state of the calling thread.  By default the callbacks are issued
+ * one at a time, under a lock shared by all the GC threads, so an agent whose callbacks do most of the work
+ * gains little; an agent whose callbacks are thread safe can have them issued concurrently instead.
+ *
+ * Parameters:
+ *	enable - COM_IBM_PARALLEL_HEAP_ITERATION_SERIAL_CALLBACKS (or any other non-zero value) to iterate the heap in
+ *		parallel with the callbacks issued one at a time, COM_IBM_PARALLEL_HEAP_ITERATION_CONCURRENT_CALLBACKS to
+ *		iterate it in parallel with concurrent callbacks, or COM_IBM_PARALLEL_HEAP_ITERATION_DISABLED to iterate it
+ *		on the calling thread (the default)
+ * Return values with meaning specific to this function:
+ *	JVMTI_ERROR_NONE - the iteration mode has been set
+ *
+ * J9JVMTIExtensionFunctionInfo.id = "com.ibm.EnableParallelHeapIteration"
+ */
+static jvmtiError JNICALL
+jvmtiEnableParallelHeapIteration(jvmtiEnv* env, jint enable, ...)
+{
+	J9JVMTIEnv * j9env = (J9JVMTIEnv *) env;
+	jvmtiError rc = JVMTI_ERROR_NONE;
+
+	Trc_JVMTI_jvmtiEnableParallelHeapIteration_Entry(env, enable);
+
+	omrthread_monitor_enter(j9env->mutex);
+	j9env->flags &= ~(UDATA)(J9JVMTIENV_FLAG_PARALLEL_HEAP_ITERATION | J9JVMTIENV_FLAG_CONCURRENT_HEAP_ITERATION_CALLBACKS);
+	if (COM_IBM_PARALLEL_HEAP_ITERATION_CONCURRENT_CALLBACKS == enable) {
+		j9env->flags |= J9JVMTIENV_FLAG_PARALLEL_HEAP_ITERATION | J9JVMTIENV_FLAG_CONCURRENT_HEAP_ITERATION_CALLBACKS;
+	} else if (COM_IBM_PARALLEL_HEAP_ITERATION_DISABLED != enable) {
+		j9env->flags |= J9JVMTIENV_FLAG_PARALLEL_HEAP_ITERATION;
+	}
+	omrthread_monitor_exit(j9env->mutex);
+
+	TRACE_JVMTI_RETURN(jvmtiEnableParallelHeapIteration);
+}
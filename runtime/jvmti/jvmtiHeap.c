@@ -74,6 +74,8 @@ typedef struct J9JVMTIHeapEvent {
 
 typedef enum J9JVMTIHeapIterationFlags {
 	J9JVMTI_HI_INITIAL_OBJECT_REF = 1,
+	J9JVMTI_HI_CONCURRENT_CALLBACKS = 2,
+	J9JVMTI_HI_PARALLEL = 4,
 } J9JVMTIHeapIterationFlags;
  
 
@@ -87,6 +89,7 @@ typedef struct J9JVMTIHeapData {
 	jvmtiError         rc;             /** jvmti error code */
 	jvmtiIterationControl visitRc;
 	J9JVMTIHeapIterationFlags flags;   /** private iteration control flags */
+	omrthread_monitor_t batchMutex;    /** serializes the callbacks of a parallel iteration (or only the recording of its result, with J9JVMTI_HI_CONCURRENT_CALLBACKS) */
 
 	J9JVMTIHeapEvent   event;         
 	j9object_t         referrer;       /** The referrer object */
@@ -104,6 +107,10 @@ typedef struct J9JVMTIHeapData {
 static UDATA copyObjectTags (J9JVMTIObjectTag * entry, J9JVMTIObjectTagMatch * results);
 static UDATA countObjectTags (J9JVMTIObjectTag * entry, J9JVMTIObjectTagMatch * results);
 static jvmtiIterationControl iterateThroughHeapCallback(J9JavaVM * vm, J9MM_IterateObjectDescriptor *objectDesc, void * userData);
+static jvmtiIterationControl iterateThroughHeapBatchCallback(J9JavaVM * vm, J9MM_IterateObjectDescriptor *objects, UDATA count, void * userData);
+static BOOLEAN iterateThroughHeapFilter(J9JavaVM * vm, J9JVMTIHeapData * iteratorData, j9object_t object, jvmtiHeapTags * tags);
+static jlong heapObjectTag(J9JVMTIHeapData * iteratorData, j9object_t object);
+static jvmtiIterationControl iterateThroughHeapReport(J9JavaVM * vm, J9JVMTIHeapData * iteratorData, j9object_t object);
 
 static jvmtiIterationControl wrap_heapReferenceCallback(J9JavaVM * vm, J9JVMTIHeapData * iteratorData);
 static jvmtiIterationControl wrap_heapIterationCallback(J9JavaVM * vm, J9JVMTIHeapData * iteratorData);
@@ -173,8 +180,7 @@ jvmtiGetTag(jvmtiEnv* env,
 
 	rc = getCurrentVMThread(vm, &currentThread);
 	if (rc == JVMTI_ERROR_NONE) {
-		J9JVMTIObjectTag entry;
-		J9JVMTIObjectTag * objectTag;
+		j9object_t objectRef;
 
 		vm->internalVMFunctions->internalEnterVMFromJNI(currentThread);
 
@@ -184,19 +190,12 @@ jvmtiGetTag(jvmtiEnv* env,
 		ENSURE_JOBJECT_NON_NULL(object);
 		ENSURE_NON_NULL(tag_ptr);
 
-		entry.ref = *(j9object_t *)object;
+		objectRef = *(j9object_t *)object;
 
-		if ( entry.ref ) {
+		if ( objectRef ) {
 
-			/* Ensure exclusive access to tag table */
-			omrthread_monitor_enter(((J9JVMTIEnv *)env)->mutex);
-
-			objectTag = hashTableFind(((J9JVMTIEnv *)env)->objectTagTable, &entry);
-			if (objectTag) {
-				rv_tag = objectTag->tag;
-			}
-
-			omrthread_monitor_exit(((J9JVMTIEnv *)env)->mutex);
+			/* Only the shard of the tag table holding the tag is locked */
+			rv_tag = getObjectTag((J9JVMTIEnv *)env, objectRef);
 
 		} else {
 			rc = JVMTI_ERROR_INVALID_OBJECT;
@@ -226,8 +225,7 @@ jvmtiSetTag(jvmtiEnv* env,
 
 	rc = getCurrentVMThread(vm, &currentThread);
 	if (rc == JVMTI_ERROR_NONE) {
-		J9JVMTIObjectTag entry;
-		J9JVMTIObjectTag * objectTag;
+		j9object_t objectRef;
 
 		vm->internalVMFunctions->internalEnterVMFromJNI(currentThread);
 
@@ -236,30 +234,12 @@ jvmtiSetTag(jvmtiEnv* env,
 
 		ENSURE_JOBJECT_NON_NULL(object);
 
-		entry.ref = *(j9object_t *)object;
-		entry.tag = tag;
+		objectRef = *(j9object_t *)object;
 
-		if ( entry.ref ) {
-
-			/* Ensure exclusive access to tag table */
-			omrthread_monitor_enter(((J9JVMTIEnv *)env)->mutex);
-
-			objectTag = hashTableFind(((J9JVMTIEnv *)env)->objectTagTable, &entry);
-			if (objectTag) {
-				if (tag) {
-					objectTag->tag = tag;
-				} else {
-					hashTableRemove(((J9JVMTIEnv *)env)->objectTagTable, &entry);
-				}
-			} else {
-				if (tag) {
-					if ( hashTableAdd(((J9JVMTIEnv *)env)->objectTagTable, &entry) == NULL ) {
-						rc = JVMTI_ERROR_OUT_OF_MEMORY;
-					}
-				}
-			}
+		if ( objectRef ) {
 
-			omrthread_monitor_exit(((J9JVMTIEnv *)env)->mutex);
+			/* Only the shard of the tag table holding the tag is locked */
+			rc = setObjectTag((J9JVMTIEnv *)env, objectRef, tag);
 
 		} else {
 			rc = JVMTI_ERROR_INVALID_OBJECT;
@@ -346,8 +326,10 @@ jvmtiGetObjectsWithTags(jvmtiEnv* env,
 			}
 		}
 
-		/* Ensure exclusive access to tag table */
-		omrthread_monitor_enter(((J9JVMTIEnv *)env)->mutex);
+		/* Ensure exclusive access to all the shards of the tag table (always locked in index order) */
+		for (i = 0; i < (jint)((J9JVMTIEnv *)env)->objectTagShardCount; i++) {
+			omrthread_monitor_enter(((J9JVMTIEnv *)env)->objectTagShards[i].mutex);
+		}
 
 		memset(&results, 0, sizeof(J9JVMTIObjectTagMatch));
 
@@ -356,7 +338,9 @@ jvmtiGetObjectsWithTags(jvmtiEnv* env,
 		results.forTags = tags;
 		results.forLen = tag_count;
 
-		hashTableForEachDo(((J9JVMTIEnv *)env)->objectTagTable, (J9HashTableDoFn) countObjectTags, &results);
+		for (i = 0; i < (jint)((J9JVMTIEnv *)env)->objectTagShardCount; i++) {
+			hashTableForEachDo(((J9JVMTIEnv *)env)->objectTagShards[i].table, (J9HashTableDoFn) countObjectTags, &results);
+		}
 
 		if (object_result_ptr) {
 			results.objects = j9mem_allocate_memory(sizeof(jobject) * results.count, J9MEM_CATEGORY_JVMTI_ALLOCATE);
@@ -385,7 +369,9 @@ jvmtiGetObjectsWithTags(jvmtiEnv* env,
 
 			/* Fill in elements ... unwinds results.count */
 			if (object_result_ptr || tag_result_ptr) {
-				hashTableForEachDo(((J9JVMTIEnv *)env)->objectTagTable, (J9HashTableDoFn) copyObjectTags, &results);
+				for (i = 0; i < (jint)((J9JVMTIEnv *)env)->objectTagShardCount; i++) {
+					hashTableForEachDo(((J9JVMTIEnv *)env)->objectTagShards[i].table, (J9HashTableDoFn) copyObjectTags, &results);
+				}
 			}
 
 		} else {
@@ -394,7 +380,9 @@ jvmtiGetObjectsWithTags(jvmtiEnv* env,
 			j9mem_free_memory(results.tags);
 		}
 
-		omrthread_monitor_exit(((J9JVMTIEnv *)env)->mutex);
+		for (i = (jint)((J9JVMTIEnv *)env)->objectTagShardCount; i > 0; i--) {
+			omrthread_monitor_exit(((J9JVMTIEnv *)env)->objectTagShards[i - 1].mutex);
+		}
 
 done:
 		vm->internalVMFunctions->internalExitVMToJNI(currentThread);
@@ -847,7 +835,6 @@ jvmtiHeapFollowRefs_getStackData(J9JVMTIHeapData * iteratorData, J9StackWalkStat
 	jint depth = (jint) walkState->framesWalked;
 	J9Method * ramMethod = walkState->method;
 	jmethodID method;
-	J9JVMTIObjectTag search;
 	J9JVMTIObjectTag * result;
 	jlong threadID;
 
@@ -883,8 +870,7 @@ jvmtiHeapFollowRefs_getStackData(J9JVMTIHeapData * iteratorData, J9StackWalkStat
 
 	/* Find thread tag */
 	
-	search.ref = (j9object_t ) walkState->walkThread->threadObject;
-	result = hashTableFind(iteratorData->env->objectTagTable, &search);
+	result = findObjectTag(iteratorData->env, (j9object_t) walkState->walkThread->threadObject);
 
 	/* Figure out the Thread ID */
 
@@ -981,6 +967,33 @@ jvmtiHeapFollowReferencesPrint(J9JavaVM * vm, j9object_t object, j9object_t refe
 #endif
 
 
+/** 
+ * \brief	Obtain the tag of an object during a heap walk
+ * \ingroup 	jvmti.heap
+ * 
+ * @param iteratorData	iteration structure containing misc data
+ * @param object 	the object
+ * @return		the tag of the object, or 0 if it is not tagged
+ * 
+ *	The walks run under exclusive VM access, so the tag table can only change through
+ *	the walk's own callbacks.  Only a parallel iteration, whose objects are filtered on
+ *	several threads, has to lock the shard of the tag table for each lookup.
+ */
+static jlong
+heapObjectTag(J9JVMTIHeapData * iteratorData, j9object_t object)
+{
+	J9JVMTIObjectTag *objectTag = NULL;
+
+	if (J9_ARE_ANY_BITS_SET(iteratorData->flags, J9JVMTI_HI_PARALLEL)) {
+		return getObjectTag(iteratorData->env, object);
+	}
+
+	objectTag = findObjectTag(iteratorData->env, object);
+	return (NULL == objectTag) ? 0 : objectTag->tag;
+}
+
+
+
 /** 
  * \brief	Obtain tags for the Referrer and Referee objects 
  * \ingroup 	jvmti.heap
@@ -993,33 +1006,24 @@ jvmtiHeapFollowReferencesPrint(J9JavaVM * vm, j9object_t object, j9object_t refe
 static void
 jvmtiFollowRefs_getTags(J9JVMTIHeapData * iteratorData, j9object_t  referrer, j9object_t  object) 
 {
-	J9JVMTIObjectTag entry, *result;
 	J9Class *clazz;
 
 	/* get the object tag */
-	entry.ref = object;
-	result = hashTableFind(iteratorData->env->objectTagTable, &entry);
-	iteratorData->tags.objectTag = (result == NULL) ? 0 : result->tag;
+	iteratorData->tags.objectTag = heapObjectTag(iteratorData, object);
 	
 	/* get the class (of object) tag */
 	clazz = J9OBJECT_CLAZZ(iteratorData->currentThread, object);
-	entry.ref = J9VM_J9CLASS_TO_HEAPCLASS(clazz);
-	result = hashTableFind(iteratorData->env->objectTagTable, &entry);
-	iteratorData->tags.classTag = (result == NULL) ? 0 : result->tag;
+	iteratorData->tags.classTag = heapObjectTag(iteratorData, J9VM_J9CLASS_TO_HEAPCLASS(clazz));
 
 	/* The referrer argument for stack slot events carries metadata rather then
 	 * the usual j9object, ignore it here */   
 	if ((referrer != NULL) && (iteratorData->event.type != J9JVMTI_HEAP_EVENT_STACK)) {
 		/* get the referrer object tag */
-		entry.ref = referrer;
-		result = hashTableFind(iteratorData->env->objectTagTable, &entry);
-		iteratorData->tags.referrerObjectTag = (result == NULL) ? 0 : result->tag;
+		iteratorData->tags.referrerObjectTag = heapObjectTag(iteratorData, referrer);
 
 		/* get the referrer object class tag */
 		clazz = J9OBJECT_CLAZZ(iteratorData->currentThread, referrer);
-		entry.ref = J9VM_J9CLASS_TO_HEAPCLASS(clazz);
-		result = hashTableFind(iteratorData->env->objectTagTable, &entry);
-		iteratorData->tags.referrerClassTag = (result == NULL) ? 0 : result->tag;
+		iteratorData->tags.referrerClassTag = heapObjectTag(iteratorData, J9VM_J9CLASS_TO_HEAPCLASS(clazz));
 	} else {
 		iteratorData->tags.referrerObjectTag = 0;
 		iteratorData->tags.referrerClassTag = 0;
@@ -1308,6 +1312,11 @@ jvmtiError JNICALL jvmtiIterateThroughHeap(jvmtiEnv* env,
 		iteratorData.userData = (void *) user_data;
 		iteratorData.clazz = 0;
 		iteratorData.rc = JVMTI_ERROR_NONE;
+		iteratorData.visitRc = JVMTI_ITERATION_CONTINUE;
+		iteratorData.flags = 0;
+		if (J9_ARE_ANY_BITS_SET(((J9JVMTIEnv *)env)->flags, J9JVMTIENV_FLAG_CONCURRENT_HEAP_ITERATION_CALLBACKS)) {
+			iteratorData.flags |= J9JVMTI_HI_CONCURRENT_CALLBACKS;
+		}
 	     
 		/* Do not report anything if the class filter set by the user is an interface class.  Quote from the spec:
 		 * "If klass is an interface, no objects are reported. This applies to both the object and primitive callbacks." 
@@ -1321,8 +1330,18 @@ jvmtiError JNICALL jvmtiIterateThroughHeap(jvmtiEnv* env,
 		vmFuncs->acquireExclusiveVMAccess(currentThread);
 		ensureHeapWalkable(currentThread);
 
-		/* Walk the heap */
-		vm->memoryManagerFunctions->j9mm_iterate_all_objects(vm, vm->portLibrary, 0, iterateThroughHeapCallback, &iteratorData);
+		/* Walk the heap.  When the agent opted in (com.ibm.EnableParallelHeapIteration) the objects are filtered
+		 * in batches on the GC threads, and the callbacks are serialized unless the agent also asked for
+		 * concurrent callbacks. */
+		if (J9_ARE_ANY_BITS_SET(((J9JVMTIEnv *)env)->flags, J9JVMTIENV_FLAG_PARALLEL_HEAP_ITERATION)
+			&& (0 == omrthread_monitor_init_with_name(&iteratorData.batchMutex, 0, "JVMTI heap iteration batches"))
+		) {
+			iteratorData.flags |= J9JVMTI_HI_PARALLEL;
+			vm->memoryManagerFunctions->j9mm_iterate_all_objects_in_batches(currentThread, vm->portLibrary, 0, iterateThroughHeapBatchCallback, &iteratorData);
+			omrthread_monitor_destroy(iteratorData.batchMutex);
+		} else {
+			vm->memoryManagerFunctions->j9mm_iterate_all_objects(vm, vm->portLibrary, 0, iterateThroughHeapCallback, &iteratorData);
+		}
 		rc = iteratorData.rc;
 
 		vmFuncs->releaseExclusiveVMAccess(currentThread);
@@ -1353,12 +1372,100 @@ iterateThroughHeapCallback(J9JavaVM *vm, J9MM_IterateObjectDescriptor *objectDes
 {
 	j9object_t object = objectDesc->object;
 	J9JVMTIHeapData * iteratorData = userData;
+
+	if (!iterateThroughHeapFilter(vm, iteratorData, object, &iteratorData->tags)) {
+		return JVMTI_ITERATION_CONTINUE;
+	}
+
+	return iterateThroughHeapReport(vm, iteratorData, object);
+}
+
+
+
+/** 
+ * \brief      Heap Iteration callback for a batch of objects (parallel iteration)
+ * \ingroup    jvmti.heap
+ * 
+ * @param[in] vm
+ * @param[in] objects    a batch of objects, filtered in place
+ * @param[in] count      the number of objects in the batch
+ * @param[in] userData   our private data, cast it to <code>J9JVMTIHeapData</code>
+ * @return               JVMTI_ITERATION_ABORT once the iteration has been aborted
+ * 
+ *	Called concurrently on the GC threads.  The objects are filtered (which is most of the
+ *	work for a selective agent) without holding any lock, then the objects which passed the
+ *	filters are reported one at a time under the batch mutex, as the user callbacks are not
+ *	expected to be reentrant.  If the agent asked for concurrent callbacks they are instead
+ *	reported through a copy of the iteration data private to this thread, and the batch
+ *	mutex only guards recording an abort or error in the shared iteration data.
+ */
+static jvmtiIterationControl
+iterateThroughHeapBatchCallback(J9JavaVM *vm, J9MM_IterateObjectDescriptor *objects, UDATA count, void * userData)
+{
+	J9JVMTIHeapData * iteratorData = userData;
+	jvmtiHeapTags tags[J9MM_OBJECT_BATCH_SIZE];
 	jvmtiIterationControl visitRc = JVMTI_ITERATION_CONTINUE;
+	UDATA reportCount = 0;
+	UDATA i;
+
+	for (i = 0; i < count; i++) {
+		if (iterateThroughHeapFilter(vm, iteratorData, objects[i].object, &tags[reportCount])) {
+			objects[reportCount].object = objects[i].object;
+			reportCount += 1;
+		}
+	}
+
+	if ((0 != reportCount) && J9_ARE_ANY_BITS_SET(iteratorData->flags, J9JVMTI_HI_CONCURRENT_CALLBACKS)) {
+		J9JVMTIHeapData batchData = *iteratorData;
+
+		for (i = 0; (i < reportCount) && (JVMTI_ITERATION_CONTINUE == iteratorData->visitRc); i++) {
+			batchData.tags = tags[i];
+			if (JVMTI_ITERATION_ABORT == iterateThroughHeapReport(vm, &batchData, objects[i].object)) {
+				omrthread_monitor_enter(iteratorData->batchMutex);
+				iteratorData->visitRc = JVMTI_ITERATION_ABORT;
+				if (JVMTI_ERROR_NONE == iteratorData->rc) {
+					iteratorData->rc = batchData.rc;
+				}
+				omrthread_monitor_exit(iteratorData->batchMutex);
+			}
+		}
+		visitRc = iteratorData->visitRc;
+	} else if (0 != reportCount) {
+		omrthread_monitor_enter(iteratorData->batchMutex);
+		for (i = 0; (i < reportCount) && (JVMTI_ITERATION_CONTINUE == iteratorData->visitRc); i++) {
+			iteratorData->tags = tags[i];
+			if (JVMTI_ITERATION_ABORT == iterateThroughHeapReport(vm, iteratorData, objects[i].object)) {
+				iteratorData->visitRc = JVMTI_ITERATION_ABORT;
+			}
+		}
+		visitRc = iteratorData->visitRc;
+		omrthread_monitor_exit(iteratorData->batchMutex);
+	}
+
+	return visitRc;
+}
+
+
+
+/** 
+ * \brief      Apply the user specified filters to an object
+ * \ingroup    jvmti.heap
+ * 
+ * @param[in] vm
+ * @param[in] iteratorData  iteration structure containing misc data (only the filters are read)
+ * @param[in] object        object being iterated over
+ * @param[out] tags         the tags of the object and of its class
+ * @return                  TRUE if the object is to be reported, FALSE otherwise
+ * 
+ */
+static BOOLEAN
+iterateThroughHeapFilter(J9JavaVM *vm, J9JVMTIHeapData * iteratorData, j9object_t object, jvmtiHeapTags * tags)
+{
 	J9Class *clazz;
 
 	/* Do not report uninitialized classes */
 	if (J9VM_IS_UNINITIALIZED_HEAPCLASS_VM(vm, object)) {
-		return JVMTI_ITERATION_CONTINUE;
+		return FALSE;
 	}
 
 	clazz = J9OBJECT_CLAZZ_VM(vm, object);
@@ -1366,25 +1473,48 @@ iterateThroughHeapCallback(J9JavaVM *vm, J9MM_IterateObjectDescriptor *objectDes
 	/* If the class filter is set, check if this references is what we are looking for,
 	 * otherwise continue itterating */
 	if ((iteratorData->classFilter != NULL) && (iteratorData->classFilter != clazz)) {
-		return JVMTI_ITERATION_CONTINUE;
+		return FALSE;
 	}
  
 	/* Get the tags required by the call back */
-	jvmtiFollowRefs_getTags(iteratorData, NULL, object);
+	tags->objectTag = heapObjectTag(iteratorData, object);
+	tags->classTag = heapObjectTag(iteratorData, J9VM_J9CLASS_TO_HEAPCLASS(clazz));
+	tags->referrerObjectTag = 0;
+	tags->referrerClassTag = 0;
 
 
 	/* Does it pass the object filters specified by the user? */
-	if (((iteratorData->filter & JVMTI_HEAP_FILTER_TAGGED) && iteratorData->tags.objectTag != (jlong) 0)  ||   /* filter out tagged objects */
-		((iteratorData->filter & JVMTI_HEAP_FILTER_UNTAGGED) && iteratorData->tags.objectTag == (jlong) 0)) {  /* filter out untagged objects */
-		return JVMTI_ITERATION_CONTINUE;
+	if (((iteratorData->filter & JVMTI_HEAP_FILTER_TAGGED) && tags->objectTag != (jlong) 0)  ||   /* filter out tagged objects */
+		((iteratorData->filter & JVMTI_HEAP_FILTER_UNTAGGED) && tags->objectTag == (jlong) 0)) {  /* filter out untagged objects */
+		return FALSE;
 	}
 
 	/* Does it pass the class filters specified by the user? */
-	if (((iteratorData->filter & JVMTI_HEAP_FILTER_CLASS_TAGGED) && iteratorData->tags.classTag != (jlong) 0) ||    /* filter out tagged classes */
-		((iteratorData->filter & JVMTI_HEAP_FILTER_CLASS_UNTAGGED) && iteratorData->tags.classTag == (jlong) 0)) {  /* filter out untagged classes */
-		return JVMTI_ITERATION_CONTINUE;
+	if (((iteratorData->filter & JVMTI_HEAP_FILTER_CLASS_TAGGED) && tags->classTag != (jlong) 0) ||    /* filter out tagged classes */
+		((iteratorData->filter & JVMTI_HEAP_FILTER_CLASS_UNTAGGED) && tags->classTag == (jlong) 0)) {  /* filter out untagged classes */
+		return FALSE;
 	}
 
+	return TRUE;
+}
+
+
+
+/** 
+ * \brief      Issue the user callbacks for an object which passed the filters
+ * \ingroup    jvmti.heap
+ * 
+ * @param[in] vm
+ * @param[in] iteratorData  iteration structure containing misc data, with the tags of the object
+ * @param[in] object        object being reported
+ * @return                  JVMTI_ITERATION_ABORT if a callback failed or asked to stop iterating
+ * 
+ */
+static jvmtiIterationControl
+iterateThroughHeapReport(J9JavaVM *vm, J9JVMTIHeapData * iteratorData, j9object_t object)
+{
+	jvmtiIterationControl visitRc = JVMTI_ITERATION_CONTINUE;
+	J9Class *clazz = J9OBJECT_CLAZZ_VM(vm, object);
 
 #ifdef JVMTI_HEAP_DEBUG	
 	{
@@ -1998,7 +2128,19 @@ updateObjectTag(J9JVMTIHeapData * iteratorData, j9object_t object, jlong *origin
 {
 	J9JVMTIObjectTag entry;
 	J9JVMTIObjectTag *resultTag;
-	
+	J9JVMTIObjectTagShard *shard = NULL;
+	BOOLEAN parallel = J9_ARE_ANY_BITS_SET(iteratorData->flags, J9JVMTI_HI_PARALLEL);
+
+	if (*originalTag == newTag) {
+		return;
+	}
+
+	/* Objects may be filtered on other threads during a parallel iteration */
+	shard = J9JVMTI_OBJECT_TAG_SHARD(iteratorData->env, object);
+	if (parallel) {
+		omrthread_monitor_enter(shard->mutex);
+	}
+
 	/* The callback could have added or removed the tag. Modify the hashtable entry to
 	 * account for it */
 	if (*originalTag != 0) {
@@ -2007,13 +2149,13 @@ updateObjectTag(J9JVMTIHeapData * iteratorData, j9object_t object, jlong *origin
 			if (*originalTag != newTag) {
 				/* was and still is tagged, but the user has changed the tag */
 				entry.ref = object;
-				resultTag = hashTableFind(iteratorData->env->objectTagTable, &entry);
+				resultTag = hashTableFind(shard->table, &entry);
 				resultTag->tag = newTag;
 			}
 		} else {
 			/* no longer tagged, remove the table entry */
 			entry.ref = object;
-			hashTableRemove(iteratorData->env->objectTagTable, &entry);
+			hashTableRemove(shard->table, &entry);
 			*originalTag = 0;
 		}
 	} else {
@@ -2022,10 +2164,14 @@ updateObjectTag(J9JVMTIHeapData * iteratorData, j9object_t object, jlong *origin
 			/* now tagged, add table entry */
 			entry.ref = object;
 			entry.tag = newTag;
-			resultTag = hashTableAdd(iteratorData->env->objectTagTable, &entry);
+			resultTag = hashTableAdd(shard->table, &entry);
 			*originalTag = resultTag->tag;
 		}
 	}
+
+	if (parallel) {
+		omrthread_monitor_exit(shard->mutex);
+	}
 }
 
 
@@ -467,7 +467,6 @@ processStackRoot(J9JVMTIObjectIteratorData * data, J9JVMTIObjectTag * entry, jlo
 	jint depth = (jint) walkState->framesWalked;
 	J9Method * ramMethod = walkState->method;
 	jmethodID method;
-	J9JVMTIObjectTag search;
 	J9JVMTIObjectTag * result;
 
 	/* Convert internal slot type to JVMTI type */
@@ -503,8 +502,7 @@ processStackRoot(J9JVMTIObjectIteratorData * data, J9JVMTIObjectTag * entry, jlo
 
 	/* Find thread tag */
 
-	search.ref = (j9object_t) walkState->walkThread->threadObject;
-	result = hashTableFind(data->env->objectTagTable, &search);
+	result = findObjectTag(data->env, (j9object_t) walkState->walkThread->threadObject);
 	
 	/* Call the callback */
 
@@ -536,8 +534,7 @@ wrapHeapIterationCallback(J9JavaVM * vm, J9MM_IterateObjectDescriptor *objectDes
 			return JVMTI_ITERATION_CONTINUE;
 		}
 
-		entry.ref = object;
-		objectTag = hashTableFind(iteratorData->env->objectTagTable, &entry);
+		objectTag = findObjectTag(iteratorData->env, object);
 
 		if ( (iteratorData->filter == JVMTI_HEAP_OBJECT_EITHER) ||
 		     (iteratorData->filter == JVMTI_HEAP_OBJECT_TAGGED && objectTag != NULL) ||
@@ -550,8 +547,7 @@ wrapHeapIterationCallback(J9JavaVM * vm, J9MM_IterateObjectDescriptor *objectDes
 			J9Class *clazz;
 
 			clazz = J9OBJECT_CLAZZ_VM(vm, object);
-			entry.ref = J9VM_J9CLASS_TO_HEAPCLASS(clazz);
-			classTag = hashTableFind(iteratorData->env->objectTagTable, &entry);
+			classTag = findObjectTag(iteratorData->env, J9VM_J9CLASS_TO_HEAPCLASS(clazz));
 
 			objectSize = getObjectSize(vm, object);
 
@@ -569,7 +565,7 @@ wrapHeapIterationCallback(J9JavaVM * vm, J9MM_IterateObjectDescriptor *objectDes
 				} else {
 					/* no longer tagged, remove the table entry */
 					entry.ref = object;
-					hashTableRemove(iteratorData->env->objectTagTable, &entry);
+					hashTableRemove(J9JVMTI_OBJECT_TAG_SHARD(iteratorData->env, entry.ref)->table, &entry);
 				}
 			} else {
 				/* object was untagged before callback */
@@ -577,7 +573,7 @@ wrapHeapIterationCallback(J9JavaVM * vm, J9MM_IterateObjectDescriptor *objectDes
 					/* now tagged, add table entry */
 					entry.ref = object;
 					entry.tag = tag;
-					hashTableAdd(iteratorData->env->objectTagTable, &entry);
+					hashTableAdd(J9JVMTI_OBJECT_TAG_SHARD(iteratorData->env, entry.ref)->table, &entry);
 				}
 			}
 		
@@ -613,13 +609,11 @@ wrapObjectIterationCallback(j9object_t *slotPtr, j9object_t referrer, void *user
 		}
 
 		clazz = J9OBJECT_CLAZZ(vmThread, object);
-		entry.ref = J9VM_J9CLASS_TO_HEAPCLASS(clazz);
-		result = hashTableFind(iteratorData->env->objectTagTable, &entry);
+		result = findObjectTag(iteratorData->env, J9VM_J9CLASS_TO_HEAPCLASS(clazz));
 		classTag = result ? result->tag : 0;
 
 		if ( referrer && (event.type != J9JVMTI_HEAP_EVENT_STACK)) {
-			entry.ref = referrer;
-			result = hashTableFind(iteratorData->env->objectTagTable, &entry);
+			result = findObjectTag(iteratorData->env, referrer);
 			referrerTag = result ? result->tag : 0;
 		}
 
@@ -627,7 +621,7 @@ wrapObjectIterationCallback(j9object_t *slotPtr, j9object_t referrer, void *user
 
 		entry.ref = object;
 		entry.tag = 0;
-		result = hashTableFind(iteratorData->env->objectTagTable, &entry);
+		result = findObjectTag(iteratorData->env, object);
 		if ( result == NULL ) {
 			result = &entry;
 		}
@@ -649,12 +643,12 @@ wrapObjectIterationCallback(j9object_t *slotPtr, j9object_t referrer, void *user
 		if ( &entry == result ) {
 			/* Tag wasn't set, but now is... */
 			if (result->tag != 0) {
-				hashTableAdd(iteratorData->env->objectTagTable, result);
+				hashTableAdd(J9JVMTI_OBJECT_TAG_SHARD(iteratorData->env, result->ref)->table, result);
 			}
 		} else {
 			/* Tag was set, but now isn't... */
 			if (result->tag == 0) {
-				hashTableRemove(iteratorData->env->objectTagTable, result);
+				hashTableRemove(J9JVMTI_OBJECT_TAG_SHARD(iteratorData->env, result->ref)->table, result);
 			}
 		}
 	} else if (J9JVMTI_HEAP_EVENT_NONE_NOFOLLOW == event.type) {
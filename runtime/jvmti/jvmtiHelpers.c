@@ -91,6 +91,8 @@ static UDATA hashEqualObjectTag (void *lhsEntry, void *rhsEntry, void *userData)
 static UDATA findDecompileInfoFrameIterator(J9VMThread *currentThread, J9StackWalkState *walkState);
 static UDATA watchedClassHash (void *entry, void *userData);
 static UDATA watchedClassEqual (void *lhsEntry, void *rhsEntry, void *userData);
+static UDATA allocateObjectTagShards (J9JVMTIEnv * j9env);
+static void freeObjectTagShards (J9JVMTIEnv * j9env);
 
 
 jvmtiError
@@ -223,10 +225,7 @@ disposeEnvironment(J9JVMTIEnv * j9env, UDATA freeData)
 			j9env->threadDataPool = NULL;
 		}
 
-		if (NULL != j9env->objectTagTable) {
-			hashTableFree(j9env->objectTagTable);
-			j9env->objectTagTable = NULL;
-		}
+		freeObjectTagShards(j9env);
 
 		if (NULL != j9env->watchedClasses) {
 			J9HashTableState walkState;
@@ -324,8 +323,7 @@ allocateEnvironment(J9InvocationJavaVM * invocationJavaVM, jint version, void **
 			if (j9env->threadDataPool == NULL) {
 				goto fail;
 			}
-			j9env->objectTagTable = hashTableNew(OMRPORT_FROM_J9PORT(vm->portLibrary), J9_GET_CALLSITE(), 0, sizeof(J9JVMTIObjectTag), sizeof(jlong), 0,  J9MEM_CATEGORY_JVMTI, hashObjectTag, hashEqualObjectTag, NULL, NULL);
-			if (j9env->objectTagTable == NULL) {
+			if (allocateObjectTagShards(j9env) != 0) {
 				goto fail;
 			}
 			j9env->watchedClasses = hashTableNew(OMRPORT_FROM_J9PORT(vm->portLibrary), J9_GET_CALLSITE(), 0, sizeof(J9JVMTIWatchedClass), sizeof(UDATA), 0,  J9MEM_CATEGORY_JVMTI, watchedClassHash, watchedClassEqual, NULL, NULL);
@@ -786,6 +784,158 @@ hashEqualObjectTag(void *lhsEntry, void *rhsEntry, void *userData)
 }
 
 
+/**
+ * Allocate the object tag table shards of an environment: one per CPU (rounded up to a power of two), up to
+ * J9JVMTI_OBJECT_TAG_SHARD_MAXIMUM.
+ * @return 0 on success, non-zero if the shards could not be allocated
+ */
+static UDATA
+allocateObjectTagShards(J9JVMTIEnv * j9env)
+{
+	J9JavaVM * vm = j9env->vm;
+	J9JVMTIObjectTagShard * shards = NULL;
+	UDATA cpuCount = 0;
+	UDATA shardCount = 1;
+	UDATA i = 0;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	cpuCount = j9sysinfo_get_number_CPUs_by_type(J9PORT_CPU_TARGET);
+	while ((shardCount < cpuCount) && (shardCount < J9JVMTI_OBJECT_TAG_SHARD_MAXIMUM)) {
+		shardCount *= 2;
+	}
+
+	shards = j9mem_allocate_memory(sizeof(J9JVMTIObjectTagShard) * shardCount, J9MEM_CATEGORY_JVMTI);
+	if (NULL == shards) {
+		return 1;
+	}
+	memset(shards, 0, sizeof(J9JVMTIObjectTagShard) * shardCount);
+
+	for (i = 0; i < shardCount; i++) {
+		if (omrthread_monitor_init(&(shards[i].mutex), 0) != 0) {
+			break;
+		}
+		shards[i].table = hashTableNew(OMRPORT_FROM_J9PORT(vm->portLibrary), J9_GET_CALLSITE(), 0, sizeof(J9JVMTIObjectTag), sizeof(jlong), 0,  J9MEM_CATEGORY_JVMTI, hashObjectTag, hashEqualObjectTag, NULL, NULL);
+		if (NULL == shards[i].table) {
+			omrthread_monitor_destroy(shards[i].mutex);
+			break;
+		}
+	}
+
+	if (i < shardCount) {
+		while (i > 0) {
+			i -= 1;
+			hashTableFree(shards[i].table);
+			omrthread_monitor_destroy(shards[i].mutex);
+		}
+		j9mem_free_memory(shards);
+		return 1;
+	}
+
+	j9env->objectTagShards = shards;
+	j9env->objectTagShardCount = shardCount;
+	return 0;
+}
+
+
+/**
+ * Free the object tag table shards of an environment.
+ */
+static void
+freeObjectTagShards(J9JVMTIEnv * j9env)
+{
+	PORT_ACCESS_FROM_JAVAVM(j9env->vm);
+
+	if (NULL != j9env->objectTagShards) {
+		UDATA shardCount = j9env->objectTagShardCount;
+		UDATA i = 0;
+
+		j9env->objectTagShardCount = 0;
+		for (i = 0; i < shardCount; i++) {
+			hashTableFree(j9env->objectTagShards[i].table);
+			omrthread_monitor_destroy(j9env->objectTagShards[i].mutex);
+		}
+		j9mem_free_memory(j9env->objectTagShards);
+		j9env->objectTagShards = NULL;
+	}
+}
+
+
+J9JVMTIObjectTag *
+findObjectTag(J9JVMTIEnv * j9env, j9object_t object)
+{
+	J9JVMTIObjectTag entry;
+
+	if (!J9JVMTI_OBJECT_MAY_BE_TAGGED(object)) {
+		return NULL;
+	}
+
+	entry.ref = object;
+	return hashTableFind(J9JVMTI_OBJECT_TAG_SHARD(j9env, object)->table, &entry);
+}
+
+
+jlong
+getObjectTag(J9JVMTIEnv * j9env, j9object_t object)
+{
+	J9JVMTIObjectTagShard * shard = NULL;
+	J9JVMTIObjectTag entry;
+	J9JVMTIObjectTag * objectTag = NULL;
+	jlong tag = 0;
+
+	if (!J9JVMTI_OBJECT_MAY_BE_TAGGED(object)) {
+		return 0;
+	}
+
+	shard = J9JVMTI_OBJECT_TAG_SHARD(j9env, object);
+	entry.ref = object;
+
+	omrthread_monitor_enter(shard->mutex);
+	objectTag = hashTableFind(shard->table, &entry);
+	if (NULL != objectTag) {
+		tag = objectTag->tag;
+	}
+	omrthread_monitor_exit(shard->mutex);
+
+	return tag;
+}
+
+
+jvmtiError
+setObjectTag(J9JVMTIEnv * j9env, j9object_t object, jlong tag)
+{
+	J9JVMTIObjectTagShard * shard = NULL;
+	J9JVMTIObjectTag entry;
+	J9JVMTIObjectTag * objectTag = NULL;
+	jvmtiError rc = JVMTI_ERROR_NONE;
+
+	/* Do not hash an untagged object only to find that it has no tag to remove */
+	if ((0 == tag) && !J9JVMTI_OBJECT_MAY_BE_TAGGED(object)) {
+		return JVMTI_ERROR_NONE;
+	}
+
+	shard = J9JVMTI_OBJECT_TAG_SHARD(j9env, object);
+	entry.ref = object;
+	entry.tag = tag;
+
+	omrthread_monitor_enter(shard->mutex);
+	objectTag = hashTableFind(shard->table, &entry);
+	if (NULL != objectTag) {
+		if (0 != tag) {
+			objectTag->tag = tag;
+		} else {
+			hashTableRemove(shard->table, &entry);
+		}
+	} else if (0 != tag) {
+		if (NULL == hashTableAdd(shard->table, &entry)) {
+			rc = JVMTI_ERROR_OUT_OF_MEMORY;
+		}
+	}
+	omrthread_monitor_exit(shard->mutex);
+
+	return rc;
+}
+
+
 static UDATA
 watchedClassHash(void *entry, void *userData) 
 {
@@ -2003,7 +2003,7 @@ jvmtiHookGCEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* us
 	J9JVMTIObjectTag * taggedObject;
 	J9HashTableState hashState;
 	UDATA phase = J9JVMTI_DATA_FROM_ENV(j9env)->phase;
-	J9JVMTIObjectTag * deletedHead = NULL;
+	UDATA shardIndex;
 #if defined(J9VM_OPT_JAVA_OFFLOAD_SUPPORT)
 	J9VMThread * currentThread = NULL;
 	UDATA javaOffloadOldState = 0;
@@ -2019,51 +2019,58 @@ jvmtiHookGCEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* us
 
 	Trc_JVMTI_jvmtiHookGCEnd_Entry();
 
-	/* Link all NULLed entries */
+	for (shardIndex = 0; shardIndex < j9env->objectTagShardCount; shardIndex++) {
+		J9HashTable * objectTagTable = j9env->objectTagShards[shardIndex].table;
+		J9JVMTIObjectTag * deletedHead = NULL;
 
-	taggedObject = hashTableStartDo(j9env->objectTagTable, &hashState);
-	while (taggedObject != NULL) {
-		if (taggedObject->ref == NULL) {
-			taggedObject->ref = (j9object_t) deletedHead;
-			deletedHead = (J9JVMTIObjectTag *) taggedObject;
+		/* Link all NULLed entries */
+
+		taggedObject = hashTableStartDo(objectTagTable, &hashState);
+		while (taggedObject != NULL) {
+			if (taggedObject->ref == NULL) {
+				taggedObject->ref = (j9object_t) deletedHead;
+				deletedHead = (J9JVMTIObjectTag *) taggedObject;
+			}
+			taggedObject = hashTableNextDo(&hashState);
 		}
-		taggedObject = hashTableNextDo(&hashState);
-	}
 
-	/* Rehash the object tag table for this environment */
+		/* Rehash this shard of the object tag table for this environment (the shard of a tag is chosen by the
+		 * identity hash code of its object, so a tag whose object moved stays in the same shard)
+		 */
 
-	hashTableRehash(j9env->objectTagTable);
+		hashTableRehash(objectTagTable);
 
-	/* Remove freed objects from the tag table - report events if need be */
+		/* Remove freed objects from the tag table - report events if need be */
 
-	if (deletedHead != NULL) {
-		jvmtiEventObjectFree objectFreeCallback = j9env->callbacks.ObjectFree;
-		UDATA reportObjectFreeEvents;
+		if (deletedHead != NULL) {
+			jvmtiEventObjectFree objectFreeCallback = j9env->callbacks.ObjectFree;
+			UDATA reportObjectFreeEvents;
 
-		reportObjectFreeEvents =
-			(phase == JVMTI_PHASE_LIVE) &&
-			(objectFreeCallback != NULL) &&
-			EVENT_IS_ENABLED(JVMTI_EVENT_OBJECT_FREE, &(j9env->globalEventEnable));
-		do {
-			taggedObject = deletedHead;
-			if (reportObjectFreeEvents) {
+			reportObjectFreeEvents =
+				(phase == JVMTI_PHASE_LIVE) &&
+				(objectFreeCallback != NULL) &&
+				EVENT_IS_ENABLED(JVMTI_EVENT_OBJECT_FREE, &(j9env->globalEventEnable));
+			do {
+				taggedObject = deletedHead;
+				if (reportObjectFreeEvents) {
 #if defined(J9VM_OPT_JAVA_OFFLOAD_SUPPORT)
-				/* Jazz 99339: Switch away from the zAAP processor if running there */
-				if (J9_ARE_ALL_BITS_SET(currentThread->javaVM->extendedRuntimeFlags, J9_EXTENDED_RUNTIME_RESTRICT_IFA)) {
-					javaOffloadSwitchOff(j9env, currentThread, JVMTI_EVENT_OBJECT_FREE, &javaOffloadOldState);
-				}
+					/* Jazz 99339: Switch away from the zAAP processor if running there */
+					if (J9_ARE_ALL_BITS_SET(currentThread->javaVM->extendedRuntimeFlags, J9_EXTENDED_RUNTIME_RESTRICT_IFA)) {
+						javaOffloadSwitchOff(j9env, currentThread, JVMTI_EVENT_OBJECT_FREE, &javaOffloadOldState);
+					}
 #endif /* J9VM_OPT_JAVA_OFFLOAD_SUPPORT */
-				objectFreeCallback((jvmtiEnv *) j9env, taggedObject->tag);
+					objectFreeCallback((jvmtiEnv *) j9env, taggedObject->tag);
 #if defined(J9VM_OPT_JAVA_OFFLOAD_SUPPORT)
-				/* Jazz 99339: Switch onto the zAAP processor if not running there after native finishes running on GP */
-				if (J9_ARE_ALL_BITS_SET(currentThread->javaVM->extendedRuntimeFlags, J9_EXTENDED_RUNTIME_RESTRICT_IFA)) {
-					javaOffloadSwitchOn(currentThread, JVMTI_EVENT_OBJECT_FREE, javaOffloadOldState);
-				}
+					/* Jazz 99339: Switch onto the zAAP processor if not running there after native finishes running on GP */
+					if (J9_ARE_ALL_BITS_SET(currentThread->javaVM->extendedRuntimeFlags, J9_EXTENDED_RUNTIME_RESTRICT_IFA)) {
+						javaOffloadSwitchOn(currentThread, JVMTI_EVENT_OBJECT_FREE, javaOffloadOldState);
+					}
 #endif /* J9VM_OPT_JAVA_OFFLOAD_SUPPORT */
-			}
-			deletedHead = (J9JVMTIObjectTag *) taggedObject->ref;
-			hashTableRemove(j9env->objectTagTable, taggedObject);
-		} while (deletedHead != NULL);
+				}
+				deletedHead = (J9JVMTIObjectTag *) taggedObject->ref;
+				hashTableRemove(objectTagTable, taggedObject);
+			} while (deletedHead != NULL);
+		}
 	}
 
 	/* Call the event callback */
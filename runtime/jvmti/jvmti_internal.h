@@ -1114,6 +1114,26 @@ jlong
 getObjectSize(J9JavaVM *vm, j9object_t obj);
 
 
+/**
+* @brief Find the tag table entry of an object without locking, for walks which exclude any change to the tag table
+* @param j9env
+* @param object
+* @return J9JVMTIObjectTag* the entry, or NULL if the object is not tagged
+*/
+J9JVMTIObjectTag *
+findObjectTag(J9JVMTIEnv * j9env, j9object_t object);
+
+
+/**
+* @brief Get the tag of an object, locking the shard of the tag table which holds it
+* @param j9env
+* @param object
+* @return jlong the tag, or 0 if the object is not tagged
+*/
+jlong
+getObjectTag(J9JVMTIEnv * j9env, j9object_t object);
+
+
 /**
 * @brief
 * @param *currentThread
@@ -1228,6 +1248,17 @@ jvmtiError
 setEventNotificationMode(J9JVMTIEnv * j9env, J9VMThread * currentThread, jint mode, jint event_type, jthread event_thread, jint low, jint high);
 
 
+/**
+* @brief Set (or remove, if tag is 0) the tag of an object, locking the shard of the tag table which holds it
+* @param j9env
+* @param object
+* @param tag
+* @return jvmtiError JVMTI_ERROR_OUT_OF_MEMORY if the tag could not be added
+*/
+jvmtiError
+setObjectTag(J9JVMTIEnv * j9env, j9object_t object, jlong tag);
+
+
 /**
 * @brief
 * @param pUtfData
@@ -149,12 +149,37 @@ typedef struct J9IndexableObject* mm_j9array_t;
 #define J9JAVAARRAY_EA_VM(javaVM, array, index, elemType) J9JAVAARRAYCONTIGUOUS_EA_VM(javaVM, array, index, elemType)
 #endif /* J9VM_GC_ARRAYLETS */
 
+/*
+ * Evacuate range check of the concurrent scavenger read barrier (the check the JIT inlines before a reference load).
+ * Only a slot referring into the evacuate space of an active concurrent scavenge needs the read barrier call, and the
+ * range of a thread is empty while no concurrent scavenge is active (see MM_ScavengerDelegate::switchConcurrentForThread).
+ * The slot is read twice, which is safe: while the range is set a slot may be healed, but never changed to refer into it.
+ */
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+#if defined(J9VM_GC_COMPRESSED_POINTERS)
+#define J9OBJECT__READ_BARRIER_RANGE_CHECK(vmThread, address) \
+	((*(volatile fj9object_t *)(address) >= (vmThread)->readBarrierRangeCheckBaseCompressed) && \
+	(*(volatile fj9object_t *)(address) <= (vmThread)->readBarrierRangeCheckTopCompressed))
+#else /* J9VM_GC_COMPRESSED_POINTERS */
+#define J9OBJECT__READ_BARRIER_RANGE_CHECK(vmThread, address) \
+	(((UDATA)*(volatile fj9object_t *)(address) >= (vmThread)->readBarrierRangeCheckBase) && \
+	((UDATA)*(volatile fj9object_t *)(address) <= (vmThread)->readBarrierRangeCheckTop))
+#endif /* J9VM_GC_COMPRESSED_POINTERS */
+#define J9STATIC__READ_BARRIER_RANGE_CHECK(vmThread, address) \
+	(((UDATA)*(volatile j9object_t *)(address) >= (vmThread)->readBarrierRangeCheckBase) && \
+	((UDATA)*(volatile j9object_t *)(address) <= (vmThread)->readBarrierRangeCheckTop))
+#else /* OMR_GC_CONCURRENT_SCAVENGER */
+#define J9OBJECT__READ_BARRIER_RANGE_CHECK(vmThread, address) 1
+#define J9STATIC__READ_BARRIER_RANGE_CHECK(vmThread, address) 1
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+
 /*
  * Private helpers for reference field types
  */
 #if defined(J9VM_GC_COMBINATION_SPEC)
 #define J9OBJECT__PRE_OBJECT_LOAD_ADDRESS(vmThread, object, address) \
-	((J9_GC_READ_BARRIER_TYPE_NONE != J9VMTHREAD_JAVAVM(vmThread)->gcReadBarrierType) ? \
+	(((J9_GC_READ_BARRIER_TYPE_NONE != J9VMTHREAD_JAVAVM(vmThread)->gcReadBarrierType) && \
+	((J9_GC_READ_BARRIER_TYPE_RANGE_CHECK != J9VMTHREAD_JAVAVM(vmThread)->gcReadBarrierType) || J9OBJECT__READ_BARRIER_RANGE_CHECK((vmThread), (address)))) ? \
 	J9VMTHREAD_JAVAVM((vmThread))->memoryManagerFunctions->J9ReadBarrier((vmThread), (fj9object_t*)(address)) : \
 	(void)0)
 #define J9OBJECT__PRE_OBJECT_LOAD_ADDRESS_VM(javaVM, object, address) \
@@ -162,7 +187,8 @@ typedef struct J9IndexableObject* mm_j9array_t;
 	(javaVM)->memoryManagerFunctions->J9ReadBarrier(J9JAVAVM_VMTHREAD(javaVM), (fj9object_t*)(address)) : \
 	(void)0)
 #define J9STATIC__PRE_OBJECT_LOAD(vmThread, clazz, address) \
-	((J9_GC_READ_BARRIER_TYPE_NONE != J9VMTHREAD_JAVAVM(vmThread)->gcReadBarrierType) ? \
+	(((J9_GC_READ_BARRIER_TYPE_NONE != J9VMTHREAD_JAVAVM(vmThread)->gcReadBarrierType) && \
+	((J9_GC_READ_BARRIER_TYPE_RANGE_CHECK != J9VMTHREAD_JAVAVM(vmThread)->gcReadBarrierType) || J9STATIC__READ_BARRIER_RANGE_CHECK((vmThread), (address)))) ? \
 	J9VMTHREAD_JAVAVM((vmThread))->memoryManagerFunctions->J9ReadBarrierJ9Class((vmThread), (j9object_t*)(address)) : \
 	(void)0)
 #define J9STATIC__PRE_OBJECT_LOAD_VM(javaVM, clazz, address) \
@@ -237,7 +263,8 @@ typedef struct J9IndexableObject* mm_j9array_t;
 #define J9STATIC__POST_OBJECT_STORE_VM(javaVM, clazz, address, value) 0
 #else /* J9VM_GC_REALTIME */
 #define J9OBJECT__PRE_OBJECT_LOAD_ADDRESS(vmThread, object, address) \
-	((J9_GC_READ_BARRIER_TYPE_NONE != J9VMTHREAD_JAVAVM(vmThread)->gcReadBarrierType) ? \
+	(((J9_GC_READ_BARRIER_TYPE_NONE != J9VMTHREAD_JAVAVM(vmThread)->gcReadBarrierType) && \
+	((J9_GC_READ_BARRIER_TYPE_RANGE_CHECK != J9VMTHREAD_JAVAVM(vmThread)->gcReadBarrierType) || J9OBJECT__READ_BARRIER_RANGE_CHECK((vmThread), (address)))) ? \
 	J9VMTHREAD_JAVAVM((vmThread))->memoryManagerFunctions->J9ReadBarrier((vmThread), (fj9object_t*)(address)) : \
 	(void)0)
 #define J9OBJECT__PRE_OBJECT_LOAD_ADDRESS_VM(javaVM, object, address) \
@@ -245,7 +272,8 @@ typedef struct J9IndexableObject* mm_j9array_t;
 	(javaVM)->memoryManagerFunctions->J9ReadBarrier(J9JAVAVM_VMTHREAD(javaVM), (fj9object_t*)(address)) : \
 	(void)0)
 #define J9STATIC__PRE_OBJECT_LOAD(vmThread, clazz, address) \
-	((J9_GC_READ_BARRIER_TYPE_NONE != J9VMTHREAD_JAVAVM(vmThread)->gcReadBarrierType) ? \
+	(((J9_GC_READ_BARRIER_TYPE_NONE != J9VMTHREAD_JAVAVM(vmThread)->gcReadBarrierType) && \
+	((J9_GC_READ_BARRIER_TYPE_RANGE_CHECK != J9VMTHREAD_JAVAVM(vmThread)->gcReadBarrierType) || J9STATIC__READ_BARRIER_RANGE_CHECK((vmThread), (address)))) ? \
 	J9VMTHREAD_JAVAVM((vmThread))->memoryManagerFunctions->J9ReadBarrierJ9Class((vmThread), (j9object_t*)(address)) : \
 	(void)0)
 #define J9STATIC__PRE_OBJECT_LOAD_VM(javaVM, clazz, address) \
@@ -267,6 +267,7 @@ struct J9JXEDescription;
 struct J9MemorySegment;
 struct J9MemorySegmentList;
 struct J9Method;
+struct J9MM_AllocationSiteDescriptor;
 struct J9MM_HeapRootSlotDescriptor;
 struct J9MM_IterateHeapDescriptor;
 struct J9MM_IterateObjectDescriptor;
@@ -4214,6 +4215,7 @@ typedef struct J9MemoryManagerFunctions {
 	UDATA  ( *j9gc_ext_check_is_valid_heap_object)(struct J9JavaVM *javaVM, j9object_t ptr, UDATA flags) ;
 #if defined(J9VM_GC_FINALIZATION)
 	UDATA  ( *j9gc_get_objects_pending_finalization_count)(struct J9JavaVM* vm) ;
+	void  ( *j9gc_get_finalizer_queue_statistics)(struct J9JavaVM* vm, UDATA *maxJobCount, U_64 *lastDrainMillis, U_64 *maxDrainMillis) ;
 #endif /* J9VM_GC_FINALIZATION */
 	UDATA  ( *j9gc_set_softmx)(struct J9JavaVM *javaVM, UDATA newsoftmx) ;
 	UDATA  ( *j9gc_get_softmx)(struct J9JavaVM *javaVM) ;
@@ -4364,6 +4366,10 @@ typedef struct J9MemoryManagerFunctions {
 	I_32  ( *j9gc_get_jit_string_dedup_policy)(struct J9JavaVM *javaVM) ;
 	UDATA ( *j9gc_stringHashFn)(void *key, void *userData);
 	UDATA ( *j9gc_stringHashEqualFn)(void *leftKey, void *rightKey, void *userData);
+	jvmtiIterationControl  ( *j9mm_iterate_allocation_profile)(struct J9JavaVM *javaVM, UDATA flags, jvmtiIterationControl (*func)(struct J9JavaVM *javaVM, struct J9MM_AllocationSiteDescriptor *siteDesc, void *userData), void *userData) ;
+	jvmtiIterationControl  ( *j9mm_iterate_region_objects_in_range)(struct J9JavaVM *vm, J9PortLibrary *portLibrary, struct J9MM_IterateRegionDescriptor *region, void *base, void *top, UDATA flags, jvmtiIterationControl (*func)(struct J9JavaVM *vm, struct J9MM_IterateObjectDescriptor *objectDesc, void *userData), void *userData) ;
+	jvmtiIterationControl  ( *j9mm_iterate_all_objects_in_batches)(struct J9VMThread *vmThread, J9PortLibrary *portLibrary, UDATA flags, jvmtiIterationControl (*func)(struct J9JavaVM *vm, struct J9MM_IterateObjectDescriptor *objects, UDATA count, void *userData), void *userData) ;
+	jvmtiIterationControl  ( *j9mm_iterate_regions_in_parallel)(struct J9VMThread *vmThread, J9PortLibrary *portLibrary, struct J9MM_IterateSpaceDescriptor *space, UDATA flags, jvmtiIterationControl (*func)(struct J9JavaVM *vm, struct J9MM_IterateRegionDescriptor *regionDesc, void *base, void *top, UDATA rangeIndex, void *userData), void *userData) ;
 } J9MemoryManagerFunctions;
 
 typedef struct J9InternalVMFunctions {
@@ -91,6 +91,27 @@ typedef struct J9JVMTIObjectTag {
 	jlong tag;
 } J9JVMTIObjectTag;
 
+/* The object tags of an environment are spread over a power of two number of shards (one per CPU, up to this many),
+ * each with its own lock, so that agent threads tagging different objects do not contend.
+ */
+#define J9JVMTI_OBJECT_TAG_SHARD_MAXIMUM 64
+
+typedef struct J9JVMTIObjectTagShard {
+	omrthread_monitor_t mutex;
+	J9HashTable* table;
+} J9JVMTIObjectTagShard;
+
+/* The shard of j9env which holds the tag of object. The shard is chosen by the identity hash code of the object, which
+ * it keeps when the GC moves it, so tags never change shard. This hashes object if it has not been hashed yet, so
+ * lookups should first check J9JVMTI_OBJECT_MAY_BE_TAGGED.
+ */
+#define J9JVMTI_OBJECT_TAG_SHARD(j9env, object) \
+	(&((j9env)->objectTagShards[((U_32)objectHashCode((j9env)->vm, (object))) & ((j9env)->objectTagShardCount - 1)]))
+
+/* An object which has never been hashed has never been tagged (see J9JVMTI_OBJECT_TAG_SHARD) */
+#define J9JVMTI_OBJECT_MAY_BE_TAGGED(object) \
+	(0 != (TMP_J9OBJECT_FLAGS(object) & (OBJECT_HEADER_HAS_BEEN_HASHED_IN_CLASS | OBJECT_HEADER_HAS_BEEN_MOVED_IN_CLASS)))
+
 #define J9JVMTI_WATCHED_FIELD_BITS_PER_FIELD 2
 #define J9JVMTI_WATCHED_FIELDS_PER_UDATA \
 	((sizeof(UDATA) * 8) / J9JVMTI_WATCHED_FIELD_BITS_PER_FIELD)
@@ -158,7 +179,8 @@ typedef struct J9JVMTIEnv {
 	J9JVMTIExtensionCallbacks extensionCallbacks;
 	omrthread_monitor_t threadDataPoolMutex;
 	J9Pool* threadDataPool;
-	J9HashTable* objectTagTable;
+	J9JVMTIObjectTagShard* objectTagShards;
+	UDATA objectTagShardCount;
 	J9JVMTIEventEnableMap globalEventEnable;
 	J9HashTable *watchedClasses;
 	J9Pool* breakpoints;
@@ -177,6 +199,8 @@ typedef struct J9JVMTIEnv {
 #define J9JVMTIENV_FLAG_UNUSED_2 2
 #define J9JVMTIENV_FLAG_CLASS_LOAD_HOOK_EVER_ENABLED 4
 #define J9JVMTIENV_FLAG_RETRANSFORM_CAPABLE 8
+#define J9JVMTIENV_FLAG_PARALLEL_HEAP_ITERATION 16
+#define J9JVMTIENV_FLAG_CONCURRENT_HEAP_ITERATION_CALLBACKS 32
 
 
 typedef struct J9JVMTIData {
@@ -25,11 +25,44 @@
 #include "FileStream.hpp"
 #include "../oti/util_api.h"
 
+#ifdef AIXPPC	/* hack for zlib/AIX problem */
+#define STDC
+#endif
+
+#include "zlib.h"
+
+/* Size of the buffers between the writer and the deflater, and between the deflater and the file */
+#define FILESTREAM_DEFLATE_BUFFER_SIZE (64 * 1024)
+
+/* ZLib interface to j9mem_allocate_memory */
+static voidpf
+fileStreamAllocate(voidpf opaque, uInt items, uInt size)
+{
+	PORT_ACCESS_FROM_PORT((J9PortLibrary*)opaque);
+
+	return j9mem_allocate_memory(items * size, OMRMEM_CATEGORY_VM);
+}
+
+/* ZLib interface to j9mem_free_memory */
+static void
+fileStreamFree(voidpf opaque, voidpf address)
+{
+	PORT_ACCESS_FROM_PORT((J9PortLibrary*)opaque);
+
+	j9mem_free_memory(address);
+}
+
 /* Constructor */
 FileStream::FileStream(J9PortLibrary* portLibrary) :
 	_PortLibrary(portLibrary),
 	_FileHandle(-1),
-	_Error(0)
+	_Error(0),
+	_Deflater(NULL),
+	_InputBuffer(NULL),
+	_InputLength(0),
+	_OutputBuffer(NULL),
+	_Crc(0),
+	_UncompressedLength(0)
 {
 	/* Nothing to do */
 }
@@ -50,10 +83,77 @@ FileStream::open(const char* fileName)
 	}
 }
 
+/* Method for opening the file, gzip compressing everything written to it */
+void
+FileStream::openCompressed(const char* fileName)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+	open(fileName);
+	if (_FileHandle == -1) {
+		return;
+	}
+
+	/* The bundled zlib is built without gzip support, so deflate raw data and write the gzip wrapper here (RFC 1952) */
+	_Deflater     = (z_stream*)j9mem_allocate_memory(sizeof(z_stream), OMRMEM_CATEGORY_VM);
+	_InputBuffer  = (char*)j9mem_allocate_memory(FILESTREAM_DEFLATE_BUFFER_SIZE, OMRMEM_CATEGORY_VM);
+	_OutputBuffer = (char*)j9mem_allocate_memory(FILESTREAM_DEFLATE_BUFFER_SIZE, OMRMEM_CATEGORY_VM);
+
+	if ((_Deflater != NULL) && (_InputBuffer != NULL) && (_OutputBuffer != NULL)) {
+		memset(_Deflater, 0, sizeof(z_stream));
+		_Deflater->zalloc = fileStreamAllocate;
+		_Deflater->zfree  = fileStreamFree;
+		_Deflater->opaque = (voidpf)_PortLibrary;
+
+		/* Favour speed: the dump is written while the application is stopped */
+		if (deflateInit2(_Deflater, Z_BEST_SPEED, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) == Z_OK) {
+			/* Magic number, deflate method, no flags, no modification time, no extra flags, unknown OS */
+			static const char gzipHeader[10] = {(char)0x1F, (char)0x8B, 8, 0, 0, 0, 0, 0, 0, (char)0xFF};
+
+			_Crc                = (U_32)crc32(0, Z_NULL, 0);
+			_UncompressedLength = 0;
+			_InputLength        = 0;
+			writeToFile(gzipHeader, sizeof(gzipHeader));
+			return;
+		}
+	}
+
+	/* Compression is not available so fail the file rather than write plain data where gzip data was asked for */
+	j9mem_free_memory(_Deflater);
+	j9mem_free_memory(_InputBuffer);
+	j9mem_free_memory(_OutputBuffer);
+	_Deflater     = NULL;
+	_InputBuffer  = NULL;
+	_OutputBuffer = NULL;
+	_Error        = -1;
+}
+
 /* Method for closing the file */
 void 
 FileStream::close(void)
 {
+	if (_Deflater != NULL) {
+		PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+		/* Compress any remaining data and write the gzip trailer (CRC-32 and length, both little endian) */
+		deflateInput(Z_FINISH);
+
+		char trailer[8];
+		for (int i = 0; i < 4; i++) {
+			trailer[i]     = (char)((_Crc >> (8 * i)) & 0xFF);
+			trailer[i + 4] = (char)((_UncompressedLength >> (8 * i)) & 0xFF);
+		}
+		writeToFile(trailer, sizeof(trailer));
+
+		deflateEnd(_Deflater);
+		j9mem_free_memory(_Deflater);
+		j9mem_free_memory(_InputBuffer);
+		j9mem_free_memory(_OutputBuffer);
+		_Deflater     = NULL;
+		_InputBuffer  = NULL;
+		_OutputBuffer = NULL;
+	}
+
 	if (_FileHandle != -1) {
 		j9cached_file_sync(_PortLibrary, _FileHandle);
 		j9cached_file_close(_PortLibrary, _FileHandle);
@@ -76,6 +176,33 @@ bool FileStream::hasError(void) const
 /* Method for writing characters described by a pointer and a length to the file*/
 void
 FileStream::writeCharacters(const char* data, IDATA length)
+{
+	if (_Deflater == NULL) {
+		writeToFile(data, length);
+		return;
+	}
+
+	/* Gather the (mostly tiny) writes so the deflater is handed whole buffers */
+	while ((length > 0) && ! _Error) {
+		UDATA count = FILESTREAM_DEFLATE_BUFFER_SIZE - _InputLength;
+		if ((UDATA)length < count) {
+			count = (UDATA)length;
+		}
+
+		memcpy(_InputBuffer + _InputLength, data, count);
+		_InputLength += count;
+		data         += count;
+		length       -= count;
+
+		if (_InputLength == FILESTREAM_DEFLATE_BUFFER_SIZE) {
+			deflateInput(Z_NO_FLUSH);
+		}
+	}
+}
+
+/* Method for writing characters to the file as they are */
+void
+FileStream::writeToFile(const char* data, IDATA length)
 {
 	if (_FileHandle != -1 && ! _Error) {
 		IDATA rc = j9cached_file_write(_PortLibrary, _FileHandle, data, length);
@@ -86,6 +213,37 @@ FileStream::writeCharacters(const char* data, IDATA length)
 	}
 }
 
+/* Method for compressing the gathered data into the file */
+void
+FileStream::deflateInput(int flush)
+{
+	_Crc                = (U_32)crc32(_Crc, (const Bytef*)_InputBuffer, (uInt)_InputLength);
+	_UncompressedLength += (U_32)_InputLength;
+
+	_Deflater->next_in  = (Bytef*)_InputBuffer;
+	_Deflater->avail_in = (uInt)_InputLength;
+
+	/* Deflate until the input is consumed (and, when finishing, until the deflater has no more output) */
+	while (! _Error) {
+		_Deflater->next_out  = (Bytef*)_OutputBuffer;
+		_Deflater->avail_out = FILESTREAM_DEFLATE_BUFFER_SIZE;
+
+		int rc = deflate(_Deflater, flush);
+		if ((rc != Z_OK) && (rc != Z_STREAM_END) && (rc != Z_BUF_ERROR)) {
+			_Error = -1;
+			break;
+		}
+
+		writeToFile(_OutputBuffer, FILESTREAM_DEFLATE_BUFFER_SIZE - _Deflater->avail_out);
+
+		if ((_Deflater->avail_out != 0) && ((flush != Z_FINISH) || (rc == Z_STREAM_END))) {
+			break;
+		}
+	}
+
+	_InputLength = 0;
+}
+
 void
 FileStream::writeCharacters(const char* data)
 {
@@ -25,6 +25,8 @@
 /* Includes */
 #include "j9port.h"
 
+struct z_stream_s;
+
 /**************************************************************************************************/
 /*                                                                                                */
 /* Class for writing to a file                                                                    */
@@ -42,6 +44,9 @@ public :
 	/* Method for opening the file */
 	void open(const char* fileName);
 
+	/* Method for opening the file, gzip compressing everything written to it */
+	void openCompressed(const char* fileName);
+
 	/* Method for closing the file */
 	void close(void);
 
@@ -59,11 +64,23 @@ private :
 	FileStream(const FileStream& source);
 	FileStream& operator=(const FileStream& source);
 
+	/* Methods for compressing the data */
+	void writeToFile (const char* data, IDATA length);
+	void deflateInput(int flush);
+
 protected :
 	/* Declared data */
 	J9PortLibrary* _PortLibrary;
 	IDATA          _FileHandle;
 	IDATA          _Error;
+
+	/* Compression state (the deflater is NULL unless the file is compressed) */
+	struct z_stream_s* _Deflater;
+	char*          _InputBuffer;
+	UDATA          _InputLength;
+	char*          _OutputBuffer;
+	U_32           _Crc;
+	U_32           _UncompressedLength;
 };
 
 #endif
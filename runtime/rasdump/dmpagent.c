@@ -1830,6 +1830,11 @@ printDumpSpec(struct J9JavaVM *vm, IDATA kind, IDATA verboseLevel)
 
 				if (strcmp(spec->name, "heap") == 0) {
 					j9tty_err_printf(PORTLIB, "\n  opts=PHD|CLASSIC\n");
+					j9tty_err_printf(PORTLIB, "       [+PARALLEL]          Write the PHD regions on the GC threads\n");
+					j9tty_err_printf(PORTLIB, "       [+GZIP]              Compress the PHD file (gzip format, .gz suffix)\n");
+#if defined(LINUX)
+					j9tty_err_printf(PORTLIB, "       [+FORK]              Write the PHD file asynchronously from a snapshot process\n");
+#endif /* defined(LINUX) */
 				} else if (strcmp(spec->name, "tool") == 0) {
 					j9tty_err_printf(PORTLIB, "\n  opts=WAIT<msec>|ASYNC\n");
 #ifdef J9ZOS390
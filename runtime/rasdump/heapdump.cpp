@@ -27,6 +27,13 @@
 #include "HeapIteratorAPI.h"
 #include "j9dmpnls.h"
 #include "FileStream.hpp"
+#if defined(LINUX)
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#endif /* defined(LINUX) */
 
 #include "ut_j9dmp.h"
 
@@ -39,6 +46,7 @@ static jvmtiIterationControl binaryHeapDumpHeapIteratorCallback   (J9JavaVM* vm,
 static jvmtiIterationControl binaryHeapDumpSpaceIteratorCallback  (J9JavaVM* vm, J9MM_IterateSpaceDescriptor*  spaceDescriptor,   void* userData);
 static jvmtiIterationControl binaryHeapDumpRegionIteratorCallback (J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDescription, void* userData);
 static jvmtiIterationControl binaryHeapDumpObjectIteratorCallback (J9JavaVM* vm, J9MM_IterateObjectDescriptor* objectDescriptor,  void* userData);
+static jvmtiIterationControl binaryHeapDumpParallelRangeIteratorCallback(J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDescription, void* base, void* top, UDATA rangeIndex, void* userData);
 
 static jvmtiIterationControl binaryHeapDumpObjectReferenceIteratorTraitsCallback(J9JavaVM* virtualMachine, J9MM_IterateObjectDescriptor* objectDescriptor, J9MM_IterateObjectRefDescriptor* referenceDescriptor, void* userData);
 static jvmtiIterationControl binaryHeapDumpObjectReferenceIteratorWriterCallback(J9JavaVM* virtualMachine, J9MM_IterateObjectDescriptor* objectDescriptor, J9MM_IterateObjectRefDescriptor* referenceDescriptor, void* userData);
@@ -734,10 +742,13 @@ class BinaryHeapDumpWriter
 {
 public :
 	/* Constructor */
-	BinaryHeapDumpWriter(const char* fileName, J9RASdumpContext* context, J9RASdumpAgent* agent);
+	BinaryHeapDumpWriter(const char* fileName, J9RASdumpContext* context, J9RASdumpAgent* agent, bool parallel, bool snapshot);
 
 	/* Destructor */
 	~BinaryHeapDumpWriter();
+
+	/* Method for checking whether the dump failed */
+	inline bool hasError(void) const {return _Error;}
 	
 	UDATA             _Id;
 	char*             _RegionStart;
@@ -756,6 +767,7 @@ private :
 	friend jvmtiIterationControl binaryHeapDumpObjectReferenceIteratorWriterCallback(J9JavaVM* virtualMachine, J9MM_IterateObjectDescriptor* objectDescriptor, J9MM_IterateObjectRefDescriptor* referenceDescriptor, void* userData);
 	friend jvmtiIterationControl binaryHeapDumpHeapIteratorCallback(J9JavaVM* virtualMachine, J9MM_IterateHeapDescriptor* heapDescriptor, void* userData);
 	friend jvmtiIterationControl binaryHeapDumpRegionIteratorCallback(J9JavaVM* virtualMachine, J9MM_IterateRegionDescriptor* regionDescription, void* userData);
+	friend jvmtiIterationControl binaryHeapDumpParallelRangeIteratorCallback(J9JavaVM* virtualMachine, J9MM_IterateRegionDescriptor* regionDescription, void* base, void* top, UDATA rangeIndex, void* userData);
 
 	/* Nested class for determining the characteristics of the references */
 	class ReferenceTraits
@@ -839,11 +851,55 @@ private :
 		int         _Index;
 	};
 
+	/* Nested class for holding the records of a range of a heap region written ahead of its turn by a parallel dump */
+	/* NB : It has no constructor as the buffers are allocated with j9mem; a zeroed buffer is empty.                   */
+	class RangeBuffer
+	{
+	public :
+		/* Methods for writing data to the buffer */
+		void writeCharacters(BinaryHeapDumpWriter* dumpWriter, const char* data, IDATA length);
+		void writeNumber    (BinaryHeapDumpWriter* dumpWriter, IDATA data, int length);
+
+		/* Method for copying the buffer to the dump file */
+		void writeTo(FileStream& outputStream) const;
+
+		/* Method for setting the object back to its initial state (i.e. empty) */
+		void clear(BinaryHeapDumpWriter* dumpWriter);
+
+		/* Declared data */
+		J9MM_IterateObjectDescriptor _FirstObject;    /* Written when the buffer is merged, as its gap depends on the previous range */
+		void*                        _LastObject;     /* The object the last record in the buffer was written for */
+		UDATA                        _Index;          /* The number of the range in the walk */
+		RangeBuffer*                 _Next;           /* The next buffer waiting to be merged (in range order) */
+		bool                         _HasFirstObject;
+		bool                         _Error;          /* Set if the buffer would exceed the limit or couldn't be extended */
+
+	private :
+		/* The buffer is a list of chunks */
+		struct Chunk
+		{
+			Chunk* _Next;
+			UDATA  _Used;
+			char   _Data[64 * 1024];
+		};
+
+		Chunk* _Head;
+		Chunk* _Tail;
+	};
+
+	/* Constructor for the writers of the range buffers of a parallel dump */
+	BinaryHeapDumpWriter(BinaryHeapDumpWriter* dumpWriter, RangeBuffer* rangeBuffer);
+
 	friend class ReferenceTraits;
 	friend class ReferenceWriter;
 
 	/* Internal methods */
+	void             openDumpFile(const char* fileName);
 	void             openNewDumpFile(J9MM_IterateSpaceDescriptor* spaceDesriptor);
+	void             writeRegionsInParallel(J9MM_IterateSpaceDescriptor* spaceDescriptor);
+	void             writeRangeInParallel(J9MM_IterateRegionDescriptor* regionDescriptor, void* base, void* top, UDATA rangeIndex);
+	void             writeRangeObjects(J9MM_IterateRegionDescriptor* regionDescriptor, void* base, void* top);
+	void             mergeRangeBuffers(void);
 	void             writeDumpFileHeader(void);
 	void             writeDumpFileTrailer(void);
 	void             writeFullVersionRecord(void);
@@ -873,10 +929,21 @@ private :
 	ClassCache        _ClassCache;
 	bool              _FileMode;
 	bool              _Error;
+	bool              _Snapshot;  /* Written by a snapshot process, which issues no messages or trace */
+
+	/* Parallel dump data */
+	bool                _Parallel;        /* Regions are written by the GC threads (and the class cache is not used) */
+	BinaryHeapDumpWriter* _DumpWriter;    /* The writer of the dump file (this, except for a range writer) */
+	RangeBuffer*        _RangeBuffer;     /* The buffer of a range writer, NULL for the dump writer */
+	RangeBuffer*        _PendingBuffers;  /* The buffers of completed ranges waiting for their turn, in range order */
+	UDATA               _BufferedChunks;  /* The number of chunks held by all the range buffers */
+	UDATA               _NextRange;       /* The range whose records are to be written to the file next */
+	omrthread_monitor_t _MergeMutex;
 
 	/* Static methods returning constant values */
 	inline static const char* identifierField(void)        {return "portable heap dump";}
 	inline static char        versionField(void)           {return 0x06;}
+	inline static UDATA       maximumBufferedChunks(void)  {return 1024;}
 
 #if defined(J9VM_OPT_NEW_OBJECT_HASH)
 	inline static char        primaryFlagsField(void)
@@ -1107,12 +1174,127 @@ BinaryHeapDumpWriter::ClassCache::clear(void)
 	_Index = 0;
 }
 
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::RangeBuffer::writeCharacters() method implementation                     */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::RangeBuffer::writeCharacters(BinaryHeapDumpWriter* dumpWriter, const char* data, IDATA length)
+{
+	PORT_ACCESS_FROM_PORT(dumpWriter->_PortLibrary);
+
+	while ((length > 0) && !_Error) {
+		/* Add a chunk when the last one is full, as long as the buffers of all the ranges stay within the limit */
+		if ((_Tail == NULL) || (_Tail->_Used == sizeof(_Tail->_Data))) {
+			Chunk* chunk = NULL;
+
+			omrthread_monitor_enter(dumpWriter->_MergeMutex);
+			if (dumpWriter->_BufferedChunks < maximumBufferedChunks()) {
+				chunk = (Chunk*)j9mem_allocate_memory(sizeof(Chunk), OMRMEM_CATEGORY_VM);
+				if (chunk != NULL) {
+					dumpWriter->_BufferedChunks += 1;
+				}
+			}
+			omrthread_monitor_exit(dumpWriter->_MergeMutex);
+
+			if (chunk == NULL) {
+				_Error = true;
+				return;
+			}
+
+			chunk->_Next = NULL;
+			chunk->_Used = 0;
+			if (_Tail == NULL) {
+				_Head = chunk;
+			} else {
+				_Tail->_Next = chunk;
+			}
+			_Tail = chunk;
+		}
+
+		UDATA count = sizeof(_Tail->_Data) - _Tail->_Used;
+		if ((UDATA)length < count) {
+			count = (UDATA)length;
+		}
+
+		memcpy(_Tail->_Data + _Tail->_Used, data, count);
+		_Tail->_Used += count;
+		data         += count;
+		length       -= count;
+	}
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::RangeBuffer::writeNumber() method implementation                         */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::RangeBuffer::writeNumber(BinaryHeapDumpWriter* dumpWriter, IDATA data, int length)
+{
+	/* Encode the number in network order as FileStream::writeNumber() does */
+	IDATA number = data;
+	int   count  = (length > 8) ? 8 : length;
+	char  buffer[8] = {0,0,0,0,0,0,0,0};
+
+	while (count-- > 0) {
+		buffer[count] = (char)(number & 0xFF);
+		number >>= 8;
+	}
+
+	writeCharacters(dumpWriter, buffer, length);
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::RangeBuffer::writeTo() method implementation                             */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::RangeBuffer::writeTo(FileStream& outputStream) const
+{
+	for (Chunk* chunk = _Head; (chunk != NULL) && !outputStream.hasError(); chunk = chunk->_Next) {
+		outputStream.writeCharacters(chunk->_Data, chunk->_Used);
+	}
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::RangeBuffer::clear() method implementation                               */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::RangeBuffer::clear(BinaryHeapDumpWriter* dumpWriter)
+{
+	PORT_ACCESS_FROM_PORT(dumpWriter->_PortLibrary);
+	UDATA chunkCount = 0;
+
+	while (_Head != NULL) {
+		Chunk* next = _Head->_Next;
+		j9mem_free_memory(_Head);
+		_Head = next;
+		chunkCount += 1;
+	}
+
+	if (chunkCount != 0) {
+		omrthread_monitor_enter(dumpWriter->_MergeMutex);
+		dumpWriter->_BufferedChunks -= chunkCount;
+		omrthread_monitor_exit(dumpWriter->_MergeMutex);
+	}
+
+	_Tail           = NULL;
+	_LastObject     = NULL;
+	_HasFirstObject = false;
+	_Error          = false;
+}
+
 /**************************************************************************************************/
 /*                                                                                                */
 /* BinaryHeapDumpWriter::BinaryHeapDumpWriter() method implementation                             */
 /*                                                                                                */
 /**************************************************************************************************/
-BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContext* context, J9RASdumpAgent* agent) :
+BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContext* context, J9RASdumpAgent* agent, bool parallel, bool snapshot) :
 	_Id(0),
 	_RegionStart(NULL),
 	_RegionEnd(NULL),
@@ -1124,7 +1306,15 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 	_OutputStream(context->javaVM->portLibrary),
 	_CurrentObject(0),
 	_FileMode(false),
-	_Error(false)
+	_Error(false),
+	_Snapshot(snapshot),
+	_Parallel(parallel),
+	_DumpWriter(this),
+	_RangeBuffer(NULL),
+	_PendingBuffers(NULL),
+	_BufferedChunks(0),
+	_NextRange(0),
+	_MergeMutex(NULL)
 {
 	PORT_ACCESS_FROM_PORT(_PortLibrary);
 
@@ -1139,10 +1329,12 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 	/* Handle the cases of multiple dump files and a single dump file separately */
 	if (!(_Agent->requestMask & J9RAS_DUMP_DO_MULTIPLE_HEAPS)) {
 		/* Write a message to standard error saying we are about to write a dump file */
-		reportDumpRequest(_PortLibrary,_Context,"Heap",fileName);
+		if (!_Snapshot) {
+			reportDumpRequest(_PortLibrary,_Context,"Heap",fileName);
+		}
 		
 		/* It's a single file so open it */
-		_OutputStream.open(_FileName.data());
+		openDumpFile(_FileName.data());
 	
 		/* Performance measuring code 
 		startTimer();
@@ -1174,7 +1366,7 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 		
 		/* Write a message to standard error saying we have written a dump file */
 		/* If an error occurred, the error message has already been printed in checkForIOError() */
-		if (! _Error) {
+		if (! _Error && ! _Snapshot) {
 			if (_FileMode) {
 				j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_WRITTEN_DUMP_STR, "Heap", fileName);
 				Trc_dump_reportDumpEnd_Event2("Heap", fileName);
@@ -1186,6 +1378,36 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 	}
 }
 
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::BinaryHeapDumpWriter() range writer method implementation                */
+/*                                                                                                */
+/**************************************************************************************************/
+BinaryHeapDumpWriter::BinaryHeapDumpWriter(BinaryHeapDumpWriter* dumpWriter, RangeBuffer* rangeBuffer) :
+	_Id(0),
+	_RegionStart(NULL),
+	_RegionEnd(NULL),
+	_Context(dumpWriter->_Context),
+	_Agent(dumpWriter->_Agent),
+	_VirtualMachine(dumpWriter->_VirtualMachine),
+	_PortLibrary(dumpWriter->_PortLibrary),
+	_FileName(dumpWriter->_PortLibrary),
+	_OutputStream(dumpWriter->_PortLibrary),
+	_CurrentObject(0),
+	_FileMode(false),
+	_Error(false),
+	_Snapshot(false),
+	_Parallel(true),
+	_DumpWriter(dumpWriter),
+	_RangeBuffer(rangeBuffer),
+	_PendingBuffers(NULL),
+	_BufferedChunks(0),
+	_NextRange(0),
+	_MergeMutex(NULL)
+{
+	/* Nothing to do: the records are written to the range buffer by writeRangeInParallel() */
+}
+
 /**************************************************************************************************/
 /*                                                                                                */
 /* BinaryHeapDumpWriter::~BinaryHeapDumpWriter() method implementation                            */
@@ -1196,6 +1418,22 @@ BinaryHeapDumpWriter::~BinaryHeapDumpWriter()
 	/* Nothing to do currently */
 }
 
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::openDumpFile() method implementation                                     */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::openDumpFile(const char* fileName)
+{
+	/* NB : writePHD() has already given the name of a compressed dump the .gz suffix */
+	if ((_Agent->dumpOptions != 0) && (strstr(_Agent->dumpOptions, "GZIP") != 0)) {
+		_OutputStream.openCompressed(fileName);
+	} else {
+		_OutputStream.open(fileName);
+	}
+}
+
 /**************************************************************************************************/
 /*                                                                                                */
 /* BinaryHeapDumpWriter::openNewDumpFile() method implementation                                  */
@@ -1220,27 +1458,33 @@ BinaryHeapDumpWriter::openNewDumpFile(J9MM_IterateSpaceDescriptor* spaceDescript
 		fileName.append(_FileName, position + 3);
 
 		/* Write a message to standard error saying we are about to write a dump file */
-		reportDumpRequest(PORTLIB, _Context,"Heap", fileName.data());
+		if (!_Snapshot) {
+			reportDumpRequest(PORTLIB, _Context,"Heap", fileName.data());
+		}
 
 		/* Initialize the data members */
 		_CurrentObject = 0;
 		_ClassCache.clear();
 
 		/* Open the file */
-		_OutputStream.open(fileName.data());
+		openDumpFile(fileName.data());
 
 		/* Start writing the file */
 		writeDumpFileHeader();
 	}
 
 	/* Iterate through the regions etc. */
-	_VirtualMachine->memoryManagerFunctions->j9mm_iterate_regions(
-			_VirtualMachine,
-			_PortLibrary,
-			spaceDescriptor,
-			j9mm_iterator_flag_regions_read_only,
-			binaryHeapDumpRegionIteratorCallback,
-			this);
+	if (_Parallel) {
+		writeRegionsInParallel(spaceDescriptor);
+	} else {
+		_VirtualMachine->memoryManagerFunctions->j9mm_iterate_regions(
+				_VirtualMachine,
+				_PortLibrary,
+				spaceDescriptor,
+				j9mm_iterator_flag_regions_read_only,
+				binaryHeapDumpRegionIteratorCallback,
+				this);
+	}
 
 	/* Handle the single and multiple dump file cases separately */
 	if (_Agent->requestMask & J9RAS_DUMP_DO_MULTIPLE_HEAPS) {
@@ -1257,7 +1501,7 @@ BinaryHeapDumpWriter::openNewDumpFile(J9MM_IterateSpaceDescriptor* spaceDescript
 		
 		/* Write a message to standard error saying we have written a dump file */
 		/* If an error occurred, the error message has already been printed in checkForIOError() */
-		if (! _Error) {
+		if (! _Error && ! _Snapshot) {
 			if (_FileMode) {
 				j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_WRITTEN_DUMP_STR, "Heap", fileName.data());
 				Trc_dump_reportDumpEnd_Event2("Heap", fileName.data());
@@ -1269,6 +1513,190 @@ BinaryHeapDumpWriter::openNewDumpFile(J9MM_IterateSpaceDescriptor* spaceDescript
 	}
 }
 
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::writeRegionsInParallel() method implementation                           */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::writeRegionsInParallel(J9MM_IterateSpaceDescriptor* spaceDescriptor)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+	J9VMThread* vmThread = _VirtualMachine->internalVMFunctions->currentVMThread(_VirtualMachine);
+
+	if ((vmThread == NULL) || (omrthread_monitor_init_with_name(&_MergeMutex, 0, "PHD range merge mutex") != 0)) {
+		/* Write the regions on this thread (the class cache stays unused so the records match the rest of the dump) */
+		_VirtualMachine->memoryManagerFunctions->j9mm_iterate_regions(
+				_VirtualMachine,
+				_PortLibrary,
+				spaceDescriptor,
+				j9mm_iterator_flag_regions_read_only,
+				binaryHeapDumpRegionIteratorCallback,
+				this);
+		return;
+	}
+
+	/* The GC threads write the ranges of the regions in range order: the range whose turn it is goes straight to the */
+	/* file, and a range reached ahead of its turn goes to a buffer which is merged into the file when its turn comes. */
+	/* The buffers held at any one time are limited to maximumBufferedChunks(); a range which would exceed the limit   */
+	/* (or whose buffer can't be allocated) is dropped from its buffer and written straight to the file in its turn    */
+	_PendingBuffers = NULL;
+	_BufferedChunks = 0;
+	_NextRange      = 0;
+
+	_VirtualMachine->memoryManagerFunctions->j9mm_iterate_regions_in_parallel(
+			vmThread,
+			_PortLibrary,
+			spaceDescriptor,
+			j9mm_iterator_flag_regions_read_only,
+			binaryHeapDumpParallelRangeIteratorCallback,
+			this);
+
+	/* Release any buffers which were not merged because the dump failed */
+	while (_PendingBuffers != NULL) {
+		RangeBuffer* rangeBuffer = _PendingBuffers;
+		_PendingBuffers = rangeBuffer->_Next;
+		rangeBuffer->clear(this);
+		j9mem_free_memory(rangeBuffer);
+	}
+
+	omrthread_monitor_destroy(_MergeMutex);
+	_MergeMutex = NULL;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::writeRangeInParallel() method implementation                             */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::writeRangeInParallel(J9MM_IterateRegionDescriptor* regionDescriptor, void* base, void* top, UDATA rangeIndex)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+	omrthread_monitor_enter(_MergeMutex);
+	bool inTurn = (rangeIndex == _NextRange);
+	omrthread_monitor_exit(_MergeMutex);
+
+	if (!inTurn) {
+		/* Write the range into a buffer and queue it to be merged (by this thread if its turn has come meanwhile) */
+		RangeBuffer* rangeBuffer = (RangeBuffer*)j9mem_allocate_memory(sizeof(RangeBuffer), OMRMEM_CATEGORY_VM);
+
+		if (rangeBuffer != NULL) {
+			memset(rangeBuffer, 0, sizeof(RangeBuffer));
+			rangeBuffer->_Index = rangeIndex;
+
+			BinaryHeapDumpWriter rangeWriter(this, rangeBuffer);
+			rangeWriter.writeRangeObjects(regionDescriptor, base, top);
+			rangeBuffer->_LastObject = rangeWriter._CurrentObject;
+
+			if (!rangeBuffer->_Error) {
+				omrthread_monitor_enter(_MergeMutex);
+				RangeBuffer** link = &_PendingBuffers;
+				while ((*link != NULL) && ((*link)->_Index < rangeIndex)) {
+					link = &(*link)->_Next;
+				}
+				rangeBuffer->_Next = *link;
+				*link = rangeBuffer;
+				inTurn = (rangeIndex == _NextRange);
+				omrthread_monitor_exit(_MergeMutex);
+
+				if (inTurn) {
+					mergeRangeBuffers();
+				}
+				return;
+			}
+
+			rangeBuffer->clear(this);
+			j9mem_free_memory(rangeBuffer);
+		}
+
+		/* The range can't be buffered so wait for its turn (the earlier ranges are all in hand, so it comes) */
+		omrthread_monitor_enter(_MergeMutex);
+		while ((rangeIndex != _NextRange) && !_Error) {
+			omrthread_monitor_wait(_MergeMutex);
+		}
+		omrthread_monitor_exit(_MergeMutex);
+
+		if (_Error) {
+			return;
+		}
+	}
+
+	/* It's the turn of the range, so nothing else writes to the file until it is done */
+	writeRangeObjects(regionDescriptor, base, top);
+
+	omrthread_monitor_enter(_MergeMutex);
+	_NextRange += 1;
+	omrthread_monitor_exit(_MergeMutex);
+
+	mergeRangeBuffers();
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::writeRangeObjects() method implementation                                */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::writeRangeObjects(J9MM_IterateRegionDescriptor* regionDescriptor, void* base, void* top)
+{
+	_Id          = regionDescriptor->id;
+	_RegionStart = (char*)regionDescriptor->regionStart;
+	_RegionEnd   = (char*)((UDATA)regionDescriptor->regionStart + regionDescriptor->regionSize);
+
+	_VirtualMachine->memoryManagerFunctions->j9mm_iterate_region_objects_in_range(
+			_VirtualMachine,
+			_PortLibrary,
+			regionDescriptor,
+			base,
+			top,
+			0,
+			binaryHeapDumpObjectIteratorCallback,
+			this);
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::mergeRangeBuffers() method implementation                                */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::mergeRangeBuffers(void)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+	omrthread_monitor_enter(_MergeMutex);
+
+	/* Write out the queued buffers which follow the last range written. The range of the buffer at the head of the */
+	/* queue is in turn, so the file is written outside the mutex while the other threads carry on buffering ranges */
+	while ((_PendingBuffers != NULL) && (_PendingBuffers->_Index == _NextRange)) {
+		RangeBuffer* rangeBuffer = _PendingBuffers;
+		_PendingBuffers = rangeBuffer->_Next;
+		omrthread_monitor_exit(_MergeMutex);
+
+		if (!_Error && rangeBuffer->_HasFirstObject) {
+			/* The first record is written relative to the last object of the previous range, the rest follow it */
+			writeObjectRecord(&rangeBuffer->_FirstObject);
+			if (!_Error) {
+				rangeBuffer->writeTo(_OutputStream);
+				checkForIOError();
+				_CurrentObject = rangeBuffer->_LastObject;
+			}
+		}
+
+		rangeBuffer->clear(this);
+		j9mem_free_memory(rangeBuffer);
+
+		omrthread_monitor_enter(_MergeMutex);
+		_NextRange += 1;
+	}
+
+	/* Wake the threads waiting for the turn of a range which couldn't be buffered (or for the dump to fail) */
+	omrthread_monitor_notify_all(_MergeMutex);
+	omrthread_monitor_exit(_MergeMutex);
+}
+
 /**************************************************************************************************/
 /*                                                                                                */
 /* BinaryHeapDumpWriter::writeDumpFileHeader() method implementation                              */
@@ -1403,6 +1831,12 @@ BinaryHeapDumpWriter::writeObjectRecord(J9MM_IterateObjectDescriptor* objectDesc
 	/* Handle class, array and normal objects separately */
 	if (J9VM_IS_INITIALIZED_HEAPCLASS_VM(_VirtualMachine, currentObject)) {
 		/* Do nothing - heap classes are handled in a separate walk */
+	} else if ((_RangeBuffer != NULL) && !_RangeBuffer->_HasFirstObject) {
+		/* The gap to the first object of a range depends on the previous range, so its record is written when */
+		/* the range buffer is merged into the file and the following records are written relative to it      */
+		_RangeBuffer->_FirstObject    = *objectDescriptor;
+		_RangeBuffer->_HasFirstObject = true;
+		_CurrentObject                 = currentObject;
 	} else if (J9ROMCLASS_IS_ARRAY(currentClass->romClass)) {
 		writeArrayObjectRecord(objectDescriptor);
 	} else {
@@ -1447,8 +1881,10 @@ BinaryHeapDumpWriter::writeNormalObjectRecord(J9MM_IterateObjectDescriptor* obje
 	J9Class* objectClass = J9OBJECT_CLAZZ_VM(_VirtualMachine, currentObject);
 	void* objectClassAddress = J9VM_J9CLASS_TO_HEAPCLASS(objectClass);
 
-	/* Determine whether this class is cached */
-	int classCacheIndex = _ClassCache.find(objectClassAddress);
+	/* Determine whether this class is cached                                                           */
+	/* NB : The regions of a parallel dump are written independently, so the cache state of the reader  */
+	/* at the start of a region can't be known and the short format (which refers to it) isn't used     */
+	int classCacheIndex = _Parallel ? -1 : _ClassCache.find(objectClassAddress);
 
 	int hashCode = getObjectHashCode(currentObject);
 
@@ -2382,9 +2818,15 @@ void
 BinaryHeapDumpWriter::checkForIOError(void)
 {
 	PORT_ACCESS_FROM_PORT(_PortLibrary);
-	if (_OutputStream.hasError()) {
-		j9nls_printf(PORTLIB, J9NLS_ERROR | J9NLS_STDERR, J9NLS_DMP_ERROR_IN_DUMP_STR, "Heap", j9error_last_error_message());
-		Trc_dump_reportDumpError_Event2("Heap", j9error_last_error_message());
+	if (_RangeBuffer != NULL) {
+		/* A range buffer which can't be extended is dropped and its range written to the file in its turn instead */
+		_Error = _RangeBuffer->_Error;
+	} else if (_OutputStream.hasError()) {
+		/* A snapshot process reports the failure itself once the writer is done */
+		if (!_Snapshot) {
+			j9nls_printf(PORTLIB, J9NLS_ERROR | J9NLS_STDERR, J9NLS_DMP_ERROR_IN_DUMP_STR, "Heap", j9error_last_error_message());
+			Trc_dump_reportDumpError_Event2("Heap", j9error_last_error_message());
+		}
 		_Error = true;
 	}
 }
@@ -2393,7 +2835,11 @@ void
 BinaryHeapDumpWriter::writeCharacters (const char* data, IDATA length)
 {
 	if (!_Error) {
-		_OutputStream.writeCharacters(data,length);
+		if (_RangeBuffer != NULL) {
+			_RangeBuffer->writeCharacters(_DumpWriter, data, length);
+		} else {
+			_OutputStream.writeCharacters(data,length);
+		}
 
 		checkForIOError();
 	}
@@ -2403,7 +2849,11 @@ void
 BinaryHeapDumpWriter::writeCharacters (const char* data)
 {
 	if (!_Error) {
-		_OutputStream.writeCharacters(data);
+		if (_RangeBuffer != NULL) {
+			_RangeBuffer->writeCharacters(_DumpWriter, data, strlen(data));
+		} else {
+			_OutputStream.writeCharacters(data);
+		}
 
 		checkForIOError();
 	}
@@ -2413,7 +2863,11 @@ void
 BinaryHeapDumpWriter::writeNumber (IDATA data, int length)
 {
 	if (!_Error) {
-		_OutputStream.writeNumber(data, length);
+		if (_RangeBuffer != NULL) {
+			_RangeBuffer->writeNumber(_DumpWriter, data, length);
+		} else {
+			_OutputStream.writeNumber(data, length);
+		}
 
 		checkForIOError();
 	}
@@ -2450,6 +2904,18 @@ binaryHeapDumpRegionIteratorCallback(J9JavaVM* vm, J9MM_IterateRegionDescriptor*
 	return ((BinaryHeapDumpWriter*)userData)->_Error ? JVMTI_ITERATION_ABORT : JVMTI_ITERATION_CONTINUE;
 }
 
+static jvmtiIterationControl
+binaryHeapDumpParallelRangeIteratorCallback(J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDescription, void* base, void* top, UDATA rangeIndex, void* userData)
+{
+	BinaryHeapDumpWriter* heapDumpWriter = (BinaryHeapDumpWriter*)userData;
+
+	if (!heapDumpWriter->_Error) {
+		heapDumpWriter->writeRangeInParallel(regionDescription, base, top, rangeIndex);
+	}
+
+	return heapDumpWriter->_Error ? JVMTI_ITERATION_ABORT : JVMTI_ITERATION_CONTINUE;
+}
+
 static jvmtiIterationControl
 binaryHeapDumpObjectIteratorCallback(J9JavaVM* vm, J9MM_IterateObjectDescriptor* objectDescriptor, void* userData)
 {
@@ -2475,10 +2941,148 @@ binaryHeapDumpObjectReferenceIteratorWriterCallback(J9JavaVM* virtualMachine, J9
 	return referenceWriter->_HeapDumpWriter->_Error ? JVMTI_ITERATION_ABORT : JVMTI_ITERATION_CONTINUE;
 }
 
+#if defined(LINUX)
+/* Write the PHD file in a snapshot process. Never returns.                                           */
+/* NB : The snapshot has only the forking thread, so anything which could wait on a lock held by one  */
+/*      of the threads left behind (NLS messages, trace, the JVM signal handlers) is avoided           */
+static void
+writeSnapshotPHD(const char* fileName, J9RASdumpContext* context, J9RASdumpAgent* agent)
+{
+	struct sigaction defaultAction;
+	sigset_t noSignals;
+
+	/* The JVM signal handlers depend on threads and state the snapshot doesn't have, so restore the defaults */
+	memset(&defaultAction, 0, sizeof(defaultAction));
+	defaultAction.sa_handler = SIG_DFL;
+	sigemptyset(&defaultAction.sa_mask);
+	for (int signalNumber = 1; signalNumber < NSIG; signalNumber++) {
+		/* SIGKILL and SIGSTOP can't be changed and fail harmlessly */
+		sigaction(signalNumber, &defaultAction, NULL);
+	}
+	sigemptyset(&noSignals);
+	sigprocmask(SIG_SETMASK, &noSignals, NULL);
+
+	/* Keep only the standard streams, so the snapshot holds no sockets, pipes or files of the JVM open */
+	long maximumFd = sysconf(_SC_OPEN_MAX);
+	if (maximumFd < 0) {
+		maximumFd = 1024;
+	}
+	for (long fd = STDERR_FILENO + 1; fd < maximumFd; fd++) {
+		close((int)fd);
+	}
+
+	BinaryHeapDumpWriter writer(fileName, context, agent, false, true);
+
+	/* Nothing waits for the snapshot, so report a failure on standard error without going through NLS */
+	if (writer.hasError()) {
+		static const char prefix[] = "JVMDUMP: asynchronous Heap dump failed: ";
+		IDATA rc = write(STDERR_FILENO, prefix, sizeof(prefix) - 1);
+		rc = write(STDERR_FILENO, fileName, strlen(fileName));
+		rc = write(STDERR_FILENO, "\n", 1);
+		(void)rc;
+	}
+
+	_exit(writer.hasError() ? 1 : 0);
+}
+
+/* Start a snapshot process writing the PHD file. Returns false if the dump is to be written in-process instead. */
+static bool
+forkSnapshotPHD(const char* fileName, J9RASdumpContext* context, J9RASdumpAgent* agent)
+{
+	J9JavaVM* vm = context->javaVM;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	int pipeFds[2];
+	pid_t writer = 0;
+
+	if (pipe(pipeFds) != 0) {
+		j9nls_printf(PORTLIB, J9NLS_ERROR | J9NLS_STDERR, J9NLS_DMP_ERROR_IN_DUMP_STR_RC, "Heap", "pipe()", errno);
+		return false;
+	}
+
+	/* The class walk of the writer enters the class table mutex, so hold it across the fork: the copy in the */
+	/* snapshot is then owned by the writing thread, rather than possibly by a thread which isn't there       */
+#if defined(J9VM_THR_PREEMPTIVE)
+	omrthread_monitor_enter(vm->classTableMutex);
+#endif
+
+	/* The first child forks the writer, sends back its pid (or the fork error) and exits straight away, so */
+	/* the writer is inherited by init and the JVM never waits on it                                        */
+	pid_t child = fork();
+
+	if (child == 0) {
+		writer = fork();
+		if (writer == 0) {
+			writeSnapshotPHD(fileName, context, agent);
+		}
+		if (writer < 0) {
+			writer = -errno;
+		}
+		IDATA rc = write(pipeFds[1], &writer, sizeof(writer));
+		_exit((rc == (IDATA)sizeof(writer)) ? 0 : 1);
+	}
+
+	int forkError = errno;
+
+#if defined(J9VM_THR_PREEMPTIVE)
+	omrthread_monitor_exit(vm->classTableMutex);
+#endif
+
+	close(pipeFds[1]);
+	if (child > 0) {
+		IDATA rc = 0;
+		do {
+			rc = read(pipeFds[0], &writer, sizeof(writer));
+		} while ((rc < 0) && (errno == EINTR));
+		if (rc != (IDATA)sizeof(writer)) {
+			writer = -ECHILD;
+		}
+		waitpid(child, NULL, 0);
+		forkError = -writer;
+	}
+	close(pipeFds[0]);
+
+	if (writer > 0) {
+		/* All the messages are issued by this process: the snapshot issues none. The dump is written while */
+		/* the JVM carries on, so there is no message when it is complete                                  */
+		reportDumpRequest(PORTLIB, context, "Heap", fileName);
+		j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_ASYNC_DUMP_STR, "Heap", fileName, (int)writer);
+		Trc_dump_reportDumpAsync_Event3("Heap", fileName, (int)writer);
+		return true;
+	}
+
+	/* The snapshot couldn't be taken so write the dump from this process, which reports the request itself */
+	j9nls_printf(PORTLIB, J9NLS_ERROR | J9NLS_STDERR, J9NLS_DMP_ERROR_IN_DUMP_STR_RC, "Heap", "fork()", forkError);
+	return false;
+}
+#endif /* defined(LINUX) */
+
 void
 writePHD(char *label, J9RASdumpContext *context, J9RASdumpAgent* agent)
 {
-	BinaryHeapDumpWriter(label, context, agent);
+	PORT_ACCESS_FROM_JAVAVM(context->javaVM);
+	bool parallel = (agent->dumpOptions != NULL) && (strstr(agent->dumpOptions, "PARALLEL") != NULL);
+	CharacterString fileName(PORTLIB);
+
+	/* A compressed dump is always given the .gz suffix, whatever the label, so it can't be taken for a plain PHD file */
+	fileName += label;
+	if ((agent->dumpOptions != NULL) && (strstr(agent->dumpOptions, "GZIP") != NULL)) {
+		UDATA length = fileName.length();
+		if ((length < 3) || (strcmp(fileName.data() + length - 3, ".gz") != 0)) {
+			fileName += ".gz";
+		}
+	}
+
+#if defined(LINUX)
+	/* Write the dump from a copy-on-write snapshot of the process so the application can resume as soon as the */
+	/* snapshot is taken. The snapshot has only this thread, so the dump is written serially                     */
+	if ((agent->dumpOptions != NULL) && (strstr(agent->dumpOptions, "FORK") != NULL)) {
+		if (forkSnapshotPHD(fileName.data(), context, agent)) {
+			return;
+		}
+	}
+#endif /* defined(LINUX) */
+
+	BinaryHeapDumpWriter(fileName.data(), context, agent, parallel, false);
 }
 
 /* Primary entry point */
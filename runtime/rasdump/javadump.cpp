@@ -86,6 +86,7 @@ static UDATA innerMemCategoryCallBack (U_32 categoryCode, const char * categoryN
 static jvmtiIterationControl heapIteratorCallback   (J9JavaVM* vm, J9MM_IterateHeapDescriptor*   heapDescriptor,    void* userData);
 static jvmtiIterationControl spaceIteratorCallback  (J9JavaVM* vm, J9MM_IterateSpaceDescriptor*  spaceDescriptor,   void* userData);
 static jvmtiIterationControl regionIteratorCallback (J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDescription, void* userData);
+static jvmtiIterationControl allocationProfileIteratorCallback (J9JavaVM* vm, J9MM_AllocationSiteDescriptor* siteDescriptor, void* userData);
 static UDATA getObjectMonitorCount	(J9JavaVM *vm);
 static UDATA getAllocatedVMThreadCount (J9JavaVM *vm);
 
@@ -225,6 +226,7 @@ private :
 	friend jvmtiIterationControl heapIteratorCallback   (J9JavaVM* vm, J9MM_IterateHeapDescriptor*   heapDescriptor,    void* userData);
 	friend jvmtiIterationControl spaceIteratorCallback  (J9JavaVM* vm, J9MM_IterateSpaceDescriptor*  spaceDescriptor,   void* userData);
 	friend jvmtiIterationControl regionIteratorCallback (J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDescription, void* userData);
+	friend jvmtiIterationControl allocationProfileIteratorCallback (J9JavaVM* vm, J9MM_AllocationSiteDescriptor* siteDescriptor, void* userData);
 
 	/* sig_protect wrappers functions and handlers */
 	friend UDATA protectedWriteSection       (struct J9PortLibrary *, void *);
@@ -291,6 +293,8 @@ private :
 	void        writeGPValue                 (const char* prefix, const char* name, U_32 kind, void* value);
 	void        writeJitMethod               (J9VMThread* vmThread);
 	void        writeSegments                (J9MemorySegmentList* list, BOOLEAN isCodeCacheSegment);
+	void        writeAllocationSite          (J9MM_AllocationSiteDescriptor* siteDescriptor);
+	void        writeAllocationClassName     (J9Class* clazz);
 	void        writeTraceHistory            (U_32 type);
 	void        writeGCHistoryLines          (UtThreadData** thr, UtTracePointIterator* iterator, const char* typePrefix);
 	void        writeDeadLocks               (void);
@@ -340,6 +344,7 @@ private :
 	bool              _AvoidLocks;
 	bool              _PreemptLocked;
 	bool              _ThreadsWalkStarted;
+	bool              _AllocationProfileStarted;
 	J9RASdumpAgent *  _Agent;
 	memcategory_data_frame* _CategoryStack;
 	U_32              _CategoryStackTop;
@@ -422,6 +427,7 @@ JavaCoreDumpWriter::JavaCoreDumpWriter(
 	_AvoidLocks(false),
 	_PreemptLocked(false),
 	_ThreadsWalkStarted(false),
+	_AllocationProfileStarted(false),
 	_Agent(agent),
 	_TotalCategories(-1)
 {
@@ -1450,6 +1456,15 @@ JavaCoreDumpWriter::writeMemorySection(void)
 	}
 #endif
 
+	/* Write the allocation profile sub-section (only present when -Xgc:allocationProfile is enabled) */
+	if (!avoidLocks()) {
+		_VirtualMachine->memoryManagerFunctions->j9mm_iterate_allocation_profile(
+			_VirtualMachine,
+			j9mm_allocation_profile_classes | j9mm_allocation_profile_sites,
+			allocationProfileIteratorCallback,
+			this);
+	}
+
 	/* Write the garbage collector history sub-section */
 	_OutputStream.writeCharacters(
 		"NULL           \n"
@@ -3563,6 +3578,81 @@ JavaCoreDumpWriter::writeSegments(J9MemorySegmentList* list, BOOLEAN isCodeCache
 	_OutputStream.writeCharacters(")\n");
 }
 
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::writeAllocationSite() method implementation                                */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+JavaCoreDumpWriter::writeAllocationSite(J9MM_AllocationSiteDescriptor* siteDescriptor)
+{
+	if (!_AllocationProfileStarted) {
+		_AllocationProfileStarted = true;
+		_OutputStream.writeCharacters(
+			"NULL           \n"
+			"1STALLOCPROF   Allocation Profile\n"
+		);
+	}
+
+	if (0 == siteDescriptor->id) {
+		/* A class summary: bytes is an estimate of the total allocated */
+		_OutputStream.writeCharacters("2ALLOCCLASS    ");
+		_OutputStream.writeInteger(siteDescriptor->samples, "%zu");
+		_OutputStream.writeCharacters(" samples, ~");
+		_OutputStream.writeInteger(siteDescriptor->bytes, "%zu");
+		_OutputStream.writeCharacters(" bytes: ");
+		writeAllocationClassName(siteDescriptor->clazz);
+		_OutputStream.writeCharacters("\n");
+	} else {
+		_OutputStream.writeCharacters("2ALLOCSITE     Site ");
+		_OutputStream.writePointer((void *)siteDescriptor->id, false);
+		_OutputStream.writeCharacters(": ");
+		_OutputStream.writeInteger(siteDescriptor->samples, "%zu");
+		_OutputStream.writeCharacters(" samples, ");
+		_OutputStream.writeInteger(siteDescriptor->bytes, "%zu");
+		_OutputStream.writeCharacters(" bytes: ");
+		writeAllocationClassName(siteDescriptor->clazz);
+		_OutputStream.writeCharacters("\n");
+
+		for (UDATA i = 0; i < siteDescriptor->frameCount; i++) {
+			J9Method* method = siteDescriptor->frames[i];
+			J9ROMMethod* romMethod = J9_ROM_METHOD_FROM_RAM_METHOD(method);
+
+			_OutputStream.writeCharacters("3ALLOCFRAME            at ");
+			_OutputStream.writeCharacters(J9ROMCLASS_CLASSNAME(J9_CLASS_FROM_METHOD(method)->romClass));
+			_OutputStream.writeCharacters(".");
+			_OutputStream.writeCharacters(J9ROMMETHOD_NAME(romMethod));
+			_OutputStream.writeCharacters(J9ROMMETHOD_SIGNATURE(romMethod));
+			_OutputStream.writeCharacters("\n");
+		}
+	}
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::writeAllocationClassName() method implementation                           */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+JavaCoreDumpWriter::writeAllocationClassName(J9Class* clazz)
+{
+	if (J9ROMCLASS_IS_ARRAY(clazz->romClass)) {
+		J9ArrayClass* array = (J9ArrayClass*)clazz;
+		J9Class* leafClass = array->leafComponentType;
+
+		for (UDATA n = array->arity; n > 1; n--) {
+			_OutputStream.writeCharacters("[");
+		}
+		_OutputStream.writeCharacters(J9ROMCLASS_CLASSNAME(leafClass->arrayClass->romClass));
+		if (!J9ROMCLASS_IS_PRIMITIVE_TYPE(leafClass->romClass)) {
+			_OutputStream.writeCharacters(J9ROMCLASS_CLASSNAME(leafClass->romClass));
+			_OutputStream.writeCharacters(";");
+		}
+	} else {
+		_OutputStream.writeCharacters(J9ROMCLASS_CLASSNAME(clazz->romClass));
+	}
+}
+
 /**************************************************************************************************/
 /*                                                                                                */
 /* JavaCoreDumpWriter::writeTraceHistory() method implementation                                  */
@@ -5290,6 +5380,16 @@ heapIteratorCallback(J9JavaVM* virtualMachine, J9MM_IterateHeapDescriptor* heapD
 	return JVMTI_ITERATION_CONTINUE;
 }
 
+static jvmtiIterationControl
+allocationProfileIteratorCallback(J9JavaVM* virtualMachine, J9MM_AllocationSiteDescriptor* siteDescriptor, void* userData)
+{
+	JavaCoreDumpWriter* jcw = (JavaCoreDumpWriter*)userData;
+
+	jcw->writeAllocationSite(siteDescriptor);
+
+	return JVMTI_ITERATION_CONTINUE;
+}
+
 static jvmtiIterationControl
 spaceIteratorCallback(J9JavaVM* virtualMachine, J9MM_IterateSpaceDescriptor* spaceDescriptor, void* userData)
 {
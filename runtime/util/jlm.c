@@ -185,22 +185,23 @@ request_MonitorJlmDump(jvmtiEnv * env, J9VMJlmDump * jlmd, jint dump_format)
 					if (monitor->flags & J9THREAD_MONITOR_OBJECT) {
 					j9object_t object = J9MONITORTABLE_OBJECT_LOAD(vmThread, &monitor->userData);
 						/* Similar to jvmtiGetTag code, but with object being of object_t type */
-						if (object != NULL) {							
+						if ((object != NULL) && J9JVMTI_OBJECT_MAY_BE_TAGGED(object)) {
 						J9JVMTIObjectTag   entry;
 						J9JVMTIObjectTag * objectTag;
+						J9JVMTIObjectTagShard * shard = J9JVMTI_OBJECT_TAG_SHARD((J9JVMTIEnv *)env, object);
 
 						entry.ref = object;
 
 						/* No need to check if entry.ref != NULL, since we checked object above */
 
-						/* Ensure exclusive access to tag table */
-						omrthread_monitor_enter(((J9JVMTIEnv *)env)->mutex);
+						/* Ensure exclusive access to the shard of the tag table */
+						omrthread_monitor_enter(shard->mutex);
 
-						objectTag = hashTableFind(((J9JVMTIEnv *)env)->objectTagTable, &entry);
+						objectTag = hashTableFind(shard->table, &entry);
 						if (objectTag) {
 							tag = objectTag->tag;
 						}
-						omrthread_monitor_exit(((J9JVMTIEnv *)env)->mutex);
+						omrthread_monitor_exit(shard->mutex);
 					}
 				}
 
@@ -110,6 +110,9 @@ public class TestMemoryMXBean {
 		attribs.put("GCSlaveThreadsCpuUsed", new AttributeData(Long.TYPE.getName(), true, false, false));
 		attribs.put("MaximumGCThreads", new AttributeData(Integer.TYPE.getName(), true, false, false));
 		attribs.put("CurrentGCThreads", new AttributeData(Integer.TYPE.getName(), true, false, false));
+		attribs.put("FinalizerQueueMaxDepth", new AttributeData(Long.TYPE.getName(), true, false, false));
+		attribs.put("FinalizerQueueLatency", new AttributeData(Long.TYPE.getName(), true, false, false));
+		attribs.put("FinalizerQueueMaxLatency", new AttributeData(Long.TYPE.getName(), true, false, false));
 	}// end static initializer
 
 	private ExtendedMemoryMXBeanImpl mb;
@@ -738,7 +741,7 @@ public class TestMemoryMXBean {
 		// Eight attributes - some writable.
 		MBeanAttributeInfo[] attributes = mbi.getAttributes();
 		AssertJUnit.assertNotNull(attributes);
-		AssertJUnit.assertTrue(attributes.length == 24);
+		AssertJUnit.assertTrue(attributes.length == 27);
 		for (int i = 0; i < attributes.length; i++) {
 			MBeanAttributeInfo info = attributes[i];
 			AssertJUnit.assertNotNull(info);